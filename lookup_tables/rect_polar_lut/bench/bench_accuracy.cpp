@@ -0,0 +1,295 @@
+/* exhaustive accuracy against speed for every 8 bit rect/polar backend
+
+   Every rect_vector (all 65536 x,y) goes through each rect to polar
+   backend and every polar_vector (all 65536 mag,nra) through each polar to
+   rect backend.  Results are compared against double precision
+   atan2/hypot and sin/cos in the generator's conventions: nra is
+   atan2(y,x) in 2*pi/256 steps as radians_2_nra() scales it, and x,y are
+   mag*cos/sin of nra_2_radians(nra), saturated to -128:127.
+   Errors are in LSBs against the unrounded reference, and "exact" counts
+   the outputs equal to the generator's own rounding (nearest mag and nra,
+   x,y truncated and saturated in the first quadrant, as the tables store
+   them).  The round trip converts each
+   rect_vector to polar and back, one leg through the backend and the
+   other through the scalar lookups, or both through the engine for the
+   templated engines, and gives the distance from the start in LSBs.
+   Throughput is the best of several passes over the 65536 inputs.
+*/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "rect_polar_lut.hpp"
+#include "rect_polar_simd.hpp"
+#include "rect_polar_res.hpp"
+
+typedef void (*r2p_func)( const rect_vector *, polar_vector *, size_t );
+typedef void (*p2r_func)( const polar_vector *, rect_vector *, size_t );
+
+const double NRA_PER_RADIAN = 256.0 / ( 2.0*M_PI );
+
+// best time per sample of func over in[], several passes of the whole buffer
+template <typename F, typename I, typename O>
+double time_func( F func, const std::vector<I> &in, std::vector<O> &out ) {
+    double best = 1e9;
+    for ( int run=0; run < 5; run++ ) {
+        auto t0 = std::chrono::steady_clock::now();
+        for ( int pass=0; pass < 64; pass++ ) {
+            func( in.data(), out.data(), in.size() );
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double t = std::chrono::duration<double>( t1 - t0 ).count() / ( 64 * in.size() );
+        if ( t < best ) best = t;
+    }
+    return best;
+}
+
+// max and rms of a set of errors
+struct error_stat {
+    double max = 0, sq = 0;
+    size_t n = 0;
+    void add( double e ) {
+        e = fabs( e );
+        max = std::max( max, e ), sq += e*e, n++;
+    }
+    double rms() const { return n ? sqrt( sq / n ) : 0; }
+};
+
+std::ostream &operator <<( std::ostream &os, const error_stat &e ) {
+    return os << std::setw(7) << e.max << std::setw(7) << e.rms();
+}
+
+// polar to rect as the generator stores it, the first quadrant truncated
+// and saturated at 127, then rotated 90 degrees per quadrant
+static rect_vector stored_p2r( polar_vector pv ) {
+    double a = ( pv.nra & 63 ) / NRA_PER_RADIAN;
+    int x = std::min( (int)( pv.mag * cos( a ) ), 127 );
+    int y = std::min( (int)( pv.mag * sin( a ) ), 127 );
+    for ( int q=0; q < ( pv.nra >> 6 ); q++ ) {
+        int t = x;
+        x = -y, y = t;
+    }
+    rect_vector rv = { (int8_t)x, (int8_t)y };
+    return rv;
+}
+
+// all 65536 of each, x,y and mag,nra in row major order
+static std::vector<rect_vector> all_rect() {
+    std::vector<rect_vector> rv( 65536 );
+    for ( int i=0; i < 65536; i++ ) {
+        rv[i].x = (int8_t)( i >> 8 ), rv[i].y = (int8_t)i;
+    }
+    return rv;
+}
+
+static std::vector<polar_vector> all_polar() {
+    std::vector<polar_vector> pv( 65536 );
+    for ( int i=0; i < 65536; i++ ) {
+        pv[i].mag = i >> 8, pv[i].nra = i;
+    }
+    return pv;
+}
+
+// distance of each rect round trip from where it started
+static error_stat round_trip( const std::vector<rect_vector> &rv, r2p_func r2p, p2r_func p2r ) {
+    std::vector<polar_vector> pv( rv.size() );
+    std::vector<rect_vector> back( rv.size() );
+    r2p( rv.data(), pv.data(), rv.size() );
+    p2r( pv.data(), back.data(), rv.size() );
+    error_stat e;
+    for ( size_t i=0; i < rv.size(); i++ ) {
+        e.add( hypot( back[i].x - rv[i].x, back[i].y - rv[i].y ) );
+    }
+    return e;
+}
+
+// report one rect to polar backend, round tripping through p2r
+static void report_r2p( const char *name, r2p_func r2p, p2r_func p2r ) {
+    std::vector<rect_vector> rv = all_rect();
+    std::vector<polar_vector> pv( rv.size() );
+    double t = time_func( r2p, rv, pv );
+    r2p( rv.data(), pv.data(), rv.size() );
+    error_stat mag, nra;
+    size_t exact = 0;
+    for ( size_t i=0; i < rv.size(); i++ ) {
+        double m = hypot( rv[i].x, rv[i].y );
+        double a = atan2( rv[i].y, rv[i].x ) * NRA_PER_RADIAN;
+        mag.add( pv[i].mag - m );
+        nra.add( remainder( pv[i].nra - a, 256.0 ) );
+        exact += ( pv[i].mag == lround( m ) ) && ( pv[i].nra == (uint8_t)lround( ( a < 0 ) ? a + 256 : a ) );
+    }
+    std::cout << std::setw(22) << std::left << name << std::right
+              << std::setw(9) << std::setprecision(1) << 1e-6 / t << std::setprecision(3)
+              << mag << nra << std::setw(7) << exact << round_trip( rv, r2p, p2r ) << "\n";
+}
+
+// report one polar to rect backend, round tripping through r2p
+static void report_p2r( const char *name, p2r_func p2r, r2p_func r2p ) {
+    std::vector<polar_vector> pv = all_polar();
+    std::vector<rect_vector> rv( pv.size() );
+    double t = time_func( p2r, pv, rv );
+    p2r( pv.data(), rv.data(), pv.size() );
+    error_stat x, y;
+    size_t exact = 0;
+    for ( size_t i=0; i < pv.size(); i++ ) {
+        double a = pv[i].nra / NRA_PER_RADIAN;
+        double cx = pv[i].mag * cos( a ), cy = pv[i].mag * sin( a );
+        x.add( rv[i].x - std::min( std::max( cx, -128.0 ), 127.0 ) );
+        y.add( rv[i].y - std::min( std::max( cy, -128.0 ), 127.0 ) );
+        rect_vector e = stored_p2r( pv[i] );
+        exact += ( rv[i].x == e.x ) && ( rv[i].y == e.y );
+    }
+    std::cout << std::setw(22) << std::left << name << std::right
+              << std::setw(9) << std::setprecision(1) << 1e-6 / t << std::setprecision(3)
+              << x << y << std::setw(7) << exact << round_trip( all_rect(), r2p, p2r ) << "\n";
+}
+
+// the per sample lookups, a function call per sample
+static void r2p_per_sample( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) pv[i] = convert_rect_2_polar( rv[i] );
+}
+
+static void p2r_per_sample( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) rv[i] = convert_polar_2_rect( pv[i] );
+}
+
+// magnitude and angle from the split tables
+static void r2p_split( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    static std::vector<uint8_t> mag, nra;
+    mag.resize( n ), nra.resize( n );
+    convert_rect_2_mag_block( rv, mag.data(), n );
+    convert_rect_2_nra_block( rv, nra.data(), n );
+    for ( size_t i=0; i < n; i++ ) pv[i].mag = mag[i], pv[i].nra = nra[i];
+}
+
+// planar kernels, timed including the split into and out of planes
+template <void (*PLANAR)( const int8_t *, const int8_t *, uint8_t *, uint8_t *, size_t )>
+void r2p_planar( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    static std::vector<int8_t> x, y;
+    static std::vector<uint8_t> mag, nra;
+    x.resize( n ), y.resize( n ), mag.resize( n ), nra.resize( n );
+    for ( size_t i=0; i < n; i++ ) x[i] = rv[i].x, y[i] = rv[i].y;
+    PLANAR( x.data(), y.data(), mag.data(), nra.data(), n );
+    for ( size_t i=0; i < n; i++ ) pv[i].mag = mag[i], pv[i].nra = nra[i];
+}
+
+template <void (*PLANAR)( const uint8_t *, const uint8_t *, int8_t *, int8_t *, size_t )>
+void p2r_planar( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    static std::vector<uint8_t> mag, nra;
+    static std::vector<int8_t> x, y;
+    x.resize( n ), y.resize( n ), mag.resize( n ), nra.resize( n );
+    for ( size_t i=0; i < n; i++ ) mag[i] = pv[i].mag, nra[i] = pv[i].nra;
+    PLANAR( mag.data(), nra.data(), x.data(), y.data(), n );
+    for ( size_t i=0; i < n; i++ ) rv[i].x = x[i], rv[i].y = y[i];
+}
+
+// the templated engines at 8/8, rect_vector_n<8> and polar_vector_n<8,8>
+// have the same layout as rect_vector and polar_vector
+template <template <int,int> class ENGINE>
+void r2p_engine( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    convert_rect_2_polar_block_n<8,8,ENGINE>( reinterpret_cast<const rect_vector_n<8> *>( rv ),
+                                              reinterpret_cast<polar_vector_n<8,8> *>( pv ), n );
+}
+
+template <template <int,int> class ENGINE>
+void p2r_engine( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    convert_polar_2_rect_block_n<8,8,ENGINE>( reinterpret_cast<const polar_vector_n<8,8> *>( pv ),
+                                              reinterpret_cast<rect_vector_n<8> *>( rv ), n );
+}
+
+// offset binary input, every i,q byte pair against the 127.5 centred reference
+static void report_u8( const char *name, void (*u8)( const uint8_t *, polar_vector *, size_t ) ) {
+    std::vector<uint8_t> iq( 2*65536 );
+    for ( int i=0; i < 65536; i++ ) {
+        iq[2*i] = i >> 8, iq[2*i+1] = i;
+    }
+    std::vector<polar_vector> pv( 65536 );
+    double best = 1e9;
+    for ( int run=0; run < 5; run++ ) {
+        auto t0 = std::chrono::steady_clock::now();
+        for ( int pass=0; pass < 64; pass++ ) {
+            u8( iq.data(), pv.data(), pv.size() );
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min( best, std::chrono::duration<double>( t1 - t0 ).count() / ( 64 * pv.size() ) );
+    }
+    error_stat mag, nra, trip;
+    size_t exact = 0;
+    std::vector<rect_vector> back( pv.size() );
+    convert_polar_2_rect_block_scalar( pv.data(), back.data(), pv.size() );
+    for ( int i=0; i < 65536; i++ ) {
+        double x = iq[2*i] - 127.5, y = iq[2*i+1] - 127.5;
+        double m = hypot( x, y ), a = atan2( y, x ) * NRA_PER_RADIAN;
+        mag.add( pv[i].mag - m );
+        nra.add( remainder( pv[i].nra - a, 256.0 ) );
+        exact += ( pv[i].mag == lround( m ) ) && ( pv[i].nra == (uint8_t)lround( ( a < 0 ) ? a + 256 : a ) );
+        trip.add( hypot( back[i].x - x, back[i].y - y ) );
+    }
+    std::cout << std::setw(22) << std::left << name << std::right
+              << std::setw(9) << std::setprecision(1) << 1e-6 / best << std::setprecision(3)
+              << mag << nra << std::setw(7) << exact << trip << "\n";
+}
+
+int main() {
+    std::cout << std::fixed;
+    std::cout << "Rect to Polar, all 65536 x,y, errors in LSBs, round trip through scalar polar to rect\n"
+              << "backend                    Msps mag max    rms nra max    rms  exact  trip    rms\n";
+    p2r_func p2r = convert_polar_2_rect_block_scalar;
+    report_r2p( "per sample", r2p_per_sample, p2r );
+    report_r2p( "block scalar", convert_rect_2_polar_block_scalar, p2r );
+    report_r2p( "block octant", convert_rect_2_polar_block_octant, p2r );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report_r2p( "block avx2", convert_rect_2_polar_block_avx2, p2r );
+    }
+    report_r2p( "block", convert_rect_2_polar_block, p2r );
+    report_r2p( "planar scalar", r2p_planar<convert_rect_2_polar_planar_scalar>, p2r );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report_r2p( "planar avx2", r2p_planar<convert_rect_2_polar_planar_avx2>, p2r );
+    }
+    report_r2p( "mag + nra split", r2p_split, p2r );
+    report_u8( "u8 block scalar", convert_rect_u8_2_polar_block_scalar );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report_u8( "u8 block avx2", convert_rect_u8_2_polar_block_avx2 );
+    }
+
+    std::cout << "\nPolar to Rect, all 65536 mag,nra, errors in LSBs, round trip through scalar rect to polar\n"
+              << "backend                    Msps  x max    rms  y max    rms  exact  trip    rms\n";
+    r2p_func r2p = convert_rect_2_polar_block_scalar;
+    report_p2r( "per sample", p2r_per_sample, r2p );
+    report_p2r( "block scalar", convert_polar_2_rect_block_scalar, r2p );
+    report_p2r( "block sine", convert_polar_2_rect_block_sine, r2p );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report_p2r( "block avx2", convert_polar_2_rect_block_avx2, r2p );
+        report_p2r( "block sine avx2", convert_polar_2_rect_block_sine_avx2, r2p );
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        report_p2r( "block avx512vbmi", convert_polar_2_rect_block_avx512vbmi, r2p );
+    }
+    report_p2r( "block", convert_polar_2_rect_block, r2p );
+    report_p2r( "planar scalar", p2r_planar<convert_polar_2_rect_planar_scalar>, r2p );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report_p2r( "planar avx2", p2r_planar<convert_polar_2_rect_planar_avx2>, r2p );
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        report_p2r( "planar avx512vbmi", p2r_planar<convert_polar_2_rect_planar_avx512vbmi>, r2p );
+    }
+
+    std::cout << "\nEngines at 8/8, rect to polar then polar to rect, round trip through the same engine\n"
+              << "backend                    Msps mag max    rms nra max    rms  exact  trip    rms\n";
+    report_r2p( "exact r2p", r2p_engine<exact_engine>, p2r_engine<exact_engine> );
+    report_r2p( "ratio r2p", r2p_engine<ratio_engine>, p2r_engine<ratio_engine> );
+    report_r2p( "interp r2p", r2p_engine<interp_engine>, p2r_engine<interp_engine> );
+    report_r2p( "cordic r2p", r2p_engine<cordic_engine>, p2r_engine<cordic_engine> );
+    std::cout << "backend                    Msps  x max    rms  y max    rms  exact  trip    rms\n";
+    report_p2r( "exact p2r", p2r_engine<exact_engine>, r2p_engine<exact_engine> );
+    report_p2r( "ratio p2r", p2r_engine<ratio_engine>, r2p_engine<ratio_engine> );
+    report_p2r( "interp p2r", p2r_engine<interp_engine>, r2p_engine<interp_engine> );
+    report_p2r( "cordic p2r", p2r_engine<cordic_engine>, r2p_engine<cordic_engine> );
+    // hybrid has no rect to polar, its round trip is through the tables
+    report_p2r( "hybrid p2r", p2r_engine<hybrid_engine>, r2p_engine<exact_engine> );
+    return 0;
+}
+
+//EOF
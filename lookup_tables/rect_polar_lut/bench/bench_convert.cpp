@@ -0,0 +1,390 @@
+/* benchmark the rect/polar lookup operations
+   reports samples/s for the per sample and block conversion paths, and
+   L1D read misses per sample where the perf counters are available
+*/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cmath>
+#include "rect_polar_lut.hpp"
+#include "rect_polar_inline.hpp"
+#include "rect_polar_simd.hpp"
+#include "rect_polar_res.hpp"
+#include "rect_polar_runtime.hpp"
+#include "perf_counters.hpp"
+
+typedef void (*r2p_func)( const rect_vector *rv, polar_vector *pv, size_t n );
+typedef void (*p2r_func)( const polar_vector *pv, rect_vector *rv, size_t n );
+
+// per sample conversion in a loop, one call into rect_polar_lut.cpp per sample
+void r2p_per_sample( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i] = convert_rect_2_polar( rv[i] );
+    }
+}
+
+void p2r_per_sample( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i] = convert_polar_2_rect( pv[i] );
+    }
+}
+
+// the same loops over the inline lookups from rect_polar_inline.hpp, which
+// the compiler can unroll and schedule with the loop (built with -flto,
+// bench_convert_lto gets the out of line versions inlined as well)
+void r2p_per_sample_inline( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i] = convert_rect_2_polar_inline( rv[i] );
+    }
+}
+
+void p2r_per_sample_inline( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i] = convert_polar_2_rect_inline( pv[i] );
+    }
+}
+
+// single precision libm per sample, atan2f/hypotf and cosf/sinf, as a
+// baseline engine for the resolutions table
+template <int IQ_BITS, int NRA_BITS>
+struct libm_engine {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) noexcept {
+        const float scale = ( 1 << NRA_BITS ) / ( 2.0f*(float)M_PI );
+        for ( size_t i=0; i < n; i++ ) {
+            float x = rv[i].x, y = rv[i].y;
+            pv[i].mag = lrintf( hypotf( x, y ) );
+            pv[i].nra = lrintf( atan2f( y, x ) * scale ) & ( ( 1 << NRA_BITS ) - 1 );
+        }
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        const float scale = ( 2.0f*(float)M_PI ) / ( 1 << NRA_BITS );
+        for ( size_t i=0; i < n; i++ ) {
+            float a = pv[i].nra * scale;
+            long x = lrintf( pv[i].mag * cosf( a ) );
+            long y = lrintf( pv[i].mag * sinf( a ) );
+            rv[i].x = std::max( (long)-XY_MAX, std::min( (long)XY_MAX, x ) );
+            rv[i].y = std::max( (long)-XY_MAX, std::min( (long)XY_MAX, y ) );
+        }
+    }
+};
+
+// time the runtime tables' first use, built on as many cores as the size
+// is worth, against a build on one thread
+template <int IQ_BITS, int NRA_BITS>
+void bench_runtime_build() {
+    typedef runtime_lut_engine<IQ_BITS,NRA_BITS> engine;
+    const typename engine::tables &t = engine::lut();
+    typename engine::tables single( 1 );
+    std::cout << std::setw(2) << IQ_BITS << "/" << std::left << std::setw(2) << NRA_BITS << std::right
+              << std::setw(10) << ( t.bytes() >> 10 ) << std::setw(8) << t.threads << std::fixed
+              << std::setprecision(2) << std::setw(10) << t.seconds * 1e3
+              << std::setw(10) << single.seconds * 1e3 << "\n";
+}
+
+// planar buffers for the structure of arrays conversions
+struct planar_rect {
+    std::vector<int8_t> x, y;
+    size_t size() const { return x.size(); }
+};
+struct planar_polar {
+    std::vector<uint8_t> mag, nra;
+    size_t size() const { return mag.size(); }
+};
+
+struct bench_result {
+    double seconds;
+    uint64_t l1d_misses;
+};
+
+// time func over the buffers, returns the best of several runs
+template <typename F, typename I, typename O>
+bench_result time_run( F func, const std::vector<I> &in, std::vector<O> &out ) {
+    perf_counter l1d( PERF_TYPE_HW_CACHE, L1D_READ_MISS );
+    bench_result best = { 1e9, perf_counter::NO_COUNT };
+    for ( int run=0; run < 10; run++ ) {
+        l1d.start();
+        auto t0 = std::chrono::steady_clock::now();
+        func( in.data(), out.data(), in.size() );
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t misses = l1d.stop();
+        double t = std::chrono::duration<double>( t1 - t0 ).count();
+        if ( t < best.seconds ) best.seconds = t, best.l1d_misses = misses;
+    }
+    return best;
+}
+
+bench_result time_planar( const planar_rect &in, planar_polar &out ) {
+    perf_counter l1d( PERF_TYPE_HW_CACHE, L1D_READ_MISS );
+    bench_result best = { 1e9, perf_counter::NO_COUNT };
+    for ( int run=0; run < 10; run++ ) {
+        l1d.start();
+        auto t0 = std::chrono::steady_clock::now();
+        convert_rect_2_polar_planar( in.x.data(), in.y.data(), out.mag.data(), out.nra.data(), in.size() );
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t misses = l1d.stop();
+        double t = std::chrono::duration<double>( t1 - t0 ).count();
+        if ( t < best.seconds ) best.seconds = t, best.l1d_misses = misses;
+    }
+    return best;
+}
+
+bench_result time_planar( const planar_polar &in, planar_rect &out ) {
+    perf_counter l1d( PERF_TYPE_HW_CACHE, L1D_READ_MISS );
+    bench_result best = { 1e9, perf_counter::NO_COUNT };
+    for ( int run=0; run < 10; run++ ) {
+        l1d.start();
+        auto t0 = std::chrono::steady_clock::now();
+        convert_polar_2_rect_planar( in.mag.data(), in.nra.data(), out.x.data(), out.y.data(), in.size() );
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t misses = l1d.stop();
+        double t = std::chrono::duration<double>( t1 - t0 ).count();
+        if ( t < best.seconds ) best.seconds = t, best.l1d_misses = misses;
+    }
+    return best;
+}
+
+void report( const char *name, bench_result r, size_t n ) {
+    std::cout << std::setw(24) << std::left << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(1) << ( n / r.seconds ) / 1e6 << " Msps  "
+              << std::setw(8) << std::setprecision(3) << ( r.seconds / n ) * 1e9 << " ns/sample";
+    if ( r.l1d_misses != perf_counter::NO_COUNT ) {
+        std::cout << "  " << std::setw(8) << std::setprecision(4) << (double)r.l1d_misses / n << " L1D miss/sample";
+    }
+    std::cout << "\n";
+}
+
+// throughput of an IQ_BITS/NRA_BITS engine on uniform random input, and its
+// max/rms error against double precision atan2/hypot and sin/cos in LSBs
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE>
+void bench_res( const char *engine, size_t n ) {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+    std::mt19937 rng( 1 );
+    std::uniform_int_distribution<int> xy( -( 1 << ( IQ_BITS - 1 ) ), ( 1 << ( IQ_BITS - 1 ) ) - 1 );
+    std::uniform_int_distribution<int> mag( 0, ( 1 << ( IQ_BITS - 1 ) ) - 1 );
+    std::uniform_int_distribution<int> nra( 0, ( 1 << NRA_BITS ) - 1 );
+    std::vector<rect> rv( n ), rv_out( n );
+    std::vector<polar> pv( n ), pv_out( n );
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i].x = xy( rng ), rv[i].y = xy( rng );
+        pv[i].mag = mag( rng ), pv[i].nra = nra( rng );
+    }
+    auto r2p = []( const rect *in, polar *out, size_t len ) {
+        convert_rect_2_polar_block_n<IQ_BITS,NRA_BITS,ENGINE>( in, out, len );
+    };
+    auto p2r = []( const polar *in, rect *out, size_t len ) {
+        convert_polar_2_rect_block_n<IQ_BITS,NRA_BITS,ENGINE>( in, out, len );
+    };
+    bench_result r2p_time = time_run( r2p, rv, pv_out );
+    bench_result p2r_time = time_run( p2r, pv, rv_out );
+    const double scale = ( 1 << NRA_BITS ) / ( 2.0*M_PI );
+    double mag_max = 0, mag_sq = 0, nra_max = 0, nra_sq = 0, xy_max = 0, xy_sq = 0;
+    for ( size_t i=0; i < n; i++ ) {
+        double dm = fabs( pv_out[i].mag - hypot( rv[i].x, rv[i].y ) );
+        double dn = fabs( remainder( pv_out[i].nra - atan2( rv[i].y, rv[i].x ) * scale, 1 << NRA_BITS ) );
+        double dx = fabs( rv_out[i].x - pv[i].mag * cos( pv[i].nra / scale ) );
+        mag_max = std::max( mag_max, dm ), mag_sq += dm*dm;
+        nra_max = std::max( nra_max, dn ), nra_sq += dn*dn;
+        xy_max = std::max( xy_max, dx ), xy_sq += dx*dx;
+    }
+    std::cout << std::setw(2) << IQ_BITS << "/" << std::left << std::setw(2) << NRA_BITS << " "
+              << std::setw(7) << engine << std::right << std::fixed
+              << std::setw(8) << std::setprecision(1) << ( n / r2p_time.seconds ) / 1e6
+              << std::setw(8) << ( n / p2r_time.seconds ) / 1e6 << std::setprecision(3)
+              << std::setw(8) << mag_max << std::setw(7) << sqrt( mag_sq / n )
+              << std::setw(8) << nra_max << std::setw(7) << sqrt( nra_sq / n )
+              << std::setw(8) << xy_max << std::setw(7) << sqrt( xy_sq / n ) << "\n";
+}
+
+// the polar to rect half of bench_res, for engines with no rect to polar
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE>
+void bench_res_p2r( const char *engine, size_t n ) {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+    std::mt19937 rng( 1 );
+    std::uniform_int_distribution<int> mag( 0, ( 1 << ( IQ_BITS - 1 ) ) - 1 );
+    std::uniform_int_distribution<int> nra( 0, ( 1 << NRA_BITS ) - 1 );
+    std::vector<rect> rv_out( n );
+    std::vector<polar> pv( n );
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i].mag = mag( rng ), pv[i].nra = nra( rng );
+    }
+    auto p2r = []( const polar *in, rect *out, size_t len ) {
+        convert_polar_2_rect_block_n<IQ_BITS,NRA_BITS,ENGINE>( in, out, len );
+    };
+    bench_result p2r_time = time_run( p2r, pv, rv_out );
+    const double scale = ( 1 << NRA_BITS ) / ( 2.0*M_PI );
+    double xy_max = 0, xy_sq = 0;
+    for ( size_t i=0; i < n; i++ ) {
+        double dx = fabs( rv_out[i].x - pv[i].mag * cos( pv[i].nra / scale ) );
+        xy_max = std::max( xy_max, dx ), xy_sq += dx*dx;
+    }
+    std::cout << std::setw(2) << IQ_BITS << "/" << std::left << std::setw(2) << NRA_BITS << " "
+              << std::setw(7) << engine << std::right << std::fixed
+              << std::setw(8) << "-" << std::setw(8) << std::setprecision(1) << ( n / p2r_time.seconds ) / 1e6
+              << std::setw(15) << "-" << std::setw(15) << "-" << std::setprecision(3)
+              << std::setw(8) << xy_max << std::setw(7) << sqrt( xy_sq / n ) << "\n";
+}
+
+int main() {
+    const size_t n = 1 << 20;
+    std::mt19937 rng( 1 );
+    std::uniform_int_distribution<int> xy( -128, 127 );
+    std::uniform_int_distribution<int> mag( 0, 181 );
+    std::uniform_int_distribution<int> nra( 0, 255 );
+
+    // uniform noise over the whole plane, worst case for the quadrant branches
+    std::vector<rect_vector> rv( n );
+    std::vector<polar_vector> pv( n );
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i].x = xy( rng ), rv[i].y = xy( rng );
+        pv[i].mag = mag( rng ), pv[i].nra = nra( rng );
+    }
+    std::vector<polar_vector> pv_out( n );
+    std::vector<rect_vector> rv_out( n );
+    planar_rect prv = { std::vector<int8_t>( n ), std::vector<int8_t>( n ) };
+    planar_polar ppv = { std::vector<uint8_t>( n ), std::vector<uint8_t>( n ) };
+    for ( size_t i=0; i < n; i++ ) {
+        prv.x[i] = rv[i].x, prv.y[i] = rv[i].y;
+        ppv.mag[i] = pv[i].mag, ppv.nra[i] = pv[i].nra;
+    }
+    planar_rect prv_out = prv;
+    planar_polar ppv_out = ppv;
+
+    std::cout << "Rect to Polar, " << n << " samples\n";
+    report( "per sample", time_run( r2p_per_sample, rv, pv_out ), n );
+    report( "per sample inline", time_run( r2p_per_sample_inline, rv, pv_out ), n );
+    report( "block scalar", time_run( convert_rect_2_polar_block_scalar, rv, pv_out ), n );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report( "block avx2", time_run( convert_rect_2_polar_block_avx2, rv, pv_out ), n );
+    }
+    report( "block octant", time_run( convert_rect_2_polar_block_octant, rv, pv_out ), n );
+    std::vector<uint8_t> half_out( n );
+    report( "block mag only", time_run( convert_rect_2_mag_block, rv, half_out ), n );
+    report( "block nra only", time_run( convert_rect_2_nra_block, rv, half_out ), n );
+    std::cout << "block dispatches to " << rect_2_polar_kernel_name() << "\n";
+    report( "block", time_run( convert_rect_2_polar_block, rv, pv_out ), n );
+    report( "planar", time_planar( prv, ppv_out ), n );
+
+    // 4 antenna channel interleaved input, copy each channel out and convert
+    // it vs one pass over the interleaved buffer
+    const size_t channels = 4;
+    std::vector<rect_vector> ch_in( n / channels );
+    polar_vector *ch_out[channels];
+    for ( size_t c=0; c < channels; c++ ) {
+        ch_out[c] = pv_out.data() + c*( n / channels );
+    }
+    auto copy_out = [&]( const rect_vector *in, polar_vector *, size_t len ) {
+        for ( size_t c=0; c < channels; c++ ) {
+            for ( size_t t=0; t < len / channels; t++ ) {
+                ch_in[t] = in[ t*channels + c ];
+            }
+            convert_rect_2_polar_block( ch_in.data(), ch_out[c], len / channels );
+        }
+    };
+    auto one_pass = [&]( const rect_vector *in, polar_vector *, size_t len ) {
+        convert_rect_2_polar_channels( in, channels, channels, ch_out, len / channels );
+    };
+    report( "4 channel copy + block", time_run( copy_out, rv, pv_out ), n );
+    report( "4 channel one pass", time_run( one_pass, rv, pv_out ), n );
+
+    // offset binary dongle buffer, removing the bias in a pre-pass before the
+    // block lookup vs the direct lookup on the raw bytes
+    std::vector<uint8_t> raw( 2*n );
+    for ( size_t i=0; i < n; i++ ) {
+        raw[2*i] = rv[i].x + 128, raw[2*i+1] = rv[i].y + 128;
+    }
+    std::vector<rect_vector> unbiased( n );
+    auto pre_pass = [&]( const rect_vector *, polar_vector *out, size_t len ) {
+        for ( size_t i=0; i < len; i++ ) {
+            unbiased[i].x = raw[2*i] - 128, unbiased[i].y = raw[2*i+1] - 128;
+        }
+        convert_rect_2_polar_block( unbiased.data(), out, len );
+    };
+    auto direct = [&]( const rect_vector *, polar_vector *out, size_t len ) {
+        convert_rect_u8_2_polar_block( raw.data(), out, len );
+    };
+    report( "u8 pre-pass + block", time_run( pre_pass, rv, pv_out ), n );
+    report( "u8 direct", time_run( direct, rv, pv_out ), n );
+    std::cout << "Polar to Rect, " << n << " samples\n";
+    report( "per sample", time_run( p2r_per_sample, pv, rv_out ), n );
+    report( "per sample inline", time_run( p2r_per_sample_inline, pv, rv_out ), n );
+    report( "block scalar", time_run( convert_polar_2_rect_block_scalar, pv, rv_out ), n );
+    report( "block sine", time_run( convert_polar_2_rect_block_sine, pv, rv_out ), n );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        report( "block avx2", time_run( convert_polar_2_rect_block_avx2, pv, rv_out ), n );
+        report( "block sine avx2", time_run( convert_polar_2_rect_block_sine_avx2, pv, rv_out ), n );
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        report( "block avx512vbmi", time_run( convert_polar_2_rect_block_avx512vbmi, pv, rv_out ), n );
+    }
+    std::cout << "block dispatches to " << polar_2_rect_kernel_name() << "\n";
+    report( "block", time_run( convert_polar_2_rect_block, pv, rv_out ), n );
+    report( "planar", time_planar( ppv, prv_out ), n );
+
+    std::cout << "Resolutions, " << n << " samples, Msps and errors in LSBs\n";
+    std::cout << "x,y/nra engine  r2p     p2r   mag max    rms nra max    rms   x max    rms\n";
+    bench_res<8,8,exact_engine>( "exact", n );
+    bench_res<8,8,ratio_engine>( "ratio", n );
+    bench_res<10,10,ratio_engine>( "ratio", n );
+    bench_res<12,12,ratio_engine>( "ratio", n );
+    bench_res<12,16,ratio_engine>( "ratio", n );
+    bench_res<16,16,ratio_engine>( "ratio", n );
+    bench_res<8,8,interp_engine>( "interp", n );
+    bench_res<12,12,interp_engine>( "interp", n );
+    bench_res<12,16,interp_engine>( "interp", n );
+    bench_res<16,16,interp_engine>( "interp", n );
+    bench_res<12,16,libm_engine>( "libm", n );
+    bench_res<16,16,libm_engine>( "libm", n );
+    bench_res<8,8,cordic_engine>( "cordic", n );
+    bench_res<12,12,cordic_engine>( "cordic", n );
+    bench_res<12,16,cordic_engine>( "cordic", n );
+    bench_res<16,16,cordic_engine>( "cordic", n );
+
+    std::cout << "CORDIC iterations at 16/16\n";
+    bench_res<16,16,cordic_iterations<8>::engine>( "iter 8", n );
+    bench_res<16,16,cordic_iterations<12>::engine>( "iter 12", n );
+    bench_res<16,16,cordic_iterations<14>::engine>( "iter 14", n );
+    bench_res<16,16,cordic_iterations<16>::engine>( "iter 16", n );
+    bench_res<16,16,cordic_iterations<18>::engine>( "iter 18", n );
+
+    std::cout << "Hybrid micro-rotations, polar to rect\n";
+    bench_res_p2r<12,12,hybrid_refine<0>::engine>( "refine0", n );
+    bench_res_p2r<12,16,hybrid_refine<0>::engine>( "refine0", n );
+    bench_res_p2r<16,16,hybrid_refine<0>::engine>( "refine0", n );
+    bench_res_p2r<16,16,hybrid_refine<2>::engine>( "refine2", n );
+    bench_res_p2r<16,16,hybrid_refine<3>::engine>( "refine3", n );
+    bench_res_p2r<16,16,hybrid_refine<4>::engine>( "refine4", n );
+
+    std::cout << "Runtime table generation (KiB, threads, ms, ms on 1 thread)\n";
+    bench_runtime_build<8,8>();
+    bench_runtime_build<9,9>();
+    bench_runtime_build<10,10>();
+    bench_runtime_build<11,11>();
+    bench_runtime_build<12,12>();
+
+    std::cout << "Crossover, full resolution runtime tables (size in KiB) against CORDIC\n";
+    std::cout << std::setw(7) << ( runtime_lut_engine<8,8>::lut().bytes() >> 10 ) << "\n";
+    bench_res<8,8,runtime_lut_engine>( "lut", n );
+    bench_res<8,8,cordic_engine>( "cordic", n );
+    std::cout << std::setw(7) << ( runtime_lut_engine<9,9>::lut().bytes() >> 10 ) << "\n";
+    bench_res<9,9,runtime_lut_engine>( "lut", n );
+    bench_res<9,9,cordic_engine>( "cordic", n );
+    std::cout << std::setw(7) << ( runtime_lut_engine<10,10>::lut().bytes() >> 10 ) << "\n";
+    bench_res<10,10,runtime_lut_engine>( "lut", n );
+    bench_res<10,10,cordic_engine>( "cordic", n );
+    std::cout << std::setw(7) << ( runtime_lut_engine<11,11>::lut().bytes() >> 10 ) << "\n";
+    bench_res<11,11,runtime_lut_engine>( "lut", n );
+    bench_res<11,11,cordic_engine>( "cordic", n );
+    std::cout << std::setw(7) << ( runtime_lut_engine<12,12>::lut().bytes() >> 10 ) << "\n";
+    bench_res<12,12,runtime_lut_engine>( "lut", n );
+    bench_res<12,12,cordic_engine>( "cordic", n );
+    return 0;
+}
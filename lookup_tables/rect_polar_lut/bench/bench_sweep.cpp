@@ -0,0 +1,310 @@
+/* sweep every rect/polar conversion path over buffer sizes and input
+   distributions, JSON results on stdout
+
+   usage: bench_sweep [--counters] [max_bytes]
+   buffer sizes run from 64 samples up to max_bytes of rect_vector input
+   (default 64 MiB) in steps of 4x, so the L1/L2/L3/DRAM knees show up.
+   Distributions:
+     uniform   x,y uniform over -128:127, worst case for the tables
+     tone      a complex tone at 0.8 full scale
+     gaussian  complex gaussian noise, sigma 32 per axis, clipped
+     qpsk      4 samples per symbol QPSK at +-90 with sigma 6 noise
+   Polar inputs are the rect inputs converted, so they follow the same
+   distribution.  The 16/16 engines of rect_polar_res.hpp run on the rect
+   inputs scaled up by 256 with random low bits, and the 4 channel kernels
+   take each 4 samples as a frame.  Not swept: exact_engine, whose blocks
+   are the dispatched "block" kernels, and runtime_lut_engine, whose
+   tables are built per width, see the crossover rows of bench_convert.
+   Each point is the best of several timed runs, each run repeating the
+   conversion over at least 2^22 samples.
+
+   --counters adds a "per_sample" object to each record with cycles,
+   instructions, L1D read misses, LLC read misses and branch mispredictions
+   per sample, from perf_event_open over one more run.  Counters the kernel
+   or VM doesn't provide, or that gave no count for the run, are null, and
+   with none at all the records are left as they are and a note goes to
+   stderr.
+*/
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <functional>
+#include "rect_polar_lut.hpp"
+#include "rect_polar_simd.hpp"
+#include "rect_polar_res.hpp"
+#include "perf_counters.hpp"
+
+// one conversion path, run( offset, n ) converts samples offset:offset+n
+struct path {
+    const char *direction;
+    const char *name;
+    std::function<void( size_t, size_t )> run;
+};
+
+// all of the buffers for one distribution
+struct buffers {
+    std::vector<rect_vector> rv;
+    std::vector<polar_vector> pv;
+    std::vector<uint8_t> iq;
+    std::vector<int8_t> x, y;
+    std::vector<uint8_t> mag, nra;
+    std::vector<rect_vector> rv_out;
+    std::vector<polar_vector> pv_out;
+    std::vector<int8_t> x_out, y_out;
+    std::vector<uint8_t> mag_out, nra_out;
+    std::vector<rect_vector_n<16>> rv16, rv16_out;
+    std::vector<polar_vector_n<16,16>> pv16, pv16_out;
+};
+
+static int8_t clip( double v ) {
+    long r = lround( v );
+    return ( r < -128 ) ? -128 : ( r > 127 ) ? 127 : r;
+}
+
+// fill b with n samples of the named distribution
+static void fill( buffers &b, const std::string &dist, size_t n ) {
+    std::mt19937 rng( 1 );
+    b.rv.resize( n );
+    if ( dist == "uniform" ) {
+        std::uniform_int_distribution<int> xy( -128, 127 );
+        for ( size_t i=0; i < n; i++ ) {
+            b.rv[i].x = xy( rng ), b.rv[i].y = xy( rng );
+        }
+    } else if ( dist == "tone" ) {
+        for ( size_t i=0; i < n; i++ ) {
+            double a = 0.0123456 * 2.0*M_PI * i;
+            b.rv[i].x = clip( 102.0 * cos( a ) ), b.rv[i].y = clip( 102.0 * sin( a ) );
+        }
+    } else if ( dist == "gaussian" ) {
+        std::normal_distribution<double> g( 0.0, 32.0 );
+        for ( size_t i=0; i < n; i++ ) {
+            b.rv[i].x = clip( g( rng ) ), b.rv[i].y = clip( g( rng ) );
+        }
+    } else {
+        std::normal_distribution<double> g( 0.0, 6.0 );
+        std::uniform_int_distribution<int> bit( 0, 1 );
+        int sx = 0, sy = 0;
+        for ( size_t i=0; i < n; i++ ) {
+            if ( i % 4 == 0 ) {
+                sx = bit( rng ) ? 90 : -90, sy = bit( rng ) ? 90 : -90;
+            }
+            b.rv[i].x = clip( sx + g( rng ) ), b.rv[i].y = clip( sy + g( rng ) );
+        }
+    }
+    b.pv.resize( n );
+    convert_rect_2_polar_block_scalar( b.rv.data(), b.pv.data(), n );
+    b.iq.resize( 2*n );
+    b.x.resize( n ), b.y.resize( n ), b.mag.resize( n ), b.nra.resize( n );
+    for ( size_t i=0; i < n; i++ ) {
+        b.iq[2*i] = b.rv[i].x + 128, b.iq[2*i+1] = b.rv[i].y + 128;
+        b.x[i] = b.rv[i].x, b.y[i] = b.rv[i].y;
+        b.mag[i] = b.pv[i].mag, b.nra[i] = b.pv[i].nra;
+    }
+    b.rv_out.resize( n ), b.pv_out.resize( n );
+    b.x_out.resize( n ), b.y_out.resize( n ), b.mag_out.resize( n ), b.nra_out.resize( n );
+    std::uniform_int_distribution<int> low( 0, 255 );
+    b.rv16.resize( n ), b.pv16.resize( n );
+    for ( size_t i=0; i < n; i++ ) {
+        b.rv16[i].x = b.rv[i].x * 256 + low( rng ), b.rv16[i].y = b.rv[i].y * 256 + low( rng );
+    }
+    convert_rect_2_polar_block_n( b.rv16.data(), b.pv16.data(), n );
+    b.rv16_out.resize( n ), b.pv16_out.resize( n );
+}
+
+// every path the cpu can run, over the buffers in b
+static std::vector<path> paths( buffers &b ) {
+    std::vector<path> p;
+    auto r2p = [&]( const char *name, void (*f)( const rect_vector *, polar_vector *, size_t ) ) {
+        p.push_back( { "rect_2_polar", name, [&b,f]( size_t o, size_t n ) { f( &b.rv[o], &b.pv_out[o], n ); } } );
+    };
+    auto p2r = [&]( const char *name, void (*f)( const polar_vector *, rect_vector *, size_t ) ) {
+        p.push_back( { "polar_2_rect", name, [&b,f]( size_t o, size_t n ) { f( &b.pv[o], &b.rv_out[o], n ); } } );
+    };
+    // 4 channels, samples o:o+n as n/4 frames, channel c out to pv_out[o+c*n/4:]
+    auto channels = [&]( const char *name, void (*f)( const rect_vector *, size_t, size_t,
+                                                      polar_vector *const *, size_t ) ) {
+        p.push_back( { "rect_2_polar", name, [&b,f]( size_t o, size_t n ) {
+            polar_vector *out[4] = { &b.pv_out[o], &b.pv_out[o+n/4], &b.pv_out[o+2*(n/4)], &b.pv_out[o+3*(n/4)] };
+            f( &b.rv[o], 4, 4, out, n / 4 );
+        } } );
+    };
+    auto r2p16 = [&]( const char *name, void (*f)( const rect_vector_n<16> *, polar_vector_n<16,16> *, size_t ) ) {
+        p.push_back( { "rect_2_polar", name, [&b,f]( size_t o, size_t n ) { f( &b.rv16[o], &b.pv16_out[o], n ); } } );
+    };
+    auto p2r16 = [&]( const char *name, void (*f)( const polar_vector_n<16,16> *, rect_vector_n<16> *, size_t ) ) {
+        p.push_back( { "polar_2_rect", name, [&b,f]( size_t o, size_t n ) { f( &b.pv16[o], &b.rv16_out[o], n ); } } );
+    };
+    p.push_back( { "rect_2_polar", "per sample", [&b]( size_t o, size_t n ) {
+        for ( size_t i=o; i < o+n; i++ ) b.pv_out[i] = convert_rect_2_polar( b.rv[i] );
+    } } );
+    p.push_back( { "rect_2_polar", "per sample octant", [&b]( size_t o, size_t n ) {
+        for ( size_t i=o; i < o+n; i++ ) b.pv_out[i] = convert_rect_2_polar_octant( b.rv[i] );
+    } } );
+    r2p( "block scalar", convert_rect_2_polar_block_scalar );
+    r2p( "block octant", convert_rect_2_polar_block_octant );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        r2p( "block avx2", convert_rect_2_polar_block_avx2 );
+    }
+    r2p( "block", convert_rect_2_polar_block );
+    p.push_back( { "rect_2_polar", "planar scalar", [&b]( size_t o, size_t n ) {
+        convert_rect_2_polar_planar_scalar( &b.x[o], &b.y[o], &b.mag_out[o], &b.nra_out[o], n );
+    } } );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        p.push_back( { "rect_2_polar", "planar avx2", [&b]( size_t o, size_t n ) {
+            convert_rect_2_polar_planar_avx2( &b.x[o], &b.y[o], &b.mag_out[o], &b.nra_out[o], n );
+        } } );
+    }
+    channels( "4 channels scalar", convert_rect_2_polar_channels_scalar );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        channels( "4 channels avx2", convert_rect_2_polar_channels_avx2 );
+    }
+    channels( "4 channels", convert_rect_2_polar_channels );
+    p.push_back( { "rect_2_polar", "mag only", [&b]( size_t o, size_t n ) {
+        convert_rect_2_mag_block( &b.rv[o], &b.mag_out[o], n );
+    } } );
+    p.push_back( { "rect_2_polar", "nra only", [&b]( size_t o, size_t n ) {
+        convert_rect_2_nra_block( &b.rv[o], &b.nra_out[o], n );
+    } } );
+    p.push_back( { "rect_2_polar", "u8 block scalar", [&b]( size_t o, size_t n ) {
+        convert_rect_u8_2_polar_block_scalar( &b.iq[2*o], &b.pv_out[o], n );
+    } } );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        p.push_back( { "rect_2_polar", "u8 block avx2", [&b]( size_t o, size_t n ) {
+            convert_rect_u8_2_polar_block_avx2( &b.iq[2*o], &b.pv_out[o], n );
+        } } );
+    }
+    p.push_back( { "rect_2_polar", "u8 block", [&b]( size_t o, size_t n ) {
+        convert_rect_u8_2_polar_block( &b.iq[2*o], &b.pv_out[o], n );
+    } } );
+    p.push_back( { "polar_2_rect", "per sample", [&b]( size_t o, size_t n ) {
+        for ( size_t i=o; i < o+n; i++ ) b.rv_out[i] = convert_polar_2_rect( b.pv[i] );
+    } } );
+    p.push_back( { "polar_2_rect", "per sample sine", [&b]( size_t o, size_t n ) {
+        for ( size_t i=o; i < o+n; i++ ) b.rv_out[i] = convert_polar_2_rect_sine( b.pv[i] );
+    } } );
+    p2r( "block scalar", convert_polar_2_rect_block_scalar );
+    p2r( "block sine", convert_polar_2_rect_block_sine );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        p2r( "block avx2", convert_polar_2_rect_block_avx2 );
+        p2r( "block sine avx2", convert_polar_2_rect_block_sine_avx2 );
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        p2r( "block avx512vbmi", convert_polar_2_rect_block_avx512vbmi );
+    }
+    p2r( "block", convert_polar_2_rect_block );
+    p.push_back( { "polar_2_rect", "planar scalar", [&b]( size_t o, size_t n ) {
+        convert_polar_2_rect_planar_scalar( &b.mag[o], &b.nra[o], &b.x_out[o], &b.y_out[o], n );
+    } } );
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        p.push_back( { "polar_2_rect", "planar avx2", [&b]( size_t o, size_t n ) {
+            convert_polar_2_rect_planar_avx2( &b.mag[o], &b.nra[o], &b.x_out[o], &b.y_out[o], n );
+        } } );
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        p.push_back( { "polar_2_rect", "planar avx512vbmi", [&b]( size_t o, size_t n ) {
+            convert_polar_2_rect_planar_avx512vbmi( &b.mag[o], &b.nra[o], &b.x_out[o], &b.y_out[o], n );
+        } } );
+    }
+    r2p16( "16/16 ratio", convert_rect_2_polar_block_n<16,16,ratio_engine> );
+    r2p16( "16/16 interp", convert_rect_2_polar_block_n<16,16,interp_engine> );
+    r2p16( "16/16 cordic", convert_rect_2_polar_block_n<16,16,cordic_engine> );
+    p2r16( "16/16 ratio", convert_polar_2_rect_block_n<16,16,ratio_engine> );
+    p2r16( "16/16 interp", convert_polar_2_rect_block_n<16,16,interp_engine> );
+    p2r16( "16/16 cordic", convert_polar_2_rect_block_n<16,16,cordic_engine> );
+    p2r16( "16/16 hybrid", convert_polar_2_rect_block_n<16,16,hybrid_engine> );
+    return p;
+}
+
+// seconds per sample for p over the first n samples, best of 5 runs.  Each
+// run repeats the conversion until at least 2^22 samples have been
+// converted, so small buffers stay hot in cache as they would in a stream.
+static size_t repetitions( size_t n ) {
+    const size_t min_samples = 1 << 22;
+    return ( min_samples + n - 1 ) / n;
+}
+
+static double time_path( const path &p, size_t n ) {
+    size_t reps = repetitions( n );
+    p.run( 0, n );
+    double best = 1e9;
+    for ( int run=0; run < 5; run++ ) {
+        auto t0 = std::chrono::steady_clock::now();
+        for ( size_t r=0; r < reps; r++ ) {
+            p.run( 0, n );
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double t = std::chrono::duration<double>( t1 - t0 ).count() / ( reps * n );
+        if ( t < best ) best = t;
+    }
+    return best;
+}
+
+// counts over one more timed run of p, divided down to per sample, NAN
+// where the counter gave no count
+static void count_path( const path &p, size_t n, perf_counter_set &pc, double per_sample[] ) {
+    size_t reps = repetitions( n );
+    pc.start();
+    for ( size_t r=0; r < reps; r++ ) {
+        p.run( 0, n );
+    }
+    pc.stop();
+    for ( int e=0; e < perf_counter_set::EVENTS; e++ ) {
+        per_sample[e] = pc.counted( e ) ? (double)pc.count[e] / ( reps * n ) : NAN;
+    }
+}
+
+int main( int argc, char **argv ) {
+    bool counters = false;
+    if ( argc > 1 && std::string( argv[1] ) == "--counters" ) {
+        counters = true, argc--, argv++;
+    }
+    size_t max_bytes = ( argc > 1 ) ? strtoull( argv[1], 0, 0 ) : (size_t)64 << 20;
+    perf_counter_set pc;
+    if ( counters && ! pc.any_valid() ) {
+        std::cerr << "bench_sweep: no perf counters available, timing only\n";
+        counters = false;
+    }
+    size_t max_samples = max_bytes / sizeof( rect_vector );
+    const char *dists[] = { "uniform", "tone", "gaussian", "qpsk" };
+    bool first = true;
+    std::cout << "{\n  \"rect_2_polar_kernel\": \"" << rect_2_polar_kernel_name() << "\",\n"
+              << "  \"polar_2_rect_kernel\": \"" << polar_2_rect_kernel_name() << "\",\n"
+              << "  \"results\": [";
+    buffers b;
+    for ( const char *dist : dists ) {
+        fill( b, dist, max_samples );
+        std::vector<path> ps = paths( b );
+        for ( const path &p : ps ) {
+            // 4x steps, always finishing on the full buffer
+            for ( size_t n=64; n <= max_samples; n = ( n < max_samples && 4*n > max_samples ) ? max_samples : 4*n ) {
+                double t = time_path( p, n );
+                std::cout << ( first ? "\n" : ",\n" )
+                          << "    { \"direction\": \"" << p.direction << "\", \"path\": \"" << p.name
+                          << "\", \"distribution\": \"" << dist << "\", \"samples\": " << n
+                          << ", \"bytes\": " << n * sizeof( rect_vector )
+                          << ", \"msps\": " << 1e-6 / t << ", \"ns_per_sample\": " << t * 1e9;
+                if ( counters ) {
+                    double per_sample[perf_counter_set::EVENTS];
+                    count_path( p, n, pc, per_sample );
+                    std::cout << ", \"per_sample\": {";
+                    for ( int e=0; e < perf_counter_set::EVENTS; e++ ) {
+                        std::cout << ( e ? ", \"" : " \"" ) << perf_counter_set::name( e ) << "\": ";
+                        if ( ! std::isnan( per_sample[e] ) ) std::cout << per_sample[e];
+                        else std::cout << "null";
+                    }
+                    std::cout << " }";
+                }
+                std::cout << " }";
+                first = false;
+            }
+        }
+    }
+    std::cout << "\n  ]\n}\n";
+    return 0;
+}
+
+//EOF
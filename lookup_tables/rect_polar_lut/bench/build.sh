@@ -0,0 +1,7 @@
+clang++-6.0 -O2 -mavx2 -c ../rect_polar_avx2.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -O2 -mavx512f -mavx512bw -mavx512vbmi -c ../rect_polar_avx512.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -O3 -c ../rect_polar_planar.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -O2 -o bench_convert bench_convert.cpp ../rect_polar_lut.cpp -Wa,-I.. ../rect_polar_dispatch.cpp rect_polar_planar.o rect_polar_avx2.o rect_polar_avx512.o -I.. -std=c++14 -pthread -ferror-limit=4
+clang++-6.0 -O2 -o bench_sweep bench_sweep.cpp ../rect_polar_lut.cpp -Wa,-I.. ../rect_polar_dispatch.cpp rect_polar_planar.o rect_polar_avx2.o rect_polar_avx512.o -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -O2 -o bench_accuracy bench_accuracy.cpp ../rect_polar_lut.cpp -Wa,-I.. ../rect_polar_dispatch.cpp rect_polar_planar.o rect_polar_avx2.o rect_polar_avx512.o -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -O2 -flto -o bench_convert_lto bench_convert.cpp ../rect_polar_lut.cpp -Wa,-I.. ../rect_polar_dispatch.cpp rect_polar_planar.o rect_polar_avx2.o rect_polar_avx512.o -I.. -std=c++14 -pthread -ferror-limit=4
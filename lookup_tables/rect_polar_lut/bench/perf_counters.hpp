@@ -0,0 +1,103 @@
+#ifndef __PERF_COUNTERS_HPP
+#define __PERF_COUNTERS_HPP
+
+/* minimal perf_event_open wrapper, counts user space events of the calling thread
+   valid() is false when the kernel (or VM) doesn't provide the counter,
+   callers should then just leave the column out.
+   Counts are scaled up by enabled/running time when the kernel had to
+   multiplex the PMU between more events than it has counters.  stop()
+   returns NO_COUNT when there is no count: no counter, a failed read, or
+   the counter never got onto the PMU.
+*/
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+class perf_counter {
+    int fd;
+public:
+    static const uint64_t NO_COUNT = UINT64_MAX;
+
+    perf_counter( uint32_t type, uint64_t config ) {
+        perf_event_attr attr;
+        memset( &attr, 0, sizeof(attr) );
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        fd = syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+    }
+    perf_counter( const perf_counter & ) = delete;
+    perf_counter &operator =( const perf_counter & ) = delete;
+    ~perf_counter() {
+        if ( fd >= 0 ) close( fd );
+    }
+    bool valid() const { return fd >= 0; }
+    void start() {
+        if ( fd < 0 ) return;
+        ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+        ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+    }
+    uint64_t stop() {
+        uint64_t v[3] = { 0, 0, 0 };   // count, time enabled, time running
+        if ( fd < 0 ) return NO_COUNT;
+        ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 );
+        if ( read( fd, v, sizeof(v) ) != sizeof(v) ) return NO_COUNT;
+        if ( v[2] == 0 ) return NO_COUNT;
+        if ( v[2] < v[1] ) return (uint64_t)( (double)v[0] * v[1] / v[2] );
+        return v[0];
+    }
+};
+
+// PERF_TYPE_HW_CACHE config for L1 data cache read misses
+const uint64_t L1D_READ_MISS = PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                               ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+
+// PERF_TYPE_HW_CACHE config for last level cache read misses
+const uint64_t LLC_READ_MISS = PERF_COUNT_HW_CACHE_LL | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                               ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+
+/* the counters the benchmarks report for each kernel, opened one by one so
+   a missing event (LLC on many VMs, or everything without a PMU) only drops
+   its own column.  stop() fills count[], NO_COUNT where there is none.
+*/
+class perf_counter_set {
+public:
+    enum event { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, EVENTS };
+    uint64_t count[EVENTS];
+    perf_counter_set() : counter{ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                                  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                                  { PERF_TYPE_HW_CACHE, L1D_READ_MISS },
+                                  { PERF_TYPE_HW_CACHE, LLC_READ_MISS },
+                                  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES } } {
+        for ( int e=0; e < EVENTS; e++ ) count[e] = perf_counter::NO_COUNT;
+    }
+    static const char *name( int e ) {
+        static const char *names[EVENTS] = { "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses" };
+        return names[e];
+    }
+    bool valid( int e ) const { return counter[e].valid(); }
+    bool counted( int e ) const { return count[e] != perf_counter::NO_COUNT; }
+    bool any_valid() const {
+        for ( int e=0; e < EVENTS; e++ ) if ( valid( e ) ) return true;
+        return false;
+    }
+    void start() {
+        for ( int e=0; e < EVENTS; e++ ) counter[e].start();
+    }
+    void stop() {
+        for ( int e=EVENTS-1; e >= 0; e-- ) count[e] = counter[e].stop();
+    }
+private:
+    perf_counter counter[EVENTS];
+};
+
+#endif
+
+//EOF
@@ -1 +1,2 @@
-clang++-3.6 -g -o gen_lookup_table gen_lookup_table.cpp -std=c++14 -ferror-limit=4
+clang++-6.0 -g -o gen_lookup_table gen_lookup_table.cpp -std=c++14 -ferror-limit=4
+./gen_lookup_table "$@"
@@ -1,11 +1,16 @@
-/* program to generate a lookup table header 
-   the provides rectanglar to polar and polar to rectanglar conversions
+/* program to check the lookup tables against libm and write them out as
+   the binary table file rect_polar_lut.bin (and, with --blob, the
+   rect_polar_lut_blob.inc that embeds it).  The tables themselves are the
+   constexpr builders in rect_polar_tables.hpp, the conversions are in the
+   hand maintained rect_polar_lut.cpp/.hpp and rect_polar_inline.hpp.
 
    Rectanglar space:
-   Rectanglar space is (x,y) where  -127 <= x <= 127 and -127 <= y <= 127
+   Rectanglar space is (x,y) where  -128 <= x <= 127 and -128 <= y <= 127
    
    Polar space:
-   Polar space is (mag,nra) where  0 <= mag <= 180  and 0 <= nra <= 255
+   Polar space is (mag,nra) where  0 <= mag <= 181  and 0 <= nra <= 255
+   (rect to polar gives mag 0:181, polar to rect takes any mag and
+   saturates x,y at 127)
    nra is Normalized Radian Angle
    it maps radian angles of 0->2*PI to 0->256
 
@@ -17,13 +22,17 @@
 #include <iostream>
 #include <fstream>
 #include <utility>
-#include <iomanip>
 #include <cstdint>
 #include <cmath>
 #include <ostream>
 #include <cstdlib>
 #include <exception>
 #include <string>
+#include <algorithm>
+#include <vector>
+#include <cstring>
+#include "rect_polar_tables.hpp"
+#include "rect_polar_table_file.hpp"
 
 class LUT_Exception : public std::exception
 {
@@ -48,32 +57,64 @@ struct polar_vector {
     uint8_t nra;
 };
 
-// add method for stream operator to print what a rect_vector is
-std::ostream& operator <<(std::ostream& os, const rect_vector &v) {
-    os << "{" << std::setw(4) << (int)v.x << "," << std::setw(4) << (int)v.y << "}";
-    return os;
-}
-
-// add method for stream operator to print what a polar_vector is
-std::ostream& operator <<(std::ostream& os, const polar_vector &v) {
-    os << "{" << std::setw(3) <<  (int)v.mag << "<" << std::setw(3) << (int)v.nra << "}";
-    return os;
-}
-
-
 // Lookup table storage for rect 2 polar
 // This LUT contains lookups for the first quadurant
 // convertion to other quadurants can be perform via simple 90 degree
 // translations to get values in other quadurants.
-struct polar_vector rect_2_polar_lut[128][128];
+// x,y run 0:128 so x or y = -128 fold in too.  Rows carry one pad entry
+// (y=129, never looked up) so every row is an even number of entries and
+// a 32-bit read at any entry stays inside the table.
+struct polar_vector rect_2_polar_lut[129][130];
+
+// Lookup table storage for rect 2 polar, folded to the first octant.
+// Only x >= y is stored, row x holds y=0:x and starts at x*(x+1)/2.
+// (x,y) with y > x is looked up as (y,x) with nra => 64-nra, which the
+// generator checks matches rect_2_polar_lut.  16.4 KiB instead of 32.8 KiB.
+#define OCTANT_LUT_SIZE (129*130/2)
+struct polar_vector rect_2_polar_octant_lut[OCTANT_LUT_SIZE];
+
+// The mag and nra halves of rect_2_polar_lut as separate tables, for
+// callers which only need one of them (16 KiB working set each)
+uint8_t rect_2_mag_lut[129][129];
+uint8_t rect_2_nra_lut[129][129];
+
+// Lookup table for unsigned offset binary I/Q (RTL-SDR style dongles), raw
+// byte r stands for r-127.5.  Entry [a][b] is the first quadrant vector
+// (a+0.5, b+0.5), so the low 7 bits of the raw bytes (inverted for the
+// negative half) index it directly and there are no samples on the axes.
+struct polar_vector rect_u8_2_polar_lut[128][128];
 
 // Lookup table for polar 2 rect
 // This LUT contains lookups for the first quadurant.
 // convertion to other quadurants can be perform via simple 90 degree
 // translations to get values in other quadurants.
-struct rect_vector polar_2_rect_lut[181][64];
+// Every uint8_t mag has a row, so no input reads past the table.  Rows over
+// 181 are never produced by rect to polar and hold saturated vectors.
+struct rect_vector polar_2_rect_lut[256][64];
+
+// Q15 cos/sin slices for nra 0:63.  Each is chosen so that
+//   polar_2_rect_lut[mag][nra].x == min( (mag*polar_2_rect_cos_q15[nra]) >> 15, 127 )
+//   polar_2_rect_lut[mag][nra].y == min( (mag*polar_2_rect_sin_q15[nra]) >> 15, 127 )
+// for every mag, so a multiply reproduces the table bit for bit.
+uint16_t polar_2_rect_cos_q15[64];
+uint16_t polar_2_rect_sin_q15[64];
+
+// smallest mag for which polar_2_rect_lut[mag][nra] had to saturate x or y,
+// 256 if none does.  The status lookup reports saturation from this.
+uint16_t polar_2_rect_sat_mag[64];
 
 
+// The tables as computed by the compiler from the constexpr builders in
+// rect_polar_tables.hpp.  The populate functions below copy these and
+// check them against the same tables built at run time with libm.
+constexpr rect_2_polar_table<polar_vector> cx_rect_2_polar = make_rect_2_polar_lut<polar_vector>();
+constexpr rect_2_polar_octant_table<polar_vector> cx_rect_2_polar_octant = make_rect_2_polar_octant_lut( cx_rect_2_polar );
+constexpr rect_byte_table cx_rect_2_mag = make_rect_2_mag_lut( cx_rect_2_polar );
+constexpr rect_byte_table cx_rect_2_nra = make_rect_2_nra_lut( cx_rect_2_polar );
+constexpr rect_u8_2_polar_table<polar_vector> cx_rect_u8_2_polar = make_rect_u8_2_polar_lut<polar_vector>();
+constexpr polar_2_rect_table<rect_vector> cx_polar_2_rect = make_polar_2_rect_lut<rect_vector>();
+constexpr polar_2_rect_slices cx_polar_2_rect_slices = make_polar_2_rect_slices( cx_polar_2_rect );
+
 // utility function to convert radians to NRA
 uint8_t radians_2_nra( double radian_angle ) {
     if ( radian_angle < 0 ) {
@@ -92,419 +133,276 @@ double nra_2_radians( uint8_t nra ) {
 void populate_rect2polar_lut() {
     int x,y;
     polar_vector pv;
-    for ( x=0; x < 128; x++ ) {
-        for ( y=0; y < 128; y++ ) {
-            pv.mag = round( sqrt( pow(x,2) + pow(y,2) ) );
-            pv.nra = radians_2_nra( atan2( y, x ) );
+    for ( x=0; x < 129; x++ ) {
+        for ( y=0; y < 130; y++ ) {
+            pv = cx_rect_2_polar.lut[x][y];
+            if (( y < 129 ) && (( pv.mag != (uint8_t)round( sqrt( pow(x,2) + pow(y,2) ) ) ) ||
+                                ( pv.nra != radians_2_nra( atan2( y, x ) ) ))) {
+                throw LUT_Exception( std::string("constexpr rect_2_polar_lut differs from libm") );
+            }
             rect_2_polar_lut[x][y] = pv;
         }
     }
 }
                     
+// build the first octant table from the first quadrant table, and check
+// the mirrored half really is a reflection across x=y
+void populate_rect2polar_octant_lut() {
+    int x,y;
+    for ( x=0; x < 129; x++ ) {
+        for ( y=0; y < 129; y++ ) {
+            polar_vector pv = rect_2_polar_lut[x][y];
+            if ( y <= x ) {
+                rect_2_polar_octant_lut[ x*(x+1)/2 + y ] = cx_rect_2_polar_octant.lut[ x*(x+1)/2 + y ];
+            } else {
+                polar_vector m = rect_2_polar_lut[y][x];
+                if (( pv.mag != m.mag ) || ( pv.nra != (uint8_t)(64 - m.nra) )) {
+                    throw LUT_Exception( std::string("rect_2_polar_lut is not symmetric about x=y") );
+                }
+            }
+        }
+    }
+}
+
+// split rect_2_polar_lut into the mag only and nra only tables
+void populate_rect2mag_nra_lut() {
+    int x,y;
+    for ( x=0; x < 129; x++ ) {
+        for ( y=0; y < 129; y++ ) {
+            rect_2_mag_lut[x][y] = cx_rect_2_mag.lut[x][y];
+            rect_2_nra_lut[x][y] = cx_rect_2_nra.lut[x][y];
+        }
+    }
+}
+
+// build lookup table of polar_vectors for offset binary I/Q, the 127.5 bias
+// is folded in here so the raw bytes index the table directly
+void populate_rect_u8_2_polar_lut() {
+    int a,b;
+    polar_vector pv;
+    for ( a=0; a < 128; a++ ) {
+        for ( b=0; b < 128; b++ ) {
+            pv = cx_rect_u8_2_polar.lut[a][b];
+            if (( pv.mag != (uint8_t)round( sqrt( pow(a+0.5,2) + pow(b+0.5,2) ) ) ) ||
+                ( pv.nra != radians_2_nra( atan2( b+0.5, a+0.5 ) ) )) {
+                throw LUT_Exception( std::string("constexpr rect_u8_2_polar_lut differs from libm") );
+            }
+            rect_u8_2_polar_lut[a][b] = pv;
+        }
+    }
+}
+
 // build lookup table of ractangular vectors
 void populate_polar2rect_lut() {
     int mag,nra;
     int x,y;
     rect_vector rv;
-    for ( mag=0; mag < 181; mag++ ) {
+    for ( nra=0; nra < 64; nra++ ) {
+        polar_2_rect_sat_mag[nra] = 256;
+    }
+    for ( mag=0; mag < 256; mag++ ) {
         for (nra=0; nra < 64; nra++ ) {
             x = mag * cos( nra_2_radians( nra ) );
             y = mag * sin( nra_2_radians( nra ) );
             // saturate for mag,nra which produce x,y over |127|
+            if ((( x > 127 ) || ( y > 127 )) && ( polar_2_rect_sat_mag[nra] > mag )) {
+                polar_2_rect_sat_mag[nra] = mag;
+            }
             if ( x > 127 ) x=127;
             if ( y > 127 ) y=127;
-            rv.x = x;
-            rv.y = y;
+            rv = cx_polar_2_rect.lut[mag][nra];
+            if (( rv.x != x ) || ( rv.y != y )) {
+                throw LUT_Exception( std::string("constexpr polar_2_rect_lut differs from libm") );
+            }
             polar_2_rect_lut[mag][nra] = rv;
         }
     }
-}
-
-// perform lookup operation
-struct rect_vector convert_polar_2_rect( polar_vector pv ) {
-    rect_vector rv;
-    if ( pv.nra < 64 ) {
-        // first quadrant lookup
-        rv = polar_2_rect_lut[pv.mag][pv.nra];
-    } 
-    if ( (pv.nra >= 64) && (pv.nra < 128) ) {
-        // second quadrant
-        rv = polar_2_rect_lut[pv.mag][pv.nra-64];
-        uint8_t t = rv.x;
-        rv.x = rv.y*-1;
-        rv.y = t;
-    }
-    if ( (pv.nra >= 128) && ( pv.nra < 192) ) {
-        // third quadrant
-        rv = polar_2_rect_lut[pv.mag][pv.nra-128];
-        rv.x = rv.x*(-1);
-        rv.y = rv.y*(-1);
-    }
-    if ( (pv.nra >= 192) && ( pv.nra <= 255) ) {
-        rv = polar_2_rect_lut[pv.mag][pv.nra-192];
-        uint8_t t = rv.x;
-        rv.x = rv.y;
-        rv.y = t*-1;
+    for ( nra=0; nra < 64; nra++ ) {
+        if ( polar_2_rect_sat_mag[nra] != cx_polar_2_rect_slices.sat_mag[nra] ) {
+            throw LUT_Exception( std::string("constexpr polar_2_rect_sat_mag differs from libm") );
+        }
     }
-/*  not need if using uint8_t nra values..
-    // 256 = 2*PI => 0  roll over..
-    if (pv.nra == 256 ) { rv = polar_2_rect_lut[pv.mag][0]; };
-    // if over 256, can not directly convert this.
-    if (pv.nra > 256 ) { 
-        rv = polar_2_rect_lut[0][0];
-        throw LUT_Exception( std::string("cannot lookup angle over 2*PI\n"));
-    };
-*/
-    return rv;
 }
 
-struct polar_vector convert_rect_2_polar( rect_vector rv ) {
-    polar_vector pv;
-    if (( rv.x > 127 ) || (rv.x < -127 )) {
-        pv.mag = 0;
-        pv.nra = 0;
-        throw LUT_Exception( std::string("cannot lookup x (x>127 or x<-127)"));
-    }
-    if (( rv.y > 127 ) || (rv.y < -127 )) {
-        pv.mag = 0;
-        pv.nra = 0;
-        throw LUT_Exception( std::string("cannot lookup y (y>127 or y<-127)"));
-    }
-
-    if ( (rv.x >= 0) && (rv.y >= 0 ) ) {
-        // first quad
-        pv = rect_2_polar_lut[rv.x][rv.y];
-    }
-    if ( (rv.x < 0) && (rv.y > 0 ) ) {
-        // second quad
-        pv = rect_2_polar_lut[(rv.x*-1)][rv.y];
-        pv.nra += 64;
-    }
-    if ( ( rv.x <= 0 ) && ( rv.y <= 0 ) ) {
-        // third quad
-        pv = rect_2_polar_lut[(rv.x*-1)][(rv.y*-1)];
-        pv.nra += 128;
-    }
-    if ( ( rv.x > 0 ) && ( rv.y < 0) ) {
-        // forth quad
-        pv = rect_2_polar_lut[rv.x][(rv.y*-1)];
-        pv.nra += 192;
+// find the Q15 constant closest to ideal which reproduces the column col
+// (x or y values for one nra over all mags) of polar_2_rect_lut exactly
+uint16_t fit_q15( const int *col, double ideal ) {
+    long lo = 0, hi = 65535;
+    for ( long mag=1; mag < 256; mag++ ) {
+        long t = col[mag];
+        // need mag*c >= t<<15, and mag*c < (t+1)<<15 unless saturated
+        lo = std::max( lo, ( (t << 15) + mag - 1 ) / mag );
+        if ( t < 127 ) {
+            hi = std::min( hi, ( ((t+1) << 15) - 1 ) / mag );
+        }
     }
-
-    return pv;
-}
-        
-// run a test on a rect lookup operation
-int run_p2r_test( uint8_t mag, uint8_t nra, int8_t expected_x, int8_t expected_y) {
-    polar_vector pv;
-    rect_vector rv;
-    pv.mag = mag, pv.nra = nra;
-    rv = convert_polar_2_rect( pv );
-    std::cout << pv << " => " << rv << "  .........  ";
-    if (( rv.x == expected_x ) && ( rv.y == expected_y )) {
-        std::cout << "PASS\n";
-    } else {
-        std::cout << "FAIL ";
-        std::cout << "Expected { " << (int)expected_x << "," << (int)expected_y << " } " << std::endl;
-        return -1;
+    if ( lo > hi ) {
+        throw LUT_Exception( std::string("no Q15 constant reproduces table column") );
     }
-    return 0;
+    long c = lround( ideal * 32768.0 );
+    if ( c < lo ) c = lo;
+    if ( c > hi ) c = hi;
+    return c;
 }
 
-// run a test on a polar lookup operation
-int run_r2p_test( int8_t x, int8_t y, uint8_t expected_mag, uint8_t expected_nra) {
-    polar_vector pv;
-    rect_vector rv;
-    rv.x = x, rv.y = y;
-    pv = convert_rect_2_polar( rv );
-    std::cout << rv << " => " << pv << "  .........  ";
-    if (( pv.mag == expected_mag ) && ( pv.nra == expected_nra )) {
-        std::cout << "PASS\n";
-    } else {
-        std::cout << "FAIL ";
-        std::cout << "Expected { " << (int)expected_mag << "," << (int)expected_nra << " } " << std::endl;
-        return -1;
+// build Q15 cos/sin slices from polar_2_rect_lut
+void populate_polar2rect_q15() {
+    int mag,nra;
+    int xcol[256], ycol[256];
+    for (nra=0; nra < 64; nra++ ) {
+        for ( mag=0; mag < 256; mag++ ) {
+            xcol[mag] = polar_2_rect_lut[mag][nra].x;
+            ycol[mag] = polar_2_rect_lut[mag][nra].y;
+        }
+        polar_2_rect_cos_q15[nra] = cx_polar_2_rect_slices.cos_q15[nra];
+        polar_2_rect_sin_q15[nra] = cx_polar_2_rect_slices.sin_q15[nra];
+        if (( polar_2_rect_cos_q15[nra] != fit_q15( xcol, cos( nra_2_radians( nra ) ) ) ) ||
+            ( polar_2_rect_sin_q15[nra] != fit_q15( ycol, sin( nra_2_radians( nra ) ) ) )) {
+            throw LUT_Exception( std::string("constexpr Q15 slices differ from libm") );
+        }
     }
-    return 0;
 }
 
+// the tables in table file order, with the symbol each is defined under in
+// rect_polar_lut.cpp.  The three slices are polar_2_rect_slices_data, one
+// after the other, so only the first of them carries the symbol.
+struct table_file_entry {
+    uint32_t id, element_size, rows, cols;
+    const void *data;
+    const char *symbol;
+};
 
-int run_test() {
-    // test polar to rect lookups
-    std::cout << "Testing Polar to Rect lookups....\n";
-    // quad 1 0->90
-    //                 mag,nra => x,y
-    if ( run_p2r_test( 71, 0, 71, 0 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 32, 50, 50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 64, 0, 71 ) != 0 ) { return -1; }
-    // quad 2 90->180
-    if ( run_p2r_test( 71, 96, -50, 50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 128, -71, 0 ) != 0 ) { return -1; }
-    // quad 3 180 -> 270
-    if ( run_p2r_test( 71, 160, -50, -50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 192, 0, -71 ) != 0 ) { return -1; }
-    // QUAD 4 270 -> 360
-    if ( run_p2r_test( 71, 224, 50, -50 ) != 0 ) { return -1; }
-    std::cout << "Testing Rect to Polar lookups....\n";
-    // QUAD 1
-    //                 x,y => mag,nra
-    if ( run_r2p_test( 71, 0, 71, 0 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 50, 50, 71, 32 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 0, 71, 71, 64 ) != 0 ) { return -1; }
-    // Quad 2
-    if ( run_r2p_test( -50, 50, 71, 96 ) != 0 ) { return -1; }
-    if ( run_r2p_test( -71, 0, 71, 128 ) != 0 ) { return -1; }
-    // Quad 3
-    if ( run_r2p_test( -50, -50, 71, 160 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 0, -71, 71, 192 ) != 0 ) { return -1; }
-    // Quad 4
-    if ( run_r2p_test( 50, -50, 71, 224 ) != 0 ) { return -1; }
-    return 0;
+const table_file_entry table_file_tables[TABLE_FILE_SECTIONS] = {
+    { SECTION_RECT_2_POLAR, sizeof(polar_vector), 129, 130, rect_2_polar_lut, "rect_2_polar_lut_data" },
+    { SECTION_RECT_2_POLAR_OCTANT, sizeof(polar_vector), 1, OCTANT_LUT_SIZE, rect_2_polar_octant_lut, "rect_2_polar_octant_lut_data" },
+    { SECTION_RECT_2_MAG, 1, 129, 129, rect_2_mag_lut, "rect_2_mag_lut_data" },
+    { SECTION_RECT_2_NRA, 1, 129, 129, rect_2_nra_lut, "rect_2_nra_lut_data" },
+    { SECTION_RECT_U8_2_POLAR, sizeof(polar_vector), 128, 128, rect_u8_2_polar_lut, "rect_u8_2_polar_lut_data" },
+    { SECTION_POLAR_2_RECT, sizeof(rect_vector), 256, 64, polar_2_rect_lut, "polar_2_rect_lut_data" },
+    { SECTION_POLAR_2_RECT_COS_Q15, 2, 1, 64, polar_2_rect_cos_q15, "polar_2_rect_slices_data" },
+    { SECTION_POLAR_2_RECT_SIN_Q15, 2, 1, 64, polar_2_rect_sin_q15, 0 },
+    { SECTION_POLAR_2_RECT_SAT_MAG, 2, 1, 64, polar_2_rect_sat_mag, 0 }
+};
+
+// lay the tables out as a binary table file (rect_polar_table_file.hpp), a
+// 64 byte header, the section directory, then each table 64 byte aligned.
+// dir gets the directory, the whole file image is returned.
+std::vector<uint8_t> table_file_image( table_file_section dir[TABLE_FILE_SECTIONS] ) {
+    table_file_header h;
+    memset( &h, 0, sizeof(h) );
+    memset( dir, 0, TABLE_FILE_SECTIONS * sizeof(table_file_section) );
+    uint64_t offset = sizeof(h) + TABLE_FILE_SECTIONS * sizeof(table_file_section);
+    for ( int t=0; t < TABLE_FILE_SECTIONS; t++ ) {
+        const table_file_entry &e = table_file_tables[t];
+        offset = ( offset + TABLE_FILE_ALIGN - 1 ) & ~(uint64_t)( TABLE_FILE_ALIGN - 1 );
+        dir[t].id = e.id;
+        dir[t].element_size = e.element_size;
+        dir[t].rows = e.rows;
+        dir[t].cols = e.cols;
+        dir[t].offset = offset;
+        dir[t].size = (uint64_t)e.element_size * e.rows * e.cols;
+        offset += dir[t].size;
+    }
+    std::vector<uint8_t> image( offset, 0 );
+    memcpy( &image[sizeof(h)], dir, TABLE_FILE_SECTIONS * sizeof(table_file_section) );
+    for ( int t=0; t < TABLE_FILE_SECTIONS; t++ ) {
+        memcpy( &image[dir[t].offset], table_file_tables[t].data, dir[t].size );
+    }
+    memcpy( h.magic, TABLE_FILE_MAGIC, sizeof(h.magic) );
+    h.version = TABLE_FILE_VERSION;
+    h.header_size = sizeof(h);
+    h.iq_bits = 8;
+    h.nra_bits = 8;
+    h.r2p_rounding = ROUND_NEAREST;
+    h.p2r_rounding = ROUND_TRUNCATE_SATURATE;
+    h.alignment = TABLE_FILE_ALIGN;
+    h.section_count = TABLE_FILE_SECTIONS;
+    h.file_size = image.size();
+    h.checksum = table_file_checksum( &image[sizeof(h)], image.size() - sizeof(h) );
+    memcpy( &image[0], &h, sizeof(h) );
+    return image;
 }
 
-// write a c program with our lookup tables defined as constants.
-int write_c_file() {
+// write the binary table file
+int write_bin_file() {
+    table_file_section dir[TABLE_FILE_SECTIONS];
+    std::vector<uint8_t> image = table_file_image( dir );
     std::fstream fh;
-    fh.open( "rect_polar_lut.cpp", std::ios::out );
+    fh.open( "rect_polar_lut.bin", std::ios::out | std::ios::binary );
     if ( fh.is_open() == 0 ) {
         return -1;
     }
-    fh << "/* Rect/Polar conversion tables & functions " << std::endl;
-    fh << "*/\n";
-    fh << "#include <cstdint>\n";
-    fh << "#include \"rect_polar_lut.hpp\"\n";
-    fh << "\n";
-    fh << "/* Lookup table for Rect to Polar conversions */\n";
-    fh << "struct polar_vector rect_2_polar_lut[128][128] = \n";
-    fh << "{ \n";
-    int x,y;
-    polar_vector pv;
-    rect_vector rv;
-    for (x=0; x < 128; x ++ ) {
-        fh << "  {  // mag,nra for x=" << (int)x << " and y=0:127\n    ";
-        for (y=0; y < 128; y++ ) {
-            pv = rect_2_polar_lut[x][y];
-            fh << "{" << std::setw(3) << (int)pv.mag << "," << std::setw(3) << (int)pv.nra << "}";
-            if (  (y != 127 ) && (y+1)%8 == 0) {
-                // continue on next line
-                fh << ",\n    ";
-            } else {
-                if ( y == 127 ) { 
-                    // last line, no comma on end
-                    fh << "\n";
-                } else {
-                    fh << ", ";
-                }
-            }
-        }
-        if ( x == 127 ) {
-            fh << "  }\n";
-        } else {
-            fh << "  },\n";
-        }
-    }
-    fh << "};\n";
-    fh << "\n";
-    fh << "/* Lookup table for Polar to Rect Conversions */\n";
-    fh << "struct rect_vector polar_2_rect_lut[181][64] = \n";
-    fh << "{ \n";
-    int mag,nra;
-    for (mag=0; mag < 181; mag ++ ) {
-        fh << "  {  // x,y for mag=" << (int)mag << " and nra=0:63\n    ";
-        for (nra=0; nra < 64; nra++ ) {
-            rv = polar_2_rect_lut[mag][nra];
-            fh << "{" << std::setw(4) << (int)rv.x << "," << std::setw(4) << (int)rv.y << "}";
-            if (  (nra != 63 ) && (nra+1)%8 == 0) {
-                // continue on next line
-                fh << ",\n    ";
-            } else {
-                if ( nra == 63 ) { 
-                    // last line, no comma on end
-                    fh << "\n";
-                } else {
-                    fh << ", ";
-                }
-            }
-        }
-        if ( mag == 180 ) {
-            fh << "  }\n";
-        } else {
-            fh << "  },\n";
-        }
-    }
-    fh << "};\n\n";
-    fh << "// perform lookup operation\n";
-    fh << "struct rect_vector convert_polar_2_rect( polar_vector pv ) {\n";
-    fh << "    rect_vector rv;\n";
-    fh << "    if ( pv.nra < 64 ) {\n";
-    fh << "        // first quadrant lookup\n";
-    fh << "        rv = polar_2_rect_lut[pv.mag][pv.nra];\n";
-    fh << "    }\n";
-    fh << "    if ( (pv.nra >= 64) && (pv.nra < 128) ) {\n";
-    fh << "        // second quadrant\n";
-    fh << "        rv = polar_2_rect_lut[pv.mag][pv.nra-64];\n";
-    fh << "        uint8_t t = rv.x;\n";
-    fh << "        rv.x = rv.y*-1;\n";
-    fh << "        rv.y = t;\n";
-    fh << "    }\n";
-    fh << "    if ( (pv.nra >= 128) && ( pv.nra < 192) ) {\n";
-    fh << "        // third quadrant\n";
-    fh << "        rv = polar_2_rect_lut[pv.mag][pv.nra-128];\n";
-    fh << "        rv.x = rv.x*(-1);\n";
-    fh << "        rv.y = rv.y*(-1);\n";
-    fh << "    }\n";
-    fh << "    if ( (pv.nra >= 192) && ( pv.nra <= 255) ) {\n";
-    fh << "        rv = polar_2_rect_lut[pv.mag][pv.nra-192];\n";
-    fh << "        uint8_t t = rv.x;\n";
-    fh << "        rv.x = rv.y;\n";
-    fh << "        rv.y = t*-1;\n";
-    fh << "    }\n";
-    fh << "    return rv;\n";
-    fh << "}\n";
-    fh << "\n";
-    fh << "struct polar_vector convert_rect_2_polar( rect_vector rv ) {\n";
-    fh << "    polar_vector pv;\n";
-    fh << "    if (( rv.x > 127 ) || (rv.x < -127 )) {\n";
-    fh << "        pv.mag = 0;\n";
-    fh << "        pv.nra = 0;\n";
-    fh << "        //throw LUT_Exception( std::string(\"cannot lookup x (x>127 or x<-127)\"));\n";
-    fh << "    }\n";
-    fh << "    if (( rv.y > 127 ) || (rv.y < -127 )) {\n";
-    fh << "        pv.mag = 0;\n";
-    fh << "        pv.nra = 0;\n";
-    fh << "        //throw LUT_Exception( std::string(\"cannot lookup y (y>127 or y<-127)\"));\n";
-    fh << "    }\n";
-    fh << "    if ( (rv.x >= 0) && (rv.y >= 0 ) ) {\n";
-    fh << "        // first quad\n";
-    fh << "        pv = rect_2_polar_lut[rv.x][rv.y];\n";
-    fh << "    }\n";
-    fh << "    if ( (rv.x < 0) && (rv.y > 0 ) ) {\n";
-    fh << "        // second quad\n";
-    fh << "        pv = rect_2_polar_lut[(rv.x*-1)][rv.y];\n";
-    fh << "        pv.nra += 64;\n";
-    fh << "    }\n";
-    fh << "    if ( ( rv.x <= 0 ) && ( rv.y <= 0 ) ) {\n";
-    fh << "        // third quad\n";
-    fh << "        pv = rect_2_polar_lut[(rv.x*-1)][(rv.y*-1)];\n";
-    fh << "        pv.nra += 128;\n";
-    fh << "    }\n";
-    fh << "    if ( ( rv.x > 0 ) && ( rv.y < 0) ) {\n";
-    fh << "        // forth quad\n";
-    fh << "        pv = rect_2_polar_lut[rv.x][(rv.y*-1)];\n";
-    fh << "        pv.nra += 192;\n";
-    fh << "    }\n";
-    fh << "    return pv;\n";
-    fh << "}\n";
-    fh << "\n";
-    fh << "#ifdef using_cpp\n";
-    fh << "#include <ostream>\n";
-    fh << "#include <iomanip>\n";
-    fh << "\n";
-    fh << "// add method for stream operator to print what a rect_vector is\n";
-    fh << "std::ostream& operator <<(std::ostream& os, const rect_vector &v) {\n";
-    fh << "    os << \"{\" << std::setw(4) << (int)v.x << \",\" << std::setw(4) << (int)v.y << \"}\";\n";
-    fh << "    return os;\n";
-    fh << "}\n";
-    fh << "\n";
-    fh << "// add method for stream operator to print what a polar_vector is\n";
-    fh << "std::ostream& operator <<(std::ostream& os, const polar_vector &v) {\n";
-    fh << "    os << \"{\" << std::setw(3) <<  (int)v.mag << \"<\" << std::setw(3) << (int)v.nra << \"}\";\n";
-    fh << "    return os;\n";
-    fh << "}\n";
-    fh << "\n";
-    fh << "class LUT_Exception : public std::exception\n";
-    fh << "{\n";
-    fh << "    std::string s;\n";
-    fh << "public:\n";
-    fh << "    LUT_Exception( std::string ss) : s(ss) {}\n";
-    fh << "    ~LUT_Exception() throw() {}\n";
-    fh << "    const char * what() const throw() { return s.c_str(); }\n";
-    fh << "};\n";
-    fh << "\n";
-    fh << "#endif\n";   
-    fh << "\n";
-    fh << "\n";
+    fh.write( reinterpret_cast<const char *>( image.data() ), image.size() );
     fh.close();
-    return 0;
+    return fh.fail() ? -1 : 0;
 }
 
-int write_h_file() {
+// write rect_polar_lut_blob.inc, which rect_polar_lut.cpp includes in
+// place of its constexpr tables when built with -DRECT_POLAR_LUT_BLOB.  It
+// defines the tables as symbols pulled straight out of rect_polar_lut.bin
+// by the assembler (.incbin), so the compiler has no builders to evaluate.
+// Each lands in .rodata on a 64 byte boundary.  The assembler looks for
+// rect_polar_lut.bin in the directory it runs in and in -Wa,-I<dir>.
+int write_blob_file() {
+    table_file_section dir[TABLE_FILE_SECTIONS];
+    table_file_image( dir );
     std::fstream fh;
-    fh.open( "rect_polar_lut.hpp", std::ios::out );
+    fh.open( "rect_polar_lut_blob.inc", std::ios::out );
     if ( fh.is_open() == 0 ) {
         return -1;
     }
-    fh << "#ifndef __RECT_POLAR_LUT_HPP\n";
-    fh << "#define __RECT_POLAR_LUT_HPP\n";
-    fh << "#define using_cpp\n";
-    fh << "\n";
-    fh << "// if using c++ enviroment enable exceptions...\n";
-    fh << "#ifdef using_cpp\n";
-    fh << "#include <exception>\n";
-    fh << "class LUT_Exception;\n";
-    fh << "#endif\n";
-    fh << "\n";
-    fh << "\n";
-    fh << "// data struct for a rect vector in X,Y\n";
-    fh << "struct rect_vector {\n";
-    fh << "    int8_t x;\n";
-    fh << "    int8_t y;\n";
-    fh << "};\n";
-    fh << "\n";
-    fh << "// data struct for a polar vector in Mag,NRA\n";
-    fh << "struct polar_vector {\n";
-    fh << "    uint8_t mag;\n";
-    fh << "    uint8_t nra;\n";
-    fh << "};\n";
-    fh << "\n";
-    fh << "//If using c++, provide stream operator to print rv,pv as text\n";
-    fh << "#ifdef using_cpp\n";
-    fh << "#include <ostream>\n";
-    fh << "// add method for stream operator to print what a rect_vector is\n";
-    fh << "std::ostream& operator <<(std::ostream& os, const rect_vector &v);\n";
-    fh << "\n";
-    fh << "// add method for stream operator to print what a polar_vector is\n";
-    fh << "std::ostream& operator <<(std::ostream& os, const polar_vector &v);\n";
-    fh << "#endif\n";
-    fh << "\n";
-    fh << "\n";
-    fh << "// Function prototypes for lookup operations\n";
-    fh << "struct polar_vector convert_rect_2_polar( rect_vector rv );\n";
-    fh << "struct rect_vector convert_polar_2_rect( polar_vector pv );\n";
-    fh << "\n";
-    fh << "#endif\n\n";
-    fh << "//EOF\n\n";
+    fh << "/* Lookup tables, embedded from the binary table file rect_polar_lut.bin\n";
+    fh << "   (see rect_polar_table_file.hpp for the layout) */\n";
+    fh << "asm(\n";
+    fh << "    \".pushsection .rodata\\n\"\n";
+    for ( int t=0; t < TABLE_FILE_SECTIONS; t++ ) {
+        const char *name = table_file_tables[t].symbol;
+        fh << "    \".balign " << TABLE_FILE_ALIGN << "\\n\"\n";
+        if ( name ) {
+            // the symbol runs on over the sections after it without one
+            uint64_t size = dir[t].size;
+            for ( int u=t+1; ( u < TABLE_FILE_SECTIONS ) && ( table_file_tables[u].symbol == 0 ); u++ ) {
+                size = dir[u].offset + dir[u].size - dir[t].offset;
+            }
+            fh << "    \".global " << name << "\\n\"\n";
+            fh << "    \".type " << name << ", @object\\n\"\n";
+            fh << "    \".size " << name << ", " << size << "\\n\"\n";
+            fh << "    \"" << name << ":\\n\"\n";
+        }
+        fh << "    \".incbin \\\"rect_polar_lut.bin\\\", " << dir[t].offset << ", " << dir[t].size << "\\n\"\n";
+    }
+    fh << "    \".popsection\\n\"\n";
+    fh << ");\n";
     fh.close();
-    return 0;
+    return fh.fail() ? -1 : 0;
 }
 
-int main() {
+// gen_lookup_table [--blob]
+// checks the constexpr tables against libm and writes rect_polar_lut.bin,
+// --blob also writes rect_polar_lut_blob.inc
+int main( int argc, char **argv ) {
+    bool blob = ( argc > 1 ) && ( std::string( argv[1] ) == "--blob" );
     std::cout << "Building Polar/Rect 8-bit lookup tables\n";
     populate_polar2rect_lut();
+    populate_polar2rect_q15();
     std::cout << "Building Rect/Polar 8-bit lookup tables\n";
     populate_rect2polar_lut();
-    std::cout << "Running validation tests..\n";
-    if ( run_test() != 0 ) {
-        std::cout << "Test Failed, run aborted..\n";
-        std::exit(-1);
-    } else {
-        std::cout << "All Tests Passed..\n";
-    }
-    // write results to output files
-    std::cout << "Writing output to rect_polar_lut.cpp\n";
-    if ( write_c_file() != 0 ) {
+    populate_rect2polar_octant_lut();
+    populate_rect2mag_nra_lut();
+    populate_rect_u8_2_polar_lut();
+    if ( write_bin_file() != 0 ) {
         std::cout << "Failed to write output file, exit...\n";
         return -1;
     } else {
-        std::cout << "Finished writing output source file..\n";
+        std::cout << "Finished writing output table file..\n";
     }
-    if ( write_h_file() != 0 ) {
-        std::cout << "Failed to write output file, exit...\n";
-        return -1;
-    } else {
-        std::cout << "Finished writing output header file..\n";
+    if ( blob ) {
+        if ( write_blob_file() != 0 ) {
+            std::cout << "Failed to write output file, exit...\n";
+            return -1;
+        } else {
+            std::cout << "Finished writing output blob include file..\n";
+        }
     }
     return 0;
 }
-    
-
@@ -0,0 +1,231 @@
+/* AVX2 rect/polar block conversions
+   16 samples per iteration, quadrants folded with sign masks and the
+   vectors fetched from rect_2_polar_lut/polar_2_rect_lut with gathers.
+*/
+#include <cstdint>
+#include <immintrin.h>
+#include "rect_polar_simd.hpp"
+
+// convert 8 samples held as zero extended 16-bit words (x low byte, y high byte)
+// returns the 8 polar_vectors as 16-bit words (mag low byte, nra high byte)
+static inline __m256i r2p_8( __m256i v ) {
+    const int *lut = (const int *)rect_2_polar_lut;
+    // sign extend x,y to 32 bits
+    __m256i x = _mm256_srai_epi32( _mm256_slli_epi32( v, 24 ), 24 );
+    __m256i y = _mm256_srai_epi32( _mm256_slli_epi32( v, 16 ), 24 );
+    // fold lower half plane (and negative x axis) up by 180 degrees
+    __m256i s = _mm256_srai_epi32( _mm256_add_epi32( _mm256_slli_epi32( y, 8 ), x ), 31 );
+    x = _mm256_sub_epi32( _mm256_xor_si256( x, s ), s );
+    y = _mm256_sub_epi32( _mm256_xor_si256( y, s ), s );
+    // fold second quad into the first by 90 degrees, (x,y) => (y,-x)
+    __m256i m = _mm256_srai_epi32( x, 31 );
+    __m256i fx = _mm256_blendv_epi8( x, y, m );
+    __m256i fy = _mm256_blendv_epi8( y, _mm256_sub_epi32( _mm256_setzero_si256(), x ), m );
+    // rows are 130 entries, fx*130 + fy as fx*128 + fx*2 + fy
+    __m256i idx = _mm256_add_epi32( _mm256_add_epi32( _mm256_slli_epi32( fx, 7 ), _mm256_slli_epi32( fx, 1 ) ), fy );
+    // 32-bit gather at the entry, the row padding keeps the upper half of
+    // the read inside the table
+    __m256i w = _mm256_i32gather_epi32( lut, idx, 2 );
+    // nra offset, 128 for the 180 degree fold, 64 for the 90 degree fold
+    __m256i off = _mm256_or_si256( _mm256_and_si256( s, _mm256_set1_epi32( 0x8000 ) ),
+                                   _mm256_and_si256( m, _mm256_set1_epi32( 0x4000 ) ) );
+    w = _mm256_add_epi32( w, off );
+    return _mm256_and_si256( w, _mm256_set1_epi32( 0xffff ) );
+}
+
+void convert_rect_2_polar_block_avx2( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        __m256i in = _mm256_loadu_si256( (const __m256i *)( rv + i ) );
+        __m256i lo = r2p_8( _mm256_cvtepu16_epi32( _mm256_castsi256_si128( in ) ) );
+        __m256i hi = r2p_8( _mm256_cvtepu16_epi32( _mm256_extracti128_si256( in, 1 ) ) );
+        // pack works per 128-bit lane, put the 64-bit quarters back in order
+        __m256i out = _mm256_permute4x64_epi64( _mm256_packus_epi32( lo, hi ), 0xd8 );
+        _mm256_storeu_si256( (__m256i *)( pv + i ), out );
+    }
+    // finish the tail with the scalar kernel
+    convert_rect_2_polar_block_scalar( rv + i, pv + i, n - i );
+}
+
+// offset binary version of r2p_8(), v holds raw i low byte, q high byte
+static inline __m256i u8_8( __m256i v ) {
+    const int *lut = (const int *)rect_u8_2_polar_lut;
+    __m256i i = _mm256_and_si256( v, _mm256_set1_epi32( 0xff ) );
+    __m256i q = _mm256_srli_epi32( v, 8 );
+    // px,py all ones for the positive half, a,b are raw-128 or 127-raw
+    __m256i px = _mm256_srai_epi32( _mm256_slli_epi32( i, 24 ), 31 );
+    __m256i py = _mm256_srai_epi32( _mm256_slli_epi32( q, 24 ), 31 );
+    __m256i a = _mm256_andnot_si256( px, _mm256_xor_si256( i, _mm256_set1_epi32( 127 ) ) );
+    a = _mm256_and_si256( _mm256_xor_si256( a, _mm256_and_si256( px, i ) ), _mm256_set1_epi32( 127 ) );
+    __m256i b = _mm256_andnot_si256( py, _mm256_xor_si256( q, _mm256_set1_epi32( 127 ) ) );
+    b = _mm256_and_si256( _mm256_xor_si256( b, _mm256_and_si256( py, q ) ), _mm256_set1_epi32( 127 ) );
+    // quads 2,4 swap a and b
+    __m256i m = _mm256_xor_si256( px, py );
+    __m256i idx = _mm256_add_epi32( _mm256_slli_epi32( _mm256_blendv_epi8( a, b, m ), 7 ),
+                                    _mm256_blendv_epi8( b, a, m ) );
+    // aligned pair gather as in p2r_8()
+    __m256i w = _mm256_i32gather_epi32( lut, _mm256_srli_epi32( idx, 1 ), 4 );
+    __m256i odd = _mm256_slli_epi32( _mm256_and_si256( idx, _mm256_set1_epi32( 1 ) ), 4 );
+    w = _mm256_srlv_epi32( w, odd );
+    __m256i off = _mm256_or_si256( _mm256_andnot_si256( py, _mm256_set1_epi32( 0x8000 ) ),
+                                   _mm256_and_si256( m, _mm256_set1_epi32( 0x4000 ) ) );
+    w = _mm256_add_epi32( w, off );
+    return _mm256_and_si256( w, _mm256_set1_epi32( 0xffff ) );
+}
+
+void convert_rect_u8_2_polar_block_avx2( const uint8_t *iq, polar_vector *pv, size_t n ) {
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        __m256i in = _mm256_loadu_si256( (const __m256i *)( iq + 2*i ) );
+        __m256i lo = u8_8( _mm256_cvtepu16_epi32( _mm256_castsi256_si128( in ) ) );
+        __m256i hi = u8_8( _mm256_cvtepu16_epi32( _mm256_extracti128_si256( in, 1 ) ) );
+        __m256i out = _mm256_permute4x64_epi64( _mm256_packus_epi32( lo, hi ), 0xd8 );
+        _mm256_storeu_si256( (__m256i *)( pv + i ), out );
+    }
+    convert_rect_u8_2_polar_block_scalar( iq + 2*i, pv + i, n - i );
+}
+
+// convert 8 samples held as zero extended 16-bit words (mag low byte, nra high byte)
+// returns the 8 rect_vectors as 16-bit words (x low byte, y high byte)
+static inline __m256i p2r_8( __m256i v ) {
+    const int *lut = (const int *)polar_2_rect_lut;
+    __m256i nra = _mm256_srli_epi32( v, 8 );
+    __m256i idx = _mm256_add_epi32( _mm256_slli_epi32( _mm256_and_si256( v, _mm256_set1_epi32( 0xff ) ), 6 ),
+                                    _mm256_and_si256( nra, _mm256_set1_epi32( 63 ) ) );
+    // gather the aligned pair of entries holding idx so the read never
+    // leaves the table, then shift the wanted entry down for odd idx
+    __m256i w = _mm256_i32gather_epi32( lut, _mm256_srli_epi32( idx, 1 ), 4 );
+    __m256i odd = _mm256_slli_epi32( _mm256_and_si256( idx, _mm256_set1_epi32( 1 ) ), 4 );
+    w = _mm256_srlv_epi32( w, odd );
+    __m256i x = _mm256_srai_epi32( _mm256_slli_epi32( w, 24 ), 24 );
+    __m256i y = _mm256_srai_epi32( _mm256_slli_epi32( w, 16 ), 24 );
+    // quads 3,4 are quads 1,2 negated, nra bit 7
+    __m256i s = _mm256_srai_epi32( _mm256_slli_epi32( nra, 24 ), 31 );
+    x = _mm256_sub_epi32( _mm256_xor_si256( x, s ), s );
+    y = _mm256_sub_epi32( _mm256_xor_si256( y, s ), s );
+    // quads 2,4 are rotated by another 90 degrees, (x,y) => (-y,x), nra bit 6
+    __m256i m = _mm256_srai_epi32( _mm256_slli_epi32( nra, 25 ), 31 );
+    __m256i rx = _mm256_blendv_epi8( x, _mm256_sub_epi32( _mm256_setzero_si256(), y ), m );
+    __m256i ry = _mm256_blendv_epi8( y, x, m );
+    return _mm256_or_si256( _mm256_and_si256( rx, _mm256_set1_epi32( 0xff ) ),
+                            _mm256_slli_epi32( _mm256_and_si256( ry, _mm256_set1_epi32( 0xff ) ), 8 ) );
+}
+
+void convert_polar_2_rect_block_avx2( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        __m256i in = _mm256_loadu_si256( (const __m256i *)( pv + i ) );
+        __m256i lo = p2r_8( _mm256_cvtepu16_epi32( _mm256_castsi256_si128( in ) ) );
+        __m256i hi = p2r_8( _mm256_cvtepu16_epi32( _mm256_extracti128_si256( in, 1 ) ) );
+        __m256i out = _mm256_permute4x64_epi64( _mm256_packus_epi32( lo, hi ), 0xd8 );
+        _mm256_storeu_si256( (__m256i *)( rv + i ), out );
+    }
+    convert_polar_2_rect_block_scalar( pv + i, rv + i, n - i );
+}
+
+// Q15 cos/sin slices packed as cos | sin << 16, one gather fetches both
+struct q15_pairs {
+    int cos_sin[64];
+    q15_pairs() {
+        for ( int i=0; i < 64; i++ ) {
+            cos_sin[i] = polar_2_rect_cos_q15[i] | ( polar_2_rect_sin_q15[i] << 16 );
+        }
+    }
+};
+
+// same as p2r_8() but x,y come from a multiply by the Q15 slices
+static inline __m256i p2r_sine_8( __m256i v, const int *cos_sin ) {
+    __m256i nra = _mm256_srli_epi32( v, 8 );
+    __m256i c = _mm256_i32gather_epi32( cos_sin, _mm256_and_si256( nra, _mm256_set1_epi32( 63 ) ), 4 );
+    // 2*mag in both 16-bit halves, mulhi gives (mag*cos) >> 15 | ((mag*sin) >> 15) << 16
+    __m256i mag2 = _mm256_slli_epi32( _mm256_and_si256( v, _mm256_set1_epi32( 0xff ) ), 1 );
+    mag2 = _mm256_or_si256( mag2, _mm256_slli_epi32( mag2, 16 ) );
+    __m256i w = _mm256_min_epu16( _mm256_mulhi_epu16( mag2, c ), _mm256_set1_epi16( 127 ) );
+    __m256i x = _mm256_and_si256( w, _mm256_set1_epi32( 0xffff ) );
+    __m256i y = _mm256_srli_epi32( w, 16 );
+    __m256i s = _mm256_srai_epi32( _mm256_slli_epi32( nra, 24 ), 31 );
+    x = _mm256_sub_epi32( _mm256_xor_si256( x, s ), s );
+    y = _mm256_sub_epi32( _mm256_xor_si256( y, s ), s );
+    __m256i m = _mm256_srai_epi32( _mm256_slli_epi32( nra, 25 ), 31 );
+    __m256i rx = _mm256_blendv_epi8( x, _mm256_sub_epi32( _mm256_setzero_si256(), y ), m );
+    __m256i ry = _mm256_blendv_epi8( y, x, m );
+    return _mm256_or_si256( _mm256_and_si256( rx, _mm256_set1_epi32( 0xff ) ),
+                            _mm256_slli_epi32( _mm256_and_si256( ry, _mm256_set1_epi32( 0xff ) ), 8 ) );
+}
+
+void convert_polar_2_rect_block_sine_avx2( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    static const q15_pairs q15;
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        __m256i in = _mm256_loadu_si256( (const __m256i *)( pv + i ) );
+        __m256i lo = p2r_sine_8( _mm256_cvtepu16_epi32( _mm256_castsi256_si128( in ) ), q15.cos_sin );
+        __m256i hi = p2r_sine_8( _mm256_cvtepu16_epi32( _mm256_extracti128_si256( in, 1 ) ), q15.cos_sin );
+        __m256i out = _mm256_permute4x64_epi64( _mm256_packus_epi32( lo, hi ), 0xd8 );
+        _mm256_storeu_si256( (__m256i *)( rv + i ), out );
+    }
+    convert_polar_2_rect_block_sine( pv + i, rv + i, n - i );
+}
+
+// planar versions, x[],y[] <=> mag[],nra[], built on the same 8 lane helpers
+
+void convert_rect_2_polar_planar_avx2( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n ) {
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        // interleave to x | y << 8 words for r2p_8()
+        __m128i xi = _mm_loadu_si128( (const __m128i *)( x + i ) );
+        __m128i yi = _mm_loadu_si128( (const __m128i *)( y + i ) );
+        __m256i v0 = _mm256_cvtepu16_epi32( _mm_unpacklo_epi8( xi, yi ) );
+        __m256i v1 = _mm256_cvtepu16_epi32( _mm_unpackhi_epi8( xi, yi ) );
+        __m256i w = _mm256_permute4x64_epi64( _mm256_packus_epi32( r2p_8( v0 ), r2p_8( v1 ) ), 0xd8 );
+        // split mag | nra << 8 words back into bytes
+        __m256i lo = _mm256_and_si256( w, _mm256_set1_epi16( 0xff ) );
+        __m256i hi = _mm256_srli_epi16( w, 8 );
+        __m256i b = _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xd8 );
+        _mm_storeu_si128( (__m128i *)( mag + i ), _mm256_castsi256_si128( b ) );
+        _mm_storeu_si128( (__m128i *)( nra + i ), _mm256_extracti128_si256( b, 1 ) );
+    }
+    convert_rect_2_polar_planar_scalar( x + i, y + i, mag + i, nra + i, n - i );
+}
+
+void convert_polar_2_rect_planar_avx2( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n ) {
+    static const q15_pairs q15;
+    size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        __m128i mi = _mm_loadu_si128( (const __m128i *)( mag + i ) );
+        __m128i ni = _mm_loadu_si128( (const __m128i *)( nra + i ) );
+        __m256i v0 = _mm256_cvtepu16_epi32( _mm_unpacklo_epi8( mi, ni ) );
+        __m256i v1 = _mm256_cvtepu16_epi32( _mm_unpackhi_epi8( mi, ni ) );
+        __m256i w = _mm256_permute4x64_epi64( _mm256_packus_epi32( p2r_sine_8( v0, q15.cos_sin ),
+                                                                   p2r_sine_8( v1, q15.cos_sin ) ), 0xd8 );
+        __m256i lo = _mm256_and_si256( w, _mm256_set1_epi16( 0xff ) );
+        __m256i hi = _mm256_srli_epi16( w, 8 );
+        __m256i b = _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xd8 );
+        _mm_storeu_si128( (__m128i *)( x + i ), _mm256_castsi256_si128( b ) );
+        _mm_storeu_si128( (__m128i *)( y + i ), _mm256_extracti128_si256( b, 1 ) );
+    }
+    convert_polar_2_rect_planar_scalar( mag + i, nra + i, x + i, y + i, n - i );
+}
+
+// channel interleaved input.  With no padding between frames the input is one
+// contiguous block, so convert a chunk of it into an L1 buffer and deal the
+// results out per channel from there.
+void convert_rect_2_polar_channels_avx2( const rect_vector *rv, size_t channels, size_t stride,
+                                         polar_vector *const *pv, size_t n ) {
+    const size_t chunk = 1024;
+    if (( channels == 0 ) || ( stride != channels ) || ( channels > chunk )) {
+        convert_rect_2_polar_channels_scalar( rv, channels, stride, pv, n );
+        return;
+    }
+    polar_vector tmp[chunk];
+    size_t frames = chunk / channels;
+    for ( size_t t=0; t < n; t += frames ) {
+        size_t f = ( n - t < frames ) ? n - t : frames;
+        convert_rect_2_polar_block_avx2( rv + t*channels, tmp, f*channels );
+        for ( size_t c=0; c < channels; c++ ) {
+            polar_vector *out = pv[c] + t;
+            for ( size_t i=0; i < f; i++ ) {
+                out[i] = tmp[ i*channels + c ];
+            }
+        }
+    }
+}
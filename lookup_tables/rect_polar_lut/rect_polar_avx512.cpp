@@ -0,0 +1,107 @@
+/* AVX-512 VBMI polar to rect block conversion
+   64 samples per iteration with no table reads in the loop.  The Q15
+   cos/sin slices (64 entries of 16 bits each) are split into low and high
+   byte registers once per call, vpermb then looks up all 64 nra at once and
+   x,y come from a 16-bit multiply by mag, which reproduces
+   polar_2_rect_lut exactly.
+*/
+#include <cstdint>
+#include <immintrin.h>
+#include "rect_polar_simd.hpp"
+
+// byte shuffles between interleaved {a,b} pairs and planar a[],b[]
+// indices 64:127 select from the second operand of vpermt2b
+struct vbmi_shuffles {
+    __m512i even, odd, ilv_lo, ilv_hi;
+    vbmi_shuffles() {
+        alignas(64) uint8_t e[64], o[64], lo[64], hi[64];
+        for ( int i=0; i < 64; i++ ) {
+            e[i] = 2*i;
+            o[i] = 2*i + 1;
+            lo[i] = ( i & 1 ) ? 64 + i/2 : i/2;
+            hi[i] = ( i & 1 ) ? 96 + i/2 : 32 + i/2;
+        }
+        even = _mm512_load_si512( e );
+        odd = _mm512_load_si512( o );
+        ilv_lo = _mm512_load_si512( lo );
+        ilv_hi = _mm512_load_si512( hi );
+    }
+};
+
+// min( (mag*c) >> 15, 127 ) for 64 byte lanes, c split in low/high bytes
+static inline __m512i mul_q15( __m512i mag, __m512i c_lo, __m512i c_hi ) {
+    const __m512i zero = _mm512_setzero_si512();
+    // unpack and pack both work per 128-bit lane, so lane order survives
+    __m512i m0 = _mm512_slli_epi16( _mm512_unpacklo_epi8( mag, zero ), 1 );
+    __m512i m1 = _mm512_slli_epi16( _mm512_unpackhi_epi8( mag, zero ), 1 );
+    __m512i p0 = _mm512_mulhi_epu16( m0, _mm512_unpacklo_epi8( c_lo, c_hi ) );
+    __m512i p1 = _mm512_mulhi_epu16( m1, _mm512_unpackhi_epi8( c_lo, c_hi ) );
+    return _mm512_min_epu8( _mm512_packus_epi16( p0, p1 ), _mm512_set1_epi8( 127 ) );
+}
+
+// the Q15 slices split into low and high byte registers
+struct q15_slices {
+    __m512i cos_lo, cos_hi, sin_lo, sin_hi;
+    q15_slices( const vbmi_shuffles &sh ) {
+        __m512i c0 = _mm512_loadu_si512( polar_2_rect_cos_q15 );
+        __m512i c1 = _mm512_loadu_si512( polar_2_rect_cos_q15 + 32 );
+        __m512i s0 = _mm512_loadu_si512( polar_2_rect_sin_q15 );
+        __m512i s1 = _mm512_loadu_si512( polar_2_rect_sin_q15 + 32 );
+        cos_lo = _mm512_permutex2var_epi8( c0, sh.even, c1 );
+        cos_hi = _mm512_permutex2var_epi8( c0, sh.odd, c1 );
+        sin_lo = _mm512_permutex2var_epi8( s0, sh.even, s1 );
+        sin_hi = _mm512_permutex2var_epi8( s0, sh.odd, s1 );
+    }
+};
+
+// convert 64 planar mag,nra byte lanes to x,y byte lanes
+static inline void p2r_64( const q15_slices &q, __m512i mag, __m512i nra, __m512i &rx, __m512i &ry ) {
+    const __m512i zero = _mm512_setzero_si512();
+    // vpermb only looks at the low 6 bits of nra
+    __m512i x = mul_q15( mag, _mm512_permutexvar_epi8( nra, q.cos_lo ), _mm512_permutexvar_epi8( nra, q.cos_hi ) );
+    __m512i y = mul_q15( mag, _mm512_permutexvar_epi8( nra, q.sin_lo ), _mm512_permutexvar_epi8( nra, q.sin_hi ) );
+    // quads 3,4 are quads 1,2 negated
+    __mmask64 neg = _mm512_test_epi8_mask( nra, _mm512_set1_epi8( (char)0x80 ) );
+    x = _mm512_mask_sub_epi8( x, neg, zero, x );
+    y = _mm512_mask_sub_epi8( y, neg, zero, y );
+    // quads 2,4 are rotated by another 90 degrees, (x,y) => (-y,x)
+    __mmask64 rot = _mm512_test_epi8_mask( nra, _mm512_set1_epi8( 0x40 ) );
+    rx = _mm512_mask_sub_epi8( x, rot, zero, y );
+    ry = _mm512_mask_mov_epi8( y, rot, x );
+}
+
+// mask of the first n (up to 64) byte lanes
+static inline __mmask64 lane_mask( size_t n ) {
+    return ( n >= 64 ) ? ~(__mmask64)0 : ( (__mmask64)1 << n ) - 1;
+}
+
+void convert_polar_2_rect_block_avx512vbmi( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    static const vbmi_shuffles sh;
+    // register resident slices
+    const q15_slices q( sh );
+    for ( size_t i=0; i < n; i += 64 ) {
+        // byte masks for the 128 bytes of this block, partial on the tail
+        size_t bytes = ( n - i < 64 ) ? 2*( n - i ) : 128;
+        __mmask64 k0 = lane_mask( bytes );
+        __mmask64 k1 = ( bytes > 64 ) ? lane_mask( bytes - 64 ) : 0;
+        __m512i in0 = _mm512_maskz_loadu_epi8( k0, pv + i );
+        __m512i in1 = _mm512_maskz_loadu_epi8( k1, pv + i + 32 );
+        __m512i rx, ry;
+        p2r_64( q, _mm512_permutex2var_epi8( in0, sh.even, in1 ), _mm512_permutex2var_epi8( in0, sh.odd, in1 ), rx, ry );
+        _mm512_mask_storeu_epi8( rv + i, k0, _mm512_permutex2var_epi8( rx, sh.ilv_lo, ry ) );
+        _mm512_mask_storeu_epi8( rv + i + 32, k1, _mm512_permutex2var_epi8( rx, sh.ilv_hi, ry ) );
+    }
+}
+
+// planar version, no interleaving needed at all
+void convert_polar_2_rect_planar_avx512vbmi( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n ) {
+    static const vbmi_shuffles sh;
+    const q15_slices q( sh );
+    for ( size_t i=0; i < n; i += 64 ) {
+        __mmask64 k = lane_mask( n - i );
+        __m512i rx, ry;
+        p2r_64( q, _mm512_maskz_loadu_epi8( k, mag + i ), _mm512_maskz_loadu_epi8( k, nra + i ), rx, ry );
+        _mm512_mask_storeu_epi8( x + i, k, rx );
+        _mm512_mask_storeu_epi8( y + i, k, ry );
+    }
+}
@@ -0,0 +1,134 @@
+/* Runtime selection of the block lookup kernels
+   Kernels are listed best first, the first one the cpu supports is picked
+   on first use and every later call goes straight to it.
+*/
+#include "rect_polar_simd.hpp"
+
+typedef void (*r2p_func)( const rect_vector *rv, polar_vector *pv, size_t n );
+typedef void (*p2r_func)( const polar_vector *pv, rect_vector *rv, size_t n );
+typedef void (*r2p_channels_func)( const rect_vector *rv, size_t channels, size_t stride,
+                                   polar_vector *const *pv, size_t n );
+typedef void (*u8_func)( const uint8_t *iq, polar_vector *pv, size_t n );
+typedef void (*r2p_planar_func)( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n );
+typedef void (*p2r_planar_func)( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+
+// cpu feature checks, __builtin_cpu_supports also checks the OS saves the registers
+static bool cpu_any() { return true; }
+static bool cpu_avx2() { return __builtin_cpu_supports( "avx2" ); }
+static bool cpu_avx512vbmi() {
+    return __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512bw" ) &&
+           __builtin_cpu_supports( "avx512vbmi" );
+}
+
+template <typename F>
+struct kernel {
+    const char *name;
+    bool (*supported)();
+    F func;
+};
+
+static const kernel<r2p_func> r2p_kernels[] = {
+    { "avx2", cpu_avx2, convert_rect_2_polar_block_avx2 },
+    { "scalar", cpu_any, convert_rect_2_polar_block_scalar }
+};
+
+static const kernel<p2r_func> p2r_kernels[] = {
+    { "avx512vbmi", cpu_avx512vbmi, convert_polar_2_rect_block_avx512vbmi },
+    { "avx2_sine", cpu_avx2, convert_polar_2_rect_block_sine_avx2 },
+    { "scalar", cpu_any, convert_polar_2_rect_block_scalar }
+};
+
+static const kernel<r2p_planar_func> r2p_planar_kernels[] = {
+    { "avx2", cpu_avx2, convert_rect_2_polar_planar_avx2 },
+    { "scalar", cpu_any, convert_rect_2_polar_planar_scalar }
+};
+
+static const kernel<p2r_planar_func> p2r_planar_kernels[] = {
+    { "avx512vbmi", cpu_avx512vbmi, convert_polar_2_rect_planar_avx512vbmi },
+    { "avx2_sine", cpu_avx2, convert_polar_2_rect_planar_avx2 },
+    { "scalar", cpu_any, convert_polar_2_rect_planar_scalar }
+};
+
+static const kernel<r2p_channels_func> r2p_channels_kernels[] = {
+    { "avx2", cpu_avx2, convert_rect_2_polar_channels_avx2 },
+    { "scalar", cpu_any, convert_rect_2_polar_channels_scalar }
+};
+
+static const kernel<u8_func> u8_kernels[] = {
+    { "avx2", cpu_avx2, convert_rect_u8_2_polar_block_avx2 },
+    { "scalar", cpu_any, convert_rect_u8_2_polar_block_scalar }
+};
+
+// first supported kernel, the list always ends with the scalar one
+template <typename F>
+static const kernel<F> *pick( const kernel<F> *k ) {
+    __builtin_cpu_init();
+    while ( ! k->supported() ) {
+        k++;
+    }
+    return k;
+}
+
+// picked once, function local statics are thread safe to initialize
+static const kernel<r2p_func> *r2p_kernel() {
+    static const kernel<r2p_func> *k = pick( r2p_kernels );
+    return k;
+}
+
+static const kernel<p2r_func> *p2r_kernel() {
+    static const kernel<p2r_func> *k = pick( p2r_kernels );
+    return k;
+}
+
+static const kernel<r2p_planar_func> *r2p_planar_kernel() {
+    static const kernel<r2p_planar_func> *k = pick( r2p_planar_kernels );
+    return k;
+}
+
+static const kernel<p2r_planar_func> *p2r_planar_kernel() {
+    static const kernel<p2r_planar_func> *k = pick( p2r_planar_kernels );
+    return k;
+}
+
+static const kernel<r2p_channels_func> *r2p_channels_kernel() {
+    static const kernel<r2p_channels_func> *k = pick( r2p_channels_kernels );
+    return k;
+}
+
+static const kernel<u8_func> *u8_kernel() {
+    static const kernel<u8_func> *k = pick( u8_kernels );
+    return k;
+}
+
+void convert_rect_2_polar_block( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    r2p_kernel()->func( rv, pv, n );
+}
+
+void convert_polar_2_rect_block( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    p2r_kernel()->func( pv, rv, n );
+}
+
+void convert_rect_2_polar_planar( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n ) {
+    r2p_planar_kernel()->func( x, y, mag, nra, n );
+}
+
+void convert_polar_2_rect_planar( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n ) {
+    p2r_planar_kernel()->func( mag, nra, x, y, n );
+}
+
+void convert_rect_2_polar_channels( const rect_vector *rv, size_t channels, size_t stride,
+                                    polar_vector *const *pv, size_t n ) {
+    r2p_channels_kernel()->func( rv, channels, stride, pv, n );
+}
+
+void convert_rect_u8_2_polar_block( const uint8_t *iq, polar_vector *pv, size_t n ) {
+    u8_kernel()->func( iq, pv, n );
+}
+
+const char *rect_2_polar_kernel_name() {
+    return r2p_kernel()->name;
+}
+
+const char *polar_2_rect_kernel_name() {
+    return p2r_kernel()->name;
+}
@@ -0,0 +1,137 @@
+#ifndef __RECT_POLAR_INLINE_HPP
+#define __RECT_POLAR_INLINE_HPP
+
+/* Inline versions of the per sample lookups, same results as the out of
+   line convert_*() functions.  The tables stay in rect_polar_lut.cpp, so
+   link with it as usual, e.g.
+     for ( size_t i=0; i < n; i++ ) {
+         pv[i] = convert_rect_2_polar_inline( rv[i] );
+     }
+   and the compiler is free to unroll and vectorize the loop around them.
+*/
+#include "rect_polar_lut.hpp"
+
+// polar to rect, the quadrant is resolved with selects rather than branches
+// and polar_2_rect_lut has a row for every mag, so there is nothing to check
+inline rect_vector convert_polar_2_rect_inline( polar_vector pv ) noexcept {
+    int quad = pv.nra >> 6;
+    rect_vector t = polar_2_rect_lut[pv.mag][pv.nra & 63];
+    // quads 3,4 are quads 1,2 negated
+    int s = -(quad >> 1);
+    int x = (t.x ^ s) - s;
+    int y = (t.y ^ s) - s;
+    // quads 2,4 are rotated by another 90 degrees, (x,y) => (-y,x)
+    int m = -(quad & 1);
+    rect_vector rv;
+    rv.x = ( x & ~m ) | ( -y & m );
+    rv.y = ( y & ~m ) | ( x & m );
+    return rv;
+}
+
+// rect to polar with the quads folded by sign masks rather than branches,
+// x or y = -128 fold onto row/column 128 so every input is valid
+inline polar_vector convert_rect_2_polar_inline( rect_vector rv ) noexcept {
+    int x = rv.x;
+    int y = rv.y;
+    // fold lower half plane (and negative x axis) up by 180 degrees
+    // y*256+x is negative exactly there, sign bit is taken with shifts
+    // so no compares/setcc land in the loop
+    int s = ( y*256 + x ) >> 31;
+    int h = -s;
+    x = (x ^ s) - s;
+    y = (y ^ s) - s;
+    // fold second quad into the first by 90 degrees, (x,y) => (y,-x)
+    int m = x >> 31;
+    int r = -m;
+    int fx = ( x & ~m ) | ( y & m );
+    int fy = ( y & ~m ) | ( -x & m );
+    polar_vector t = rect_2_polar_lut[fx][fy];
+    t.nra += ( h << 7 ) | ( r << 6 );
+    return t;
+}
+
+// offset binary I/Q to polar, raw bytes i,q stand for i-127.5, q-127.5
+inline polar_vector convert_rect_u8_2_polar_inline( uint8_t i, uint8_t q ) noexcept {
+    // px,py are 1 for the positive half (raw byte >= 128)
+    int px = i >> 7;
+    int py = q >> 7;
+    // distance from the centre minus 0.5, raw-128 or 127-raw
+    int a = ( i ^ ( px - 1 ) ) & 127;
+    int b = ( q ^ ( py - 1 ) ) & 127;
+    // quads 2,4 are rotated into the first, so a and b swap places
+    int m = -( px ^ py );
+    int fa = ( a & ~m ) | ( b & m );
+    int fb = ( b & ~m ) | ( a & m );
+    polar_vector pv = rect_u8_2_polar_lut[fa][fb];
+    pv.nra += ( ( 1 - py ) << 7 ) | ( ( px ^ py ) << 6 );
+    return pv;
+}
+
+// rect to polar using the first octant table, no branches
+inline polar_vector convert_rect_2_polar_octant_inline( rect_vector rv ) noexcept {
+    int x = rv.x;
+    int y = rv.y;
+    // same half plane and quad folds as convert_rect_2_polar_block_scalar()
+    int s = ( y*256 + x ) >> 31;
+    x = (x ^ s) - s;
+    y = (y ^ s) - s;
+    int m = x >> 31;
+    int fx = ( x & ~m ) | ( y & m );
+    int fy = ( y & ~m ) | ( -x & m );
+    // fold the second octant onto the first, (x,y) => (y,x) and nra => 64-nra
+    int o = ( fx - fy ) >> 31;
+    int hi = ( fx & ~o ) | ( fy & o );
+    int lo = ( fy & ~o ) | ( fx & o );
+    polar_vector pv = rect_2_polar_octant_lut[ ( ( hi*(hi+1) ) >> 1 ) + lo ];
+    int nra = ( pv.nra ^ o ) - o;
+    pv.nra = nra + ( 64 & o ) + ( 128 & s ) + ( 64 & m );
+    return pv;
+}
+
+// polar to rect from the Q15 cos/sin slices instead of polar_2_rect_lut,
+// a multiply per axis reproduces the table exactly
+inline rect_vector convert_polar_2_rect_sine_inline( polar_vector pv ) noexcept {
+    int quad = pv.nra >> 6;
+    int nra = pv.nra & 63;
+    int x = ( pv.mag * polar_2_rect_cos_q15[nra] ) >> 15;
+    int y = ( pv.mag * polar_2_rect_sin_q15[nra] ) >> 15;
+    // saturate as the table does for x,y over 127
+    x = ( x < 127 ) ? x : 127;
+    y = ( y < 127 ) ? y : 127;
+    // same quad rotation as convert_polar_2_rect_block_scalar()
+    int s = -(quad >> 1);
+    x = (x ^ s) - s;
+    y = (y ^ s) - s;
+    int m = -(quad & 1);
+    rect_vector rv;
+    rv.x = ( x & ~m ) | ( -y & m );
+    rv.y = ( y & ~m ) | ( x & m );
+    return rv;
+}
+
+// magnitude only lookup, mag is the same in every quad so |x|,|y| index it
+inline uint8_t convert_rect_2_mag_inline( rect_vector rv ) noexcept {
+    int x = rv.x;
+    int y = rv.y;
+    int sx = x >> 31;
+    int sy = y >> 31;
+    return rect_2_mag_lut[ (x ^ sx) - sx ][ (y ^ sy) - sy ];
+}
+
+// angle only lookup, same folds as convert_rect_2_polar_block_scalar()
+inline uint8_t convert_rect_2_nra_inline( rect_vector rv ) noexcept {
+    int x = rv.x;
+    int y = rv.y;
+    int s = ( y*256 + x ) >> 31;
+    x = (x ^ s) - s;
+    y = (y ^ s) - s;
+    int m = x >> 31;
+    int fx = ( x & ~m ) | ( y & m );
+    int fy = ( y & ~m ) | ( -x & m );
+    return rect_2_nra_lut[fx][fy] + ( ( 128 & s ) | ( 64 & m ) );
+}
+
+#endif
+
+//EOF
+
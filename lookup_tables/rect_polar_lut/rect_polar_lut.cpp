@@ -2,4192 +2,116 @@
 */
 #include <cstdint>
 #include "rect_polar_lut.hpp"
+#include "rect_polar_inline.hpp"
 
-/* Lookup table for Rect to Polar conversions */
-struct polar_vector rect_2_polar_lut[128][128] = 
-{ 
-  {  // mag,nra for x=0 and y=0:127
-    {  0,  0}, {  1, 64}, {  2, 64}, {  3, 64}, {  4, 64}, {  5, 64}, {  6, 64}, {  7, 64},
-    {  8, 64}, {  9, 64}, { 10, 64}, { 11, 64}, { 12, 64}, { 13, 64}, { 14, 64}, { 15, 64},
-    { 16, 64}, { 17, 64}, { 18, 64}, { 19, 64}, { 20, 64}, { 21, 64}, { 22, 64}, { 23, 64},
-    { 24, 64}, { 25, 64}, { 26, 64}, { 27, 64}, { 28, 64}, { 29, 64}, { 30, 64}, { 31, 64},
-    { 32, 64}, { 33, 64}, { 34, 64}, { 35, 64}, { 36, 64}, { 37, 64}, { 38, 64}, { 39, 64},
-    { 40, 64}, { 41, 64}, { 42, 64}, { 43, 64}, { 44, 64}, { 45, 64}, { 46, 64}, { 47, 64},
-    { 48, 64}, { 49, 64}, { 50, 64}, { 51, 64}, { 52, 64}, { 53, 64}, { 54, 64}, { 55, 64},
-    { 56, 64}, { 57, 64}, { 58, 64}, { 59, 64}, { 60, 64}, { 61, 64}, { 62, 64}, { 63, 64},
-    { 64, 64}, { 65, 64}, { 66, 64}, { 67, 64}, { 68, 64}, { 69, 64}, { 70, 64}, { 71, 64},
-    { 72, 64}, { 73, 64}, { 74, 64}, { 75, 64}, { 76, 64}, { 77, 64}, { 78, 64}, { 79, 64},
-    { 80, 64}, { 81, 64}, { 82, 64}, { 83, 64}, { 84, 64}, { 85, 64}, { 86, 64}, { 87, 64},
-    { 88, 64}, { 89, 64}, { 90, 64}, { 91, 64}, { 92, 64}, { 93, 64}, { 94, 64}, { 95, 64},
-    { 96, 64}, { 97, 64}, { 98, 64}, { 99, 64}, {100, 64}, {101, 64}, {102, 64}, {103, 64},
-    {104, 64}, {105, 64}, {106, 64}, {107, 64}, {108, 64}, {109, 64}, {110, 64}, {111, 64},
-    {112, 64}, {113, 64}, {114, 64}, {115, 64}, {116, 64}, {117, 64}, {118, 64}, {119, 64},
-    {120, 64}, {121, 64}, {122, 64}, {123, 64}, {124, 64}, {125, 64}, {126, 64}, {127, 64}
-  },
-  {  // mag,nra for x=1 and y=0:127
-    {  1,  0}, {  1, 32}, {  2, 45}, {  3, 51}, {  4, 54}, {  5, 56}, {  6, 57}, {  7, 58},
-    {  8, 59}, {  9, 59}, { 10, 60}, { 11, 60}, { 12, 61}, { 13, 61}, { 14, 61}, { 15, 61},
-    { 16, 61}, { 17, 62}, { 18, 62}, { 19, 62}, { 20, 62}, { 21, 62}, { 22, 62}, { 23, 62},
-    { 24, 62}, { 25, 62}, { 26, 62}, { 27, 62}, { 28, 63}, { 29, 63}, { 30, 63}, { 31, 63},
-    { 32, 63}, { 33, 63}, { 34, 63}, { 35, 63}, { 36, 63}, { 37, 63}, { 38, 63}, { 39, 63},
-    { 40, 63}, { 41, 63}, { 42, 63}, { 43, 63}, { 44, 63}, { 45, 63}, { 46, 63}, { 47, 63},
-    { 48, 63}, { 49, 63}, { 50, 63}, { 51, 63}, { 52, 63}, { 53, 63}, { 54, 63}, { 55, 63},
-    { 56, 63}, { 57, 63}, { 58, 63}, { 59, 63}, { 60, 63}, { 61, 63}, { 62, 63}, { 63, 63},
-    { 64, 63}, { 65, 63}, { 66, 63}, { 67, 63}, { 68, 63}, { 69, 63}, { 70, 63}, { 71, 63},
-    { 72, 63}, { 73, 63}, { 74, 63}, { 75, 63}, { 76, 63}, { 77, 63}, { 78, 63}, { 79, 63},
-    { 80, 63}, { 81, 63}, { 82, 64}, { 83, 64}, { 84, 64}, { 85, 64}, { 86, 64}, { 87, 64},
-    { 88, 64}, { 89, 64}, { 90, 64}, { 91, 64}, { 92, 64}, { 93, 64}, { 94, 64}, { 95, 64},
-    { 96, 64}, { 97, 64}, { 98, 64}, { 99, 64}, {100, 64}, {101, 64}, {102, 64}, {103, 64},
-    {104, 64}, {105, 64}, {106, 64}, {107, 64}, {108, 64}, {109, 64}, {110, 64}, {111, 64},
-    {112, 64}, {113, 64}, {114, 64}, {115, 64}, {116, 64}, {117, 64}, {118, 64}, {119, 64},
-    {120, 64}, {121, 64}, {122, 64}, {123, 64}, {124, 64}, {125, 64}, {126, 64}, {127, 64}
-  },
-  {  // mag,nra for x=2 and y=0:127
-    {  2,  0}, {  2, 19}, {  3, 32}, {  4, 40}, {  4, 45}, {  5, 48}, {  6, 51}, {  7, 53},
-    {  8, 54}, {  9, 55}, { 10, 56}, { 11, 57}, { 12, 57}, { 13, 58}, { 14, 58}, { 15, 59},
-    { 16, 59}, { 17, 59}, { 18, 59}, { 19, 60}, { 20, 60}, { 21, 60}, { 22, 60}, { 23, 60},
-    { 24, 61}, { 25, 61}, { 26, 61}, { 27, 61}, { 28, 61}, { 29, 61}, { 30, 61}, { 31, 61},
-    { 32, 61}, { 33, 62}, { 34, 62}, { 35, 62}, { 36, 62}, { 37, 62}, { 38, 62}, { 39, 62},
-    { 40, 62}, { 41, 62}, { 42, 62}, { 43, 62}, { 44, 62}, { 45, 62}, { 46, 62}, { 47, 62},
-    { 48, 62}, { 49, 62}, { 50, 62}, { 51, 62}, { 52, 62}, { 53, 62}, { 54, 62}, { 55, 63},
-    { 56, 63}, { 57, 63}, { 58, 63}, { 59, 63}, { 60, 63}, { 61, 63}, { 62, 63}, { 63, 63},
-    { 64, 63}, { 65, 63}, { 66, 63}, { 67, 63}, { 68, 63}, { 69, 63}, { 70, 63}, { 71, 63},
-    { 72, 63}, { 73, 63}, { 74, 63}, { 75, 63}, { 76, 63}, { 77, 63}, { 78, 63}, { 79, 63},
-    { 80, 63}, { 81, 63}, { 82, 63}, { 83, 63}, { 84, 63}, { 85, 63}, { 86, 63}, { 87, 63},
-    { 88, 63}, { 89, 63}, { 90, 63}, { 91, 63}, { 92, 63}, { 93, 63}, { 94, 63}, { 95, 63},
-    { 96, 63}, { 97, 63}, { 98, 63}, { 99, 63}, {100, 63}, {101, 63}, {102, 63}, {103, 63},
-    {104, 63}, {105, 63}, {106, 63}, {107, 63}, {108, 63}, {109, 63}, {110, 63}, {111, 63},
-    {112, 63}, {113, 63}, {114, 63}, {115, 63}, {116, 63}, {117, 63}, {118, 63}, {119, 63},
-    {120, 63}, {121, 63}, {122, 63}, {123, 63}, {124, 63}, {125, 63}, {126, 63}, {127, 63}
-  },
-  {  // mag,nra for x=3 and y=0:127
-    {  3,  0}, {  3, 13}, {  4, 24}, {  4, 32}, {  5, 38}, {  6, 42}, {  7, 45}, {  8, 48},
-    {  9, 49}, {  9, 51}, { 10, 52}, { 11, 53}, { 12, 54}, { 13, 55}, { 14, 55}, { 15, 56},
-    { 16, 56}, { 17, 57}, { 18, 57}, { 19, 58}, { 20, 58}, { 21, 58}, { 22, 58}, { 23, 59},
-    { 24, 59}, { 25, 59}, { 26, 59}, { 27, 59}, { 28, 60}, { 29, 60}, { 30, 60}, { 31, 60},
-    { 32, 60}, { 33, 60}, { 34, 60}, { 35, 61}, { 36, 61}, { 37, 61}, { 38, 61}, { 39, 61},
-    { 40, 61}, { 41, 61}, { 42, 61}, { 43, 61}, { 44, 61}, { 45, 61}, { 46, 61}, { 47, 61},
-    { 48, 61}, { 49, 62}, { 50, 62}, { 51, 62}, { 52, 62}, { 53, 62}, { 54, 62}, { 55, 62},
-    { 56, 62}, { 57, 62}, { 58, 62}, { 59, 62}, { 60, 62}, { 61, 62}, { 62, 62}, { 63, 62},
-    { 64, 62}, { 65, 62}, { 66, 62}, { 67, 62}, { 68, 62}, { 69, 62}, { 70, 62}, { 71, 62},
-    { 72, 62}, { 73, 62}, { 74, 62}, { 75, 62}, { 76, 62}, { 77, 62}, { 78, 62}, { 79, 62},
-    { 80, 62}, { 81, 62}, { 82, 63}, { 83, 63}, { 84, 63}, { 85, 63}, { 86, 63}, { 87, 63},
-    { 88, 63}, { 89, 63}, { 90, 63}, { 91, 63}, { 92, 63}, { 93, 63}, { 94, 63}, { 95, 63},
-    { 96, 63}, { 97, 63}, { 98, 63}, { 99, 63}, {100, 63}, {101, 63}, {102, 63}, {103, 63},
-    {104, 63}, {105, 63}, {106, 63}, {107, 63}, {108, 63}, {109, 63}, {110, 63}, {111, 63},
-    {112, 63}, {113, 63}, {114, 63}, {115, 63}, {116, 63}, {117, 63}, {118, 63}, {119, 63},
-    {120, 63}, {121, 63}, {122, 63}, {123, 63}, {124, 63}, {125, 63}, {126, 63}, {127, 63}
-  },
-  {  // mag,nra for x=4 and y=0:127
-    {  4,  0}, {  4, 10}, {  4, 19}, {  5, 26}, {  6, 32}, {  6, 37}, {  7, 40}, {  8, 43},
-    {  9, 45}, { 10, 47}, { 11, 48}, { 12, 50}, { 13, 51}, { 14, 52}, { 15, 53}, { 16, 53},
-    { 16, 54}, { 17, 55}, { 18, 55}, { 19, 56}, { 20, 56}, { 21, 56}, { 22, 57}, { 23, 57},
-    { 24, 57}, { 25, 58}, { 26, 58}, { 27, 58}, { 28, 58}, { 29, 58}, { 30, 59}, { 31, 59},
-    { 32, 59}, { 33, 59}, { 34, 59}, { 35, 59}, { 36, 59}, { 37, 60}, { 38, 60}, { 39, 60},
-    { 40, 60}, { 41, 60}, { 42, 60}, { 43, 60}, { 44, 60}, { 45, 60}, { 46, 60}, { 47, 61},
-    { 48, 61}, { 49, 61}, { 50, 61}, { 51, 61}, { 52, 61}, { 53, 61}, { 54, 61}, { 55, 61},
-    { 56, 61}, { 57, 61}, { 58, 61}, { 59, 61}, { 60, 61}, { 61, 61}, { 62, 61}, { 63, 61},
-    { 64, 61}, { 65, 61}, { 66, 62}, { 67, 62}, { 68, 62}, { 69, 62}, { 70, 62}, { 71, 62},
-    { 72, 62}, { 73, 62}, { 74, 62}, { 75, 62}, { 76, 62}, { 77, 62}, { 78, 62}, { 79, 62},
-    { 80, 62}, { 81, 62}, { 82, 62}, { 83, 62}, { 84, 62}, { 85, 62}, { 86, 62}, { 87, 62},
-    { 88, 62}, { 89, 62}, { 90, 62}, { 91, 62}, { 92, 62}, { 93, 62}, { 94, 62}, { 95, 62},
-    { 96, 62}, { 97, 62}, { 98, 62}, { 99, 62}, {100, 62}, {101, 62}, {102, 62}, {103, 62},
-    {104, 62}, {105, 62}, {106, 62}, {107, 62}, {108, 62}, {109, 63}, {110, 63}, {111, 63},
-    {112, 63}, {113, 63}, {114, 63}, {115, 63}, {116, 63}, {117, 63}, {118, 63}, {119, 63},
-    {120, 63}, {121, 63}, {122, 63}, {123, 63}, {124, 63}, {125, 63}, {126, 63}, {127, 63}
-  },
-  {  // mag,nra for x=5 and y=0:127
-    {  5,  0}, {  5,  8}, {  5, 16}, {  6, 22}, {  6, 27}, {  7, 32}, {  8, 36}, {  9, 39},
-    {  9, 41}, { 10, 43}, { 11, 45}, { 12, 47}, { 13, 48}, { 14, 49}, { 15, 50}, { 16, 51},
-    { 17, 52}, { 18, 52}, { 19, 53}, { 20, 54}, { 21, 54}, { 22, 54}, { 23, 55}, { 24, 55},
-    { 25, 56}, { 25, 56}, { 26, 56}, { 27, 57}, { 28, 57}, { 29, 57}, { 30, 57}, { 31, 57},
-    { 32, 58}, { 33, 58}, { 34, 58}, { 35, 58}, { 36, 58}, { 37, 59}, { 38, 59}, { 39, 59},
-    { 40, 59}, { 41, 59}, { 42, 59}, { 43, 59}, { 44, 59}, { 45, 59}, { 46, 60}, { 47, 60},
-    { 48, 60}, { 49, 60}, { 50, 60}, { 51, 60}, { 52, 60}, { 53, 60}, { 54, 60}, { 55, 60},
-    { 56, 60}, { 57, 60}, { 58, 60}, { 59, 61}, { 60, 61}, { 61, 61}, { 62, 61}, { 63, 61},
-    { 64, 61}, { 65, 61}, { 66, 61}, { 67, 61}, { 68, 61}, { 69, 61}, { 70, 61}, { 71, 61},
-    { 72, 61}, { 73, 61}, { 74, 61}, { 75, 61}, { 76, 61}, { 77, 61}, { 78, 61}, { 79, 61},
-    { 80, 61}, { 81, 61}, { 82, 62}, { 83, 62}, { 84, 62}, { 85, 62}, { 86, 62}, { 87, 62},
-    { 88, 62}, { 89, 62}, { 90, 62}, { 91, 62}, { 92, 62}, { 93, 62}, { 94, 62}, { 95, 62},
-    { 96, 62}, { 97, 62}, { 98, 62}, { 99, 62}, {100, 62}, {101, 62}, {102, 62}, {103, 62},
-    {104, 62}, {105, 62}, {106, 62}, {107, 62}, {108, 62}, {109, 62}, {110, 62}, {111, 62},
-    {112, 62}, {113, 62}, {114, 62}, {115, 62}, {116, 62}, {117, 62}, {118, 62}, {119, 62},
-    {120, 62}, {121, 62}, {122, 62}, {123, 62}, {124, 62}, {125, 62}, {126, 62}, {127, 62}
-  },
-  {  // mag,nra for x=6 and y=0:127
-    {  6,  0}, {  6,  7}, {  6, 13}, {  7, 19}, {  7, 24}, {  8, 28}, {  8, 32}, {  9, 35},
-    { 10, 38}, { 11, 40}, { 12, 42}, { 13, 44}, { 13, 45}, { 14, 46}, { 15, 48}, { 16, 48},
-    { 17, 49}, { 18, 50}, { 19, 51}, { 20, 52}, { 21, 52}, { 22, 53}, { 23, 53}, { 24, 54},
-    { 25, 54}, { 26, 54}, { 27, 55}, { 28, 55}, { 29, 55}, { 30, 56}, { 31, 56}, { 32, 56},
-    { 33, 56}, { 34, 57}, { 35, 57}, { 36, 57}, { 36, 57}, { 37, 57}, { 38, 58}, { 39, 58},
-    { 40, 58}, { 41, 58}, { 42, 58}, { 43, 58}, { 44, 58}, { 45, 59}, { 46, 59}, { 47, 59},
-    { 48, 59}, { 49, 59}, { 50, 59}, { 51, 59}, { 52, 59}, { 53, 59}, { 54, 59}, { 55, 60},
-    { 56, 60}, { 57, 60}, { 58, 60}, { 59, 60}, { 60, 60}, { 61, 60}, { 62, 60}, { 63, 60},
-    { 64, 60}, { 65, 60}, { 66, 60}, { 67, 60}, { 68, 60}, { 69, 60}, { 70, 61}, { 71, 61},
-    { 72, 61}, { 73, 61}, { 74, 61}, { 75, 61}, { 76, 61}, { 77, 61}, { 78, 61}, { 79, 61},
-    { 80, 61}, { 81, 61}, { 82, 61}, { 83, 61}, { 84, 61}, { 85, 61}, { 86, 61}, { 87, 61},
-    { 88, 61}, { 89, 61}, { 90, 61}, { 91, 61}, { 92, 61}, { 93, 61}, { 94, 61}, { 95, 61},
-    { 96, 61}, { 97, 61}, { 98, 62}, { 99, 62}, {100, 62}, {101, 62}, {102, 62}, {103, 62},
-    {104, 62}, {105, 62}, {106, 62}, {107, 62}, {108, 62}, {109, 62}, {110, 62}, {111, 62},
-    {112, 62}, {113, 62}, {114, 62}, {115, 62}, {116, 62}, {117, 62}, {118, 62}, {119, 62},
-    {120, 62}, {121, 62}, {122, 62}, {123, 62}, {124, 62}, {125, 62}, {126, 62}, {127, 62}
-  },
-  {  // mag,nra for x=7 and y=0:127
-    {  7,  0}, {  7,  6}, {  7, 11}, {  8, 16}, {  8, 21}, {  9, 25}, {  9, 29}, { 10, 32},
-    { 11, 35}, { 11, 37}, { 12, 39}, { 13, 41}, { 14, 42}, { 15, 44}, { 16, 45}, { 17, 46},
-    { 17, 47}, { 18, 48}, { 19, 49}, { 20, 50}, { 21, 50}, { 22, 51}, { 23, 51}, { 24, 52},
-    { 25, 52}, { 26, 53}, { 27, 53}, { 28, 54}, { 29, 54}, { 30, 54}, { 31, 55}, { 32, 55},
-    { 33, 55}, { 34, 55}, { 35, 56}, { 36, 56}, { 37, 56}, { 38, 56}, { 39, 57}, { 40, 57},
-    { 41, 57}, { 42, 57}, { 43, 57}, { 44, 57}, { 45, 58}, { 46, 58}, { 47, 58}, { 48, 58},
-    { 49, 58}, { 49, 58}, { 50, 58}, { 51, 58}, { 52, 59}, { 53, 59}, { 54, 59}, { 55, 59},
-    { 56, 59}, { 57, 59}, { 58, 59}, { 59, 59}, { 60, 59}, { 61, 59}, { 62, 59}, { 63, 59},
-    { 64, 60}, { 65, 60}, { 66, 60}, { 67, 60}, { 68, 60}, { 69, 60}, { 70, 60}, { 71, 60},
-    { 72, 60}, { 73, 60}, { 74, 60}, { 75, 60}, { 76, 60}, { 77, 60}, { 78, 60}, { 79, 60},
-    { 80, 60}, { 81, 60}, { 82, 61}, { 83, 61}, { 84, 61}, { 85, 61}, { 86, 61}, { 87, 61},
-    { 88, 61}, { 89, 61}, { 90, 61}, { 91, 61}, { 92, 61}, { 93, 61}, { 94, 61}, { 95, 61},
-    { 96, 61}, { 97, 61}, { 98, 61}, { 99, 61}, {100, 61}, {101, 61}, {102, 61}, {103, 61},
-    {104, 61}, {105, 61}, {106, 61}, {107, 61}, {108, 61}, {109, 61}, {110, 61}, {111, 61},
-    {112, 61}, {113, 61}, {114, 62}, {115, 62}, {116, 62}, {117, 62}, {118, 62}, {119, 62},
-    {120, 62}, {121, 62}, {122, 62}, {123, 62}, {124, 62}, {125, 62}, {126, 62}, {127, 62}
-  },
-  {  // mag,nra for x=8 and y=0:127
-    {  8,  0}, {  8,  5}, {  8, 10}, {  9, 15}, {  9, 19}, {  9, 23}, { 10, 26}, { 11, 29},
-    { 11, 32}, { 12, 34}, { 13, 37}, { 14, 38}, { 14, 40}, { 15, 42}, { 16, 43}, { 17, 44},
-    { 18, 45}, { 19, 46}, { 20, 47}, { 21, 48}, { 22, 48}, { 22, 49}, { 23, 50}, { 24, 50},
-    { 25, 51}, { 26, 51}, { 27, 52}, { 28, 52}, { 29, 53}, { 30, 53}, { 31, 53}, { 32, 54},
-    { 33, 54}, { 34, 54}, { 35, 55}, { 36, 55}, { 37, 55}, { 38, 55}, { 39, 56}, { 40, 56},
-    { 41, 56}, { 42, 56}, { 43, 56}, { 44, 57}, { 45, 57}, { 46, 57}, { 47, 57}, { 48, 57},
-    { 49, 57}, { 50, 57}, { 51, 58}, { 52, 58}, { 53, 58}, { 54, 58}, { 55, 58}, { 56, 58},
-    { 57, 58}, { 58, 58}, { 59, 58}, { 60, 59}, { 61, 59}, { 62, 59}, { 63, 59}, { 64, 59},
-    { 64, 59}, { 65, 59}, { 66, 59}, { 67, 59}, { 68, 59}, { 69, 59}, { 70, 59}, { 71, 59},
-    { 72, 59}, { 73, 60}, { 74, 60}, { 75, 60}, { 76, 60}, { 77, 60}, { 78, 60}, { 79, 60},
-    { 80, 60}, { 81, 60}, { 82, 60}, { 83, 60}, { 84, 60}, { 85, 60}, { 86, 60}, { 87, 60},
-    { 88, 60}, { 89, 60}, { 90, 60}, { 91, 60}, { 92, 60}, { 93, 61}, { 94, 61}, { 95, 61},
-    { 96, 61}, { 97, 61}, { 98, 61}, { 99, 61}, {100, 61}, {101, 61}, {102, 61}, {103, 61},
-    {104, 61}, {105, 61}, {106, 61}, {107, 61}, {108, 61}, {109, 61}, {110, 61}, {111, 61},
-    {112, 61}, {113, 61}, {114, 61}, {115, 61}, {116, 61}, {117, 61}, {118, 61}, {119, 61},
-    {120, 61}, {121, 61}, {122, 61}, {123, 61}, {124, 61}, {125, 61}, {126, 61}, {127, 61}
-  },
-  {  // mag,nra for x=9 and y=0:127
-    {  9,  0}, {  9,  5}, {  9,  9}, {  9, 13}, { 10, 17}, { 10, 21}, { 11, 24}, { 11, 27},
-    { 12, 30}, { 13, 32}, { 13, 34}, { 14, 36}, { 15, 38}, { 16, 39}, { 17, 41}, { 17, 42},
-    { 18, 43}, { 19, 44}, { 20, 45}, { 21, 46}, { 22, 47}, { 23, 48}, { 24, 48}, { 25, 49},
-    { 26, 49}, { 27, 50}, { 28, 50}, { 28, 51}, { 29, 51}, { 30, 52}, { 31, 52}, { 32, 52},
-    { 33, 53}, { 34, 53}, { 35, 53}, { 36, 54}, { 37, 54}, { 38, 54}, { 39, 55}, { 40, 55},
-    { 41, 55}, { 42, 55}, { 43, 55}, { 44, 56}, { 45, 56}, { 46, 56}, { 47, 56}, { 48, 56},
-    { 49, 56}, { 50, 57}, { 51, 57}, { 52, 57}, { 53, 57}, { 54, 57}, { 55, 57}, { 56, 57},
-    { 57, 58}, { 58, 58}, { 59, 58}, { 60, 58}, { 61, 58}, { 62, 58}, { 63, 58}, { 64, 58},
-    { 65, 58}, { 66, 58}, { 67, 58}, { 68, 59}, { 69, 59}, { 70, 59}, { 71, 59}, { 72, 59},
-    { 73, 59}, { 74, 59}, { 75, 59}, { 76, 59}, { 77, 59}, { 78, 59}, { 79, 59}, { 80, 59},
-    { 81, 59}, { 81, 59}, { 82, 60}, { 83, 60}, { 84, 60}, { 85, 60}, { 86, 60}, { 87, 60},
-    { 88, 60}, { 89, 60}, { 90, 60}, { 91, 60}, { 92, 60}, { 93, 60}, { 94, 60}, { 95, 60},
-    { 96, 60}, { 97, 60}, { 98, 60}, { 99, 60}, {100, 60}, {101, 60}, {102, 60}, {103, 60},
-    {104, 60}, {105, 61}, {106, 61}, {107, 61}, {108, 61}, {109, 61}, {110, 61}, {111, 61},
-    {112, 61}, {113, 61}, {114, 61}, {115, 61}, {116, 61}, {117, 61}, {118, 61}, {119, 61},
-    {120, 61}, {121, 61}, {122, 61}, {123, 61}, {124, 61}, {125, 61}, {126, 61}, {127, 61}
-  },
-  {  // mag,nra for x=10 and y=0:127
-    { 10,  0}, { 10,  4}, { 10,  8}, { 10, 12}, { 11, 16}, { 11, 19}, { 12, 22}, { 12, 25},
-    { 13, 27}, { 13, 30}, { 14, 32}, { 15, 34}, { 16, 36}, { 16, 37}, { 17, 39}, { 18, 40},
-    { 19, 41}, { 20, 42}, { 21, 43}, { 21, 44}, { 22, 45}, { 23, 46}, { 24, 47}, { 25, 47},
-    { 26, 48}, { 27, 48}, { 28, 49}, { 29, 50}, { 30, 50}, { 31, 50}, { 32, 51}, { 33, 51},
-    { 34, 52}, { 34, 52}, { 35, 52}, { 36, 53}, { 37, 53}, { 38, 53}, { 39, 54}, { 40, 54},
-    { 41, 54}, { 42, 54}, { 43, 54}, { 44, 55}, { 45, 55}, { 46, 55}, { 47, 55}, { 48, 55},
-    { 49, 56}, { 50, 56}, { 51, 56}, { 52, 56}, { 53, 56}, { 54, 56}, { 55, 57}, { 56, 57},
-    { 57, 57}, { 58, 57}, { 59, 57}, { 60, 57}, { 61, 57}, { 62, 57}, { 63, 57}, { 64, 58},
-    { 65, 58}, { 66, 58}, { 67, 58}, { 68, 58}, { 69, 58}, { 70, 58}, { 71, 58}, { 72, 58},
-    { 73, 58}, { 74, 58}, { 75, 59}, { 76, 59}, { 77, 59}, { 78, 59}, { 79, 59}, { 80, 59},
-    { 81, 59}, { 82, 59}, { 83, 59}, { 84, 59}, { 85, 59}, { 86, 59}, { 87, 59}, { 88, 59},
-    { 89, 59}, { 90, 59}, { 91, 59}, { 92, 60}, { 93, 60}, { 94, 60}, { 95, 60}, { 96, 60},
-    { 97, 60}, { 98, 60}, { 99, 60}, {100, 60}, {100, 60}, {101, 60}, {102, 60}, {103, 60},
-    {104, 60}, {105, 60}, {106, 60}, {107, 60}, {108, 60}, {109, 60}, {110, 60}, {111, 60},
-    {112, 60}, {113, 60}, {114, 60}, {115, 60}, {116, 60}, {117, 61}, {118, 61}, {119, 61},
-    {120, 61}, {121, 61}, {122, 61}, {123, 61}, {124, 61}, {125, 61}, {126, 61}, {127, 61}
-  },
-  {  // mag,nra for x=11 and y=0:127
-    { 11,  0}, { 11,  4}, { 11,  7}, { 11, 11}, { 12, 14}, { 12, 17}, { 13, 20}, { 13, 23},
-    { 14, 26}, { 14, 28}, { 15, 30}, { 16, 32}, { 16, 34}, { 17, 35}, { 18, 37}, { 19, 38},
-    { 19, 39}, { 20, 41}, { 21, 42}, { 22, 43}, { 23, 44}, { 24, 44}, { 25, 45}, { 25, 46},
-    { 26, 46}, { 27, 47}, { 28, 48}, { 29, 48}, { 30, 49}, { 31, 49}, { 32, 50}, { 33, 50},
-    { 34, 51}, { 35, 51}, { 36, 51}, { 37, 52}, { 38, 52}, { 39, 52}, { 40, 53}, { 41, 53},
-    { 41, 53}, { 42, 53}, { 43, 54}, { 44, 54}, { 45, 54}, { 46, 54}, { 47, 54}, { 48, 55},
-    { 49, 55}, { 50, 55}, { 51, 55}, { 52, 55}, { 53, 56}, { 54, 56}, { 55, 56}, { 56, 56},
-    { 57, 56}, { 58, 56}, { 59, 56}, { 60, 56}, { 61, 57}, { 62, 57}, { 63, 57}, { 64, 57},
-    { 65, 57}, { 66, 57}, { 67, 57}, { 68, 57}, { 69, 57}, { 70, 58}, { 71, 58}, { 72, 58},
-    { 73, 58}, { 74, 58}, { 75, 58}, { 76, 58}, { 77, 58}, { 78, 58}, { 79, 58}, { 80, 58},
-    { 81, 58}, { 82, 59}, { 83, 59}, { 84, 59}, { 85, 59}, { 86, 59}, { 87, 59}, { 88, 59},
-    { 89, 59}, { 90, 59}, { 91, 59}, { 92, 59}, { 93, 59}, { 94, 59}, { 95, 59}, { 96, 59},
-    { 97, 59}, { 98, 59}, { 99, 59}, {100, 59}, {101, 60}, {102, 60}, {103, 60}, {104, 60},
-    {105, 60}, {106, 60}, {107, 60}, {108, 60}, {109, 60}, {110, 60}, {111, 60}, {112, 60},
-    {113, 60}, {114, 60}, {115, 60}, {116, 60}, {117, 60}, {118, 60}, {119, 60}, {120, 60},
-    {121, 60}, {121, 60}, {122, 60}, {123, 60}, {124, 60}, {125, 60}, {126, 60}, {127, 60}
-  },
-  {  // mag,nra for x=12 and y=0:127
-    { 12,  0}, { 12,  3}, { 12,  7}, { 12, 10}, { 13, 13}, { 13, 16}, { 13, 19}, { 14, 22},
-    { 14, 24}, { 15, 26}, { 16, 28}, { 16, 30}, { 17, 32}, { 18, 34}, { 18, 35}, { 19, 37},
-    { 20, 38}, { 21, 39}, { 22, 40}, { 22, 41}, { 23, 42}, { 24, 43}, { 25, 44}, { 26, 44},
-    { 27, 45}, { 28, 46}, { 29, 46}, { 30, 47}, { 30, 48}, { 31, 48}, { 32, 48}, { 33, 49},
-    { 34, 49}, { 35, 50}, { 36, 50}, { 37, 51}, { 38, 51}, { 39, 51}, { 40, 52}, { 41, 52},
-    { 42, 52}, { 43, 52}, { 44, 53}, { 45, 53}, { 46, 53}, { 47, 53}, { 48, 54}, { 49, 54},
-    { 49, 54}, { 50, 54}, { 51, 54}, { 52, 55}, { 53, 55}, { 54, 55}, { 55, 55}, { 56, 55},
-    { 57, 55}, { 58, 56}, { 59, 56}, { 60, 56}, { 61, 56}, { 62, 56}, { 63, 56}, { 64, 56},
-    { 65, 56}, { 66, 57}, { 67, 57}, { 68, 57}, { 69, 57}, { 70, 57}, { 71, 57}, { 72, 57},
-    { 73, 57}, { 74, 57}, { 75, 57}, { 76, 58}, { 77, 58}, { 78, 58}, { 79, 58}, { 80, 58},
-    { 81, 58}, { 82, 58}, { 83, 58}, { 84, 58}, { 85, 58}, { 86, 58}, { 87, 58}, { 88, 58},
-    { 89, 58}, { 90, 59}, { 91, 59}, { 92, 59}, { 93, 59}, { 94, 59}, { 95, 59}, { 96, 59},
-    { 97, 59}, { 98, 59}, { 99, 59}, {100, 59}, {101, 59}, {102, 59}, {103, 59}, {104, 59},
-    {105, 59}, {106, 59}, {107, 59}, {108, 59}, {109, 59}, {110, 60}, {111, 60}, {112, 60},
-    {113, 60}, {114, 60}, {115, 60}, {116, 60}, {117, 60}, {118, 60}, {119, 60}, {120, 60},
-    {121, 60}, {122, 60}, {123, 60}, {124, 60}, {125, 60}, {126, 60}, {127, 60}, {128, 60}
-  },
-  {  // mag,nra for x=13 and y=0:127
-    { 13,  0}, { 13,  3}, { 13,  6}, { 13,  9}, { 14, 12}, { 14, 15}, { 14, 18}, { 15, 20},
-    { 15, 22}, { 16, 25}, { 16, 27}, { 17, 29}, { 18, 30}, { 18, 32}, { 19, 34}, { 20, 35},
-    { 21, 36}, { 21, 37}, { 22, 39}, { 23, 40}, { 24, 41}, { 25, 41}, { 26, 42}, { 26, 43},
-    { 27, 44}, { 28, 44}, { 29, 45}, { 30, 46}, { 31, 46}, { 32, 47}, { 33, 47}, { 34, 48},
-    { 35, 48}, { 35, 49}, { 36, 49}, { 37, 50}, { 38, 50}, { 39, 50}, { 40, 51}, { 41, 51},
-    { 42, 51}, { 43, 51}, { 44, 52}, { 45, 52}, { 46, 52}, { 47, 53}, { 48, 53}, { 49, 53},
-    { 50, 53}, { 51, 53}, { 52, 54}, { 53, 54}, { 54, 54}, { 55, 54}, { 56, 54}, { 57, 55},
-    { 57, 55}, { 58, 55}, { 59, 55}, { 60, 55}, { 61, 55}, { 62, 55}, { 63, 56}, { 64, 56},
-    { 65, 56}, { 66, 56}, { 67, 56}, { 68, 56}, { 69, 56}, { 70, 56}, { 71, 57}, { 72, 57},
-    { 73, 57}, { 74, 57}, { 75, 57}, { 76, 57}, { 77, 57}, { 78, 57}, { 79, 57}, { 80, 57},
-    { 81, 57}, { 82, 58}, { 83, 58}, { 84, 58}, { 85, 58}, { 86, 58}, { 87, 58}, { 88, 58},
-    { 89, 58}, { 90, 58}, { 91, 58}, { 92, 58}, { 93, 58}, { 94, 58}, { 95, 58}, { 96, 58},
-    { 97, 59}, { 98, 59}, { 99, 59}, {100, 59}, {101, 59}, {102, 59}, {103, 59}, {104, 59},
-    {105, 59}, {106, 59}, {107, 59}, {108, 59}, {109, 59}, {110, 59}, {111, 59}, {112, 59},
-    {113, 59}, {114, 59}, {115, 59}, {116, 59}, {117, 59}, {118, 59}, {119, 60}, {120, 60},
-    {121, 60}, {122, 60}, {123, 60}, {124, 60}, {125, 60}, {126, 60}, {127, 60}, {128, 60}
-  },
-  {  // mag,nra for x=14 and y=0:127
-    { 14,  0}, { 14,  3}, { 14,  6}, { 14,  9}, { 15, 11}, { 15, 14}, { 15, 16}, { 16, 19},
-    { 16, 21}, { 17, 23}, { 17, 25}, { 18, 27}, { 18, 29}, { 19, 30}, { 20, 32}, { 21, 33},
-    { 21, 35}, { 22, 36}, { 23, 37}, { 24, 38}, { 24, 39}, { 25, 40}, { 26, 41}, { 27, 42},
-    { 28, 42}, { 29, 43}, { 30, 44}, { 30, 45}, { 31, 45}, { 32, 46}, { 33, 46}, { 34, 47},
-    { 35, 47}, { 36, 48}, { 37, 48}, { 38, 48}, { 39, 49}, { 40, 49}, { 40, 50}, { 41, 50},
-    { 42, 50}, { 43, 51}, { 44, 51}, { 45, 51}, { 46, 51}, { 47, 52}, { 48, 52}, { 49, 52},
-    { 50, 52}, { 51, 53}, { 52, 53}, { 53, 53}, { 54, 53}, { 55, 53}, { 56, 54}, { 57, 54},
-    { 58, 54}, { 59, 54}, { 60, 54}, { 61, 55}, { 62, 55}, { 63, 55}, { 64, 55}, { 65, 55},
-    { 66, 55}, { 66, 55}, { 67, 55}, { 68, 56}, { 69, 56}, { 70, 56}, { 71, 56}, { 72, 56},
-    { 73, 56}, { 74, 56}, { 75, 56}, { 76, 56}, { 77, 57}, { 78, 57}, { 79, 57}, { 80, 57},
-    { 81, 57}, { 82, 57}, { 83, 57}, { 84, 57}, { 85, 57}, { 86, 57}, { 87, 57}, { 88, 57},
-    { 89, 58}, { 90, 58}, { 91, 58}, { 92, 58}, { 93, 58}, { 94, 58}, { 95, 58}, { 96, 58},
-    { 97, 58}, { 98, 58}, { 99, 58}, {100, 58}, {101, 58}, {102, 58}, {103, 58}, {104, 58},
-    {105, 59}, {106, 59}, {107, 59}, {108, 59}, {109, 59}, {110, 59}, {111, 59}, {112, 59},
-    {113, 59}, {114, 59}, {115, 59}, {116, 59}, {117, 59}, {118, 59}, {119, 59}, {120, 59},
-    {121, 59}, {122, 59}, {123, 59}, {124, 59}, {125, 59}, {126, 59}, {127, 59}, {128, 60}
-  },
-  {  // mag,nra for x=15 and y=0:127
-    { 15,  0}, { 15,  3}, { 15,  5}, { 15,  8}, { 16, 11}, { 16, 13}, { 16, 16}, { 17, 18},
-    { 17, 20}, { 17, 22}, { 18, 24}, { 19, 26}, { 19, 27}, { 20, 29}, { 21, 31}, { 21, 32},
-    { 22, 33}, { 23, 35}, { 23, 36}, { 24, 37}, { 25, 38}, { 26, 39}, { 27, 40}, { 27, 40},
-    { 28, 41}, { 29, 42}, { 30, 43}, { 31, 43}, { 32, 44}, { 33, 45}, { 34, 45}, { 34, 46},
-    { 35, 46}, { 36, 47}, { 37, 47}, { 38, 48}, { 39, 48}, { 40, 48}, { 41, 49}, { 42, 49},
-    { 43, 49}, { 44, 50}, { 45, 50}, { 46, 50}, { 46, 51}, { 47, 51}, { 48, 51}, { 49, 51},
-    { 50, 52}, { 51, 52}, { 52, 52}, { 53, 52}, { 54, 53}, { 55, 53}, { 56, 53}, { 57, 53},
-    { 58, 53}, { 59, 54}, { 60, 54}, { 61, 54}, { 62, 54}, { 63, 54}, { 64, 54}, { 65, 54},
-    { 66, 55}, { 67, 55}, { 68, 55}, { 69, 55}, { 70, 55}, { 71, 55}, { 72, 55}, { 73, 56},
-    { 74, 56}, { 75, 56}, { 76, 56}, { 76, 56}, { 77, 56}, { 78, 56}, { 79, 56}, { 80, 56},
-    { 81, 56}, { 82, 57}, { 83, 57}, { 84, 57}, { 85, 57}, { 86, 57}, { 87, 57}, { 88, 57},
-    { 89, 57}, { 90, 57}, { 91, 57}, { 92, 57}, { 93, 57}, { 94, 57}, { 95, 58}, { 96, 58},
-    { 97, 58}, { 98, 58}, { 99, 58}, {100, 58}, {101, 58}, {102, 58}, {103, 58}, {104, 58},
-    {105, 58}, {106, 58}, {107, 58}, {108, 58}, {109, 58}, {110, 58}, {111, 58}, {112, 59},
-    {113, 59}, {114, 59}, {115, 59}, {116, 59}, {117, 59}, {118, 59}, {119, 59}, {120, 59},
-    {121, 59}, {122, 59}, {123, 59}, {124, 59}, {125, 59}, {126, 59}, {127, 59}, {128, 59}
-  },
-  {  // mag,nra for x=16 and y=0:127
-    { 16,  0}, { 16,  3}, { 16,  5}, { 16,  8}, { 16, 10}, { 17, 12}, { 17, 15}, { 17, 17},
-    { 18, 19}, { 18, 21}, { 19, 23}, { 19, 25}, { 20, 26}, { 21, 28}, { 21, 29}, { 22, 31},
-    { 23, 32}, { 23, 33}, { 24, 34}, { 25, 35}, { 26, 37}, { 26, 37}, { 27, 38}, { 28, 39},
-    { 29, 40}, { 30, 41}, { 31, 42}, { 31, 42}, { 32, 43}, { 33, 43}, { 34, 44}, { 35, 45},
-    { 36, 45}, { 37, 46}, { 38, 46}, { 38, 47}, { 39, 47}, { 40, 47}, { 41, 48}, { 42, 48},
-    { 43, 48}, { 44, 49}, { 45, 49}, { 46, 49}, { 47, 50}, { 48, 50}, { 49, 50}, { 50, 51},
-    { 51, 51}, { 52, 51}, { 52, 51}, { 53, 52}, { 54, 52}, { 55, 52}, { 56, 52}, { 57, 52},
-    { 58, 53}, { 59, 53}, { 60, 53}, { 61, 53}, { 62, 53}, { 63, 54}, { 64, 54}, { 65, 54},
-    { 66, 54}, { 67, 54}, { 68, 54}, { 69, 54}, { 70, 55}, { 71, 55}, { 72, 55}, { 73, 55},
-    { 74, 55}, { 75, 55}, { 76, 55}, { 77, 55}, { 78, 56}, { 79, 56}, { 80, 56}, { 81, 56},
-    { 82, 56}, { 83, 56}, { 84, 56}, { 85, 56}, { 86, 56}, { 86, 56}, { 87, 57}, { 88, 57},
-    { 89, 57}, { 90, 57}, { 91, 57}, { 92, 57}, { 93, 57}, { 94, 57}, { 95, 57}, { 96, 57},
-    { 97, 57}, { 98, 57}, { 99, 57}, {100, 57}, {101, 58}, {102, 58}, {103, 58}, {104, 58},
-    {105, 58}, {106, 58}, {107, 58}, {108, 58}, {109, 58}, {110, 58}, {111, 58}, {112, 58},
-    {113, 58}, {114, 58}, {115, 58}, {116, 58}, {117, 58}, {118, 58}, {119, 59}, {120, 59},
-    {121, 59}, {122, 59}, {123, 59}, {124, 59}, {125, 59}, {126, 59}, {127, 59}, {128, 59}
-  },
-  {  // mag,nra for x=17 and y=0:127
-    { 17,  0}, { 17,  2}, { 17,  5}, { 17,  7}, { 17,  9}, { 18, 12}, { 18, 14}, { 18, 16},
-    { 19, 18}, { 19, 20}, { 20, 22}, { 20, 23}, { 21, 25}, { 21, 27}, { 22, 28}, { 23, 29},
-    { 23, 31}, { 24, 32}, { 25, 33}, { 25, 34}, { 26, 35}, { 27, 36}, { 28, 37}, { 29, 38},
-    { 29, 39}, { 30, 40}, { 31, 40}, { 32, 41}, { 33, 42}, { 34, 42}, { 34, 43}, { 35, 44},
-    { 36, 44}, { 37, 45}, { 38, 45}, { 39, 46}, { 40, 46}, { 41, 46}, { 42, 47}, { 43, 47},
-    { 43, 48}, { 44, 48}, { 45, 48}, { 46, 49}, { 47, 49}, { 48, 49}, { 49, 50}, { 50, 50},
-    { 51, 50}, { 52, 50}, { 53, 51}, { 54, 51}, { 55, 51}, { 56, 51}, { 57, 52}, { 58, 52},
-    { 59, 52}, { 59, 52}, { 60, 52}, { 61, 53}, { 62, 53}, { 63, 53}, { 64, 53}, { 65, 53},
-    { 66, 53}, { 67, 54}, { 68, 54}, { 69, 54}, { 70, 54}, { 71, 54}, { 72, 54}, { 73, 54},
-    { 74, 55}, { 75, 55}, { 76, 55}, { 77, 55}, { 78, 55}, { 79, 55}, { 80, 55}, { 81, 55},
-    { 82, 55}, { 83, 56}, { 84, 56}, { 85, 56}, { 86, 56}, { 87, 56}, { 88, 56}, { 89, 56},
-    { 90, 56}, { 91, 56}, { 92, 56}, { 93, 56}, { 94, 57}, { 95, 57}, { 96, 57}, { 97, 57},
-    { 97, 57}, { 98, 57}, { 99, 57}, {100, 57}, {101, 57}, {102, 57}, {103, 57}, {104, 57},
-    {105, 57}, {106, 57}, {107, 58}, {108, 58}, {109, 58}, {110, 58}, {111, 58}, {112, 58},
-    {113, 58}, {114, 58}, {115, 58}, {116, 58}, {117, 58}, {118, 58}, {119, 58}, {120, 58},
-    {121, 58}, {122, 58}, {123, 58}, {124, 58}, {125, 58}, {126, 58}, {127, 59}, {128, 59}
-  },
-  {  // mag,nra for x=18 and y=0:127
-    { 18,  0}, { 18,  2}, { 18,  5}, { 18,  7}, { 18,  9}, { 19, 11}, { 19, 13}, { 19, 15},
-    { 20, 17}, { 20, 19}, { 21, 21}, { 21, 22}, { 22, 24}, { 22, 25}, { 23, 27}, { 23, 28},
-    { 24, 30}, { 25, 31}, { 25, 32}, { 26, 33}, { 27, 34}, { 28, 35}, { 28, 36}, { 29, 37},
-    { 30, 38}, { 31, 39}, { 32, 39}, { 32, 40}, { 33, 41}, { 34, 41}, { 35, 42}, { 36, 43},
-    { 37, 43}, { 38, 44}, { 38, 44}, { 39, 45}, { 40, 45}, { 41, 46}, { 42, 46}, { 43, 46},
-    { 44, 47}, { 45, 47}, { 46, 48}, { 47, 48}, { 48, 48}, { 48, 48}, { 49, 49}, { 50, 49},
-    { 51, 49}, { 52, 50}, { 53, 50}, { 54, 50}, { 55, 50}, { 56, 51}, { 57, 51}, { 58, 51},
-    { 59, 51}, { 60, 52}, { 61, 52}, { 62, 52}, { 63, 52}, { 64, 52}, { 65, 52}, { 66, 53},
-    { 66, 53}, { 67, 53}, { 68, 53}, { 69, 53}, { 70, 53}, { 71, 54}, { 72, 54}, { 73, 54},
-    { 74, 54}, { 75, 54}, { 76, 54}, { 77, 54}, { 78, 55}, { 79, 55}, { 80, 55}, { 81, 55},
-    { 82, 55}, { 83, 55}, { 84, 55}, { 85, 55}, { 86, 55}, { 87, 55}, { 88, 56}, { 89, 56},
-    { 90, 56}, { 91, 56}, { 92, 56}, { 93, 56}, { 94, 56}, { 95, 56}, { 96, 56}, { 97, 56},
-    { 98, 56}, { 99, 57}, {100, 57}, {101, 57}, {102, 57}, {103, 57}, {104, 57}, {105, 57},
-    {106, 57}, {107, 57}, {108, 57}, {109, 57}, {109, 57}, {110, 57}, {111, 57}, {112, 57},
-    {113, 58}, {114, 58}, {115, 58}, {116, 58}, {117, 58}, {118, 58}, {119, 58}, {120, 58},
-    {121, 58}, {122, 58}, {123, 58}, {124, 58}, {125, 58}, {126, 58}, {127, 58}, {128, 58}
-  },
-  {  // mag,nra for x=19 and y=0:127
-    { 19,  0}, { 19,  2}, { 19,  4}, { 19,  6}, { 19,  8}, { 20, 10}, { 20, 12}, { 20, 14},
-    { 21, 16}, { 21, 18}, { 21, 20}, { 22, 21}, { 22, 23}, { 23, 24}, { 24, 26}, { 24, 27},
-    { 25, 29}, { 25, 30}, { 26, 31}, { 27, 32}, { 28, 33}, { 28, 34}, { 29, 35}, { 30, 36},
-    { 31, 37}, { 31, 38}, { 32, 38}, { 33, 39}, { 34, 40}, { 35, 40}, { 36, 41}, { 36, 42},
-    { 37, 42}, { 38, 43}, { 39, 43}, { 40, 44}, { 41, 44}, { 42, 45}, { 42, 45}, { 43, 46},
-    { 44, 46}, { 45, 46}, { 46, 47}, { 47, 47}, { 48, 47}, { 49, 48}, { 50, 48}, { 51, 48},
-    { 52, 49}, { 53, 49}, { 53, 49}, { 54, 49}, { 55, 50}, { 56, 50}, { 57, 50}, { 58, 50},
-    { 59, 51}, { 60, 51}, { 61, 51}, { 62, 51}, { 63, 52}, { 64, 52}, { 65, 52}, { 66, 52},
-    { 67, 52}, { 68, 52}, { 69, 53}, { 70, 53}, { 71, 53}, { 72, 53}, { 73, 53}, { 73, 53},
-    { 74, 53}, { 75, 54}, { 76, 54}, { 77, 54}, { 78, 54}, { 79, 54}, { 80, 54}, { 81, 54},
-    { 82, 54}, { 83, 55}, { 84, 55}, { 85, 55}, { 86, 55}, { 87, 55}, { 88, 55}, { 89, 55},
-    { 90, 55}, { 91, 55}, { 92, 56}, { 93, 56}, { 94, 56}, { 95, 56}, { 96, 56}, { 97, 56},
-    { 98, 56}, { 99, 56}, {100, 56}, {101, 56}, {102, 56}, {103, 56}, {104, 56}, {105, 57},
-    {106, 57}, {107, 57}, {108, 57}, {109, 57}, {110, 57}, {111, 57}, {112, 57}, {113, 57},
-    {114, 57}, {115, 57}, {116, 57}, {117, 57}, {118, 57}, {119, 57}, {120, 57}, {121, 58},
-    {121, 58}, {122, 58}, {123, 58}, {124, 58}, {125, 58}, {126, 58}, {127, 58}, {128, 58}
-  },
-  {  // mag,nra for x=20 and y=0:127
-    { 20,  0}, { 20,  2}, { 20,  4}, { 20,  6}, { 20,  8}, { 21, 10}, { 21, 12}, { 21, 14},
-    { 22, 16}, { 22, 17}, { 22, 19}, { 23, 20}, { 23, 22}, { 24, 23}, { 24, 25}, { 25, 26},
-    { 26, 27}, { 26, 29}, { 27, 30}, { 28, 31}, { 28, 32}, { 29, 33}, { 30, 34}, { 30, 35},
-    { 31, 36}, { 32, 37}, { 33, 37}, { 34, 38}, { 34, 39}, { 35, 39}, { 36, 40}, { 37, 41},
-    { 38, 41}, { 39, 42}, { 39, 42}, { 40, 43}, { 41, 43}, { 42, 44}, { 43, 44}, { 44, 45},
-    { 45, 45}, { 46, 46}, { 47, 46}, { 47, 46}, { 48, 47}, { 49, 47}, { 50, 47}, { 51, 48},
-    { 52, 48}, { 53, 48}, { 54, 48}, { 55, 49}, { 56, 49}, { 57, 49}, { 58, 50}, { 59, 50},
-    { 59, 50}, { 60, 50}, { 61, 50}, { 62, 51}, { 63, 51}, { 64, 51}, { 65, 51}, { 66, 51},
-    { 67, 52}, { 68, 52}, { 69, 52}, { 70, 52}, { 71, 52}, { 72, 53}, { 73, 53}, { 74, 53},
-    { 75, 53}, { 76, 53}, { 77, 53}, { 78, 53}, { 79, 54}, { 80, 54}, { 81, 54}, { 81, 54},
-    { 82, 54}, { 83, 54}, { 84, 54}, { 85, 54}, { 86, 54}, { 87, 55}, { 88, 55}, { 89, 55},
-    { 90, 55}, { 91, 55}, { 92, 55}, { 93, 55}, { 94, 55}, { 95, 55}, { 96, 55}, { 97, 56},
-    { 98, 56}, { 99, 56}, {100, 56}, {101, 56}, {102, 56}, {103, 56}, {104, 56}, {105, 56},
-    {106, 56}, {107, 56}, {108, 56}, {109, 56}, {110, 57}, {111, 57}, {112, 57}, {113, 57},
-    {114, 57}, {115, 57}, {116, 57}, {117, 57}, {118, 57}, {119, 57}, {120, 57}, {121, 57},
-    {122, 57}, {123, 57}, {124, 57}, {125, 57}, {126, 57}, {127, 58}, {128, 58}, {129, 58}
-  },
-  {  // mag,nra for x=21 and y=0:127
-    { 21,  0}, { 21,  2}, { 21,  4}, { 21,  6}, { 21,  8}, { 22, 10}, { 22, 11}, { 22, 13},
-    { 22, 15}, { 23, 16}, { 23, 18}, { 24, 20}, { 24, 21}, { 25, 23}, { 25, 24}, { 26, 25},
-    { 26, 27}, { 27, 28}, { 28, 29}, { 28, 30}, { 29, 31}, { 30, 32}, { 30, 33}, { 31, 34},
-    { 32, 35}, { 33, 36}, { 33, 36}, { 34, 37}, { 35, 38}, { 36, 38}, { 37, 39}, { 37, 40},
-    { 38, 40}, { 39, 41}, { 40, 41}, { 41, 42}, { 42, 42}, { 43, 43}, { 43, 43}, { 44, 44},
-    { 45, 44}, { 46, 45}, { 47, 45}, { 48, 45}, { 49, 46}, { 50, 46}, { 51, 47}, { 51, 47},
-    { 52, 47}, { 53, 48}, { 54, 48}, { 55, 48}, { 56, 48}, { 57, 49}, { 58, 49}, { 59, 49},
-    { 60, 49}, { 61, 50}, { 62, 50}, { 63, 50}, { 64, 50}, { 65, 50}, { 65, 51}, { 66, 51},
-    { 67, 51}, { 68, 51}, { 69, 51}, { 70, 52}, { 71, 52}, { 72, 52}, { 73, 52}, { 74, 52},
-    { 75, 52}, { 76, 53}, { 77, 53}, { 78, 53}, { 79, 53}, { 80, 53}, { 81, 53}, { 82, 53},
-    { 83, 54}, { 84, 54}, { 85, 54}, { 86, 54}, { 87, 54}, { 88, 54}, { 89, 54}, { 89, 54},
-    { 90, 54}, { 91, 55}, { 92, 55}, { 93, 55}, { 94, 55}, { 95, 55}, { 96, 55}, { 97, 55},
-    { 98, 55}, { 99, 55}, {100, 55}, {101, 55}, {102, 56}, {103, 56}, {104, 56}, {105, 56},
-    {106, 56}, {107, 56}, {108, 56}, {109, 56}, {110, 56}, {111, 56}, {112, 56}, {113, 56},
-    {114, 56}, {115, 57}, {116, 57}, {117, 57}, {118, 57}, {119, 57}, {120, 57}, {121, 57},
-    {122, 57}, {123, 57}, {124, 57}, {125, 57}, {126, 57}, {127, 57}, {128, 57}, {129, 57}
-  },
-  {  // mag,nra for x=22 and y=0:127
-    { 22,  0}, { 22,  2}, { 22,  4}, { 22,  6}, { 22,  7}, { 23,  9}, { 23, 11}, { 23, 13},
-    { 23, 14}, { 24, 16}, { 24, 17}, { 25, 19}, { 25, 20}, { 26, 22}, { 26, 23}, { 27, 24},
-    { 27, 26}, { 28, 27}, { 28, 28}, { 29, 29}, { 30, 30}, { 30, 31}, { 31, 32}, { 32, 33},
-    { 33, 34}, { 33, 35}, { 34, 35}, { 35, 36}, { 36, 37}, { 36, 38}, { 37, 38}, { 38, 39},
-    { 39, 39}, { 40, 40}, { 40, 41}, { 41, 41}, { 42, 42}, { 43, 42}, { 44, 43}, { 45, 43},
-    { 46, 44}, { 47, 44}, { 47, 44}, { 48, 45}, { 49, 45}, { 50, 45}, { 51, 46}, { 52, 46},
-    { 53, 46}, { 54, 47}, { 55, 47}, { 56, 47}, { 56, 48}, { 57, 48}, { 58, 48}, { 59, 48},
-    { 60, 49}, { 61, 49}, { 62, 49}, { 63, 49}, { 64, 50}, { 65, 50}, { 66, 50}, { 67, 50},
-    { 68, 51}, { 69, 51}, { 70, 51}, { 71, 51}, { 71, 51}, { 72, 51}, { 73, 52}, { 74, 52},
-    { 75, 52}, { 76, 52}, { 77, 52}, { 78, 52}, { 79, 53}, { 80, 53}, { 81, 53}, { 82, 53},
-    { 83, 53}, { 84, 53}, { 85, 53}, { 86, 53}, { 87, 54}, { 88, 54}, { 89, 54}, { 90, 54},
-    { 91, 54}, { 92, 54}, { 93, 54}, { 94, 54}, { 95, 54}, { 96, 55}, { 97, 55}, { 98, 55},
-    { 98, 55}, { 99, 55}, {100, 55}, {101, 55}, {102, 55}, {103, 55}, {104, 55}, {105, 55},
-    {106, 56}, {107, 56}, {108, 56}, {109, 56}, {110, 56}, {111, 56}, {112, 56}, {113, 56},
-    {114, 56}, {115, 56}, {116, 56}, {117, 56}, {118, 56}, {119, 56}, {120, 56}, {121, 57},
-    {122, 57}, {123, 57}, {124, 57}, {125, 57}, {126, 57}, {127, 57}, {128, 57}, {129, 57}
-  },
-  {  // mag,nra for x=23 and y=0:127
-    { 23,  0}, { 23,  2}, { 23,  4}, { 23,  5}, { 23,  7}, { 24,  9}, { 24, 10}, { 24, 12},
-    { 24, 14}, { 25, 15}, { 25, 17}, { 25, 18}, { 26, 20}, { 26, 21}, { 27, 22}, { 27, 24},
-    { 28, 25}, { 29, 26}, { 29, 27}, { 30, 28}, { 30, 29}, { 31, 30}, { 32, 31}, { 33, 32},
-    { 33, 33}, { 34, 34}, { 35, 34}, { 35, 35}, { 36, 36}, { 37, 37}, { 38, 37}, { 39, 38},
-    { 39, 39}, { 40, 39}, { 41, 40}, { 42, 40}, { 43, 41}, { 44, 41}, { 44, 42}, { 45, 42},
-    { 46, 43}, { 47, 43}, { 48, 44}, { 49, 44}, { 50, 44}, { 51, 45}, { 51, 45}, { 52, 45},
-    { 53, 46}, { 54, 46}, { 55, 46}, { 56, 47}, { 57, 47}, { 58, 47}, { 59, 48}, { 60, 48},
-    { 61, 48}, { 61, 48}, { 62, 49}, { 63, 49}, { 64, 49}, { 65, 49}, { 66, 50}, { 67, 50},
-    { 68, 50}, { 69, 50}, { 70, 50}, { 71, 51}, { 72, 51}, { 73, 51}, { 74, 51}, { 75, 51},
-    { 76, 51}, { 77, 52}, { 77, 52}, { 78, 52}, { 79, 52}, { 80, 52}, { 81, 52}, { 82, 52},
-    { 83, 53}, { 84, 53}, { 85, 53}, { 86, 53}, { 87, 53}, { 88, 53}, { 89, 53}, { 90, 53},
-    { 91, 54}, { 92, 54}, { 93, 54}, { 94, 54}, { 95, 54}, { 96, 54}, { 97, 54}, { 98, 54},
-    { 99, 54}, {100, 55}, {101, 55}, {102, 55}, {103, 55}, {104, 55}, {105, 55}, {106, 55},
-    {107, 55}, {107, 55}, {108, 55}, {109, 55}, {110, 55}, {111, 56}, {112, 56}, {113, 56},
-    {114, 56}, {115, 56}, {116, 56}, {117, 56}, {118, 56}, {119, 56}, {120, 56}, {121, 56},
-    {122, 56}, {123, 56}, {124, 56}, {125, 56}, {126, 57}, {127, 57}, {128, 57}, {129, 57}
-  },
-  {  // mag,nra for x=24 and y=0:127
-    { 24,  0}, { 24,  2}, { 24,  3}, { 24,  5}, { 24,  7}, { 25,  8}, { 25, 10}, { 25, 12},
-    { 25, 13}, { 26, 15}, { 26, 16}, { 26, 18}, { 27, 19}, { 27, 20}, { 28, 22}, { 28, 23},
-    { 29, 24}, { 29, 25}, { 30, 26}, { 31, 27}, { 31, 28}, { 32, 29}, { 33, 30}, { 33, 31},
-    { 34, 32}, { 35, 33}, { 35, 34}, { 36, 34}, { 37, 35}, { 38, 36}, { 38, 37}, { 39, 37},
-    { 40, 38}, { 41, 38}, { 42, 39}, { 42, 40}, { 43, 40}, { 44, 41}, { 45, 41}, { 46, 42},
-    { 47, 42}, { 48, 42}, { 48, 43}, { 49, 43}, { 50, 44}, { 51, 44}, { 52, 44}, { 53, 45},
-    { 54, 45}, { 55, 45}, { 55, 46}, { 56, 46}, { 57, 46}, { 58, 47}, { 59, 47}, { 60, 47},
-    { 61, 48}, { 62, 48}, { 63, 48}, { 64, 48}, { 65, 48}, { 66, 49}, { 66, 49}, { 67, 49},
-    { 68, 49}, { 69, 50}, { 70, 50}, { 71, 50}, { 72, 50}, { 73, 50}, { 74, 51}, { 75, 51},
-    { 76, 51}, { 77, 51}, { 78, 51}, { 79, 51}, { 80, 52}, { 81, 52}, { 82, 52}, { 83, 52},
-    { 84, 52}, { 84, 52}, { 85, 52}, { 86, 53}, { 87, 53}, { 88, 53}, { 89, 53}, { 90, 53},
-    { 91, 53}, { 92, 53}, { 93, 53}, { 94, 53}, { 95, 54}, { 96, 54}, { 97, 54}, { 98, 54},
-    { 99, 54}, {100, 54}, {101, 54}, {102, 54}, {103, 54}, {104, 54}, {105, 55}, {106, 55},
-    {107, 55}, {108, 55}, {109, 55}, {110, 55}, {111, 55}, {112, 55}, {113, 55}, {114, 55},
-    {115, 55}, {116, 55}, {116, 56}, {117, 56}, {118, 56}, {119, 56}, {120, 56}, {121, 56},
-    {122, 56}, {123, 56}, {124, 56}, {125, 56}, {126, 56}, {127, 56}, {128, 56}, {129, 56}
-  },
-  {  // mag,nra for x=25 and y=0:127
-    { 25,  0}, { 25,  2}, { 25,  3}, { 25,  5}, { 25,  6}, { 25,  8}, { 26, 10}, { 26, 11},
-    { 26, 13}, { 27, 14}, { 27, 16}, { 27, 17}, { 28, 18}, { 28, 20}, { 29, 21}, { 29, 22},
-    { 30, 23}, { 30, 24}, { 31, 25}, { 31, 26}, { 32, 27}, { 33, 28}, { 33, 29}, { 34, 30},
-    { 35, 31}, { 35, 32}, { 36, 33}, { 37, 34}, { 38, 34}, { 38, 35}, { 39, 36}, { 40, 36},
-    { 41, 37}, { 41, 38}, { 42, 38}, { 43, 39}, { 44, 39}, { 45, 40}, { 45, 40}, { 46, 41},
-    { 47, 41}, { 48, 42}, { 49, 42}, { 50, 43}, { 51, 43}, { 51, 43}, { 52, 44}, { 53, 44},
-    { 54, 44}, { 55, 45}, { 56, 45}, { 57, 45}, { 58, 46}, { 59, 46}, { 60, 46}, { 60, 47},
-    { 61, 47}, { 62, 47}, { 63, 47}, { 64, 48}, { 65, 48}, { 66, 48}, { 67, 48}, { 68, 49},
-    { 69, 49}, { 70, 49}, { 71, 49}, { 72, 49}, { 72, 50}, { 73, 50}, { 74, 50}, { 75, 50},
-    { 76, 50}, { 77, 51}, { 78, 51}, { 79, 51}, { 80, 51}, { 81, 51}, { 82, 51}, { 83, 52},
-    { 84, 52}, { 85, 52}, { 86, 52}, { 87, 52}, { 88, 52}, { 89, 52}, { 90, 52}, { 91, 53},
-    { 91, 53}, { 92, 53}, { 93, 53}, { 94, 53}, { 95, 53}, { 96, 53}, { 97, 53}, { 98, 54},
-    { 99, 54}, {100, 54}, {101, 54}, {102, 54}, {103, 54}, {104, 54}, {105, 54}, {106, 54},
-    {107, 54}, {108, 54}, {109, 55}, {110, 55}, {111, 55}, {112, 55}, {113, 55}, {114, 55},
-    {115, 55}, {116, 55}, {117, 55}, {118, 55}, {119, 55}, {120, 55}, {121, 55}, {122, 56},
-    {123, 56}, {124, 56}, {125, 56}, {126, 56}, {126, 56}, {127, 56}, {128, 56}, {129, 56}
-  },
-  {  // mag,nra for x=26 and y=0:127
-    { 26,  0}, { 26,  2}, { 26,  3}, { 26,  5}, { 26,  6}, { 26,  8}, { 27,  9}, { 27, 11},
-    { 27, 12}, { 28, 14}, { 28, 15}, { 28, 16}, { 29, 18}, { 29, 19}, { 30, 20}, { 30, 21},
-    { 31, 22}, { 31, 24}, { 32, 25}, { 32, 26}, { 33, 27}, { 33, 28}, { 34, 29}, { 35, 30},
-    { 35, 30}, { 36, 31}, { 37, 32}, { 37, 33}, { 38, 34}, { 39, 34}, { 40, 35}, { 40, 36},
-    { 41, 36}, { 42, 37}, { 43, 37}, { 44, 38}, { 44, 39}, { 45, 39}, { 46, 40}, { 47, 40},
-    { 48, 41}, { 49, 41}, { 49, 41}, { 50, 42}, { 51, 42}, { 52, 43}, { 53, 43}, { 54, 43},
-    { 55, 44}, { 55, 44}, { 56, 44}, { 57, 45}, { 58, 45}, { 59, 45}, { 60, 46}, { 61, 46},
-    { 62, 46}, { 63, 47}, { 64, 47}, { 64, 47}, { 65, 47}, { 66, 48}, { 67, 48}, { 68, 48},
-    { 69, 48}, { 70, 48}, { 71, 49}, { 72, 49}, { 73, 49}, { 74, 49}, { 75, 50}, { 76, 50},
-    { 77, 50}, { 77, 50}, { 78, 50}, { 79, 50}, { 80, 51}, { 81, 51}, { 82, 51}, { 83, 51},
-    { 84, 51}, { 85, 51}, { 86, 51}, { 87, 52}, { 88, 52}, { 89, 52}, { 90, 52}, { 91, 52},
-    { 92, 52}, { 93, 52}, { 94, 53}, { 95, 53}, { 96, 53}, { 97, 53}, { 98, 53}, { 98, 53},
-    { 99, 53}, {100, 53}, {101, 53}, {102, 54}, {103, 54}, {104, 54}, {105, 54}, {106, 54},
-    {107, 54}, {108, 54}, {109, 54}, {110, 54}, {111, 54}, {112, 54}, {113, 55}, {114, 55},
-    {115, 55}, {116, 55}, {117, 55}, {118, 55}, {119, 55}, {120, 55}, {121, 55}, {122, 55},
-    {123, 55}, {124, 55}, {125, 55}, {126, 56}, {127, 56}, {128, 56}, {129, 56}, {130, 56}
-  },
-  {  // mag,nra for x=27 and y=0:127
-    { 27,  0}, { 27,  2}, { 27,  3}, { 27,  5}, { 27,  6}, { 27,  7}, { 28,  9}, { 28, 10},
-    { 28, 12}, { 28, 13}, { 29, 14}, { 29, 16}, { 30, 17}, { 30, 18}, { 30, 19}, { 31, 21},
-    { 31, 22}, { 32, 23}, { 32, 24}, { 33, 25}, { 34, 26}, { 34, 27}, { 35, 28}, { 35, 29},
-    { 36, 30}, { 37, 30}, { 37, 31}, { 38, 32}, { 39, 33}, { 40, 33}, { 40, 34}, { 41, 35},
-    { 42, 35}, { 43, 36}, { 43, 37}, { 44, 37}, { 45, 38}, { 46, 38}, { 47, 39}, { 47, 39},
-    { 48, 40}, { 49, 40}, { 50, 41}, { 51, 41}, { 52, 42}, { 52, 42}, { 53, 42}, { 54, 43},
-    { 55, 43}, { 56, 43}, { 57, 44}, { 58, 44}, { 59, 44}, { 59, 45}, { 60, 45}, { 61, 45},
-    { 62, 46}, { 63, 46}, { 64, 46}, { 65, 47}, { 66, 47}, { 67, 47}, { 68, 47}, { 69, 48},
-    { 69, 48}, { 70, 48}, { 71, 48}, { 72, 48}, { 73, 49}, { 74, 49}, { 75, 49}, { 76, 49},
-    { 77, 49}, { 78, 50}, { 79, 50}, { 80, 50}, { 81, 50}, { 82, 50}, { 83, 50}, { 83, 51},
-    { 84, 51}, { 85, 51}, { 86, 51}, { 87, 51}, { 88, 51}, { 89, 51}, { 90, 52}, { 91, 52},
-    { 92, 52}, { 93, 52}, { 94, 52}, { 95, 52}, { 96, 52}, { 97, 52}, { 98, 53}, { 99, 53},
-    {100, 53}, {101, 53}, {102, 53}, {103, 53}, {104, 53}, {105, 53}, {106, 53}, {106, 54},
-    {107, 54}, {108, 54}, {109, 54}, {110, 54}, {111, 54}, {112, 54}, {113, 54}, {114, 54},
-    {115, 54}, {116, 54}, {117, 55}, {118, 55}, {119, 55}, {120, 55}, {121, 55}, {122, 55},
-    {123, 55}, {124, 55}, {125, 55}, {126, 55}, {127, 55}, {128, 55}, {129, 55}, {130, 55}
-  },
-  {  // mag,nra for x=28 and y=0:127
-    { 28,  0}, { 28,  1}, { 28,  3}, { 28,  4}, { 28,  6}, { 28,  7}, { 29,  9}, { 29, 10},
-    { 29, 11}, { 29, 13}, { 30, 14}, { 30, 15}, { 30, 16}, { 31, 18}, { 31, 19}, { 32, 20},
-    { 32, 21}, { 33, 22}, { 33, 23}, { 34, 24}, { 34, 25}, { 35, 26}, { 36, 27}, { 36, 28},
-    { 37, 29}, { 38, 30}, { 38, 30}, { 39, 31}, { 40, 32}, { 40, 33}, { 41, 33}, { 42, 34},
-    { 43, 35}, { 43, 35}, { 44, 36}, { 45, 37}, { 46, 37}, { 46, 38}, { 47, 38}, { 48, 39},
-    { 49, 39}, { 50, 40}, { 50, 40}, { 51, 40}, { 52, 41}, { 53, 41}, { 54, 42}, { 55, 42},
-    { 56, 42}, { 56, 43}, { 57, 43}, { 58, 44}, { 59, 44}, { 60, 44}, { 61, 45}, { 62, 45},
-    { 63, 45}, { 64, 45}, { 64, 46}, { 65, 46}, { 66, 46}, { 67, 46}, { 68, 47}, { 69, 47},
-    { 70, 47}, { 71, 47}, { 72, 48}, { 73, 48}, { 74, 48}, { 74, 48}, { 75, 48}, { 76, 49},
-    { 77, 49}, { 78, 49}, { 79, 49}, { 80, 49}, { 81, 50}, { 82, 50}, { 83, 50}, { 84, 50},
-    { 85, 50}, { 86, 50}, { 87, 51}, { 88, 51}, { 89, 51}, { 89, 51}, { 90, 51}, { 91, 51},
-    { 92, 51}, { 93, 52}, { 94, 52}, { 95, 52}, { 96, 52}, { 97, 52}, { 98, 52}, { 99, 52},
-    {100, 52}, {101, 53}, {102, 53}, {103, 53}, {104, 53}, {105, 53}, {106, 53}, {107, 53},
-    {108, 53}, {109, 53}, {110, 53}, {111, 54}, {112, 54}, {113, 54}, {114, 54}, {114, 54},
-    {115, 54}, {116, 54}, {117, 54}, {118, 54}, {119, 54}, {120, 54}, {121, 55}, {122, 55},
-    {123, 55}, {124, 55}, {125, 55}, {126, 55}, {127, 55}, {128, 55}, {129, 55}, {130, 55}
-  },
-  {  // mag,nra for x=29 and y=0:127
-    { 29,  0}, { 29,  1}, { 29,  3}, { 29,  4}, { 29,  6}, { 29,  7}, { 30,  8}, { 30, 10},
-    { 30, 11}, { 30, 12}, { 31, 14}, { 31, 15}, { 31, 16}, { 32, 17}, { 32, 18}, { 33, 19},
-    { 33, 21}, { 34, 22}, { 34, 23}, { 35, 24}, { 35, 25}, { 36, 26}, { 36, 26}, { 37, 27},
-    { 38, 28}, { 38, 29}, { 39, 30}, { 40, 31}, { 40, 31}, { 41, 32}, { 42, 33}, { 42, 33},
-    { 43, 34}, { 44, 35}, { 45, 35}, { 45, 36}, { 46, 36}, { 47, 37}, { 48, 37}, { 49, 38},
-    { 49, 38}, { 50, 39}, { 51, 39}, { 52, 40}, { 53, 40}, { 54, 41}, { 54, 41}, { 55, 41},
-    { 56, 42}, { 57, 42}, { 58, 43}, { 59, 43}, { 60, 43}, { 60, 44}, { 61, 44}, { 62, 44},
-    { 63, 45}, { 64, 45}, { 65, 45}, { 66, 45}, { 67, 46}, { 68, 46}, { 68, 46}, { 69, 46},
-    { 70, 47}, { 71, 47}, { 72, 47}, { 73, 47}, { 74, 48}, { 75, 48}, { 76, 48}, { 77, 48},
-    { 78, 48}, { 79, 49}, { 79, 49}, { 80, 49}, { 81, 49}, { 82, 49}, { 83, 49}, { 84, 50},
-    { 85, 50}, { 86, 50}, { 87, 50}, { 88, 50}, { 89, 50}, { 90, 51}, { 91, 51}, { 92, 51},
-    { 93, 51}, { 94, 51}, { 95, 51}, { 96, 51}, { 96, 52}, { 97, 52}, { 98, 52}, { 99, 52},
-    {100, 52}, {101, 52}, {102, 52}, {103, 52}, {104, 52}, {105, 53}, {106, 53}, {107, 53},
-    {108, 53}, {109, 53}, {110, 53}, {111, 53}, {112, 53}, {113, 53}, {114, 53}, {115, 54},
-    {116, 54}, {117, 54}, {118, 54}, {119, 54}, {120, 54}, {121, 54}, {122, 54}, {122, 54},
-    {123, 54}, {124, 54}, {125, 54}, {126, 55}, {127, 55}, {128, 55}, {129, 55}, {130, 55}
-  },
-  {  // mag,nra for x=30 and y=0:127
-    { 30,  0}, { 30,  1}, { 30,  3}, { 30,  4}, { 30,  5}, { 30,  7}, { 31,  8}, { 31,  9},
-    { 31, 11}, { 31, 12}, { 32, 13}, { 32, 14}, { 32, 16}, { 33, 17}, { 33, 18}, { 34, 19},
-    { 34, 20}, { 34, 21}, { 35, 22}, { 36, 23}, { 36, 24}, { 37, 25}, { 37, 26}, { 38, 27},
-    { 38, 27}, { 39, 28}, { 40, 29}, { 40, 30}, { 41, 31}, { 42, 31}, { 42, 32}, { 43, 33},
-    { 44, 33}, { 45, 34}, { 45, 35}, { 46, 35}, { 47, 36}, { 48, 36}, { 48, 37}, { 49, 37},
-    { 50, 38}, { 51, 38}, { 52, 39}, { 52, 39}, { 53, 40}, { 54, 40}, { 55, 40}, { 56, 41},
-    { 57, 41}, { 57, 42}, { 58, 42}, { 59, 42}, { 60, 43}, { 61, 43}, { 62, 43}, { 63, 44},
-    { 64, 44}, { 64, 44}, { 65, 45}, { 66, 45}, { 67, 45}, { 68, 45}, { 69, 46}, { 70, 46},
-    { 71, 46}, { 72, 46}, { 72, 47}, { 73, 47}, { 74, 47}, { 75, 47}, { 76, 48}, { 77, 48},
-    { 78, 48}, { 79, 48}, { 80, 48}, { 81, 48}, { 82, 49}, { 83, 49}, { 84, 49}, { 85, 49},
-    { 85, 49}, { 86, 50}, { 87, 50}, { 88, 50}, { 89, 50}, { 90, 50}, { 91, 50}, { 92, 50},
-    { 93, 51}, { 94, 51}, { 95, 51}, { 96, 51}, { 97, 51}, { 98, 51}, { 99, 51}, {100, 52},
-    {101, 52}, {102, 52}, {102, 52}, {103, 52}, {104, 52}, {105, 52}, {106, 52}, {107, 52},
-    {108, 53}, {109, 53}, {110, 53}, {111, 53}, {112, 53}, {113, 53}, {114, 53}, {115, 53},
-    {116, 53}, {117, 53}, {118, 54}, {119, 54}, {120, 54}, {121, 54}, {122, 54}, {123, 54},
-    {124, 54}, {125, 54}, {126, 54}, {127, 54}, {128, 54}, {129, 54}, {130, 54}, {130, 55}
-  },
-  {  // mag,nra for x=31 and y=0:127
-    { 31,  0}, { 31,  1}, { 31,  3}, { 31,  4}, { 31,  5}, { 31,  7}, { 32,  8}, { 32,  9},
-    { 32, 10}, { 32, 12}, { 33, 13}, { 33, 14}, { 33, 15}, { 34, 16}, { 34, 17}, { 34, 18},
-    { 35, 19}, { 35, 20}, { 36, 21}, { 36, 22}, { 37, 23}, { 37, 24}, { 38, 25}, { 39, 26},
-    { 39, 27}, { 40, 28}, { 40, 28}, { 41, 29}, { 42, 30}, { 42, 31}, { 43, 31}, { 44, 32},
-    { 45, 33}, { 45, 33}, { 46, 34}, { 47, 34}, { 48, 35}, { 48, 36}, { 49, 36}, { 50, 37},
-    { 51, 37}, { 51, 38}, { 52, 38}, { 53, 39}, { 54, 39}, { 55, 39}, { 55, 40}, { 56, 40},
-    { 57, 41}, { 58, 41}, { 59, 41}, { 60, 42}, { 61, 42}, { 61, 42}, { 62, 43}, { 63, 43},
-    { 64, 43}, { 65, 44}, { 66, 44}, { 67, 44}, { 68, 45}, { 68, 45}, { 69, 45}, { 70, 45},
-    { 71, 46}, { 72, 46}, { 73, 46}, { 74, 46}, { 75, 47}, { 76, 47}, { 77, 47}, { 77, 47},
-    { 78, 47}, { 79, 48}, { 80, 48}, { 81, 48}, { 82, 48}, { 83, 48}, { 84, 49}, { 85, 49},
-    { 86, 49}, { 87, 49}, { 88, 49}, { 89, 49}, { 90, 50}, { 90, 50}, { 91, 50}, { 92, 50},
-    { 93, 50}, { 94, 50}, { 95, 50}, { 96, 51}, { 97, 51}, { 98, 51}, { 99, 51}, {100, 51},
-    {101, 51}, {102, 51}, {103, 52}, {104, 52}, {105, 52}, {106, 52}, {107, 52}, {108, 52},
-    {109, 52}, {109, 52}, {110, 52}, {111, 53}, {112, 53}, {113, 53}, {114, 53}, {115, 53},
-    {116, 53}, {117, 53}, {118, 53}, {119, 53}, {120, 53}, {121, 53}, {122, 54}, {123, 54},
-    {124, 54}, {125, 54}, {126, 54}, {127, 54}, {128, 54}, {129, 54}, {130, 54}, {131, 54}
-  },
-  {  // mag,nra for x=32 and y=0:127
-    { 32,  0}, { 32,  1}, { 32,  3}, { 32,  4}, { 32,  5}, { 32,  6}, { 33,  8}, { 33,  9},
-    { 33, 10}, { 33, 11}, { 34, 12}, { 34, 13}, { 34, 15}, { 35, 16}, { 35, 17}, { 35, 18},
-    { 36, 19}, { 36, 20}, { 37, 21}, { 37, 22}, { 38, 23}, { 38, 24}, { 39, 25}, { 39, 25},
-    { 40, 26}, { 41, 27}, { 41, 28}, { 42, 29}, { 43, 29}, { 43, 30}, { 44, 31}, { 45, 31},
-    { 45, 32}, { 46, 33}, { 47, 33}, { 47, 34}, { 48, 34}, { 49, 35}, { 50, 35}, { 50, 36},
-    { 51, 37}, { 52, 37}, { 53, 37}, { 54, 38}, { 54, 38}, { 55, 39}, { 56, 39}, { 57, 40},
-    { 58, 40}, { 59, 40}, { 59, 41}, { 60, 41}, { 61, 42}, { 62, 42}, { 63, 42}, { 64, 43},
-    { 64, 43}, { 65, 43}, { 66, 43}, { 67, 44}, { 68, 44}, { 69, 44}, { 70, 45}, { 71, 45},
-    { 72, 45}, { 72, 45}, { 73, 46}, { 74, 46}, { 75, 46}, { 76, 46}, { 77, 47}, { 78, 47},
-    { 79, 47}, { 80, 47}, { 81, 47}, { 82, 48}, { 82, 48}, { 83, 48}, { 84, 48}, { 85, 48},
-    { 86, 48}, { 87, 49}, { 88, 49}, { 89, 49}, { 90, 49}, { 91, 49}, { 92, 49}, { 93, 50},
-    { 94, 50}, { 95, 50}, { 96, 50}, { 96, 50}, { 97, 50}, { 98, 50}, { 99, 51}, {100, 51},
-    {101, 51}, {102, 51}, {103, 51}, {104, 51}, {105, 51}, {106, 51}, {107, 52}, {108, 52},
-    {109, 52}, {110, 52}, {111, 52}, {112, 52}, {113, 52}, {114, 52}, {115, 52}, {116, 53},
-    {116, 53}, {117, 53}, {118, 53}, {119, 53}, {120, 53}, {121, 53}, {122, 53}, {123, 53},
-    {124, 53}, {125, 53}, {126, 54}, {127, 54}, {128, 54}, {129, 54}, {130, 54}, {131, 54}
-  },
-  {  // mag,nra for x=33 and y=0:127
-    { 33,  0}, { 33,  1}, { 33,  2}, { 33,  4}, { 33,  5}, { 33,  6}, { 34,  7}, { 34,  9},
-    { 34, 10}, { 34, 11}, { 34, 12}, { 35, 13}, { 35, 14}, { 35, 15}, { 36, 16}, { 36, 17},
-    { 37, 18}, { 37, 19}, { 38, 20}, { 38, 21}, { 39, 22}, { 39, 23}, { 40, 24}, { 40, 25},
-    { 41, 26}, { 41, 26}, { 42, 27}, { 43, 28}, { 43, 29}, { 44, 29}, { 45, 30}, { 45, 31},
-    { 46, 31}, { 47, 32}, { 47, 33}, { 48, 33}, { 49, 34}, { 50, 34}, { 50, 35}, { 51, 35},
-    { 52, 36}, { 53, 36}, { 53, 37}, { 54, 37}, { 55, 38}, { 56, 38}, { 57, 39}, { 57, 39},
-    { 58, 39}, { 59, 40}, { 60, 40}, { 61, 41}, { 62, 41}, { 62, 41}, { 63, 42}, { 64, 42},
-    { 65, 42}, { 66, 43}, { 67, 43}, { 68, 43}, { 68, 44}, { 69, 44}, { 70, 44}, { 71, 44},
-    { 72, 45}, { 73, 45}, { 74, 45}, { 75, 45}, { 76, 46}, { 76, 46}, { 77, 46}, { 78, 46},
-    { 79, 46}, { 80, 47}, { 81, 47}, { 82, 47}, { 83, 47}, { 84, 48}, { 85, 48}, { 86, 48},
-    { 87, 48}, { 87, 48}, { 88, 48}, { 89, 49}, { 90, 49}, { 91, 49}, { 92, 49}, { 93, 49},
-    { 94, 49}, { 95, 50}, { 96, 50}, { 97, 50}, { 98, 50}, { 99, 50}, {100, 50}, {101, 50},
-    {102, 51}, {102, 51}, {103, 51}, {104, 51}, {105, 51}, {106, 51}, {107, 51}, {108, 51},
-    {109, 51}, {110, 52}, {111, 52}, {112, 52}, {113, 52}, {114, 52}, {115, 52}, {116, 52},
-    {117, 52}, {118, 52}, {119, 53}, {120, 53}, {121, 53}, {122, 53}, {123, 53}, {123, 53},
-    {124, 53}, {125, 53}, {126, 53}, {127, 53}, {128, 53}, {129, 53}, {130, 54}, {131, 54}
-  },
-  {  // mag,nra for x=34 and y=0:127
-    { 34,  0}, { 34,  1}, { 34,  2}, { 34,  4}, { 34,  5}, { 34,  6}, { 35,  7}, { 35,  8},
-    { 35,  9}, { 35, 11}, { 35, 12}, { 36, 13}, { 36, 14}, { 36, 15}, { 37, 16}, { 37, 17},
-    { 38, 18}, { 38, 19}, { 38, 20}, { 39, 21}, { 39, 22}, { 40, 23}, { 40, 23}, { 41, 24},
-    { 42, 25}, { 42, 26}, { 43, 27}, { 43, 27}, { 44, 28}, { 45, 29}, { 45, 29}, { 46, 30},
-    { 47, 31}, { 47, 31}, { 48, 32}, { 49, 33}, { 50, 33}, { 50, 34}, { 51, 34}, { 52, 35},
-    { 52, 35}, { 53, 36}, { 54, 36}, { 55, 37}, { 56, 37}, { 56, 38}, { 57, 38}, { 58, 38},
-    { 59, 39}, { 60, 39}, { 60, 40}, { 61, 40}, { 62, 40}, { 63, 41}, { 64, 41}, { 65, 41},
-    { 66, 42}, { 66, 42}, { 67, 42}, { 68, 43}, { 69, 43}, { 70, 43}, { 71, 44}, { 72, 44},
-    { 72, 44}, { 73, 44}, { 74, 45}, { 75, 45}, { 76, 45}, { 77, 45}, { 78, 46}, { 79, 46},
-    { 80, 46}, { 81, 46}, { 81, 46}, { 82, 47}, { 83, 47}, { 84, 47}, { 85, 47}, { 86, 47},
-    { 87, 48}, { 88, 48}, { 89, 48}, { 90, 48}, { 91, 48}, { 92, 48}, { 92, 49}, { 93, 49},
-    { 94, 49}, { 95, 49}, { 96, 49}, { 97, 49}, { 98, 50}, { 99, 50}, {100, 50}, {101, 50},
-    {102, 50}, {103, 50}, {104, 50}, {105, 51}, {106, 51}, {107, 51}, {108, 51}, {108, 51},
-    {109, 51}, {110, 51}, {111, 51}, {112, 51}, {113, 52}, {114, 52}, {115, 52}, {116, 52},
-    {117, 52}, {118, 52}, {119, 52}, {120, 52}, {121, 52}, {122, 52}, {123, 53}, {124, 53},
-    {125, 53}, {126, 53}, {127, 53}, {128, 53}, {129, 53}, {130, 53}, {131, 53}, {131, 53}
-  },
-  {  // mag,nra for x=35 and y=0:127
-    { 35,  0}, { 35,  1}, { 35,  2}, { 35,  3}, { 35,  5}, { 35,  6}, { 36,  7}, { 36,  8},
-    { 36,  9}, { 36, 10}, { 36, 11}, { 37, 12}, { 37, 13}, { 37, 14}, { 38, 16}, { 38, 16},
-    { 38, 17}, { 39, 18}, { 39, 19}, { 40, 20}, { 40, 21}, { 41, 22}, { 41, 23}, { 42, 24},
-    { 42, 24}, { 43, 25}, { 44, 26}, { 44, 27}, { 45, 27}, { 45, 28}, { 46, 29}, { 47, 30},
-    { 47, 30}, { 48, 31}, { 49, 31}, { 49, 32}, { 50, 33}, { 51, 33}, { 52, 34}, { 52, 34},
-    { 53, 35}, { 54, 35}, { 55, 36}, { 55, 36}, { 56, 37}, { 57, 37}, { 58, 37}, { 59, 38},
-    { 59, 38}, { 60, 39}, { 61, 39}, { 62, 39}, { 63, 40}, { 64, 40}, { 64, 41}, { 65, 41},
-    { 66, 41}, { 67, 42}, { 68, 42}, { 69, 42}, { 69, 42}, { 70, 43}, { 71, 43}, { 72, 43},
-    { 73, 44}, { 74, 44}, { 75, 44}, { 76, 44}, { 76, 45}, { 77, 45}, { 78, 45}, { 79, 45},
-    { 80, 46}, { 81, 46}, { 82, 46}, { 83, 46}, { 84, 46}, { 85, 47}, { 85, 47}, { 86, 47},
-    { 87, 47}, { 88, 47}, { 89, 48}, { 90, 48}, { 91, 48}, { 92, 48}, { 93, 48}, { 94, 48},
-    { 95, 49}, { 96, 49}, { 97, 49}, { 97, 49}, { 98, 49}, { 99, 49}, {100, 49}, {101, 50},
-    {102, 50}, {103, 50}, {104, 50}, {105, 50}, {106, 50}, {107, 50}, {108, 51}, {109, 51},
-    {110, 51}, {111, 51}, {112, 51}, {113, 51}, {114, 51}, {114, 51}, {115, 51}, {116, 52},
-    {117, 52}, {118, 52}, {119, 52}, {120, 52}, {121, 52}, {122, 52}, {123, 52}, {124, 52},
-    {125, 52}, {126, 53}, {127, 53}, {128, 53}, {129, 53}, {130, 53}, {131, 53}, {132, 53}
-  },
-  {  // mag,nra for x=36 and y=0:127
-    { 36,  0}, { 36,  1}, { 36,  2}, { 36,  3}, { 36,  5}, { 36,  6}, { 36,  7}, { 37,  8},
-    { 37,  9}, { 37, 10}, { 37, 11}, { 38, 12}, { 38, 13}, { 38, 14}, { 39, 15}, { 39, 16},
-    { 39, 17}, { 40, 18}, { 40, 19}, { 41, 20}, { 41, 21}, { 42, 22}, { 42, 22}, { 43, 23},
-    { 43, 24}, { 44, 25}, { 44, 25}, { 45, 26}, { 46, 27}, { 46, 28}, { 47, 28}, { 48, 29},
-    { 48, 30}, { 49, 30}, { 50, 31}, { 50, 31}, { 51, 32}, { 52, 33}, { 52, 33}, { 53, 34},
-    { 54, 34}, { 55, 35}, { 55, 35}, { 56, 36}, { 57, 36}, { 58, 37}, { 58, 37}, { 59, 37},
-    { 60, 38}, { 61, 38}, { 62, 39}, { 62, 39}, { 63, 39}, { 64, 40}, { 65, 40}, { 66, 40},
-    { 67, 41}, { 67, 41}, { 68, 41}, { 69, 42}, { 70, 42}, { 71, 42}, { 72, 43}, { 73, 43},
-    { 73, 43}, { 74, 43}, { 75, 44}, { 76, 44}, { 77, 44}, { 78, 44}, { 79, 45}, { 80, 45},
-    { 80, 45}, { 81, 45}, { 82, 46}, { 83, 46}, { 84, 46}, { 85, 46}, { 86, 46}, { 87, 47},
-    { 88, 47}, { 89, 47}, { 90, 47}, { 90, 47}, { 91, 48}, { 92, 48}, { 93, 48}, { 94, 48},
-    { 95, 48}, { 96, 48}, { 97, 48}, { 98, 49}, { 99, 49}, {100, 49}, {101, 49}, {102, 49},
-    {103, 49}, {103, 50}, {104, 50}, {105, 50}, {106, 50}, {107, 50}, {108, 50}, {109, 50},
-    {110, 50}, {111, 51}, {112, 51}, {113, 51}, {114, 51}, {115, 51}, {116, 51}, {117, 51},
-    {118, 51}, {119, 51}, {120, 52}, {121, 52}, {121, 52}, {122, 52}, {123, 52}, {124, 52},
-    {125, 52}, {126, 52}, {127, 52}, {128, 52}, {129, 52}, {130, 53}, {131, 53}, {132, 53}
-  },
-  {  // mag,nra for x=37 and y=0:127
-    { 37,  0}, { 37,  1}, { 37,  2}, { 37,  3}, { 37,  4}, { 37,  5}, { 37,  7}, { 38,  8},
-    { 38,  9}, { 38, 10}, { 38, 11}, { 39, 12}, { 39, 13}, { 39, 14}, { 40, 15}, { 40, 16},
-    { 40, 17}, { 41, 18}, { 41, 18}, { 42, 19}, { 42, 20}, { 43, 21}, { 43, 22}, { 44, 23},
-    { 44, 23}, { 45, 24}, { 45, 25}, { 46, 26}, { 46, 26}, { 47, 27}, { 48, 28}, { 48, 28},
-    { 49, 29}, { 50, 30}, { 50, 30}, { 51, 31}, { 52, 31}, { 52, 32}, { 53, 33}, { 54, 33},
-    { 54, 34}, { 55, 34}, { 56, 35}, { 57, 35}, { 57, 36}, { 58, 36}, { 59, 36}, { 60, 37},
-    { 61, 37}, { 61, 38}, { 62, 38}, { 63, 38}, { 64, 39}, { 65, 39}, { 65, 40}, { 66, 40},
-    { 67, 40}, { 68, 41}, { 69, 41}, { 70, 41}, { 70, 41}, { 71, 42}, { 72, 42}, { 73, 42},
-    { 74, 43}, { 75, 43}, { 76, 43}, { 77, 43}, { 77, 44}, { 78, 44}, { 79, 44}, { 80, 44},
-    { 81, 45}, { 82, 45}, { 83, 45}, { 84, 45}, { 85, 46}, { 85, 46}, { 86, 46}, { 87, 46},
-    { 88, 46}, { 89, 47}, { 90, 47}, { 91, 47}, { 92, 47}, { 93, 47}, { 94, 47}, { 95, 48},
-    { 95, 48}, { 96, 48}, { 97, 48}, { 98, 48}, { 99, 48}, {100, 49}, {101, 49}, {102, 49},
-    {103, 49}, {104, 49}, {105, 49}, {106, 49}, {107, 50}, {108, 50}, {109, 50}, {109, 50},
-    {110, 50}, {111, 50}, {112, 50}, {113, 50}, {114, 51}, {115, 51}, {116, 51}, {117, 51},
-    {118, 51}, {119, 51}, {120, 51}, {121, 51}, {122, 51}, {123, 52}, {124, 52}, {125, 52},
-    {126, 52}, {127, 52}, {127, 52}, {128, 52}, {129, 52}, {130, 52}, {131, 52}, {132, 52}
-  },
-  {  // mag,nra for x=38 and y=0:127
-    { 38,  0}, { 38,  1}, { 38,  2}, { 38,  3}, { 38,  4}, { 38,  5}, { 38,  6}, { 39,  7},
-    { 39,  8}, { 39,  9}, { 39, 10}, { 40, 11}, { 40, 12}, { 40, 13}, { 40, 14}, { 41, 15},
-    { 41, 16}, { 42, 17}, { 42, 18}, { 42, 19}, { 43, 20}, { 43, 21}, { 44, 21}, { 44, 22},
-    { 45, 23}, { 45, 24}, { 46, 24}, { 47, 25}, { 47, 26}, { 48, 27}, { 48, 27}, { 49, 28},
-    { 50, 29}, { 50, 29}, { 51, 30}, { 52, 30}, { 52, 31}, { 53, 31}, { 54, 32}, { 54, 33},
-    { 55, 33}, { 56, 34}, { 57, 34}, { 57, 35}, { 58, 35}, { 59, 35}, { 60, 36}, { 60, 36},
-    { 61, 37}, { 62, 37}, { 63, 38}, { 64, 38}, { 64, 38}, { 65, 39}, { 66, 39}, { 67, 39},
-    { 68, 40}, { 69, 40}, { 69, 40}, { 70, 41}, { 71, 41}, { 72, 41}, { 73, 42}, { 74, 42},
-    { 74, 42}, { 75, 42}, { 76, 43}, { 77, 43}, { 78, 43}, { 79, 43}, { 80, 44}, { 81, 44},
-    { 81, 44}, { 82, 44}, { 83, 45}, { 84, 45}, { 85, 45}, { 86, 45}, { 87, 46}, { 88, 46},
-    { 89, 46}, { 89, 46}, { 90, 46}, { 91, 47}, { 92, 47}, { 93, 47}, { 94, 47}, { 95, 47},
-    { 96, 47}, { 97, 48}, { 98, 48}, { 99, 48}, {100, 48}, {100, 48}, {101, 48}, {102, 48},
-    {103, 49}, {104, 49}, {105, 49}, {106, 49}, {107, 49}, {108, 49}, {109, 49}, {110, 50},
-    {111, 50}, {112, 50}, {113, 50}, {114, 50}, {114, 50}, {115, 50}, {116, 50}, {117, 51},
-    {118, 51}, {119, 51}, {120, 51}, {121, 51}, {122, 51}, {123, 51}, {124, 51}, {125, 51},
-    {126, 52}, {127, 52}, {128, 52}, {129, 52}, {130, 52}, {131, 52}, {132, 52}, {133, 52}
-  },
-  {  // mag,nra for x=39 and y=0:127
-    { 39,  0}, { 39,  1}, { 39,  2}, { 39,  3}, { 39,  4}, { 39,  5}, { 39,  6}, { 40,  7},
-    { 40,  8}, { 40,  9}, { 40, 10}, { 41, 11}, { 41, 12}, { 41, 13}, { 41, 14}, { 42, 15},
-    { 42, 16}, { 43, 17}, { 43, 18}, { 43, 18}, { 44, 19}, { 44, 20}, { 45, 21}, { 45, 22},
-    { 46, 22}, { 46, 23}, { 47, 24}, { 47, 25}, { 48, 25}, { 49, 26}, { 49, 27}, { 50, 27},
-    { 50, 28}, { 51, 29}, { 52, 29}, { 52, 30}, { 53, 30}, { 54, 31}, { 54, 31}, { 55, 32},
-    { 56, 33}, { 57, 33}, { 57, 34}, { 58, 34}, { 59, 34}, { 60, 35}, { 60, 35}, { 61, 36},
-    { 62, 36}, { 63, 37}, { 63, 37}, { 64, 37}, { 65, 38}, { 66, 38}, { 67, 39}, { 67, 39},
-    { 68, 39}, { 69, 40}, { 70, 40}, { 71, 40}, { 72, 41}, { 72, 41}, { 73, 41}, { 74, 41},
-    { 75, 42}, { 76, 42}, { 77, 42}, { 78, 43}, { 78, 43}, { 79, 43}, { 80, 43}, { 81, 44},
-    { 82, 44}, { 83, 44}, { 84, 44}, { 85, 44}, { 85, 45}, { 86, 45}, { 87, 45}, { 88, 45},
-    { 89, 46}, { 90, 46}, { 91, 46}, { 92, 46}, { 93, 46}, { 94, 46}, { 94, 47}, { 95, 47},
-    { 96, 47}, { 97, 47}, { 98, 47}, { 99, 48}, {100, 48}, {101, 48}, {102, 48}, {103, 48},
-    {104, 48}, {105, 48}, {105, 49}, {106, 49}, {107, 49}, {108, 49}, {109, 49}, {110, 49},
-    {111, 49}, {112, 50}, {113, 50}, {114, 50}, {115, 50}, {116, 50}, {117, 50}, {118, 50},
-    {119, 50}, {120, 50}, {120, 51}, {121, 51}, {122, 51}, {123, 51}, {124, 51}, {125, 51},
-    {126, 51}, {127, 51}, {128, 51}, {129, 51}, {130, 52}, {131, 52}, {132, 52}, {133, 52}
-  },
-  {  // mag,nra for x=40 and y=0:127
-    { 40,  0}, { 40,  1}, { 40,  2}, { 40,  3}, { 40,  4}, { 40,  5}, { 40,  6}, { 41,  7},
-    { 41,  8}, { 41,  9}, { 41, 10}, { 41, 11}, { 42, 12}, { 42, 13}, { 42, 14}, { 43, 15},
-    { 43, 16}, { 43, 16}, { 44, 17}, { 44, 18}, { 45, 19}, { 45, 20}, { 46, 20}, { 46, 21},
-    { 47, 22}, { 47, 23}, { 48, 23}, { 48, 24}, { 49, 25}, { 49, 26}, { 50, 26}, { 51, 27},
-    { 51, 27}, { 52, 28}, { 52, 29}, { 53, 29}, { 54, 30}, { 54, 30}, { 55, 31}, { 56, 31},
-    { 57, 32}, { 57, 33}, { 58, 33}, { 59, 33}, { 59, 34}, { 60, 34}, { 61, 35}, { 62, 35},
-    { 62, 36}, { 63, 36}, { 64, 37}, { 65, 37}, { 66, 37}, { 66, 38}, { 67, 38}, { 68, 38},
-    { 69, 39}, { 70, 39}, { 70, 39}, { 71, 40}, { 72, 40}, { 73, 40}, { 74, 41}, { 75, 41},
-    { 75, 41}, { 76, 42}, { 77, 42}, { 78, 42}, { 79, 42}, { 80, 43}, { 81, 43}, { 81, 43},
-    { 82, 43}, { 83, 44}, { 84, 44}, { 85, 44}, { 86, 44}, { 87, 44}, { 88, 45}, { 89, 45},
-    { 89, 45}, { 90, 45}, { 91, 46}, { 92, 46}, { 93, 46}, { 94, 46}, { 95, 46}, { 96, 46},
-    { 97, 47}, { 98, 47}, { 98, 47}, { 99, 47}, {100, 47}, {101, 47}, {102, 48}, {103, 48},
-    {104, 48}, {105, 48}, {106, 48}, {107, 48}, {108, 48}, {109, 49}, {110, 49}, {110, 49},
-    {111, 49}, {112, 49}, {113, 49}, {114, 49}, {115, 50}, {116, 50}, {117, 50}, {118, 50},
-    {119, 50}, {120, 50}, {121, 50}, {122, 50}, {123, 50}, {124, 51}, {125, 51}, {126, 51},
-    {126, 51}, {127, 51}, {128, 51}, {129, 51}, {130, 51}, {131, 51}, {132, 51}, {133, 52}
-  },
-  {  // mag,nra for x=41 and y=0:127
-    { 41,  0}, { 41,  1}, { 41,  2}, { 41,  3}, { 41,  4}, { 41,  5}, { 41,  6}, { 42,  7},
-    { 42,  8}, { 42,  9}, { 42, 10}, { 42, 11}, { 43, 12}, { 43, 13}, { 43, 13}, { 44, 14},
-    { 44, 15}, { 44, 16}, { 45, 17}, { 45, 18}, { 46, 18}, { 46, 19}, { 47, 20}, { 47, 21},
-    { 48, 22}, { 48, 22}, { 49, 23}, { 49, 24}, { 50, 24}, { 50, 25}, { 51, 26}, { 51, 26},
-    { 52, 27}, { 53, 28}, { 53, 28}, { 54, 29}, { 55, 29}, { 55, 30}, { 56, 30}, { 57, 31},
-    { 57, 31}, { 58, 32}, { 59, 32}, { 59, 33}, { 60, 33}, { 61, 34}, { 62, 34}, { 62, 35},
-    { 63, 35}, { 64, 36}, { 65, 36}, { 65, 36}, { 66, 37}, { 67, 37}, { 68, 38}, { 69, 38},
-    { 69, 38}, { 70, 39}, { 71, 39}, { 72, 39}, { 73, 40}, { 73, 40}, { 74, 40}, { 75, 40},
-    { 76, 41}, { 77, 41}, { 78, 41}, { 79, 42}, { 79, 42}, { 80, 42}, { 81, 42}, { 82, 43},
-    { 83, 43}, { 84, 43}, { 85, 43}, { 85, 44}, { 86, 44}, { 87, 44}, { 88, 44}, { 89, 44},
-    { 90, 45}, { 91, 45}, { 92, 45}, { 93, 45}, { 93, 45}, { 94, 46}, { 95, 46}, { 96, 46},
-    { 97, 46}, { 98, 46}, { 99, 47}, {100, 47}, {101, 47}, {102, 47}, {103, 47}, {103, 47},
-    {104, 48}, {105, 48}, {106, 48}, {107, 48}, {108, 48}, {109, 48}, {110, 48}, {111, 49},
-    {112, 49}, {113, 49}, {114, 49}, {115, 49}, {116, 49}, {116, 49}, {117, 49}, {118, 50},
-    {119, 50}, {120, 50}, {121, 50}, {122, 50}, {123, 50}, {124, 50}, {125, 50}, {126, 50},
-    {127, 51}, {128, 51}, {129, 51}, {130, 51}, {131, 51}, {132, 51}, {133, 51}, {133, 51}
-  },
-  {  // mag,nra for x=42 and y=0:127
-    { 42,  0}, { 42,  1}, { 42,  2}, { 42,  3}, { 42,  4}, { 42,  5}, { 42,  6}, { 43,  7},
-    { 43,  8}, { 43,  9}, { 43, 10}, { 43, 10}, { 44, 11}, { 44, 12}, { 44, 13}, { 45, 14},
-    { 45, 15}, { 45, 16}, { 46, 16}, { 46, 17}, { 47, 18}, { 47, 19}, { 47, 20}, { 48, 20},
-    { 48, 21}, { 49, 22}, { 49, 23}, { 50, 23}, { 50, 24}, { 51, 25}, { 52, 25}, { 52, 26},
-    { 53, 27}, { 53, 27}, { 54, 28}, { 55, 28}, { 55, 29}, { 56, 29}, { 57, 30}, { 57, 30},
-    { 58, 31}, { 59, 32}, { 59, 32}, { 60, 32}, { 61, 33}, { 62, 33}, { 62, 34}, { 63, 34},
-    { 64, 35}, { 65, 35}, { 65, 36}, { 66, 36}, { 67, 36}, { 68, 37}, { 68, 37}, { 69, 37},
-    { 70, 38}, { 71, 38}, { 72, 38}, { 72, 39}, { 73, 39}, { 74, 39}, { 75, 40}, { 76, 40},
-    { 77, 40}, { 77, 41}, { 78, 41}, { 79, 41}, { 80, 41}, { 81, 42}, { 82, 42}, { 82, 42},
-    { 83, 42}, { 84, 43}, { 85, 43}, { 86, 43}, { 87, 43}, { 88, 44}, { 89, 44}, { 89, 44},
-    { 90, 44}, { 91, 45}, { 92, 45}, { 93, 45}, { 94, 45}, { 95, 45}, { 96, 45}, { 97, 46},
-    { 98, 46}, { 98, 46}, { 99, 46}, {100, 46}, {101, 47}, {102, 47}, {103, 47}, {104, 47},
-    {105, 47}, {106, 47}, {107, 48}, {108, 48}, {108, 48}, {109, 48}, {110, 48}, {111, 48},
-    {112, 48}, {113, 48}, {114, 49}, {115, 49}, {116, 49}, {117, 49}, {118, 49}, {119, 49},
-    {120, 49}, {121, 50}, {121, 50}, {122, 50}, {123, 50}, {124, 50}, {125, 50}, {126, 50},
-    {127, 50}, {128, 50}, {129, 50}, {130, 51}, {131, 51}, {132, 51}, {133, 51}, {134, 51}
-  },
-  {  // mag,nra for x=43 and y=0:127
-    { 43,  0}, { 43,  1}, { 43,  2}, { 43,  3}, { 43,  4}, { 43,  5}, { 43,  6}, { 44,  7},
-    { 44,  7}, { 44,  8}, { 44,  9}, { 44, 10}, { 45, 11}, { 45, 12}, { 45, 13}, { 46, 14},
-    { 46, 15}, { 46, 15}, { 47, 16}, { 47, 17}, { 47, 18}, { 48, 19}, { 48, 19}, { 49, 20},
-    { 49, 21}, { 50, 21}, { 50, 22}, { 51, 23}, { 51, 24}, { 52, 24}, { 52, 25}, { 53, 25},
-    { 54, 26}, { 54, 27}, { 55, 27}, { 55, 28}, { 56, 28}, { 57, 29}, { 57, 29}, { 58, 30},
-    { 59, 31}, { 59, 31}, { 60, 32}, { 61, 32}, { 62, 32}, { 62, 33}, { 63, 33}, { 64, 34},
-    { 64, 34}, { 65, 35}, { 66, 35}, { 67, 35}, { 67, 36}, { 68, 36}, { 69, 37}, { 70, 37},
-    { 71, 37}, { 71, 38}, { 72, 38}, { 73, 38}, { 74, 39}, { 75, 39}, { 75, 39}, { 76, 40},
-    { 77, 40}, { 78, 40}, { 79, 40}, { 80, 41}, { 80, 41}, { 81, 41}, { 82, 42}, { 83, 42},
-    { 84, 42}, { 85, 42}, { 86, 43}, { 86, 43}, { 87, 43}, { 88, 43}, { 89, 43}, { 90, 44},
-    { 91, 44}, { 92, 44}, { 93, 44}, { 93, 45}, { 94, 45}, { 95, 45}, { 96, 45}, { 97, 45},
-    { 98, 45}, { 99, 46}, {100, 46}, {101, 46}, {102, 46}, {102, 46}, {103, 47}, {104, 47},
-    {105, 47}, {106, 47}, {107, 47}, {108, 47}, {109, 47}, {110, 48}, {111, 48}, {112, 48},
-    {113, 48}, {113, 48}, {114, 48}, {115, 48}, {116, 49}, {117, 49}, {118, 49}, {119, 49},
-    {120, 49}, {121, 49}, {122, 49}, {123, 49}, {124, 50}, {125, 50}, {126, 50}, {127, 50},
-    {127, 50}, {128, 50}, {129, 50}, {130, 50}, {131, 50}, {132, 51}, {133, 51}, {134, 51}
-  },
-  {  // mag,nra for x=44 and y=0:127
-    { 44,  0}, { 44,  1}, { 44,  2}, { 44,  3}, { 44,  4}, { 44,  5}, { 44,  6}, { 45,  6},
-    { 45,  7}, { 45,  8}, { 45,  9}, { 45, 10}, { 46, 11}, { 46, 12}, { 46, 13}, { 46, 13},
-    { 47, 14}, { 47, 15}, { 48, 16}, { 48, 17}, { 48, 17}, { 49, 18}, { 49, 19}, { 50, 20},
-    { 50, 20}, { 51, 21}, { 51, 22}, { 52, 22}, { 52, 23}, { 53, 24}, { 53, 24}, { 54, 25},
-    { 54, 26}, { 55, 26}, { 56, 27}, { 56, 27}, { 57, 28}, { 57, 28}, { 58, 29}, { 59, 30},
-    { 59, 30}, { 60, 31}, { 61, 31}, { 62, 32}, { 62, 32}, { 63, 32}, { 64, 33}, { 64, 33},
-    { 65, 34}, { 66, 34}, { 67, 35}, { 67, 35}, { 68, 35}, { 69, 36}, { 70, 36}, { 70, 37},
-    { 71, 37}, { 72, 37}, { 73, 38}, { 74, 38}, { 74, 38}, { 75, 39}, { 76, 39}, { 77, 39},
-    { 78, 39}, { 78, 40}, { 79, 40}, { 80, 40}, { 81, 41}, { 82, 41}, { 83, 41}, { 84, 41},
-    { 84, 42}, { 85, 42}, { 86, 42}, { 87, 42}, { 88, 43}, { 89, 43}, { 90, 43}, { 90, 43},
-    { 91, 44}, { 92, 44}, { 93, 44}, { 94, 44}, { 95, 44}, { 96, 45}, { 97, 45}, { 97, 45},
-    { 98, 45}, { 99, 45}, {100, 45}, {101, 46}, {102, 46}, {103, 46}, {104, 46}, {105, 46},
-    {106, 46}, {107, 47}, {107, 47}, {108, 47}, {109, 47}, {110, 47}, {111, 47}, {112, 48},
-    {113, 48}, {114, 48}, {115, 48}, {116, 48}, {117, 48}, {118, 48}, {118, 48}, {119, 49},
-    {120, 49}, {121, 49}, {122, 49}, {123, 49}, {124, 49}, {125, 49}, {126, 49}, {127, 50},
-    {128, 50}, {129, 50}, {130, 50}, {131, 50}, {132, 50}, {133, 50}, {133, 50}, {134, 50}
-  },
-  {  // mag,nra for x=45 and y=0:127
-    { 45,  0}, { 45,  1}, { 45,  2}, { 45,  3}, { 45,  4}, { 45,  5}, { 45,  5}, { 46,  6},
-    { 46,  7}, { 46,  8}, { 46,  9}, { 46, 10}, { 47, 11}, { 47, 11}, { 47, 12}, { 47, 13},
-    { 48, 14}, { 48, 15}, { 48, 16}, { 49, 16}, { 49, 17}, { 50, 18}, { 50, 19}, { 51, 19},
-    { 51, 20}, { 51, 21}, { 52, 21}, { 52, 22}, { 53, 23}, { 54, 23}, { 54, 24}, { 55, 25},
-    { 55, 25}, { 56, 26}, { 56, 26}, { 57, 27}, { 58, 27}, { 58, 28}, { 59, 29}, { 60, 29},
-    { 60, 30}, { 61, 30}, { 62, 31}, { 62, 31}, { 63, 32}, { 64, 32}, { 64, 32}, { 65, 33},
-    { 66, 33}, { 67, 34}, { 67, 34}, { 68, 35}, { 69, 35}, { 70, 35}, { 70, 36}, { 71, 36},
-    { 72, 36}, { 73, 37}, { 73, 37}, { 74, 37}, { 75, 38}, { 76, 38}, { 77, 38}, { 77, 39},
-    { 78, 39}, { 79, 39}, { 80, 40}, { 81, 40}, { 82, 40}, { 82, 40}, { 83, 41}, { 84, 41},
-    { 85, 41}, { 86, 41}, { 87, 42}, { 87, 42}, { 88, 42}, { 89, 42}, { 90, 43}, { 91, 43},
-    { 92, 43}, { 93, 43}, { 94, 44}, { 94, 44}, { 95, 44}, { 96, 44}, { 97, 44}, { 98, 45},
-    { 99, 45}, {100, 45}, {101, 45}, {102, 45}, {102, 45}, {103, 46}, {104, 46}, {105, 46},
-    {106, 46}, {107, 46}, {108, 46}, {109, 47}, {110, 47}, {111, 47}, {111, 47}, {112, 47},
-    {113, 47}, {114, 48}, {115, 48}, {116, 48}, {117, 48}, {118, 48}, {119, 48}, {120, 48},
-    {121, 48}, {122, 49}, {123, 49}, {123, 49}, {124, 49}, {125, 49}, {126, 49}, {127, 49},
-    {128, 49}, {129, 49}, {130, 50}, {131, 50}, {132, 50}, {133, 50}, {134, 50}, {135, 50}
-  },
-  {  // mag,nra for x=46 and y=0:127
-    { 46,  0}, { 46,  1}, { 46,  2}, { 46,  3}, { 46,  4}, { 46,  4}, { 46,  5}, { 47,  6},
-    { 47,  7}, { 47,  8}, { 47,  9}, { 47, 10}, { 48, 10}, { 48, 11}, { 48, 12}, { 48, 13},
-    { 49, 14}, { 49, 14}, { 49, 15}, { 50, 16}, { 50, 17}, { 51, 17}, { 51, 18}, { 51, 19},
-    { 52, 20}, { 52, 20}, { 53, 21}, { 53, 22}, { 54, 22}, { 54, 23}, { 55, 24}, { 55, 24},
-    { 56, 25}, { 57, 25}, { 57, 26}, { 58, 27}, { 58, 27}, { 59, 28}, { 60, 28}, { 60, 29},
-    { 61, 29}, { 62, 30}, { 62, 30}, { 63, 31}, { 64, 31}, { 64, 32}, { 65, 32}, { 66, 32},
-    { 66, 33}, { 67, 33}, { 68, 34}, { 69, 34}, { 69, 34}, { 70, 35}, { 71, 35}, { 72, 36},
-    { 72, 36}, { 73, 36}, { 74, 37}, { 75, 37}, { 76, 37}, { 76, 38}, { 77, 38}, { 78, 38},
-    { 79, 39}, { 80, 39}, { 80, 39}, { 81, 39}, { 82, 40}, { 83, 40}, { 84, 40}, { 85, 41},
-    { 85, 41}, { 86, 41}, { 87, 41}, { 88, 42}, { 89, 42}, { 90, 42}, { 91, 42}, { 91, 43},
-    { 92, 43}, { 93, 43}, { 94, 43}, { 95, 43}, { 96, 44}, { 97, 44}, { 98, 44}, { 98, 44},
-    { 99, 44}, {100, 45}, {101, 45}, {102, 45}, {103, 45}, {104, 45}, {105, 45}, {106, 46},
-    {106, 46}, {107, 46}, {108, 46}, {109, 46}, {110, 46}, {111, 47}, {112, 47}, {113, 47},
-    {114, 47}, {115, 47}, {116, 47}, {116, 47}, {117, 48}, {118, 48}, {119, 48}, {120, 48},
-    {121, 48}, {122, 48}, {123, 48}, {124, 48}, {125, 49}, {126, 49}, {127, 49}, {128, 49},
-    {129, 49}, {129, 49}, {130, 49}, {131, 49}, {132, 50}, {133, 50}, {134, 50}, {135, 50}
-  },
-  {  // mag,nra for x=47 and y=0:127
-    { 47,  0}, { 47,  1}, { 47,  2}, { 47,  3}, { 47,  3}, { 47,  4}, { 47,  5}, { 48,  6},
-    { 48,  7}, { 48,  8}, { 48,  9}, { 48,  9}, { 49, 10}, { 49, 11}, { 49, 12}, { 49, 13},
-    { 50, 13}, { 50, 14}, { 50, 15}, { 51, 16}, { 51, 16}, { 51, 17}, { 52, 18}, { 52, 19},
-    { 53, 19}, { 53, 20}, { 54, 21}, { 54, 21}, { 55, 22}, { 55, 23}, { 56, 23}, { 56, 24},
-    { 57, 24}, { 57, 25}, { 58, 26}, { 59, 26}, { 59, 27}, { 60, 27}, { 60, 28}, { 61, 28},
-    { 62, 29}, { 62, 29}, { 63, 30}, { 64, 30}, { 64, 31}, { 65, 31}, { 66, 32}, { 66, 32},
-    { 67, 32}, { 68, 33}, { 69, 33}, { 69, 34}, { 70, 34}, { 71, 34}, { 72, 35}, { 72, 35},
-    { 73, 36}, { 74, 36}, { 75, 36}, { 75, 37}, { 76, 37}, { 77, 37}, { 78, 38}, { 79, 38},
-    { 79, 38}, { 80, 38}, { 81, 39}, { 82, 39}, { 83, 39}, { 83, 40}, { 84, 40}, { 85, 40},
-    { 86, 40}, { 87, 41}, { 88, 41}, { 89, 41}, { 89, 41}, { 90, 42}, { 91, 42}, { 92, 42},
-    { 93, 42}, { 94, 43}, { 95, 43}, { 95, 43}, { 96, 43}, { 97, 43}, { 98, 44}, { 99, 44},
-    {100, 44}, {101, 44}, {102, 44}, {102, 45}, {103, 45}, {104, 45}, {105, 45}, {106, 45},
-    {107, 45}, {108, 46}, {109, 46}, {110, 46}, {110, 46}, {111, 46}, {112, 46}, {113, 47},
-    {114, 47}, {115, 47}, {116, 47}, {117, 47}, {118, 47}, {119, 47}, {120, 48}, {121, 48},
-    {121, 48}, {122, 48}, {123, 48}, {124, 48}, {125, 48}, {126, 48}, {127, 49}, {128, 49},
-    {129, 49}, {130, 49}, {131, 49}, {132, 49}, {133, 49}, {134, 49}, {134, 49}, {135, 50}
-  },
-  {  // mag,nra for x=48 and y=0:127
-    { 48,  0}, { 48,  1}, { 48,  2}, { 48,  3}, { 48,  3}, { 48,  4}, { 48,  5}, { 49,  6},
-    { 49,  7}, { 49,  8}, { 49,  8}, { 49,  9}, { 49, 10}, { 50, 11}, { 50, 12}, { 50, 12},
-    { 51, 13}, { 51, 14}, { 51, 15}, { 52, 15}, { 52, 16}, { 52, 17}, { 53, 18}, { 53, 18},
-    { 54, 19}, { 54, 20}, { 55, 20}, { 55, 21}, { 56, 22}, { 56, 22}, { 57, 23}, { 57, 23},
-    { 58, 24}, { 58, 25}, { 59, 25}, { 59, 26}, { 60, 26}, { 61, 27}, { 61, 27}, { 62, 28},
-    { 62, 28}, { 63, 29}, { 64, 29}, { 64, 30}, { 65, 30}, { 66, 31}, { 66, 31}, { 67, 32},
-    { 68, 32}, { 69, 32}, { 69, 33}, { 70, 33}, { 71, 34}, { 72, 34}, { 72, 34}, { 73, 35},
-    { 74, 35}, { 75, 35}, { 75, 36}, { 76, 36}, { 77, 37}, { 78, 37}, { 78, 37}, { 79, 37},
-    { 80, 38}, { 81, 38}, { 82, 38}, { 82, 39}, { 83, 39}, { 84, 39}, { 85, 40}, { 86, 40},
-    { 87, 40}, { 87, 40}, { 88, 41}, { 89, 41}, { 90, 41}, { 91, 41}, { 92, 42}, { 92, 42},
-    { 93, 42}, { 94, 42}, { 95, 42}, { 96, 43}, { 97, 43}, { 98, 43}, { 98, 43}, { 99, 43},
-    {100, 44}, {101, 44}, {102, 44}, {103, 44}, {104, 44}, {105, 45}, {106, 45}, {106, 45},
-    {107, 45}, {108, 45}, {109, 45}, {110, 46}, {111, 46}, {112, 46}, {113, 46}, {114, 46},
-    {115, 46}, {115, 47}, {116, 47}, {117, 47}, {118, 47}, {119, 47}, {120, 47}, {121, 47},
-    {122, 48}, {123, 48}, {124, 48}, {125, 48}, {126, 48}, {126, 48}, {127, 48}, {128, 48},
-    {129, 48}, {130, 49}, {131, 49}, {132, 49}, {133, 49}, {134, 49}, {135, 49}, {136, 49}
-  },
-  {  // mag,nra for x=49 and y=0:127
-    { 49,  0}, { 49,  1}, { 49,  2}, { 49,  2}, { 49,  3}, { 49,  4}, { 49,  5}, { 49,  6},
-    { 50,  7}, { 50,  7}, { 50,  8}, { 50,  9}, { 50, 10}, { 51, 11}, { 51, 11}, { 51, 12},
-    { 52, 13}, { 52, 14}, { 52, 14}, { 53, 15}, { 53, 16}, { 53, 16}, { 54, 17}, { 54, 18},
-    { 55, 19}, { 55, 19}, { 55, 20}, { 56, 21}, { 56, 21}, { 57, 22}, { 57, 22}, { 58, 23},
-    { 59, 24}, { 59, 24}, { 60, 25}, { 60, 25}, { 61, 26}, { 61, 26}, { 62, 27}, { 63, 27},
-    { 63, 28}, { 64, 28}, { 65, 29}, { 65, 29}, { 66, 30}, { 67, 30}, { 67, 31}, { 68, 31},
-    { 69, 32}, { 69, 32}, { 70, 32}, { 71, 33}, { 71, 33}, { 72, 34}, { 73, 34}, { 74, 34},
-    { 74, 35}, { 75, 35}, { 76, 35}, { 77, 36}, { 77, 36}, { 78, 36}, { 79, 37}, { 80, 37},
-    { 81, 37}, { 81, 38}, { 82, 38}, { 83, 38}, { 84, 39}, { 85, 39}, { 85, 39}, { 86, 39},
-    { 87, 40}, { 88, 40}, { 89, 40}, { 90, 40}, { 90, 41}, { 91, 41}, { 92, 41}, { 93, 41},
-    { 94, 42}, { 95, 42}, { 96, 42}, { 96, 42}, { 97, 42}, { 98, 43}, { 99, 43}, {100, 43},
-    {101, 43}, {102, 43}, {102, 44}, {103, 44}, {104, 44}, {105, 44}, {106, 44}, {107, 45},
-    {108, 45}, {109, 45}, {110, 45}, {110, 45}, {111, 45}, {112, 46}, {113, 46}, {114, 46},
-    {115, 46}, {116, 46}, {117, 46}, {118, 47}, {119, 47}, {120, 47}, {120, 47}, {121, 47},
-    {122, 47}, {123, 47}, {124, 47}, {125, 48}, {126, 48}, {127, 48}, {128, 48}, {129, 48},
-    {130, 48}, {131, 48}, {131, 48}, {132, 49}, {133, 49}, {134, 49}, {135, 49}, {136, 49}
-  },
-  {  // mag,nra for x=50 and y=0:127
-    { 50,  0}, { 50,  1}, { 50,  2}, { 50,  2}, { 50,  3}, { 50,  4}, { 50,  5}, { 50,  6},
-    { 51,  6}, { 51,  7}, { 51,  8}, { 51,  9}, { 51, 10}, { 52, 10}, { 52, 11}, { 52, 12},
-    { 52, 13}, { 53, 13}, { 53, 14}, { 53, 15}, { 54, 16}, { 54, 16}, { 55, 17}, { 55, 18},
-    { 55, 18}, { 56, 19}, { 56, 20}, { 57, 20}, { 57, 21}, { 58, 21}, { 58, 22}, { 59, 23},
-    { 59, 23}, { 60, 24}, { 60, 24}, { 61, 25}, { 62, 25}, { 62, 26}, { 63, 26}, { 63, 27},
-    { 64, 27}, { 65, 28}, { 65, 28}, { 66, 29}, { 67, 29}, { 67, 30}, { 68, 30}, { 69, 31},
-    { 69, 31}, { 70, 32}, { 71, 32}, { 71, 32}, { 72, 33}, { 73, 33}, { 74, 34}, { 74, 34},
-    { 75, 34}, { 76, 35}, { 77, 35}, { 77, 35}, { 78, 36}, { 79, 36}, { 80, 36}, { 80, 37},
-    { 81, 37}, { 82, 37}, { 83, 38}, { 84, 38}, { 84, 38}, { 85, 38}, { 86, 39}, { 87, 39},
-    { 88, 39}, { 88, 40}, { 89, 40}, { 90, 40}, { 91, 40}, { 92, 41}, { 93, 41}, { 93, 41},
-    { 94, 41}, { 95, 41}, { 96, 42}, { 97, 42}, { 98, 42}, { 99, 42}, { 99, 43}, {100, 43},
-    {101, 43}, {102, 43}, {103, 43}, {104, 44}, {105, 44}, {106, 44}, {106, 44}, {107, 44},
-    {108, 44}, {109, 45}, {110, 45}, {111, 45}, {112, 45}, {113, 45}, {114, 45}, {114, 46},
-    {115, 46}, {116, 46}, {117, 46}, {118, 46}, {119, 46}, {120, 46}, {121, 47}, {122, 47},
-    {123, 47}, {124, 47}, {124, 47}, {125, 47}, {126, 47}, {127, 48}, {128, 48}, {129, 48},
-    {130, 48}, {131, 48}, {132, 48}, {133, 48}, {134, 48}, {135, 48}, {136, 49}, {136, 49}
-  },
-  {  // mag,nra for x=51 and y=0:127
-    { 51,  0}, { 51,  1}, { 51,  2}, { 51,  2}, { 51,  3}, { 51,  4}, { 51,  5}, { 51,  6},
-    { 52,  6}, { 52,  7}, { 52,  8}, { 52,  9}, { 52,  9}, { 53, 10}, { 53, 11}, { 53, 12},
-    { 53, 12}, { 54, 13}, { 54, 14}, { 54, 15}, { 55, 15}, { 55, 16}, { 56, 17}, { 56, 17},
-    { 56, 18}, { 57, 19}, { 57, 19}, { 58, 20}, { 58, 20}, { 59, 21}, { 59, 22}, { 60, 22},
-    { 60, 23}, { 61, 23}, { 61, 24}, { 62, 25}, { 62, 25}, { 63, 26}, { 64, 26}, { 64, 27},
-    { 65, 27}, { 65, 28}, { 66, 28}, { 67, 29}, { 67, 29}, { 68, 29}, { 69, 30}, { 69, 30},
-    { 70, 31}, { 71, 31}, { 71, 32}, { 72, 32}, { 73, 32}, { 74, 33}, { 74, 33}, { 75, 34},
-    { 76, 34}, { 76, 34}, { 77, 35}, { 78, 35}, { 79, 35}, { 80, 36}, { 80, 36}, { 81, 36},
-    { 82, 37}, { 83, 37}, { 83, 37}, { 84, 37}, { 85, 38}, { 86, 38}, { 87, 38}, { 87, 39},
-    { 88, 39}, { 89, 39}, { 90, 39}, { 91, 40}, { 92, 40}, { 92, 40}, { 93, 40}, { 94, 41},
-    { 95, 41}, { 96, 41}, { 97, 41}, { 97, 42}, { 98, 42}, { 99, 42}, {100, 42}, {101, 42},
-    {102, 43}, {103, 43}, {103, 43}, {104, 43}, {105, 43}, {106, 44}, {107, 44}, {108, 44},
-    {109, 44}, {110, 44}, {110, 44}, {111, 45}, {112, 45}, {113, 45}, {114, 45}, {115, 45},
-    {116, 45}, {117, 46}, {118, 46}, {119, 46}, {119, 46}, {120, 46}, {121, 46}, {122, 46},
-    {123, 47}, {124, 47}, {125, 47}, {126, 47}, {127, 47}, {128, 47}, {129, 47}, {129, 48},
-    {130, 48}, {131, 48}, {132, 48}, {133, 48}, {134, 48}, {135, 48}, {136, 48}, {137, 48}
-  },
-  {  // mag,nra for x=52 and y=0:127
-    { 52,  0}, { 52,  1}, { 52,  2}, { 52,  2}, { 52,  3}, { 52,  4}, { 52,  5}, { 52,  5},
-    { 53,  6}, { 53,  7}, { 53,  8}, { 53,  8}, { 53,  9}, { 54, 10}, { 54, 11}, { 54, 11},
-    { 54, 12}, { 55, 13}, { 55, 14}, { 55, 14}, { 56, 15}, { 56, 16}, { 56, 16}, { 57, 17},
-    { 57, 18}, { 58, 18}, { 58, 19}, { 59, 20}, { 59, 20}, { 60, 21}, { 60, 21}, { 61, 22},
-    { 61, 22}, { 62, 23}, { 62, 24}, { 63, 24}, { 63, 25}, { 64, 25}, { 64, 26}, { 65, 26},
-    { 66, 27}, { 66, 27}, { 67, 28}, { 67, 28}, { 68, 29}, { 69, 29}, { 69, 30}, { 70, 30},
-    { 71, 30}, { 71, 31}, { 72, 31}, { 73, 32}, { 74, 32}, { 74, 32}, { 75, 33}, { 76, 33},
-    { 76, 34}, { 77, 34}, { 78, 34}, { 79, 35}, { 79, 35}, { 80, 35}, { 81, 36}, { 82, 36},
-    { 82, 36}, { 83, 37}, { 84, 37}, { 85, 37}, { 86, 37}, { 86, 38}, { 87, 38}, { 88, 38},
-    { 89, 39}, { 90, 39}, { 90, 39}, { 91, 39}, { 92, 40}, { 93, 40}, { 94, 40}, { 95, 40},
-    { 95, 41}, { 96, 41}, { 97, 41}, { 98, 41}, { 99, 41}, {100, 42}, {100, 42}, {101, 42},
-    {102, 42}, {103, 42}, {104, 43}, {105, 43}, {106, 43}, {107, 43}, {107, 43}, {108, 44},
-    {109, 44}, {110, 44}, {111, 44}, {112, 44}, {113, 44}, {114, 45}, {114, 45}, {115, 45},
-    {116, 45}, {117, 45}, {118, 45}, {119, 46}, {120, 46}, {121, 46}, {122, 46}, {123, 46},
-    {123, 46}, {124, 46}, {125, 47}, {126, 47}, {127, 47}, {128, 47}, {129, 47}, {130, 47},
-    {131, 47}, {132, 47}, {133, 48}, {134, 48}, {134, 48}, {135, 48}, {136, 48}, {137, 48}
-  },
-  {  // mag,nra for x=53 and y=0:127
-    { 53,  0}, { 53,  1}, { 53,  2}, { 53,  2}, { 53,  3}, { 53,  4}, { 53,  5}, { 53,  5},
-    { 54,  6}, { 54,  7}, { 54,  8}, { 54,  8}, { 54,  9}, { 55, 10}, { 55, 11}, { 55, 11},
-    { 55, 12}, { 56, 13}, { 56, 13}, { 56, 14}, { 57, 15}, { 57, 15}, { 57, 16}, { 58, 17},
-    { 58, 17}, { 59, 18}, { 59, 19}, { 59, 19}, { 60, 20}, { 60, 20}, { 61, 21}, { 61, 22},
-    { 62, 22}, { 62, 23}, { 63, 23}, { 64, 24}, { 64, 24}, { 65, 25}, { 65, 25}, { 66, 26},
-    { 66, 26}, { 67, 27}, { 68, 27}, { 68, 28}, { 69, 28}, { 70, 29}, { 70, 29}, { 71, 30},
-    { 72, 30}, { 72, 30}, { 73, 31}, { 74, 31}, { 74, 32}, { 75, 32}, { 76, 32}, { 76, 33},
-    { 77, 33}, { 78, 33}, { 79, 34}, { 79, 34}, { 80, 35}, { 81, 35}, { 82, 35}, { 82, 36},
-    { 83, 36}, { 84, 36}, { 85, 36}, { 85, 37}, { 86, 37}, { 87, 37}, { 88, 38}, { 89, 38},
-    { 89, 38}, { 90, 38}, { 91, 39}, { 92, 39}, { 93, 39}, { 93, 39}, { 94, 40}, { 95, 40},
-    { 96, 40}, { 97, 40}, { 98, 41}, { 98, 41}, { 99, 41}, {100, 41}, {101, 41}, {102, 42},
-    {103, 42}, {104, 42}, {104, 42}, {105, 43}, {106, 43}, {107, 43}, {108, 43}, {109, 43},
-    {110, 43}, {111, 44}, {111, 44}, {112, 44}, {113, 44}, {114, 44}, {115, 44}, {116, 45},
-    {117, 45}, {118, 45}, {119, 45}, {119, 45}, {120, 45}, {121, 46}, {122, 46}, {123, 46},
-    {124, 46}, {125, 46}, {126, 46}, {127, 46}, {128, 47}, {128, 47}, {129, 47}, {130, 47},
-    {131, 47}, {132, 47}, {133, 47}, {134, 47}, {135, 48}, {136, 48}, {137, 48}, {138, 48}
-  },
-  {  // mag,nra for x=54 and y=0:127
-    { 54,  0}, { 54,  1}, { 54,  2}, { 54,  2}, { 54,  3}, { 54,  4}, { 54,  5}, { 54,  5},
-    { 55,  6}, { 55,  7}, { 55,  7}, { 55,  8}, { 55,  9}, { 56, 10}, { 56, 10}, { 56, 11},
-    { 56, 12}, { 57, 12}, { 57, 13}, { 57, 14}, { 58, 14}, { 58, 15}, { 58, 16}, { 59, 16},
-    { 59, 17}, { 60, 18}, { 60, 18}, { 60, 19}, { 61, 19}, { 61, 20}, { 62, 21}, { 62, 21},
-    { 63, 22}, { 63, 22}, { 64, 23}, { 64, 23}, { 65, 24}, { 65, 24}, { 66, 25}, { 67, 25},
-    { 67, 26}, { 68, 26}, { 68, 27}, { 69, 27}, { 70, 28}, { 70, 28}, { 71, 29}, { 72, 29},
-    { 72, 30}, { 73, 30}, { 74, 30}, { 74, 31}, { 75, 31}, { 76, 32}, { 76, 32}, { 77, 32},
-    { 78, 33}, { 79, 33}, { 79, 33}, { 80, 34}, { 81, 34}, { 81, 34}, { 82, 35}, { 83, 35},
-    { 84, 35}, { 85, 36}, { 85, 36}, { 86, 36}, { 87, 37}, { 88, 37}, { 88, 37}, { 89, 38},
-    { 90, 38}, { 91, 38}, { 92, 38}, { 92, 39}, { 93, 39}, { 94, 39}, { 95, 39}, { 96, 40},
-    { 97, 40}, { 97, 40}, { 98, 40}, { 99, 40}, {100, 41}, {101, 41}, {102, 41}, {102, 41},
-    {103, 42}, {104, 42}, {105, 42}, {106, 42}, {107, 42}, {108, 43}, {108, 43}, {109, 43},
-    {110, 43}, {111, 43}, {112, 43}, {113, 44}, {114, 44}, {115, 44}, {115, 44}, {116, 44},
-    {117, 44}, {118, 45}, {119, 45}, {120, 45}, {121, 45}, {122, 45}, {123, 45}, {123, 46},
-    {124, 46}, {125, 46}, {126, 46}, {127, 46}, {128, 46}, {129, 46}, {130, 47}, {131, 47},
-    {132, 47}, {133, 47}, {133, 47}, {134, 47}, {135, 47}, {136, 47}, {137, 48}, {138, 48}
-  },
-  {  // mag,nra for x=55 and y=0:127
-    { 55,  0}, { 55,  1}, { 55,  1}, { 55,  2}, { 55,  3}, { 55,  4}, { 55,  4}, { 55,  5},
-    { 56,  6}, { 56,  7}, { 56,  7}, { 56,  8}, { 56,  9}, { 57,  9}, { 57, 10}, { 57, 11},
-    { 57, 12}, { 58, 12}, { 58, 13}, { 58, 14}, { 59, 14}, { 59, 15}, { 59, 16}, { 60, 16},
-    { 60, 17}, { 60, 17}, { 61, 18}, { 61, 19}, { 62, 19}, { 62, 20}, { 63, 20}, { 63, 21},
-    { 64, 21}, { 64, 22}, { 65, 23}, { 65, 23}, { 66, 24}, { 66, 24}, { 67, 25}, { 67, 25},
-    { 68, 26}, { 69, 26}, { 69, 27}, { 70, 27}, { 70, 27}, { 71, 28}, { 72, 28}, { 72, 29},
-    { 73, 29}, { 74, 30}, { 74, 30}, { 75, 30}, { 76, 31}, { 76, 31}, { 77, 32}, { 78, 32},
-    { 78, 32}, { 79, 33}, { 80, 33}, { 81, 33}, { 81, 34}, { 82, 34}, { 83, 34}, { 84, 35},
-    { 84, 35}, { 85, 35}, { 86, 36}, { 87, 36}, { 87, 36}, { 88, 37}, { 89, 37}, { 90, 37},
-    { 91, 37}, { 91, 38}, { 92, 38}, { 93, 38}, { 94, 38}, { 95, 39}, { 95, 39}, { 96, 39},
-    { 97, 39}, { 98, 40}, { 99, 40}, {100, 40}, {100, 40}, {101, 41}, {102, 41}, {103, 41},
-    {104, 41}, {105, 41}, {105, 42}, {106, 42}, {107, 42}, {108, 42}, {109, 42}, {110, 43},
-    {111, 43}, {112, 43}, {112, 43}, {113, 43}, {114, 44}, {115, 44}, {116, 44}, {117, 44},
-    {118, 44}, {119, 44}, {119, 44}, {120, 45}, {121, 45}, {122, 45}, {123, 45}, {124, 45},
-    {125, 45}, {126, 46}, {127, 46}, {127, 46}, {128, 46}, {129, 46}, {130, 46}, {131, 46},
-    {132, 46}, {133, 47}, {134, 47}, {135, 47}, {136, 47}, {137, 47}, {137, 47}, {138, 47}
-  },
-  {  // mag,nra for x=56 and y=0:127
-    { 56,  0}, { 56,  1}, { 56,  1}, { 56,  2}, { 56,  3}, { 56,  4}, { 56,  4}, { 56,  5},
-    { 57,  6}, { 57,  6}, { 57,  7}, { 57,  8}, { 57,  9}, { 57,  9}, { 58, 10}, { 58, 11},
-    { 58, 11}, { 59, 12}, { 59, 13}, { 59, 13}, { 59, 14}, { 60, 15}, { 60, 15}, { 61, 16},
-    { 61, 16}, { 61, 17}, { 62, 18}, { 62, 18}, { 63, 19}, { 63, 19}, { 64, 20}, { 64, 21},
-    { 64, 21}, { 65, 22}, { 66, 22}, { 66, 23}, { 67, 23}, { 67, 24}, { 68, 24}, { 68, 25},
-    { 69, 25}, { 69, 26}, { 70, 26}, { 71, 27}, { 71, 27}, { 72, 28}, { 72, 28}, { 73, 28},
-    { 74, 29}, { 74, 29}, { 75, 30}, { 76, 30}, { 76, 30}, { 77, 31}, { 78, 31}, { 78, 32},
-    { 79, 32}, { 80, 32}, { 81, 33}, { 81, 33}, { 82, 33}, { 83, 34}, { 84, 34}, { 84, 34},
-    { 85, 35}, { 86, 35}, { 87, 35}, { 87, 36}, { 88, 36}, { 89, 36}, { 90, 37}, { 90, 37},
-    { 91, 37}, { 92, 37}, { 93, 38}, { 94, 38}, { 94, 38}, { 95, 38}, { 96, 39}, { 97, 39},
-    { 98, 39}, { 98, 39}, { 99, 40}, {100, 40}, {101, 40}, {102, 40}, {103, 40}, {103, 41},
-    {104, 41}, {105, 41}, {106, 41}, {107, 42}, {108, 42}, {109, 42}, {109, 42}, {110, 42},
-    {111, 42}, {112, 43}, {113, 43}, {114, 43}, {115, 43}, {115, 43}, {116, 44}, {117, 44},
-    {118, 44}, {119, 44}, {120, 44}, {121, 44}, {122, 45}, {123, 45}, {123, 45}, {124, 45},
-    {125, 45}, {126, 45}, {127, 45}, {128, 46}, {129, 46}, {130, 46}, {131, 46}, {132, 46},
-    {132, 46}, {133, 46}, {134, 46}, {135, 47}, {136, 47}, {137, 47}, {138, 47}, {139, 47}
-  },
-  {  // mag,nra for x=57 and y=0:127
-    { 57,  0}, { 57,  1}, { 57,  1}, { 57,  2}, { 57,  3}, { 57,  4}, { 57,  4}, { 57,  5},
-    { 58,  6}, { 58,  6}, { 58,  7}, { 58,  8}, { 58,  8}, { 58,  9}, { 59, 10}, { 59, 10},
-    { 59, 11}, { 59, 12}, { 60, 12}, { 60, 13}, { 60, 14}, { 61, 14}, { 61, 15}, { 61, 16},
-    { 62, 16}, { 62, 17}, { 63, 17}, { 63, 18}, { 64, 19}, { 64, 19}, { 64, 20}, { 65, 20},
-    { 65, 21}, { 66, 21}, { 66, 22}, { 67, 22}, { 67, 23}, { 68, 23}, { 69, 24}, { 69, 24},
-    { 70, 25}, { 70, 25}, { 71, 26}, { 71, 26}, { 72, 27}, { 73, 27}, { 73, 28}, { 74, 28},
-    { 75, 29}, { 75, 29}, { 76, 29}, { 76, 30}, { 77, 30}, { 78, 31}, { 79, 31}, { 79, 31},
-    { 80, 32}, { 81, 32}, { 81, 32}, { 82, 33}, { 83, 33}, { 83, 33}, { 84, 34}, { 85, 34},
-    { 86, 34}, { 86, 35}, { 87, 35}, { 88, 35}, { 89, 36}, { 89, 36}, { 90, 36}, { 91, 36},
-    { 92, 37}, { 93, 37}, { 93, 37}, { 94, 38}, { 95, 38}, { 96, 38}, { 97, 38}, { 97, 39},
-    { 98, 39}, { 99, 39}, {100, 39}, {101, 39}, {102, 40}, {102, 40}, {103, 40}, {104, 40},
-    {105, 41}, {106, 41}, {107, 41}, {107, 41}, {108, 41}, {109, 42}, {110, 42}, {111, 42},
-    {112, 42}, {113, 42}, {113, 43}, {114, 43}, {115, 43}, {116, 43}, {117, 43}, {118, 43},
-    {119, 44}, {119, 44}, {120, 44}, {121, 44}, {122, 44}, {123, 44}, {124, 45}, {125, 45},
-    {126, 45}, {127, 45}, {127, 45}, {128, 45}, {129, 45}, {130, 46}, {131, 46}, {132, 46},
-    {133, 46}, {134, 46}, {135, 46}, {136, 46}, {136, 46}, {137, 47}, {138, 47}, {139, 47}
-  },
-  {  // mag,nra for x=58 and y=0:127
-    { 58,  0}, { 58,  1}, { 58,  1}, { 58,  2}, { 58,  3}, { 58,  4}, { 58,  4}, { 58,  5},
-    { 59,  6}, { 59,  6}, { 59,  7}, { 59,  8}, { 59,  8}, { 59,  9}, { 60, 10}, { 60, 10},
-    { 60, 11}, { 60, 12}, { 61, 12}, { 61, 13}, { 61, 14}, { 62, 14}, { 62, 15}, { 62, 15},
-    { 63, 16}, { 63, 17}, { 64, 17}, { 64, 18}, { 64, 18}, { 65, 19}, { 65, 19}, { 66, 20},
-    { 66, 21}, { 67, 21}, { 67, 22}, { 68, 22}, { 68, 23}, { 69, 23}, { 69, 24}, { 70, 24},
-    { 70, 25}, { 71, 25}, { 72, 26}, { 72, 26}, { 73, 26}, { 73, 27}, { 74, 27}, { 75, 28},
-    { 75, 28}, { 76, 29}, { 77, 29}, { 77, 29}, { 78, 30}, { 79, 30}, { 79, 31}, { 80, 31},
-    { 81, 31}, { 81, 32}, { 82, 32}, { 83, 32}, { 83, 33}, { 84, 33}, { 85, 33}, { 86, 34},
-    { 86, 34}, { 87, 34}, { 88, 35}, { 89, 35}, { 89, 35}, { 90, 36}, { 91, 36}, { 92, 36},
-    { 92, 36}, { 93, 37}, { 94, 37}, { 95, 37}, { 96, 37}, { 96, 38}, { 97, 38}, { 98, 38},
-    { 99, 38}, {100, 39}, {100, 39}, {101, 39}, {102, 39}, {103, 40}, {104, 40}, {105, 40},
-    {105, 40}, {106, 40}, {107, 41}, {108, 41}, {109, 41}, {110, 41}, {110, 41}, {111, 42},
-    {112, 42}, {113, 42}, {114, 42}, {115, 42}, {116, 43}, {116, 43}, {117, 43}, {118, 43},
-    {119, 43}, {120, 43}, {121, 44}, {122, 44}, {123, 44}, {123, 44}, {124, 44}, {125, 44},
-    {126, 45}, {127, 45}, {128, 45}, {129, 45}, {130, 45}, {131, 45}, {131, 45}, {132, 46},
-    {133, 46}, {134, 46}, {135, 46}, {136, 46}, {137, 46}, {138, 46}, {139, 46}, {140, 47}
-  },
-  {  // mag,nra for x=59 and y=0:127
-    { 59,  0}, { 59,  1}, { 59,  1}, { 59,  2}, { 59,  3}, { 59,  3}, { 59,  4}, { 59,  5},
-    { 60,  5}, { 60,  6}, { 60,  7}, { 60,  8}, { 60,  8}, { 60,  9}, { 61,  9}, { 61, 10},
-    { 61, 11}, { 61, 11}, { 62, 12}, { 62, 13}, { 62, 13}, { 63, 14}, { 63, 15}, { 63, 15},
-    { 64, 16}, { 64, 16}, { 64, 17}, { 65, 17}, { 65, 18}, { 66, 19}, { 66, 19}, { 67, 20},
-    { 67, 20}, { 68, 21}, { 68, 21}, { 69, 22}, { 69, 22}, { 70, 23}, { 70, 23}, { 71, 24},
-    { 71, 24}, { 72, 25}, { 72, 25}, { 73, 26}, { 74, 26}, { 74, 27}, { 75, 27}, { 75, 27},
-    { 76, 28}, { 77, 28}, { 77, 29}, { 78, 29}, { 79, 29}, { 79, 30}, { 80, 30}, { 81, 31},
-    { 81, 31}, { 82, 31}, { 83, 32}, { 83, 32}, { 84, 32}, { 85, 33}, { 86, 33}, { 86, 33},
-    { 87, 34}, { 88, 34}, { 89, 34}, { 89, 35}, { 90, 35}, { 91, 35}, { 92, 35}, { 92, 36},
-    { 93, 36}, { 94, 36}, { 95, 37}, { 95, 37}, { 96, 37}, { 97, 37}, { 98, 38}, { 99, 38},
-    { 99, 38}, {100, 38}, {101, 39}, {102, 39}, {103, 39}, {103, 39}, {104, 40}, {105, 40},
-    {106, 40}, {107, 40}, {108, 40}, {108, 41}, {109, 41}, {110, 41}, {111, 41}, {112, 41},
-    {113, 42}, {114, 42}, {114, 42}, {115, 42}, {116, 42}, {117, 42}, {118, 43}, {119, 43},
-    {120, 43}, {120, 43}, {121, 43}, {122, 43}, {123, 44}, {124, 44}, {125, 44}, {126, 44},
-    {127, 44}, {127, 44}, {128, 45}, {129, 45}, {130, 45}, {131, 45}, {132, 45}, {133, 45},
-    {134, 45}, {135, 46}, {136, 46}, {136, 46}, {137, 46}, {138, 46}, {139, 46}, {140, 46}
-  },
-  {  // mag,nra for x=60 and y=0:127
-    { 60,  0}, { 60,  1}, { 60,  1}, { 60,  2}, { 60,  3}, { 60,  3}, { 60,  4}, { 60,  5},
-    { 61,  5}, { 61,  6}, { 61,  7}, { 61,  7}, { 61,  8}, { 61,  9}, { 62,  9}, { 62, 10},
-    { 62, 11}, { 62, 11}, { 63, 12}, { 63, 12}, { 63, 13}, { 64, 14}, { 64, 14}, { 64, 15},
-    { 65, 16}, { 65, 16}, { 65, 17}, { 66, 17}, { 66, 18}, { 67, 18}, { 67, 19}, { 68, 19},
-    { 68, 20}, { 68, 20}, { 69, 21}, { 69, 22}, { 70, 22}, { 70, 23}, { 71, 23}, { 72, 23},
-    { 72, 24}, { 73, 24}, { 73, 25}, { 74, 25}, { 74, 26}, { 75, 26}, { 76, 27}, { 76, 27},
-    { 77, 27}, { 77, 28}, { 78, 28}, { 79, 29}, { 79, 29}, { 80, 29}, { 81, 30}, { 81, 30},
-    { 82, 31}, { 83, 31}, { 83, 31}, { 84, 32}, { 85, 32}, { 86, 32}, { 86, 33}, { 87, 33},
-    { 88, 33}, { 88, 34}, { 89, 34}, { 90, 34}, { 91, 35}, { 91, 35}, { 92, 35}, { 93, 35},
-    { 94, 36}, { 94, 36}, { 95, 36}, { 96, 37}, { 97, 37}, { 98, 37}, { 98, 37}, { 99, 38},
-    {100, 38}, {101, 38}, {102, 38}, {102, 38}, {103, 39}, {104, 39}, {105, 39}, {106, 39},
-    {107, 40}, {107, 40}, {108, 40}, {109, 40}, {110, 40}, {111, 41}, {112, 41}, {112, 41},
-    {113, 41}, {114, 41}, {115, 42}, {116, 42}, {117, 42}, {117, 42}, {118, 42}, {119, 43},
-    {120, 43}, {121, 43}, {122, 43}, {123, 43}, {124, 43}, {124, 43}, {125, 44}, {126, 44},
-    {127, 44}, {128, 44}, {129, 44}, {130, 44}, {131, 45}, {131, 45}, {132, 45}, {133, 45},
-    {134, 45}, {135, 45}, {136, 45}, {137, 46}, {138, 46}, {139, 46}, {140, 46}, {140, 46}
-  },
-  {  // mag,nra for x=61 and y=0:127
-    { 61,  0}, { 61,  1}, { 61,  1}, { 61,  2}, { 61,  3}, { 61,  3}, { 61,  4}, { 61,  5},
-    { 62,  5}, { 62,  6}, { 62,  7}, { 62,  7}, { 62,  8}, { 62,  9}, { 63,  9}, { 63, 10},
-    { 63, 10}, { 63, 11}, { 64, 12}, { 64, 12}, { 64, 13}, { 65, 14}, { 65, 14}, { 65, 15},
-    { 66, 15}, { 66, 16}, { 66, 16}, { 67, 17}, { 67, 18}, { 68, 18}, { 68, 19}, { 68, 19},
-    { 69, 20}, { 69, 20}, { 70, 21}, { 70, 21}, { 71, 22}, { 71, 22}, { 72, 23}, { 72, 23},
-    { 73, 24}, { 73, 24}, { 74, 25}, { 75, 25}, { 75, 25}, { 76, 26}, { 76, 26}, { 77, 27},
-    { 78, 27}, { 78, 28}, { 79, 28}, { 80, 28}, { 80, 29}, { 81, 29}, { 81, 30}, { 82, 30},
-    { 83, 30}, { 83, 31}, { 84, 31}, { 85, 31}, { 86, 32}, { 86, 32}, { 87, 32}, { 88, 33},
-    { 88, 33}, { 89, 33}, { 90, 34}, { 91, 34}, { 91, 34}, { 92, 35}, { 93, 35}, { 94, 35},
-    { 94, 35}, { 95, 36}, { 96, 36}, { 97, 36}, { 97, 36}, { 98, 37}, { 99, 37}, {100, 37},
-    {101, 37}, {101, 38}, {102, 38}, {103, 38}, {104, 38}, {105, 39}, {105, 39}, {106, 39},
-    {107, 39}, {108, 40}, {109, 40}, {110, 40}, {110, 40}, {111, 40}, {112, 41}, {113, 41},
-    {114, 41}, {115, 41}, {115, 41}, {116, 42}, {117, 42}, {118, 42}, {119, 42}, {120, 42},
-    {121, 42}, {121, 43}, {122, 43}, {123, 43}, {124, 43}, {125, 43}, {126, 43}, {127, 44},
-    {128, 44}, {128, 44}, {129, 44}, {130, 44}, {131, 44}, {132, 44}, {133, 45}, {134, 45},
-    {135, 45}, {136, 45}, {136, 45}, {137, 45}, {138, 45}, {139, 46}, {140, 46}, {141, 46}
-  },
-  {  // mag,nra for x=62 and y=0:127
-    { 62,  0}, { 62,  1}, { 62,  1}, { 62,  2}, { 62,  3}, { 62,  3}, { 62,  4}, { 62,  5},
-    { 63,  5}, { 63,  6}, { 63,  7}, { 63,  7}, { 63,  8}, { 63,  8}, { 64,  9}, { 64, 10},
-    { 64, 10}, { 64, 11}, { 65, 12}, { 65, 12}, { 65, 13}, { 65, 13}, { 66, 14}, { 66, 14},
-    { 66, 15}, { 67, 16}, { 67, 16}, { 68, 17}, { 68, 17}, { 68, 18}, { 69, 18}, { 69, 19},
-    { 70, 19}, { 70, 20}, { 71, 20}, { 71, 21}, { 72, 21}, { 72, 22}, { 73, 22}, { 73, 23},
-    { 74, 23}, { 74, 24}, { 75, 24}, { 75, 25}, { 76, 25}, { 77, 26}, { 77, 26}, { 78, 26},
-    { 78, 27}, { 79, 27}, { 80, 28}, { 80, 28}, { 81, 28}, { 82, 29}, { 82, 29}, { 83, 30},
-    { 84, 30}, { 84, 30}, { 85, 31}, { 86, 31}, { 86, 31}, { 87, 32}, { 88, 32}, { 88, 32},
-    { 89, 33}, { 90, 33}, { 91, 33}, { 91, 34}, { 92, 34}, { 93, 34}, { 94, 34}, { 94, 35},
-    { 95, 35}, { 96, 35}, { 97, 36}, { 97, 36}, { 98, 36}, { 99, 36}, {100, 37}, {100, 37},
-    {101, 37}, {102, 37}, {103, 38}, {104, 38}, {104, 38}, {105, 38}, {106, 39}, {107, 39},
-    {108, 39}, {108, 39}, {109, 39}, {110, 40}, {111, 40}, {112, 40}, {113, 40}, {113, 40},
-    {114, 41}, {115, 41}, {116, 41}, {117, 41}, {118, 41}, {119, 42}, {119, 42}, {120, 42},
-    {121, 42}, {122, 42}, {123, 42}, {124, 43}, {125, 43}, {125, 43}, {126, 43}, {127, 43},
-    {128, 43}, {129, 44}, {130, 44}, {131, 44}, {132, 44}, {132, 44}, {133, 44}, {134, 44},
-    {135, 45}, {136, 45}, {137, 45}, {138, 45}, {139, 45}, {140, 45}, {140, 45}, {141, 45}
-  },
-  {  // mag,nra for x=63 and y=0:127
-    { 63,  0}, { 63,  1}, { 63,  1}, { 63,  2}, { 63,  3}, { 63,  3}, { 63,  4}, { 63,  5},
-    { 64,  5}, { 64,  6}, { 64,  6}, { 64,  7}, { 64,  8}, { 64,  8}, { 65,  9}, { 65, 10},
-    { 65, 10}, { 65, 11}, { 66, 11}, { 66, 12}, { 66, 13}, { 66, 13}, { 67, 14}, { 67, 14},
-    { 67, 15}, { 68, 15}, { 68, 16}, { 69, 16}, { 69, 17}, { 69, 18}, { 70, 18}, { 70, 19},
-    { 71, 19}, { 71, 20}, { 72, 20}, { 72, 21}, { 73, 21}, { 73, 22}, { 74, 22}, { 74, 23},
-    { 75, 23}, { 75, 24}, { 76, 24}, { 76, 24}, { 77, 25}, { 77, 25}, { 78, 26}, { 79, 26},
-    { 79, 27}, { 80, 27}, { 80, 27}, { 81, 28}, { 82, 28}, { 82, 28}, { 83, 29}, { 84, 29},
-    { 84, 30}, { 85, 30}, { 86, 30}, { 86, 31}, { 87, 31}, { 88, 31}, { 88, 32}, { 89, 32},
-    { 90, 32}, { 91, 33}, { 91, 33}, { 92, 33}, { 93, 34}, { 93, 34}, { 94, 34}, { 95, 34},
-    { 96, 35}, { 96, 35}, { 97, 35}, { 98, 36}, { 99, 36}, { 99, 36}, {100, 36}, {101, 37},
-    {102, 37}, {103, 37}, {103, 37}, {104, 38}, {105, 38}, {106, 38}, {107, 38}, {107, 38},
-    {108, 39}, {109, 39}, {110, 39}, {111, 39}, {112, 40}, {112, 40}, {113, 40}, {114, 40},
-    {115, 40}, {116, 41}, {117, 41}, {117, 41}, {118, 41}, {119, 41}, {120, 41}, {121, 42},
-    {122, 42}, {122, 42}, {123, 42}, {124, 42}, {125, 42}, {126, 43}, {127, 43}, {128, 43},
-    {129, 43}, {129, 43}, {130, 43}, {131, 44}, {132, 44}, {133, 44}, {134, 44}, {135, 44},
-    {136, 44}, {136, 44}, {137, 45}, {138, 45}, {139, 45}, {140, 45}, {141, 45}, {142, 45}
-  },
-  {  // mag,nra for x=64 and y=0:127
-    { 64,  0}, { 64,  1}, { 64,  1}, { 64,  2}, { 64,  3}, { 64,  3}, { 64,  4}, { 64,  4},
-    { 64,  5}, { 65,  6}, { 65,  6}, { 65,  7}, { 65,  8}, { 65,  8}, { 66,  9}, { 66,  9},
-    { 66, 10}, { 66, 11}, { 66, 11}, { 67, 12}, { 67, 12}, { 67, 13}, { 68, 13}, { 68, 14},
-    { 68, 15}, { 69, 15}, { 69, 16}, { 69, 16}, { 70, 17}, { 70, 17}, { 71, 18}, { 71, 18},
-    { 72, 19}, { 72, 19}, { 72, 20}, { 73, 20}, { 73, 21}, { 74, 21}, { 74, 22}, { 75, 22},
-    { 75, 23}, { 76, 23}, { 77, 24}, { 77, 24}, { 78, 25}, { 78, 25}, { 79, 25}, { 79, 26},
-    { 80, 26}, { 81, 27}, { 81, 27}, { 82, 27}, { 82, 28}, { 83, 28}, { 84, 29}, { 84, 29},
-    { 85, 29}, { 86, 30}, { 86, 30}, { 87, 30}, { 88, 31}, { 88, 31}, { 89, 31}, { 90, 32},
-    { 91, 32}, { 91, 32}, { 92, 33}, { 93, 33}, { 93, 33}, { 94, 34}, { 95, 34}, { 96, 34},
-    { 96, 34}, { 97, 35}, { 98, 35}, { 99, 35}, { 99, 35}, {100, 36}, {101, 36}, {102, 36},
-    {102, 37}, {103, 37}, {104, 37}, {105, 37}, {106, 37}, {106, 38}, {107, 38}, {108, 38},
-    {109, 38}, {110, 39}, {110, 39}, {111, 39}, {112, 39}, {113, 39}, {114, 40}, {115, 40},
-    {115, 40}, {116, 40}, {117, 40}, {118, 41}, {119, 41}, {120, 41}, {120, 41}, {121, 41},
-    {122, 42}, {123, 42}, {124, 42}, {125, 42}, {126, 42}, {126, 42}, {127, 43}, {128, 43},
-    {129, 43}, {130, 43}, {131, 43}, {132, 43}, {132, 43}, {133, 44}, {134, 44}, {135, 44},
-    {136, 44}, {137, 44}, {138, 44}, {139, 44}, {140, 45}, {140, 45}, {141, 45}, {142, 45}
-  },
-  {  // mag,nra for x=65 and y=0:127
-    { 65,  0}, { 65,  1}, { 65,  1}, { 65,  2}, { 65,  3}, { 65,  3}, { 65,  4}, { 65,  4},
-    { 65,  5}, { 66,  6}, { 66,  6}, { 66,  7}, { 66,  7}, { 66,  8}, { 66,  9}, { 67,  9},
-    { 67, 10}, { 67, 10}, { 67, 11}, { 68, 12}, { 68, 12}, { 68, 13}, { 69, 13}, { 69, 14},
-    { 69, 14}, { 70, 15}, { 70, 16}, { 70, 16}, { 71, 17}, { 71, 17}, { 72, 18}, { 72, 18},
-    { 72, 19}, { 73, 19}, { 73, 20}, { 74, 20}, { 74, 21}, { 75, 21}, { 75, 22}, { 76, 22},
-    { 76, 22}, { 77, 23}, { 77, 23}, { 78, 24}, { 78, 24}, { 79, 25}, { 80, 25}, { 80, 26},
-    { 81, 26}, { 81, 26}, { 82, 27}, { 83, 27}, { 83, 27}, { 84, 28}, { 85, 28}, { 85, 29},
-    { 86, 29}, { 86, 29}, { 87, 30}, { 88, 30}, { 88, 30}, { 89, 31}, { 90, 31}, { 91, 31},
-    { 91, 32}, { 92, 32}, { 93, 32}, { 93, 33}, { 94, 33}, { 95, 33}, { 96, 34}, { 96, 34},
-    { 97, 34}, { 98, 34}, { 98, 35}, { 99, 35}, {100, 35}, {101, 35}, {102, 36}, {102, 36},
-    {103, 36}, {104, 36}, {105, 37}, {105, 37}, {106, 37}, {107, 37}, {108, 38}, {109, 38},
-    {109, 38}, {110, 38}, {111, 39}, {112, 39}, {113, 39}, {113, 39}, {114, 39}, {115, 40},
-    {116, 40}, {117, 40}, {118, 40}, {118, 40}, {119, 41}, {120, 41}, {121, 41}, {122, 41},
-    {123, 41}, {123, 41}, {124, 42}, {125, 42}, {126, 42}, {127, 42}, {128, 42}, {129, 42},
-    {129, 43}, {130, 43}, {131, 43}, {132, 43}, {133, 43}, {134, 43}, {135, 43}, {136, 44},
-    {136, 44}, {137, 44}, {138, 44}, {139, 44}, {140, 44}, {141, 44}, {142, 45}, {143, 45}
-  },
-  {  // mag,nra for x=66 and y=0:127
-    { 66,  0}, { 66,  1}, { 66,  1}, { 66,  2}, { 66,  2}, { 66,  3}, { 66,  4}, { 66,  4},
-    { 66,  5}, { 67,  6}, { 67,  6}, { 67,  7}, { 67,  7}, { 67,  8}, { 67,  9}, { 68,  9},
-    { 68, 10}, { 68, 10}, { 68, 11}, { 69, 11}, { 69, 12}, { 69, 13}, { 70, 13}, { 70, 14},
-    { 70, 14}, { 71, 15}, { 71, 15}, { 71, 16}, { 72, 16}, { 72, 17}, { 72, 17}, { 73, 18},
-    { 73, 18}, { 74, 19}, { 74, 19}, { 75, 20}, { 75, 20}, { 76, 21}, { 76, 21}, { 77, 22},
-    { 77, 22}, { 78, 23}, { 78, 23}, { 79, 24}, { 79, 24}, { 80, 24}, { 80, 25}, { 81, 25},
-    { 82, 26}, { 82, 26}, { 83, 26}, { 83, 27}, { 84, 27}, { 85, 28}, { 85, 28}, { 86, 28},
-    { 87, 29}, { 87, 29}, { 88, 29}, { 89, 30}, { 89, 30}, { 90, 30}, { 91, 31}, { 91, 31},
-    { 92, 31}, { 93, 32}, { 93, 32}, { 94, 32}, { 95, 33}, { 95, 33}, { 96, 33}, { 97, 33},
-    { 98, 34}, { 98, 34}, { 99, 34}, {100, 35}, {101, 35}, {101, 35}, {102, 35}, {103, 36},
-    {104, 36}, {104, 36}, {105, 36}, {106, 37}, {107, 37}, {108, 37}, {108, 37}, {109, 38},
-    {110, 38}, {111, 38}, {112, 38}, {112, 38}, {113, 39}, {114, 39}, {115, 39}, {116, 39},
-    {116, 39}, {117, 40}, {118, 40}, {119, 40}, {120, 40}, {121, 40}, {121, 41}, {122, 41},
-    {123, 41}, {124, 41}, {125, 41}, {126, 41}, {127, 42}, {127, 42}, {128, 42}, {129, 42},
-    {130, 42}, {131, 42}, {132, 43}, {133, 43}, {133, 43}, {134, 43}, {135, 43}, {136, 43},
-    {137, 44}, {138, 44}, {139, 44}, {140, 44}, {140, 44}, {141, 44}, {142, 44}, {143, 44}
-  },
-  {  // mag,nra for x=67 and y=0:127
-    { 67,  0}, { 67,  1}, { 67,  1}, { 67,  2}, { 67,  2}, { 67,  3}, { 67,  4}, { 67,  4},
-    { 67,  5}, { 68,  5}, { 68,  6}, { 68,  7}, { 68,  7}, { 68,  8}, { 68,  8}, { 69,  9},
-    { 69, 10}, { 69, 10}, { 69, 11}, { 70, 11}, { 70, 12}, { 70, 12}, { 71, 13}, { 71, 13},
-    { 71, 14}, { 72, 15}, { 72, 15}, { 72, 16}, { 73, 16}, { 73, 17}, { 73, 17}, { 74, 18},
-    { 74, 18}, { 75, 19}, { 75, 19}, { 76, 20}, { 76, 20}, { 77, 21}, { 77, 21}, { 78, 21},
-    { 78, 22}, { 79, 22}, { 79, 23}, { 80, 23}, { 80, 24}, { 81, 24}, { 81, 25}, { 82, 25},
-    { 82, 25}, { 83, 26}, { 84, 26}, { 84, 27}, { 85, 27}, { 85, 27}, { 86, 28}, { 87, 28},
-    { 87, 28}, { 88, 29}, { 89, 29}, { 89, 29}, { 90, 30}, { 91, 30}, { 91, 30}, { 92, 31},
-    { 93, 31}, { 93, 31}, { 94, 32}, { 95, 32}, { 95, 32}, { 96, 33}, { 97, 33}, { 98, 33},
-    { 98, 33}, { 99, 34}, {100, 34}, {101, 34}, {101, 35}, {102, 35}, {103, 35}, {104, 35},
-    {104, 36}, {105, 36}, {106, 36}, {107, 36}, {107, 37}, {108, 37}, {109, 37}, {110, 37},
-    {111, 37}, {111, 38}, {112, 38}, {113, 38}, {114, 38}, {115, 39}, {115, 39}, {116, 39},
-    {117, 39}, {118, 39}, {119, 40}, {120, 40}, {120, 40}, {121, 40}, {122, 40}, {123, 41},
-    {124, 41}, {125, 41}, {125, 41}, {126, 41}, {127, 41}, {128, 42}, {129, 42}, {130, 42},
-    {131, 42}, {131, 42}, {132, 42}, {133, 43}, {134, 43}, {135, 43}, {136, 43}, {137, 43},
-    {137, 43}, {138, 43}, {139, 44}, {140, 44}, {141, 44}, {142, 44}, {143, 44}, {144, 44}
-  },
-  {  // mag,nra for x=68 and y=0:127
-    { 68,  0}, { 68,  1}, { 68,  1}, { 68,  2}, { 68,  2}, { 68,  3}, { 68,  4}, { 68,  4},
-    { 68,  5}, { 69,  5}, { 69,  6}, { 69,  7}, { 69,  7}, { 69,  8}, { 69,  8}, { 70,  9},
-    { 70,  9}, { 70, 10}, { 70, 11}, { 71, 11}, { 71, 12}, { 71, 12}, { 71, 13}, { 72, 13},
-    { 72, 14}, { 72, 14}, { 73, 15}, { 73, 15}, { 74, 16}, { 74, 16}, { 74, 17}, { 75, 17},
-    { 75, 18}, { 76, 18}, { 76, 19}, { 76, 19}, { 77, 20}, { 77, 20}, { 78, 21}, { 78, 21},
-    { 79, 22}, { 79, 22}, { 80, 23}, { 80, 23}, { 81, 23}, { 82, 24}, { 82, 24}, { 83, 25},
-    { 83, 25}, { 84, 25}, { 84, 26}, { 85, 26}, { 86, 27}, { 86, 27}, { 87, 27}, { 87, 28},
-    { 88, 28}, { 89, 28}, { 89, 29}, { 90, 29}, { 91, 29}, { 91, 30}, { 92, 30}, { 93, 30},
-    { 93, 31}, { 94, 31}, { 95, 31}, { 95, 32}, { 96, 32}, { 97, 32}, { 98, 33}, { 98, 33},
-    { 99, 33}, {100, 33}, {100, 34}, {101, 34}, {102, 34}, {103, 35}, {103, 35}, {104, 35},
-    {105, 35}, {106, 36}, {107, 36}, {107, 36}, {108, 36}, {109, 37}, {110, 37}, {110, 37},
-    {111, 37}, {112, 37}, {113, 38}, {114, 38}, {114, 38}, {115, 38}, {116, 38}, {117, 39},
-    {118, 39}, {118, 39}, {119, 39}, {120, 39}, {121, 40}, {122, 40}, {123, 40}, {123, 40},
-    {124, 40}, {125, 41}, {126, 41}, {127, 41}, {128, 41}, {128, 41}, {129, 41}, {130, 42},
-    {131, 42}, {132, 42}, {133, 42}, {134, 42}, {134, 42}, {135, 43}, {136, 43}, {137, 43},
-    {138, 43}, {139, 43}, {140, 43}, {141, 43}, {141, 44}, {142, 44}, {143, 44}, {144, 44}
-  },
-  {  // mag,nra for x=69 and y=0:127
-    { 69,  0}, { 69,  1}, { 69,  1}, { 69,  2}, { 69,  2}, { 69,  3}, { 69,  4}, { 69,  4},
-    { 69,  5}, { 70,  5}, { 70,  6}, { 70,  6}, { 70,  7}, { 70,  8}, { 70,  8}, { 71,  9},
-    { 71,  9}, { 71, 10}, { 71, 10}, { 72, 11}, { 72, 11}, { 72, 12}, { 72, 13}, { 73, 13},
-    { 73, 14}, { 73, 14}, { 74, 15}, { 74, 15}, { 74, 16}, { 75, 16}, { 75, 17}, { 76, 17},
-    { 76, 18}, { 76, 18}, { 77, 19}, { 77, 19}, { 78, 20}, { 78, 20}, { 79, 21}, { 79, 21},
-    { 80, 21}, { 80, 22}, { 81, 22}, { 81, 23}, { 82, 23}, { 82, 24}, { 83, 24}, { 83, 24},
-    { 84, 25}, { 85, 25}, { 85, 26}, { 86, 26}, { 86, 26}, { 87, 27}, { 88, 27}, { 88, 27},
-    { 89, 28}, { 89, 28}, { 90, 28}, { 91, 29}, { 91, 29}, { 92, 29}, { 93, 30}, { 93, 30},
-    { 94, 30}, { 95, 31}, { 95, 31}, { 96, 31}, { 97, 32}, { 98, 32}, { 98, 32}, { 99, 33},
-    {100, 33}, {100, 33}, {101, 33}, {102, 34}, {103, 34}, {103, 34}, {104, 34}, {105, 35},
-    {106, 35}, {106, 35}, {107, 35}, {108, 36}, {109, 36}, {109, 36}, {110, 36}, {111, 37},
-    {112, 37}, {113, 37}, {113, 37}, {114, 38}, {115, 38}, {116, 38}, {117, 38}, {117, 38},
-    {118, 39}, {119, 39}, {120, 39}, {121, 39}, {121, 39}, {122, 40}, {123, 40}, {124, 40},
-    {125, 40}, {126, 40}, {126, 40}, {127, 41}, {128, 41}, {129, 41}, {130, 41}, {131, 41},
-    {132, 42}, {132, 42}, {133, 42}, {134, 42}, {135, 42}, {136, 42}, {137, 42}, {138, 43},
-    {138, 43}, {139, 43}, {140, 43}, {141, 43}, {142, 43}, {143, 43}, {144, 44}, {145, 44}
-  },
-  {  // mag,nra for x=70 and y=0:127
-    { 70,  0}, { 70,  1}, { 70,  1}, { 70,  2}, { 70,  2}, { 70,  3}, { 70,  3}, { 70,  4},
-    { 70,  5}, { 71,  5}, { 71,  6}, { 71,  6}, { 71,  7}, { 71,  7}, { 71,  8}, { 72,  9},
-    { 72,  9}, { 72, 10}, { 72, 10}, { 73, 11}, { 73, 11}, { 73, 12}, { 73, 12}, { 74, 13},
-    { 74, 13}, { 74, 14}, { 75, 14}, { 75, 15}, { 75, 16}, { 76, 16}, { 76, 16}, { 77, 17},
-    { 77, 17}, { 77, 18}, { 78, 18}, { 78, 19}, { 79, 19}, { 79, 20}, { 80, 20}, { 80, 21},
-    { 81, 21}, { 81, 22}, { 82, 22}, { 82, 22}, { 83, 23}, { 83, 23}, { 84, 24}, { 84, 24},
-    { 85, 24}, { 85, 25}, { 86, 25}, { 87, 26}, { 87, 26}, { 88, 26}, { 88, 27}, { 89, 27},
-    { 90, 27}, { 90, 28}, { 91, 28}, { 92, 29}, { 92, 29}, { 93, 29}, { 94, 30}, { 94, 30},
-    { 95, 30}, { 96, 30}, { 96, 31}, { 97, 31}, { 98, 31}, { 98, 32}, { 99, 32}, {100, 32},
-    {100, 33}, {101, 33}, {102, 33}, {103, 33}, {103, 34}, {104, 34}, {105, 34}, {106, 34},
-    {106, 35}, {107, 35}, {108, 35}, {109, 35}, {109, 36}, {110, 36}, {111, 36}, {112, 36},
-    {112, 37}, {113, 37}, {114, 37}, {115, 37}, {116, 37}, {116, 38}, {117, 38}, {118, 38},
-    {119, 38}, {120, 39}, {120, 39}, {121, 39}, {122, 39}, {123, 39}, {124, 39}, {125, 40},
-    {125, 40}, {126, 40}, {127, 40}, {128, 40}, {129, 41}, {130, 41}, {130, 41}, {131, 41},
-    {132, 41}, {133, 41}, {134, 42}, {135, 42}, {135, 42}, {136, 42}, {137, 42}, {138, 42},
-    {139, 42}, {140, 43}, {141, 43}, {142, 43}, {142, 43}, {143, 43}, {144, 43}, {145, 43}
-  },
-  {  // mag,nra for x=71 and y=0:127
-    { 71,  0}, { 71,  1}, { 71,  1}, { 71,  2}, { 71,  2}, { 71,  3}, { 71,  3}, { 71,  4},
-    { 71,  5}, { 72,  5}, { 72,  6}, { 72,  6}, { 72,  7}, { 72,  7}, { 72,  8}, { 73,  8},
-    { 73,  9}, { 73, 10}, { 73, 10}, { 73, 11}, { 74, 11}, { 74, 12}, { 74, 12}, { 75, 13},
-    { 75, 13}, { 75, 14}, { 76, 14}, { 76, 15}, { 76, 15}, { 77, 16}, { 77, 16}, { 77, 17},
-    { 78, 17}, { 78, 18}, { 79, 18}, { 79, 19}, { 80, 19}, { 80, 20}, { 81, 20}, { 81, 20},
-    { 81, 21}, { 82, 21}, { 82, 22}, { 83, 22}, { 84, 23}, { 84, 23}, { 85, 23}, { 85, 24},
-    { 86, 24}, { 86, 25}, { 87, 25}, { 87, 25}, { 88, 26}, { 89, 26}, { 89, 26}, { 90, 27},
-    { 90, 27}, { 91, 28}, { 92, 28}, { 92, 28}, { 93, 29}, { 94, 29}, { 94, 29}, { 95, 30},
-    { 96, 30}, { 96, 30}, { 97, 31}, { 98, 31}, { 98, 31}, { 99, 31}, {100, 32}, {100, 32},
-    {101, 32}, {102, 33}, {103, 33}, {103, 33}, {104, 33}, {105, 34}, {105, 34}, {106, 34},
-    {107, 34}, {108, 35}, {108, 35}, {109, 35}, {110, 35}, {111, 36}, {112, 36}, {112, 36},
-    {113, 36}, {114, 37}, {115, 37}, {115, 37}, {116, 37}, {117, 37}, {118, 38}, {119, 38},
-    {119, 38}, {120, 38}, {121, 38}, {122, 39}, {123, 39}, {123, 39}, {124, 39}, {125, 39},
-    {126, 40}, {127, 40}, {128, 40}, {128, 40}, {129, 40}, {130, 40}, {131, 41}, {132, 41},
-    {133, 41}, {133, 41}, {134, 41}, {135, 41}, {136, 42}, {137, 42}, {138, 42}, {139, 42},
-    {139, 42}, {140, 42}, {141, 43}, {142, 43}, {143, 43}, {144, 43}, {145, 43}, {145, 43}
-  },
-  {  // mag,nra for x=72 and y=0:127
-    { 72,  0}, { 72,  1}, { 72,  1}, { 72,  2}, { 72,  2}, { 72,  3}, { 72,  3}, { 72,  4},
-    { 72,  5}, { 73,  5}, { 73,  6}, { 73,  6}, { 73,  7}, { 73,  7}, { 73,  8}, { 74,  8},
-    { 74,  9}, { 74,  9}, { 74, 10}, { 74, 11}, { 75, 11}, { 75, 12}, { 75, 12}, { 76, 13},
-    { 76, 13}, { 76, 14}, { 77, 14}, { 77, 15}, { 77, 15}, { 78, 16}, { 78, 16}, { 78, 17},
-    { 79, 17}, { 79, 18}, { 80, 18}, { 80, 18}, { 80, 19}, { 81, 19}, { 81, 20}, { 82, 20},
-    { 82, 21}, { 83, 21}, { 83, 22}, { 84, 22}, { 84, 22}, { 85, 23}, { 85, 23}, { 86, 24},
-    { 87, 24}, { 87, 24}, { 88, 25}, { 88, 25}, { 89, 25}, { 89, 26}, { 90, 26}, { 91, 27},
-    { 91, 27}, { 92, 27}, { 92, 28}, { 93, 28}, { 94, 28}, { 94, 29}, { 95, 29}, { 96, 29},
-    { 96, 30}, { 97, 30}, { 98, 30}, { 98, 31}, { 99, 31}, {100, 31}, {100, 31}, {101, 32},
-    {102, 32}, {103, 32}, {103, 33}, {104, 33}, {105, 33}, {105, 33}, {106, 34}, {107, 34},
-    {108, 34}, {108, 34}, {109, 35}, {110, 35}, {111, 35}, {111, 35}, {112, 36}, {113, 36},
-    {114, 36}, {114, 36}, {115, 37}, {116, 37}, {117, 37}, {118, 37}, {118, 37}, {119, 38},
-    {120, 38}, {121, 38}, {122, 38}, {122, 38}, {123, 39}, {124, 39}, {125, 39}, {126, 39},
-    {126, 39}, {127, 40}, {128, 40}, {129, 40}, {130, 40}, {131, 40}, {131, 40}, {132, 41},
-    {133, 41}, {134, 41}, {135, 41}, {136, 41}, {137, 41}, {137, 42}, {138, 42}, {139, 42},
-    {140, 42}, {141, 42}, {142, 42}, {143, 42}, {143, 43}, {144, 43}, {145, 43}, {146, 43}
-  },
-  {  // mag,nra for x=73 and y=0:127
-    { 73,  0}, { 73,  1}, { 73,  1}, { 73,  2}, { 73,  2}, { 73,  3}, { 73,  3}, { 73,  4},
-    { 73,  4}, { 74,  5}, { 74,  6}, { 74,  6}, { 74,  7}, { 74,  7}, { 74,  8}, { 75,  8},
-    { 75,  9}, { 75,  9}, { 75, 10}, { 75, 10}, { 76, 11}, { 76, 11}, { 76, 12}, { 77, 12},
-    { 77, 13}, { 77, 13}, { 77, 14}, { 78, 14}, { 78, 15}, { 79, 15}, { 79, 16}, { 79, 16},
-    { 80, 17}, { 80, 17}, { 81, 18}, { 81, 18}, { 81, 19}, { 82, 19}, { 82, 20}, { 83, 20},
-    { 83, 20}, { 84, 21}, { 84, 21}, { 85, 22}, { 85, 22}, { 86, 23}, { 86, 23}, { 87, 23},
-    { 87, 24}, { 88, 24}, { 88, 24}, { 89, 25}, { 90, 25}, { 90, 26}, { 91, 26}, { 91, 26},
-    { 92, 27}, { 93, 27}, { 93, 27}, { 94, 28}, { 94, 28}, { 95, 28}, { 96, 29}, { 96, 29},
-    { 97, 29}, { 98, 30}, { 98, 30}, { 99, 30}, {100, 31}, {100, 31}, {101, 31}, {102, 31},
-    {103, 32}, {103, 32}, {104, 32}, {105, 33}, {105, 33}, {106, 33}, {107, 33}, {108, 34},
-    {108, 34}, {109, 34}, {110, 34}, {111, 35}, {111, 35}, {112, 35}, {113, 35}, {114, 36},
-    {114, 36}, {115, 36}, {116, 36}, {117, 36}, {117, 37}, {118, 37}, {119, 37}, {120, 37},
-    {121, 38}, {121, 38}, {122, 38}, {123, 38}, {124, 38}, {125, 39}, {125, 39}, {126, 39},
-    {127, 39}, {128, 39}, {129, 39}, {130, 40}, {130, 40}, {131, 40}, {132, 40}, {133, 40},
-    {134, 40}, {135, 41}, {135, 41}, {136, 41}, {137, 41}, {138, 41}, {139, 41}, {140, 42},
-    {140, 42}, {141, 42}, {142, 42}, {143, 42}, {144, 42}, {145, 42}, {146, 43}, {146, 43}
-  },
-  {  // mag,nra for x=74 and y=0:127
-    { 74,  0}, { 74,  1}, { 74,  1}, { 74,  2}, { 74,  2}, { 74,  3}, { 74,  3}, { 74,  4},
-    { 74,  4}, { 75,  5}, { 75,  5}, { 75,  6}, { 75,  7}, { 75,  7}, { 75,  8}, { 76,  8},
-    { 76,  9}, { 76,  9}, { 76, 10}, { 76, 10}, { 77, 11}, { 77, 11}, { 77, 12}, { 77, 12},
-    { 78, 13}, { 78, 13}, { 78, 14}, { 79, 14}, { 79, 15}, { 79, 15}, { 80, 16}, { 80, 16},
-    { 81, 17}, { 81, 17}, { 81, 18}, { 82, 18}, { 82, 18}, { 83, 19}, { 83, 19}, { 84, 20},
-    { 84, 20}, { 85, 21}, { 85, 21}, { 86, 21}, { 86, 22}, { 87, 22}, { 87, 23}, { 88, 23},
-    { 88, 23}, { 89, 24}, { 89, 24}, { 90, 25}, { 90, 25}, { 91, 25}, { 92, 26}, { 92, 26},
-    { 93, 26}, { 93, 27}, { 94, 27}, { 95, 27}, { 95, 28}, { 96, 28}, { 97, 28}, { 97, 29},
-    { 98, 29}, { 98, 29}, { 99, 30}, {100, 30}, {100, 30}, {101, 31}, {102, 31}, {103, 31},
-    {103, 31}, {104, 32}, {105, 32}, {105, 32}, {106, 33}, {107, 33}, {108, 33}, {108, 33},
-    {109, 34}, {110, 34}, {110, 34}, {111, 34}, {112, 35}, {113, 35}, {113, 35}, {114, 35},
-    {115, 36}, {116, 36}, {117, 36}, {117, 36}, {118, 36}, {119, 37}, {120, 37}, {120, 37},
-    {121, 37}, {122, 37}, {123, 38}, {124, 38}, {124, 38}, {125, 38}, {126, 38}, {127, 39},
-    {128, 39}, {128, 39}, {129, 39}, {130, 39}, {131, 40}, {132, 40}, {133, 40}, {133, 40},
-    {134, 40}, {135, 40}, {136, 41}, {137, 41}, {138, 41}, {138, 41}, {139, 41}, {140, 41},
-    {141, 41}, {142, 42}, {143, 42}, {144, 42}, {144, 42}, {145, 42}, {146, 42}, {147, 43}
-  },
-  {  // mag,nra for x=75 and y=0:127
-    { 75,  0}, { 75,  1}, { 75,  1}, { 75,  2}, { 75,  2}, { 75,  3}, { 75,  3}, { 75,  4},
-    { 75,  4}, { 76,  5}, { 76,  5}, { 76,  6}, { 76,  6}, { 76,  7}, { 76,  8}, { 76,  8},
-    { 77,  9}, { 77,  9}, { 77, 10}, { 77, 10}, { 78, 11}, { 78, 11}, { 78, 12}, { 78, 12},
-    { 79, 13}, { 79, 13}, { 79, 14}, { 80, 14}, { 80, 15}, { 80, 15}, { 81, 16}, { 81, 16},
-    { 82, 16}, { 82, 17}, { 82, 17}, { 83, 18}, { 83, 18}, { 84, 19}, { 84, 19}, { 85, 20},
-    { 85, 20}, { 85, 20}, { 86, 21}, { 86, 21}, { 87, 22}, { 87, 22}, { 88, 22}, { 89, 23},
-    { 89, 23}, { 90, 24}, { 90, 24}, { 91, 24}, { 91, 25}, { 92, 25}, { 92, 25}, { 93, 26},
-    { 94, 26}, { 94, 26}, { 95, 27}, { 95, 27}, { 96, 27}, { 97, 28}, { 97, 28}, { 98, 28},
-    { 99, 29}, { 99, 29}, {100, 29}, {101, 30}, {101, 30}, {102, 30}, {103, 31}, {103, 31},
-    {104, 31}, {105, 31}, {105, 32}, {106, 32}, {107, 32}, {107, 33}, {108, 33}, {109, 33},
-    {110, 33}, {110, 34}, {111, 34}, {112, 34}, {113, 34}, {113, 35}, {114, 35}, {115, 35},
-    {116, 35}, {116, 35}, {117, 36}, {118, 36}, {119, 36}, {119, 36}, {120, 37}, {121, 37},
-    {122, 37}, {123, 37}, {123, 37}, {124, 38}, {125, 38}, {126, 38}, {127, 38}, {127, 38},
-    {128, 39}, {129, 39}, {130, 39}, {131, 39}, {131, 39}, {132, 39}, {133, 40}, {134, 40},
-    {135, 40}, {136, 40}, {136, 40}, {137, 40}, {138, 41}, {139, 41}, {140, 41}, {141, 41},
-    {142, 41}, {142, 41}, {143, 42}, {144, 42}, {145, 42}, {146, 42}, {147, 42}, {147, 42}
-  },
-  {  // mag,nra for x=76 and y=0:127
-    { 76,  0}, { 76,  1}, { 76,  1}, { 76,  2}, { 76,  2}, { 76,  3}, { 76,  3}, { 76,  4},
-    { 76,  4}, { 77,  5}, { 77,  5}, { 77,  6}, { 77,  6}, { 77,  7}, { 77,  7}, { 77,  8},
-    { 78,  8}, { 78,  9}, { 78,  9}, { 78, 10}, { 79, 10}, { 79, 11}, { 79, 11}, { 79, 12},
-    { 80, 12}, { 80, 13}, { 80, 13}, { 81, 14}, { 81, 14}, { 81, 15}, { 82, 15}, { 82, 16},
-    { 82, 16}, { 83, 17}, { 83, 17}, { 84, 18}, { 84, 18}, { 85, 18}, { 85, 19}, { 85, 19},
-    { 86, 20}, { 86, 20}, { 87, 21}, { 87, 21}, { 88, 21}, { 88, 22}, { 89, 22}, { 89, 23},
-    { 90, 23}, { 90, 23}, { 91, 24}, { 92, 24}, { 92, 24}, { 93, 25}, { 93, 25}, { 94, 26},
-    { 94, 26}, { 95, 26}, { 96, 27}, { 96, 27}, { 97, 27}, { 97, 28}, { 98, 28}, { 99, 28},
-    { 99, 29}, {100, 29}, {101, 29}, {101, 29}, {102, 30}, {103, 30}, {103, 30}, {104, 31},
-    {105, 31}, {105, 31}, {106, 31}, {107, 32}, {107, 32}, {108, 32}, {109, 33}, {110, 33},
-    {110, 33}, {111, 33}, {112, 34}, {113, 34}, {113, 34}, {114, 34}, {115, 35}, {116, 35},
-    {116, 35}, {117, 35}, {118, 35}, {119, 36}, {119, 36}, {120, 36}, {121, 36}, {122, 37},
-    {122, 37}, {123, 37}, {124, 37}, {125, 37}, {126, 38}, {126, 38}, {127, 38}, {128, 38},
-    {129, 38}, {130, 38}, {130, 39}, {131, 39}, {132, 39}, {133, 39}, {134, 39}, {135, 40},
-    {135, 40}, {136, 40}, {137, 40}, {138, 40}, {139, 40}, {140, 41}, {140, 41}, {141, 41},
-    {142, 41}, {143, 41}, {144, 41}, {145, 41}, {145, 42}, {146, 42}, {147, 42}, {148, 42}
-  },
-  {  // mag,nra for x=77 and y=0:127
-    { 77,  0}, { 77,  1}, { 77,  1}, { 77,  2}, { 77,  2}, { 77,  3}, { 77,  3}, { 77,  4},
-    { 77,  4}, { 78,  5}, { 78,  5}, { 78,  6}, { 78,  6}, { 78,  7}, { 78,  7}, { 78,  8},
-    { 79,  8}, { 79,  9}, { 79,  9}, { 79, 10}, { 80, 10}, { 80, 11}, { 80, 11}, { 80, 12},
-    { 81, 12}, { 81, 13}, { 81, 13}, { 82, 14}, { 82, 14}, { 82, 15}, { 83, 15}, { 83, 16},
-    { 83, 16}, { 84, 16}, { 84, 17}, { 85, 17}, { 85, 18}, { 85, 18}, { 86, 19}, { 86, 19},
-    { 87, 20}, { 87, 20}, { 88, 20}, { 88, 21}, { 89, 21}, { 89, 22}, { 90, 22}, { 90, 22},
-    { 91, 23}, { 91, 23}, { 92, 23}, { 92, 24}, { 93, 24}, { 93, 25}, { 94, 25}, { 95, 25},
-    { 95, 26}, { 96, 26}, { 96, 26}, { 97, 27}, { 98, 27}, { 98, 27}, { 99, 28}, { 99, 28},
-    {100, 28}, {101, 29}, {101, 29}, {102, 29}, {103, 29}, {103, 30}, {104, 30}, {105, 30},
-    {105, 31}, {106, 31}, {107, 31}, {107, 31}, {108, 32}, {109, 32}, {110, 32}, {110, 33},
-    {111, 33}, {112, 33}, {112, 33}, {113, 34}, {114, 34}, {115, 34}, {115, 34}, {116, 34},
-    {117, 35}, {118, 35}, {118, 35}, {119, 35}, {120, 36}, {121, 36}, {122, 36}, {122, 36},
-    {123, 36}, {124, 37}, {125, 37}, {125, 37}, {126, 37}, {127, 37}, {128, 38}, {129, 38},
-    {129, 38}, {130, 38}, {131, 38}, {132, 39}, {133, 39}, {133, 39}, {134, 39}, {135, 39},
-    {136, 39}, {137, 40}, {138, 40}, {138, 40}, {139, 40}, {140, 40}, {141, 40}, {142, 41},
-    {143, 41}, {143, 41}, {144, 41}, {145, 41}, {146, 41}, {147, 42}, {148, 42}, {149, 42}
-  },
-  {  // mag,nra for x=78 and y=0:127
-    { 78,  0}, { 78,  1}, { 78,  1}, { 78,  2}, { 78,  2}, { 78,  3}, { 78,  3}, { 78,  4},
-    { 78,  4}, { 79,  5}, { 79,  5}, { 79,  6}, { 79,  6}, { 79,  7}, { 79,  7}, { 79,  8},
-    { 80,  8}, { 80,  9}, { 80,  9}, { 80, 10}, { 81, 10}, { 81, 11}, { 81, 11}, { 81, 12},
-    { 82, 12}, { 82, 13}, { 82, 13}, { 83, 14}, { 83, 14}, { 83, 15}, { 84, 15}, { 84, 15},
-    { 84, 16}, { 85, 16}, { 85, 17}, { 85, 17}, { 86, 18}, { 86, 18}, { 87, 18}, { 87, 19},
-    { 88, 19}, { 88, 20}, { 89, 20}, { 89, 21}, { 90, 21}, { 90, 21}, { 91, 22}, { 91, 22},
-    { 92, 22}, { 92, 23}, { 93, 23}, { 93, 24}, { 94, 24}, { 94, 24}, { 95, 25}, { 95, 25},
-    { 96, 25}, { 97, 26}, { 97, 26}, { 98, 26}, { 98, 27}, { 99, 27}, {100, 27}, {100, 28},
-    {101, 28}, {102, 28}, {102, 29}, {103, 29}, {103, 29}, {104, 30}, {105, 30}, {105, 30},
-    {106, 30}, {107, 31}, {108, 31}, {108, 31}, {109, 31}, {110, 32}, {110, 32}, {111, 32},
-    {112, 33}, {112, 33}, {113, 33}, {114, 33}, {115, 34}, {115, 34}, {116, 34}, {117, 34},
-    {118, 34}, {118, 35}, {119, 35}, {120, 35}, {121, 35}, {121, 36}, {122, 36}, {123, 36},
-    {124, 36}, {124, 36}, {125, 37}, {126, 37}, {127, 37}, {128, 37}, {128, 37}, {129, 38},
-    {130, 38}, {131, 38}, {132, 38}, {132, 38}, {133, 39}, {134, 39}, {135, 39}, {136, 39},
-    {136, 39}, {137, 39}, {138, 40}, {139, 40}, {140, 40}, {141, 40}, {141, 40}, {142, 40},
-    {143, 41}, {144, 41}, {145, 41}, {146, 41}, {146, 41}, {147, 41}, {148, 41}, {149, 42}
-  },
-  {  // mag,nra for x=79 and y=0:127
-    { 79,  0}, { 79,  1}, { 79,  1}, { 79,  2}, { 79,  2}, { 79,  3}, { 79,  3}, { 79,  4},
-    { 79,  4}, { 80,  5}, { 80,  5}, { 80,  6}, { 80,  6}, { 80,  7}, { 80,  7}, { 80,  8},
-    { 81,  8}, { 81,  9}, { 81,  9}, { 81, 10}, { 81, 10}, { 82, 11}, { 82, 11}, { 82, 12},
-    { 83, 12}, { 83, 12}, { 83, 13}, { 83, 13}, { 84, 14}, { 84, 14}, { 85, 15}, { 85, 15},
-    { 85, 16}, { 86, 16}, { 86, 17}, { 86, 17}, { 87, 17}, { 87, 18}, { 88, 18}, { 88, 19},
-    { 89, 19}, { 89, 20}, { 89, 20}, { 90, 20}, { 90, 21}, { 91, 21}, { 91, 21}, { 92, 22},
-    { 92, 22}, { 93, 23}, { 93, 23}, { 94, 23}, { 95, 24}, { 95, 24}, { 96, 24}, { 96, 25},
-    { 97, 25}, { 97, 25}, { 98, 26}, { 99, 26}, { 99, 26}, {100, 27}, {100, 27}, {101, 27},
-    {102, 28}, {102, 28}, {103, 28}, {104, 29}, {104, 29}, {105, 29}, {106, 30}, {106, 30},
-    {107, 30}, {108, 30}, {108, 31}, {109, 31}, {110, 31}, {110, 31}, {111, 32}, {112, 32},
-    {112, 32}, {113, 33}, {114, 33}, {115, 33}, {115, 33}, {116, 33}, {117, 34}, {118, 34},
-    {118, 34}, {119, 34}, {120, 35}, {121, 35}, {121, 35}, {122, 35}, {123, 36}, {124, 36},
-    {124, 36}, {125, 36}, {126, 36}, {127, 37}, {127, 37}, {128, 37}, {129, 37}, {130, 37},
-    {131, 38}, {131, 38}, {132, 38}, {133, 38}, {134, 38}, {135, 38}, {135, 39}, {136, 39},
-    {137, 39}, {138, 39}, {139, 39}, {140, 39}, {140, 40}, {141, 40}, {142, 40}, {143, 40},
-    {144, 40}, {145, 40}, {145, 41}, {146, 41}, {147, 41}, {148, 41}, {149, 41}, {150, 41}
-  },
-  {  // mag,nra for x=80 and y=0:127
-    { 80,  0}, { 80,  1}, { 80,  1}, { 80,  2}, { 80,  2}, { 80,  3}, { 80,  3}, { 80,  4},
-    { 80,  4}, { 81,  5}, { 81,  5}, { 81,  6}, { 81,  6}, { 81,  7}, { 81,  7}, { 81,  8},
-    { 82,  8}, { 82,  9}, { 82,  9}, { 82, 10}, { 82, 10}, { 83, 10}, { 83, 11}, { 83, 11},
-    { 84, 12}, { 84, 12}, { 84, 13}, { 84, 13}, { 85, 14}, { 85, 14}, { 85, 15}, { 86, 15},
-    { 86, 16}, { 87, 16}, { 87, 16}, { 87, 17}, { 88, 17}, { 88, 18}, { 89, 18}, { 89, 18},
-    { 89, 19}, { 90, 19}, { 90, 20}, { 91, 20}, { 91, 20}, { 92, 21}, { 92, 21}, { 93, 22},
-    { 93, 22}, { 94, 22}, { 94, 23}, { 95, 23}, { 95, 23}, { 96, 24}, { 97, 24}, { 97, 25},
-    { 98, 25}, { 98, 25}, { 99, 26}, { 99, 26}, {100, 26}, {101, 27}, {101, 27}, {102, 27},
-    {102, 27}, {103, 28}, {104, 28}, {104, 28}, {105, 29}, {106, 29}, {106, 29}, {107, 30},
-    {108, 30}, {108, 30}, {109, 30}, {110, 31}, {110, 31}, {111, 31}, {112, 31}, {112, 32},
-    {113, 32}, {114, 32}, {115, 33}, {115, 33}, {116, 33}, {117, 33}, {117, 33}, {118, 34},
-    {119, 34}, {120, 34}, {120, 34}, {121, 35}, {122, 35}, {123, 35}, {123, 35}, {124, 35},
-    {125, 36}, {126, 36}, {127, 36}, {127, 36}, {128, 37}, {129, 37}, {130, 37}, {130, 37},
-    {131, 37}, {132, 37}, {133, 38}, {134, 38}, {134, 38}, {135, 38}, {136, 38}, {137, 39},
-    {138, 39}, {138, 39}, {139, 39}, {140, 39}, {141, 39}, {142, 40}, {143, 40}, {143, 40},
-    {144, 40}, {145, 40}, {146, 40}, {147, 41}, {148, 41}, {148, 41}, {149, 41}, {150, 41}
-  },
-  {  // mag,nra for x=81 and y=0:127
-    { 81,  0}, { 81,  1}, { 81,  1}, { 81,  2}, { 81,  2}, { 81,  3}, { 81,  3}, { 81,  4},
-    { 81,  4}, { 81,  5}, { 82,  5}, { 82,  5}, { 82,  6}, { 82,  6}, { 82,  7}, { 82,  7},
-    { 83,  8}, { 83,  8}, { 83,  9}, { 83,  9}, { 83, 10}, { 84, 10}, { 84, 11}, { 84, 11},
-    { 84, 12}, { 85, 12}, { 85, 13}, { 85, 13}, { 86, 14}, { 86, 14}, { 86, 14}, { 87, 15},
-    { 87, 15}, { 87, 16}, { 88, 16}, { 88, 17}, { 89, 17}, { 89, 17}, { 89, 18}, { 90, 18},
-    { 90, 19}, { 91, 19}, { 91, 19}, { 92, 20}, { 92, 20}, { 93, 21}, { 93, 21}, { 94, 21},
-    { 94, 22}, { 95, 22}, { 95, 23}, { 96, 23}, { 96, 23}, { 97, 24}, { 97, 24}, { 98, 24},
-    { 98, 25}, { 99, 25}, {100, 25}, {100, 26}, {101, 26}, {101, 26}, {102, 27}, {103, 27},
-    {103, 27}, {104, 28}, {104, 28}, {105, 28}, {106, 28}, {106, 29}, {107, 29}, {108, 29},
-    {108, 30}, {109, 30}, {110, 30}, {110, 30}, {111, 31}, {112, 31}, {112, 31}, {113, 31},
-    {114, 32}, {115, 32}, {115, 32}, {116, 32}, {117, 33}, {117, 33}, {118, 33}, {119, 33},
-    {120, 34}, {120, 34}, {121, 34}, {122, 34}, {123, 35}, {123, 35}, {124, 35}, {125, 35},
-    {126, 35}, {126, 36}, {127, 36}, {128, 36}, {129, 36}, {129, 36}, {130, 37}, {131, 37},
-    {132, 37}, {133, 37}, {133, 37}, {134, 38}, {135, 38}, {136, 38}, {137, 38}, {137, 38},
-    {138, 38}, {139, 39}, {140, 39}, {141, 39}, {141, 39}, {142, 39}, {143, 39}, {144, 40},
-    {145, 40}, {146, 40}, {146, 40}, {147, 40}, {148, 40}, {149, 41}, {150, 41}, {151, 41}
-  },
-  {  // mag,nra for x=82 and y=0:127
-    { 82,  0}, { 82,  0}, { 82,  1}, { 82,  1}, { 82,  2}, { 82,  2}, { 82,  3}, { 82,  3},
-    { 82,  4}, { 82,  4}, { 83,  5}, { 83,  5}, { 83,  6}, { 83,  6}, { 83,  7}, { 83,  7},
-    { 84,  8}, { 84,  8}, { 84,  9}, { 84,  9}, { 84, 10}, { 85, 10}, { 85, 11}, { 85, 11},
-    { 85, 12}, { 86, 12}, { 86, 13}, { 86, 13}, { 87, 13}, { 87, 14}, { 87, 14}, { 88, 15},
-    { 88, 15}, { 88, 16}, { 89, 16}, { 89, 16}, { 90, 17}, { 90, 17}, { 90, 18}, { 91, 18},
-    { 91, 18}, { 92, 19}, { 92, 19}, { 93, 20}, { 93, 20}, { 94, 20}, { 94, 21}, { 95, 21},
-    { 95, 22}, { 96, 22}, { 96, 22}, { 97, 23}, { 97, 23}, { 98, 23}, { 98, 24}, { 99, 24},
-    { 99, 24}, {100, 25}, {100, 25}, {101, 25}, {102, 26}, {102, 26}, {103, 26}, {103, 27},
-    {104, 27}, {105, 27}, {105, 28}, {106, 28}, {107, 28}, {107, 29}, {108, 29}, {108, 29},
-    {109, 29}, {110, 30}, {110, 30}, {111, 30}, {112, 30}, {112, 31}, {113, 31}, {114, 31},
-    {115, 31}, {115, 32}, {116, 32}, {117, 32}, {117, 32}, {118, 33}, {119, 33}, {120, 33},
-    {120, 33}, {121, 34}, {122, 34}, {122, 34}, {123, 34}, {124, 35}, {125, 35}, {125, 35},
-    {126, 35}, {127, 35}, {128, 36}, {129, 36}, {129, 36}, {130, 36}, {131, 36}, {132, 37},
-    {132, 37}, {133, 37}, {134, 37}, {135, 37}, {136, 38}, {136, 38}, {137, 38}, {138, 38},
-    {139, 38}, {140, 38}, {140, 39}, {141, 39}, {142, 39}, {143, 39}, {144, 39}, {145, 39},
-    {145, 40}, {146, 40}, {147, 40}, {148, 40}, {149, 40}, {149, 40}, {150, 40}, {151, 41}
-  },
-  {  // mag,nra for x=83 and y=0:127
-    { 83,  0}, { 83,  0}, { 83,  1}, { 83,  1}, { 83,  2}, { 83,  2}, { 83,  3}, { 83,  3},
-    { 83,  4}, { 83,  4}, { 84,  5}, { 84,  5}, { 84,  6}, { 84,  6}, { 84,  7}, { 84,  7},
-    { 85,  8}, { 85,  8}, { 85,  9}, { 85,  9}, { 85, 10}, { 86, 10}, { 86, 11}, { 86, 11},
-    { 86, 11}, { 87, 12}, { 87, 12}, { 87, 13}, { 88, 13}, { 88, 14}, { 88, 14}, { 89, 15},
-    { 89, 15}, { 89, 15}, { 90, 16}, { 90, 16}, { 90, 17}, { 91, 17}, { 91, 17}, { 92, 18},
-    { 92, 18}, { 93, 19}, { 93, 19}, { 93, 19}, { 94, 20}, { 94, 20}, { 95, 21}, { 95, 21},
-    { 96, 21}, { 96, 22}, { 97, 22}, { 97, 22}, { 98, 23}, { 98, 23}, { 99, 24}, {100, 24},
-    {100, 24}, {101, 25}, {101, 25}, {102, 25}, {102, 26}, {103, 26}, {104, 26}, {104, 26},
-    {105, 27}, {105, 27}, {106, 27}, {107, 28}, {107, 28}, {108, 28}, {109, 29}, {109, 29},
-    {110, 29}, {111, 29}, {111, 30}, {112, 30}, {113, 30}, {113, 30}, {114, 31}, {115, 31},
-    {115, 31}, {116, 32}, {117, 32}, {117, 32}, {118, 32}, {119, 32}, {120, 33}, {120, 33},
-    {121, 33}, {122, 33}, {122, 34}, {123, 34}, {124, 34}, {125, 34}, {125, 35}, {126, 35},
-    {127, 35}, {128, 35}, {128, 35}, {129, 36}, {130, 36}, {131, 36}, {132, 36}, {132, 36},
-    {133, 37}, {134, 37}, {135, 37}, {135, 37}, {136, 37}, {137, 37}, {138, 38}, {139, 38},
-    {139, 38}, {140, 38}, {141, 38}, {142, 39}, {143, 39}, {143, 39}, {144, 39}, {145, 39},
-    {146, 39}, {147, 40}, {148, 40}, {148, 40}, {149, 40}, {150, 40}, {151, 40}, {152, 40}
-  },
-  {  // mag,nra for x=84 and y=0:127
-    { 84,  0}, { 84,  0}, { 84,  1}, { 84,  1}, { 84,  2}, { 84,  2}, { 84,  3}, { 84,  3},
-    { 84,  4}, { 84,  4}, { 85,  5}, { 85,  5}, { 85,  6}, { 85,  6}, { 85,  7}, { 85,  7},
-    { 86,  8}, { 86,  8}, { 86,  9}, { 86,  9}, { 86, 10}, { 87, 10}, { 87, 10}, { 87, 11},
-    { 87, 11}, { 88, 12}, { 88, 12}, { 88, 13}, { 89, 13}, { 89, 14}, { 89, 14}, { 90, 14},
-    { 90, 15}, { 90, 15}, { 91, 16}, { 91, 16}, { 91, 16}, { 92, 17}, { 92, 17}, { 93, 18},
-    { 93, 18}, { 93, 19}, { 94, 19}, { 94, 19}, { 95, 20}, { 95, 20}, { 96, 20}, { 96, 21},
-    { 97, 21}, { 97, 22}, { 98, 22}, { 98, 22}, { 99, 23}, { 99, 23}, {100, 23}, {100, 24},
-    {101, 24}, {102, 24}, {102, 25}, {103, 25}, {103, 25}, {104, 26}, {104, 26}, {105, 26},
-    {106, 27}, {106, 27}, {107, 27}, {107, 27}, {108, 28}, {109, 28}, {109, 28}, {110, 29},
-    {111, 29}, {111, 29}, {112, 29}, {113, 30}, {113, 30}, {114, 30}, {115, 30}, {115, 31},
-    {116, 31}, {117, 31}, {117, 32}, {118, 32}, {119, 32}, {120, 32}, {120, 32}, {121, 33},
-    {122, 33}, {122, 33}, {123, 33}, {124, 34}, {125, 34}, {125, 34}, {126, 34}, {127, 35},
-    {128, 35}, {128, 35}, {129, 35}, {130, 35}, {131, 36}, {131, 36}, {132, 36}, {133, 36},
-    {134, 36}, {134, 37}, {135, 37}, {136, 37}, {137, 37}, {138, 37}, {138, 37}, {139, 38},
-    {140, 38}, {141, 38}, {142, 38}, {142, 38}, {143, 38}, {144, 39}, {145, 39}, {146, 39},
-    {146, 39}, {147, 39}, {148, 39}, {149, 40}, {150, 40}, {151, 40}, {151, 40}, {152, 40}
-  },
-  {  // mag,nra for x=85 and y=0:127
-    { 85,  0}, { 85,  0}, { 85,  1}, { 85,  1}, { 85,  2}, { 85,  2}, { 85,  3}, { 85,  3},
-    { 85,  4}, { 85,  4}, { 86,  5}, { 86,  5}, { 86,  6}, { 86,  6}, { 86,  7}, { 86,  7},
-    { 86,  8}, { 87,  8}, { 87,  9}, { 87,  9}, { 87,  9}, { 88, 10}, { 88, 10}, { 88, 11},
-    { 88, 11}, { 89, 12}, { 89, 12}, { 89, 13}, { 89, 13}, { 90, 13}, { 90, 14}, { 90, 14},
-    { 91, 15}, { 91, 15}, { 92, 16}, { 92, 16}, { 92, 16}, { 93, 17}, { 93, 17}, { 94, 18},
-    { 94, 18}, { 94, 18}, { 95, 19}, { 95, 19}, { 96, 19}, { 96, 20}, { 97, 20}, { 97, 21},
-    { 98, 21}, { 98, 21}, { 99, 22}, { 99, 22}, {100, 22}, {100, 23}, {101, 23}, {101, 23},
-    {102, 24}, {102, 24}, {103, 24}, {103, 25}, {104, 25}, {105, 25}, {105, 26}, {106, 26},
-    {106, 26}, {107, 27}, {108, 27}, {108, 27}, {109, 27}, {109, 28}, {110, 28}, {111, 28},
-    {111, 29}, {112, 29}, {113, 29}, {113, 29}, {114, 30}, {115, 30}, {115, 30}, {116, 31},
-    {117, 31}, {117, 31}, {118, 31}, {119, 32}, {120, 32}, {120, 32}, {121, 32}, {122, 32},
-    {122, 33}, {123, 33}, {124, 33}, {125, 33}, {125, 34}, {126, 34}, {127, 34}, {127, 34},
-    {128, 34}, {129, 35}, {130, 35}, {130, 35}, {131, 35}, {132, 35}, {133, 36}, {134, 36},
-    {134, 36}, {135, 36}, {136, 36}, {137, 37}, {137, 37}, {138, 37}, {139, 37}, {140, 37},
-    {141, 38}, {141, 38}, {142, 38}, {143, 38}, {144, 38}, {145, 38}, {145, 39}, {146, 39},
-    {147, 39}, {148, 39}, {149, 39}, {150, 39}, {150, 40}, {151, 40}, {152, 40}, {153, 40}
-  },
-  {  // mag,nra for x=86 and y=0:127
-    { 86,  0}, { 86,  0}, { 86,  1}, { 86,  1}, { 86,  2}, { 86,  2}, { 86,  3}, { 86,  3},
-    { 86,  4}, { 86,  4}, { 87,  5}, { 87,  5}, { 87,  6}, { 87,  6}, { 87,  7}, { 87,  7},
-    { 87,  7}, { 88,  8}, { 88,  8}, { 88,  9}, { 88,  9}, { 89, 10}, { 89, 10}, { 89, 11},
-    { 89, 11}, { 90, 12}, { 90, 12}, { 90, 12}, { 90, 13}, { 91, 13}, { 91, 14}, { 91, 14},
-    { 92, 15}, { 92, 15}, { 92, 15}, { 93, 16}, { 93, 16}, { 94, 17}, { 94, 17}, { 94, 17},
-    { 95, 18}, { 95, 18}, { 96, 19}, { 96, 19}, { 97, 19}, { 97, 20}, { 98, 20}, { 98, 20},
-    { 98, 21}, { 99, 21}, { 99, 21}, {100, 22}, {100, 22}, {101, 23}, {102, 23}, {102, 23},
-    {103, 24}, {103, 24}, {104, 24}, {104, 24}, {105, 25}, {105, 25}, {106, 25}, {107, 26},
-    {107, 26}, {108, 26}, {108, 27}, {109, 27}, {110, 27}, {110, 28}, {111, 28}, {112, 28},
-    {112, 28}, {113, 29}, {113, 29}, {114, 29}, {115, 29}, {115, 30}, {116, 30}, {117, 30},
-    {117, 31}, {118, 31}, {119, 31}, {120, 31}, {120, 32}, {121, 32}, {122, 32}, {122, 32},
-    {123, 32}, {124, 33}, {124, 33}, {125, 33}, {126, 33}, {127, 34}, {127, 34}, {128, 34},
-    {129, 34}, {130, 34}, {130, 35}, {131, 35}, {132, 35}, {133, 35}, {133, 35}, {134, 36},
-    {135, 36}, {136, 36}, {136, 36}, {137, 36}, {138, 37}, {139, 37}, {140, 37}, {140, 37},
-    {141, 37}, {142, 37}, {143, 38}, {144, 38}, {144, 38}, {145, 38}, {146, 38}, {147, 39},
-    {148, 39}, {148, 39}, {149, 39}, {150, 39}, {151, 39}, {152, 39}, {153, 40}, {153, 40}
-  },
-  {  // mag,nra for x=87 and y=0:127
-    { 87,  0}, { 87,  0}, { 87,  1}, { 87,  1}, { 87,  2}, { 87,  2}, { 87,  3}, { 87,  3},
-    { 87,  4}, { 87,  4}, { 88,  5}, { 88,  5}, { 88,  6}, { 88,  6}, { 88,  7}, { 88,  7},
-    { 88,  7}, { 89,  8}, { 89,  8}, { 89,  9}, { 89,  9}, { 89, 10}, { 90, 10}, { 90, 11},
-    { 90, 11}, { 91, 11}, { 91, 12}, { 91, 12}, { 91, 13}, { 92, 13}, { 92, 14}, { 92, 14},
-    { 93, 14}, { 93, 15}, { 93, 15}, { 94, 16}, { 94, 16}, { 95, 16}, { 95, 17}, { 95, 17},
-    { 96, 18}, { 96, 18}, { 97, 18}, { 97, 19}, { 97, 19}, { 98, 19}, { 98, 20}, { 99, 20},
-    { 99, 21}, {100, 21}, {100, 21}, {101, 22}, {101, 22}, {102, 22}, {102, 23}, {103, 23},
-    {103, 23}, {104, 24}, {105, 24}, {105, 24}, {106, 25}, {106, 25}, {107, 25}, {107, 26},
-    {108, 26}, {109, 26}, {109, 26}, {110, 27}, {110, 27}, {111, 27}, {112, 28}, {112, 28},
-    {113, 28}, {114, 28}, {114, 29}, {115, 29}, {116, 29}, {116, 30}, {117, 30}, {118, 30},
-    {118, 30}, {119, 31}, {120, 31}, {120, 31}, {121, 31}, {122, 32}, {122, 32}, {123, 32},
-    {124, 32}, {124, 32}, {125, 33}, {126, 33}, {127, 33}, {127, 33}, {128, 34}, {129, 34},
-    {130, 34}, {130, 34}, {131, 34}, {132, 35}, {133, 35}, {133, 35}, {134, 35}, {135, 35},
-    {136, 36}, {136, 36}, {137, 36}, {138, 36}, {139, 36}, {139, 37}, {140, 37}, {141, 37},
-    {142, 37}, {143, 37}, {143, 37}, {144, 38}, {145, 38}, {146, 38}, {147, 38}, {147, 38},
-    {148, 38}, {149, 39}, {150, 39}, {151, 39}, {151, 39}, {152, 39}, {153, 39}, {154, 40}
-  },
-  {  // mag,nra for x=88 and y=0:127
-    { 88,  0}, { 88,  0}, { 88,  1}, { 88,  1}, { 88,  2}, { 88,  2}, { 88,  3}, { 88,  3},
-    { 88,  4}, { 88,  4}, { 89,  5}, { 89,  5}, { 89,  6}, { 89,  6}, { 89,  6}, { 89,  7},
-    { 89,  7}, { 90,  8}, { 90,  8}, { 90,  9}, { 90,  9}, { 90, 10}, { 91, 10}, { 91, 10},
-    { 91, 11}, { 91, 11}, { 92, 12}, { 92, 12}, { 92, 13}, { 93, 13}, { 93, 13}, { 93, 14},
-    { 94, 14}, { 94, 15}, { 94, 15}, { 95, 15}, { 95, 16}, { 95, 16}, { 96, 17}, { 96, 17},
-    { 97, 17}, { 97, 18}, { 98, 18}, { 98, 19}, { 98, 19}, { 99, 19}, { 99, 20}, {100, 20},
-    {100, 20}, {101, 21}, {101, 21}, {102, 21}, {102, 22}, {103, 22}, {103, 22}, {104, 23},
-    {104, 23}, {105, 23}, {105, 24}, {106, 24}, {107, 24}, {107, 25}, {108, 25}, {108, 25},
-    {109, 26}, {109, 26}, {110, 26}, {111, 27}, {111, 27}, {112, 27}, {112, 27}, {113, 28},
-    {114, 28}, {114, 28}, {115, 28}, {116, 29}, {116, 29}, {117, 29}, {118, 30}, {118, 30},
-    {119, 30}, {120, 30}, {120, 31}, {121, 31}, {122, 31}, {122, 31}, {123, 32}, {124, 32},
-    {124, 32}, {125, 32}, {126, 32}, {127, 33}, {127, 33}, {128, 33}, {129, 33}, {129, 34},
-    {130, 34}, {131, 34}, {132, 34}, {132, 34}, {133, 35}, {134, 35}, {135, 35}, {135, 35},
-    {136, 35}, {137, 36}, {138, 36}, {139, 36}, {139, 36}, {140, 36}, {141, 37}, {142, 37},
-    {142, 37}, {143, 37}, {144, 37}, {145, 37}, {146, 38}, {146, 38}, {147, 38}, {148, 38},
-    {149, 38}, {150, 38}, {150, 39}, {151, 39}, {152, 39}, {153, 39}, {154, 39}, {155, 39}
-  },
-  {  // mag,nra for x=89 and y=0:127
-    { 89,  0}, { 89,  0}, { 89,  1}, { 89,  1}, { 89,  2}, { 89,  2}, { 89,  3}, { 89,  3},
-    { 89,  4}, { 89,  4}, { 90,  5}, { 90,  5}, { 90,  5}, { 90,  6}, { 90,  6}, { 90,  7},
-    { 90,  7}, { 91,  8}, { 91,  8}, { 91,  9}, { 91,  9}, { 91,  9}, { 92, 10}, { 92, 10},
-    { 92, 11}, { 92, 11}, { 93, 12}, { 93, 12}, { 93, 12}, { 94, 13}, { 94, 13}, { 94, 14},
-    { 95, 14}, { 95, 14}, { 95, 15}, { 96, 15}, { 96, 16}, { 96, 16}, { 97, 16}, { 97, 17},
-    { 98, 17}, { 98, 18}, { 98, 18}, { 99, 18}, { 99, 19}, {100, 19}, {100, 19}, {101, 20},
-    {101, 20}, {102, 21}, {102, 21}, {103, 21}, {103, 22}, {104, 22}, {104, 22}, {105, 23},
-    {105, 23}, {106, 23}, {106, 24}, {107, 24}, {107, 24}, {108, 24}, {108, 25}, {109, 25},
-    {110, 25}, {110, 26}, {111, 26}, {111, 26}, {112, 27}, {113, 27}, {113, 27}, {114, 27},
-    {114, 28}, {115, 28}, {116, 28}, {116, 29}, {117, 29}, {118, 29}, {118, 29}, {119, 30},
-    {120, 30}, {120, 30}, {121, 30}, {122, 31}, {122, 31}, {123, 31}, {124, 31}, {124, 32},
-    {125, 32}, {126, 32}, {127, 32}, {127, 32}, {128, 33}, {129, 33}, {129, 33}, {130, 33},
-    {131, 34}, {132, 34}, {132, 34}, {133, 34}, {134, 34}, {135, 35}, {135, 35}, {136, 35},
-    {137, 35}, {138, 35}, {138, 36}, {139, 36}, {140, 36}, {141, 36}, {141, 36}, {142, 36},
-    {143, 37}, {144, 37}, {145, 37}, {145, 37}, {146, 37}, {147, 38}, {148, 38}, {149, 38},
-    {149, 38}, {150, 38}, {151, 38}, {152, 38}, {153, 39}, {153, 39}, {154, 39}, {155, 39}
-  },
-  {  // mag,nra for x=90 and y=0:127
-    { 90,  0}, { 90,  0}, { 90,  1}, { 90,  1}, { 90,  2}, { 90,  2}, { 90,  3}, { 90,  3},
-    { 90,  4}, { 90,  4}, { 91,  5}, { 91,  5}, { 91,  5}, { 91,  6}, { 91,  6}, { 91,  7},
-    { 91,  7}, { 92,  8}, { 92,  8}, { 92,  8}, { 92,  9}, { 92,  9}, { 93, 10}, { 93, 10},
-    { 93, 11}, { 93, 11}, { 94, 11}, { 94, 12}, { 94, 12}, { 95, 13}, { 95, 13}, { 95, 14},
-    { 96, 14}, { 96, 14}, { 96, 15}, { 97, 15}, { 97, 16}, { 97, 16}, { 98, 16}, { 98, 17},
-    { 98, 17}, { 99, 17}, { 99, 18}, {100, 18}, {100, 19}, {101, 19}, {101, 19}, {102, 20},
-    {102, 20}, {102, 20}, {103, 21}, {103, 21}, {104, 21}, {104, 22}, {105, 22}, {105, 22},
-    {106, 23}, {107, 23}, {107, 23}, {108, 24}, {108, 24}, {109, 24}, {109, 25}, {110, 25},
-    {110, 25}, {111, 25}, {112, 26}, {112, 26}, {113, 26}, {113, 27}, {114, 27}, {115, 27},
-    {115, 27}, {116, 28}, {117, 28}, {117, 28}, {118, 29}, {118, 29}, {119, 29}, {120, 29},
-    {120, 30}, {121, 30}, {122, 30}, {122, 30}, {123, 31}, {124, 31}, {124, 31}, {125, 31},
-    {126, 32}, {127, 32}, {127, 32}, {128, 32}, {129, 32}, {129, 33}, {130, 33}, {131, 33},
-    {132, 33}, {132, 34}, {133, 34}, {134, 34}, {135, 34}, {135, 34}, {136, 35}, {137, 35},
-    {138, 35}, {138, 35}, {139, 35}, {140, 36}, {141, 36}, {141, 36}, {142, 36}, {143, 36},
-    {144, 36}, {144, 37}, {145, 37}, {146, 37}, {147, 37}, {148, 37}, {148, 37}, {149, 38},
-    {150, 38}, {151, 38}, {152, 38}, {152, 38}, {153, 38}, {154, 39}, {155, 39}, {156, 39}
-  },
-  {  // mag,nra for x=91 and y=0:127
-    { 91,  0}, { 91,  0}, { 91,  1}, { 91,  1}, { 91,  2}, { 91,  2}, { 91,  3}, { 91,  3},
-    { 91,  4}, { 91,  4}, { 92,  4}, { 92,  5}, { 92,  5}, { 92,  6}, { 92,  6}, { 92,  7},
-    { 92,  7}, { 93,  8}, { 93,  8}, { 93,  8}, { 93,  9}, { 93,  9}, { 94, 10}, { 94, 10},
-    { 94, 11}, { 94, 11}, { 95, 11}, { 95, 12}, { 95, 12}, { 96, 13}, { 96, 13}, { 96, 13},
-    { 96, 14}, { 97, 14}, { 97, 15}, { 97, 15}, { 98, 15}, { 98, 16}, { 99, 16}, { 99, 16},
-    { 99, 17}, {100, 17}, {100, 18}, {101, 18}, {101, 18}, {102, 19}, {102, 19}, {102, 19},
-    {103, 20}, {103, 20}, {104, 20}, {104, 21}, {105, 21}, {105, 21}, {106, 22}, {106, 22},
-    {107, 22}, {107, 23}, {108, 23}, {108, 23}, {109, 24}, {110, 24}, {110, 24}, {111, 25},
-    {111, 25}, {112, 25}, {112, 26}, {113, 26}, {114, 26}, {114, 26}, {115, 27}, {115, 27},
-    {116, 27}, {117, 28}, {117, 28}, {118, 28}, {119, 28}, {119, 29}, {120, 29}, {121, 29},
-    {121, 29}, {122, 30}, {122, 30}, {123, 30}, {124, 30}, {125, 31}, {125, 31}, {126, 31},
-    {127, 31}, {127, 32}, {128, 32}, {129, 32}, {129, 32}, {130, 32}, {131, 33}, {132, 33},
-    {132, 33}, {133, 33}, {134, 34}, {134, 34}, {135, 34}, {136, 34}, {137, 34}, {137, 35},
-    {138, 35}, {139, 35}, {140, 35}, {140, 35}, {141, 35}, {142, 36}, {143, 36}, {144, 36},
-    {144, 36}, {145, 36}, {146, 37}, {147, 37}, {147, 37}, {148, 37}, {149, 37}, {150, 37},
-    {151, 38}, {151, 38}, {152, 38}, {153, 38}, {154, 38}, {155, 38}, {155, 39}, {156, 39}
-  },
-  {  // mag,nra for x=92 and y=0:127
-    { 92,  0}, { 92,  0}, { 92,  1}, { 92,  1}, { 92,  2}, { 92,  2}, { 92,  3}, { 92,  3},
-    { 92,  4}, { 92,  4}, { 93,  4}, { 93,  5}, { 93,  5}, { 93,  6}, { 93,  6}, { 93,  7},
-    { 93,  7}, { 94,  7}, { 94,  8}, { 94,  8}, { 94,  9}, { 94,  9}, { 95, 10}, { 95, 10},
-    { 95, 10}, { 95, 11}, { 96, 11}, { 96, 12}, { 96, 12}, { 96, 12}, { 97, 13}, { 97, 13},
-    { 97, 14}, { 98, 14}, { 98, 14}, { 98, 15}, { 99, 15}, { 99, 16}, {100, 16}, {100, 16},
-    {100, 17}, {101, 17}, {101, 17}, {102, 18}, {102, 18}, {102, 19}, {103, 19}, {103, 19},
-    {104, 20}, {104, 20}, {105, 20}, {105, 21}, {106, 21}, {106, 21}, {107, 22}, {107, 22},
-    {108, 22}, {108, 23}, {109, 23}, {109, 23}, {110, 24}, {110, 24}, {111, 24}, {112, 24},
-    {112, 25}, {113, 25}, {113, 25}, {114, 26}, {114, 26}, {115, 26}, {116, 27}, {116, 27},
-    {117, 27}, {117, 27}, {118, 28}, {119, 28}, {119, 28}, {120, 28}, {121, 29}, {121, 29},
-    {122, 29}, {123, 29}, {123, 30}, {124, 30}, {125, 30}, {125, 30}, {126, 31}, {127, 31},
-    {127, 31}, {128, 31}, {129, 32}, {129, 32}, {130, 32}, {131, 32}, {132, 32}, {132, 33},
-    {133, 33}, {134, 33}, {134, 33}, {135, 33}, {136, 34}, {137, 34}, {137, 34}, {138, 34},
-    {139, 34}, {140, 35}, {140, 35}, {141, 35}, {142, 35}, {143, 35}, {143, 36}, {144, 36},
-    {145, 36}, {146, 36}, {146, 36}, {147, 37}, {148, 37}, {149, 37}, {150, 37}, {150, 37},
-    {151, 37}, {152, 38}, {153, 38}, {154, 38}, {154, 38}, {155, 38}, {156, 38}, {157, 38}
-  },
-  {  // mag,nra for x=93 and y=0:127
-    { 93,  0}, { 93,  0}, { 93,  1}, { 93,  1}, { 93,  2}, { 93,  2}, { 93,  3}, { 93,  3},
-    { 93,  3}, { 93,  4}, { 94,  4}, { 94,  5}, { 94,  5}, { 94,  6}, { 94,  6}, { 94,  7},
-    { 94,  7}, { 95,  7}, { 95,  8}, { 95,  8}, { 95,  9}, { 95,  9}, { 96,  9}, { 96, 10},
-    { 96, 10}, { 96, 11}, { 97, 11}, { 97, 12}, { 97, 12}, { 97, 12}, { 98, 13}, { 98, 13},
-    { 98, 14}, { 99, 14}, { 99, 14}, { 99, 15}, {100, 15}, {100, 15}, {100, 16}, {101, 16},
-    {101, 17}, {102, 17}, {102, 17}, {102, 18}, {103, 18}, {103, 18}, {104, 19}, {104, 19},
-    {105, 19}, {105, 20}, {106, 20}, {106, 20}, {107, 21}, {107, 21}, {108, 21}, {108, 22},
-    {109, 22}, {109, 22}, {110, 23}, {110, 23}, {111, 23}, {111, 24}, {112, 24}, {112, 24},
-    {113, 25}, {113, 25}, {114, 25}, {115, 25}, {115, 26}, {116, 26}, {116, 26}, {117, 27},
-    {118, 27}, {118, 27}, {119, 27}, {119, 28}, {120, 28}, {121, 28}, {121, 28}, {122, 29},
-    {123, 29}, {123, 29}, {124, 29}, {125, 30}, {125, 30}, {126, 30}, {127, 30}, {127, 31},
-    {128, 31}, {129, 31}, {129, 31}, {130, 32}, {131, 32}, {132, 32}, {132, 32}, {133, 32},
-    {134, 33}, {134, 33}, {135, 33}, {136, 33}, {137, 33}, {137, 34}, {138, 34}, {139, 34},
-    {140, 34}, {140, 34}, {141, 35}, {142, 35}, {143, 35}, {143, 35}, {144, 35}, {145, 36},
-    {146, 36}, {146, 36}, {147, 36}, {148, 36}, {149, 36}, {149, 37}, {150, 37}, {151, 37},
-    {152, 37}, {153, 37}, {153, 37}, {154, 38}, {155, 38}, {156, 38}, {157, 38}, {157, 38}
-  },
-  {  // mag,nra for x=94 and y=0:127
-    { 94,  0}, { 94,  0}, { 94,  1}, { 94,  1}, { 94,  2}, { 94,  2}, { 94,  3}, { 94,  3},
-    { 94,  3}, { 94,  4}, { 95,  4}, { 95,  5}, { 95,  5}, { 95,  6}, { 95,  6}, { 95,  6},
-    { 95,  7}, { 96,  7}, { 96,  8}, { 96,  8}, { 96,  9}, { 96,  9}, { 97,  9}, { 97, 10},
-    { 97, 10}, { 97, 11}, { 98, 11}, { 98, 11}, { 98, 12}, { 98, 12}, { 99, 13}, { 99, 13},
-    { 99, 13}, {100, 14}, {100, 14}, {100, 15}, {101, 15}, {101, 15}, {101, 16}, {102, 16},
-    {102, 16}, {103, 17}, {103, 17}, {103, 17}, {104, 18}, {104, 18}, {105, 19}, {105, 19},
-    {106, 19}, {106, 20}, {106, 20}, {107, 20}, {107, 21}, {108, 21}, {108, 21}, {109, 22},
-    {109, 22}, {110, 22}, {110, 23}, {111, 23}, {112, 23}, {112, 23}, {113, 24}, {113, 24},
-    {114, 24}, {114, 25}, {115, 25}, {115, 25}, {116, 26}, {117, 26}, {117, 26}, {118, 26},
-    {118, 27}, {119, 27}, {120, 27}, {120, 27}, {121, 28}, {122, 28}, {122, 28}, {123, 28},
-    {123, 29}, {124, 29}, {125, 29}, {125, 29}, {126, 30}, {127, 30}, {127, 30}, {128, 30},
-    {129, 31}, {129, 31}, {130, 31}, {131, 31}, {132, 32}, {132, 32}, {133, 32}, {134, 32},
-    {134, 32}, {135, 33}, {136, 33}, {137, 33}, {137, 33}, {138, 33}, {139, 34}, {139, 34},
-    {140, 34}, {141, 34}, {142, 34}, {142, 35}, {143, 35}, {144, 35}, {145, 35}, {145, 35},
-    {146, 36}, {147, 36}, {148, 36}, {149, 36}, {149, 36}, {150, 36}, {151, 37}, {152, 37},
-    {152, 37}, {153, 37}, {154, 37}, {155, 37}, {156, 38}, {156, 38}, {157, 38}, {158, 38}
-  },
-  {  // mag,nra for x=95 and y=0:127
-    { 95,  0}, { 95,  0}, { 95,  1}, { 95,  1}, { 95,  2}, { 95,  2}, { 95,  3}, { 95,  3},
-    { 95,  3}, { 95,  4}, { 96,  4}, { 96,  5}, { 96,  5}, { 96,  6}, { 96,  6}, { 96,  6},
-    { 96,  7}, { 97,  7}, { 97,  8}, { 97,  8}, { 97,  8}, { 97,  9}, { 98,  9}, { 98, 10},
-    { 98, 10}, { 98, 10}, { 98, 11}, { 99, 11}, { 99, 12}, { 99, 12}, {100, 12}, {100, 13},
-    {100, 13}, {101, 14}, {101, 14}, {101, 14}, {102, 15}, {102, 15}, {102, 16}, {103, 16},
-    {103, 16}, {103, 17}, {104, 17}, {104, 17}, {105, 18}, {105, 18}, {106, 18}, {106, 19},
-    {106, 19}, {107, 19}, {107, 20}, {108, 20}, {108, 20}, {109, 21}, {109, 21}, {110, 21},
-    {110, 22}, {111, 22}, {111, 22}, {112, 23}, {112, 23}, {113, 23}, {113, 24}, {114, 24},
-    {115, 24}, {115, 24}, {116, 25}, {116, 25}, {117, 25}, {117, 26}, {118, 26}, {119, 26},
-    {119, 26}, {120, 27}, {120, 27}, {121, 27}, {122, 27}, {122, 28}, {123, 28}, {124, 28},
-    {124, 29}, {125, 29}, {125, 29}, {126, 29}, {127, 29}, {127, 30}, {128, 30}, {129, 30},
-    {129, 30}, {130, 31}, {131, 31}, {132, 31}, {132, 31}, {133, 32}, {134, 32}, {134, 32},
-    {135, 32}, {136, 32}, {136, 33}, {137, 33}, {138, 33}, {139, 33}, {139, 33}, {140, 34},
-    {141, 34}, {142, 34}, {142, 34}, {143, 34}, {144, 35}, {145, 35}, {145, 35}, {146, 35},
-    {147, 35}, {148, 36}, {148, 36}, {149, 36}, {150, 36}, {151, 36}, {151, 36}, {152, 37},
-    {153, 37}, {154, 37}, {155, 37}, {155, 37}, {156, 37}, {157, 38}, {158, 38}, {159, 38}
-  },
-  {  // mag,nra for x=96 and y=0:127
-    { 96,  0}, { 96,  0}, { 96,  1}, { 96,  1}, { 96,  2}, { 96,  2}, { 96,  3}, { 96,  3},
-    { 96,  3}, { 96,  4}, { 97,  4}, { 97,  5}, { 97,  5}, { 97,  5}, { 97,  6}, { 97,  6},
-    { 97,  7}, { 97,  7}, { 98,  8}, { 98,  8}, { 98,  8}, { 98,  9}, { 98,  9}, { 99, 10},
-    { 99, 10}, { 99, 10}, { 99, 11}, {100, 11}, {100, 12}, {100, 12}, {101, 12}, {101, 13},
-    {101, 13}, {102, 13}, {102, 14}, {102, 14}, {103, 15}, {103, 15}, {103, 15}, {104, 16},
-    {104, 16}, {104, 16}, {105, 17}, {105, 17}, {106, 18}, {106, 18}, {106, 18}, {107, 19},
-    {107, 19}, {108, 19}, {108, 20}, {109, 20}, {109, 20}, {110, 21}, {110, 21}, {111, 21},
-    {111, 22}, {112, 22}, {112, 22}, {113, 22}, {113, 23}, {114, 23}, {114, 23}, {115, 24},
-    {115, 24}, {116, 24}, {116, 25}, {117, 25}, {118, 25}, {118, 25}, {119, 26}, {119, 26},
-    {120, 26}, {121, 26}, {121, 27}, {122, 27}, {122, 27}, {123, 28}, {124, 28}, {124, 28},
-    {125, 28}, {126, 29}, {126, 29}, {127, 29}, {128, 29}, {128, 30}, {129, 30}, {130, 30},
-    {130, 30}, {131, 30}, {132, 31}, {132, 31}, {133, 31}, {134, 31}, {134, 32}, {135, 32},
-    {136, 32}, {136, 32}, {137, 32}, {138, 33}, {139, 33}, {139, 33}, {140, 33}, {141, 33},
-    {142, 34}, {142, 34}, {143, 34}, {144, 34}, {144, 34}, {145, 35}, {146, 35}, {147, 35},
-    {148, 35}, {148, 35}, {149, 35}, {150, 36}, {151, 36}, {151, 36}, {152, 36}, {153, 36},
-    {154, 37}, {154, 37}, {155, 37}, {156, 37}, {157, 37}, {158, 37}, {158, 37}, {159, 38}
-  },
-  {  // mag,nra for x=97 and y=0:127
-    { 97,  0}, { 97,  0}, { 97,  1}, { 97,  1}, { 97,  2}, { 97,  2}, { 97,  3}, { 97,  3},
-    { 97,  3}, { 97,  4}, { 98,  4}, { 98,  5}, { 98,  5}, { 98,  5}, { 98,  6}, { 98,  6},
-    { 98,  7}, { 98,  7}, { 99,  7}, { 99,  8}, { 99,  8}, { 99,  9}, { 99,  9}, {100,  9},
-    {100, 10}, {100, 10}, {100, 11}, {101, 11}, {101, 11}, {101, 12}, {102, 12}, {102, 13},
-    {102, 13}, {102, 13}, {103, 14}, {103, 14}, {103, 14}, {104, 15}, {104, 15}, {105, 16},
-    {105, 16}, {105, 16}, {106, 17}, {106, 17}, {107, 17}, {107, 18}, {107, 18}, {108, 18},
-    {108, 19}, {109, 19}, {109, 19}, {110, 20}, {110, 20}, {111, 20}, {111, 21}, {112, 21},
-    {112, 21}, {113, 22}, {113, 22}, {114, 22}, {114, 23}, {115, 23}, {115, 23}, {116, 23},
-    {116, 24}, {117, 24}, {117, 24}, {118, 25}, {118, 25}, {119, 25}, {120, 25}, {120, 26},
-    {121, 26}, {121, 26}, {122, 27}, {123, 27}, {123, 27}, {124, 27}, {124, 28}, {125, 28},
-    {126, 28}, {126, 28}, {127, 29}, {128, 29}, {128, 29}, {129, 29}, {130, 30}, {130, 30},
-    {131, 30}, {132, 30}, {132, 30}, {133, 31}, {134, 31}, {134, 31}, {135, 31}, {136, 32},
-    {136, 32}, {137, 32}, {138, 32}, {139, 32}, {139, 33}, {140, 33}, {141, 33}, {141, 33},
-    {142, 33}, {143, 34}, {144, 34}, {144, 34}, {145, 34}, {146, 34}, {147, 35}, {147, 35},
-    {148, 35}, {149, 35}, {150, 35}, {150, 35}, {151, 36}, {152, 36}, {153, 36}, {154, 36},
-    {154, 36}, {155, 36}, {156, 37}, {157, 37}, {157, 37}, {158, 37}, {159, 37}, {160, 37}
-  },
-  {  // mag,nra for x=98 and y=0:127
-    { 98,  0}, { 98,  0}, { 98,  1}, { 98,  1}, { 98,  2}, { 98,  2}, { 98,  2}, { 98,  3},
-    { 98,  3}, { 98,  4}, { 99,  4}, { 99,  5}, { 99,  5}, { 99,  5}, { 99,  6}, { 99,  6},
-    { 99,  7}, { 99,  7}, {100,  7}, {100,  8}, {100,  8}, {100,  9}, {100,  9}, {101,  9},
-    {101, 10}, {101, 10}, {101, 11}, {102, 11}, {102, 11}, {102, 12}, {102, 12}, {103, 12},
-    {103, 13}, {103, 13}, {104, 14}, {104, 14}, {104, 14}, {105, 15}, {105, 15}, {105, 15},
-    {106, 16}, {106, 16}, {107, 16}, {107, 17}, {107, 17}, {108, 18}, {108, 18}, {109, 18},
-    {109, 19}, {110, 19}, {110, 19}, {110, 20}, {111, 20}, {111, 20}, {112, 21}, {112, 21},
-    {113, 21}, {113, 21}, {114, 22}, {114, 22}, {115, 22}, {115, 23}, {116, 23}, {117, 23},
-    {117, 24}, {118, 24}, {118, 24}, {119, 24}, {119, 25}, {120, 25}, {120, 25}, {121, 26},
-    {122, 26}, {122, 26}, {123, 26}, {123, 27}, {124, 27}, {125, 27}, {125, 27}, {126, 28},
-    {127, 28}, {127, 28}, {128, 28}, {128, 29}, {129, 29}, {130, 29}, {130, 29}, {131, 30},
-    {132, 30}, {132, 30}, {133, 30}, {134, 30}, {134, 31}, {135, 31}, {136, 31}, {136, 31},
-    {137, 32}, {138, 32}, {139, 32}, {139, 32}, {140, 32}, {141, 33}, {141, 33}, {142, 33},
-    {143, 33}, {144, 33}, {144, 34}, {145, 34}, {146, 34}, {147, 34}, {147, 34}, {148, 35},
-    {149, 35}, {150, 35}, {150, 35}, {151, 35}, {152, 35}, {153, 36}, {153, 36}, {154, 36},
-    {155, 36}, {156, 36}, {156, 36}, {157, 37}, {158, 37}, {159, 37}, {160, 37}, {160, 37}
-  },
-  {  // mag,nra for x=99 and y=0:127
-    { 99,  0}, { 99,  0}, { 99,  1}, { 99,  1}, { 99,  2}, { 99,  2}, { 99,  2}, { 99,  3},
-    { 99,  3}, { 99,  4}, {100,  4}, {100,  5}, {100,  5}, {100,  5}, {100,  6}, {100,  6},
-    {100,  7}, {100,  7}, {101,  7}, {101,  8}, {101,  8}, {101,  9}, {101,  9}, {102,  9},
-    {102, 10}, {102, 10}, {102, 10}, {103, 11}, {103, 11}, {103, 12}, {103, 12}, {104, 12},
-    {104, 13}, {104, 13}, {105, 13}, {105, 14}, {105, 14}, {106, 15}, {106, 15}, {106, 15},
-    {107, 16}, {107, 16}, {108, 16}, {108, 17}, {108, 17}, {109, 17}, {109, 18}, {110, 18},
-    {110, 18}, {110, 19}, {111, 19}, {111, 19}, {112, 20}, {112, 20}, {113, 20}, {113, 21},
-    {114, 21}, {114, 21}, {115, 22}, {115, 22}, {116, 22}, {116, 22}, {117, 23}, {117, 23},
-    {118, 23}, {118, 24}, {119, 24}, {120, 24}, {120, 25}, {121, 25}, {121, 25}, {122, 25},
-    {122, 26}, {123, 26}, {124, 26}, {124, 26}, {125, 27}, {125, 27}, {126, 27}, {127, 27},
-    {127, 28}, {128, 28}, {129, 28}, {129, 28}, {130, 29}, {130, 29}, {131, 29}, {132, 29},
-    {132, 30}, {133, 30}, {134, 30}, {134, 30}, {135, 31}, {136, 31}, {137, 31}, {137, 31},
-    {138, 31}, {139, 32}, {139, 32}, {140, 32}, {141, 32}, {141, 32}, {142, 33}, {143, 33},
-    {144, 33}, {144, 33}, {145, 33}, {146, 34}, {147, 34}, {147, 34}, {148, 34}, {149, 34},
-    {149, 35}, {150, 35}, {151, 35}, {152, 35}, {153, 35}, {153, 35}, {154, 36}, {155, 36},
-    {156, 36}, {156, 36}, {157, 36}, {158, 36}, {159, 37}, {159, 37}, {160, 37}, {161, 37}
-  },
-  {  // mag,nra for x=100 and y=0:127
-    {100,  0}, {100,  0}, {100,  1}, {100,  1}, {100,  2}, {100,  2}, {100,  2}, {100,  3},
-    {100,  3}, {100,  4}, {100,  4}, {101,  4}, {101,  5}, {101,  5}, {101,  6}, {101,  6},
-    {101,  6}, {101,  7}, {102,  7}, {102,  8}, {102,  8}, {102,  8}, {102,  9}, {103,  9},
-    {103, 10}, {103, 10}, {103, 10}, {104, 11}, {104, 11}, {104, 12}, {104, 12}, {105, 12},
-    {105, 13}, {105, 13}, {106, 13}, {106, 14}, {106, 14}, {107, 14}, {107, 15}, {107, 15},
-    {108, 16}, {108, 16}, {108, 16}, {109, 17}, {109, 17}, {110, 17}, {110, 18}, {110, 18},
-    {111, 18}, {111, 19}, {112, 19}, {112, 19}, {113, 20}, {113, 20}, {114, 20}, {114, 20},
-    {115, 21}, {115, 21}, {116, 21}, {116, 22}, {117, 22}, {117, 22}, {118, 23}, {118, 23},
-    {119, 23}, {119, 23}, {120, 24}, {120, 24}, {121, 24}, {121, 25}, {122, 25}, {123, 25},
-    {123, 25}, {124, 26}, {124, 26}, {125, 26}, {126, 26}, {126, 27}, {127, 27}, {127, 27},
-    {128, 27}, {129, 28}, {129, 28}, {130, 28}, {131, 28}, {131, 29}, {132, 29}, {133, 29},
-    {133, 29}, {134, 30}, {135, 30}, {135, 30}, {136, 30}, {137, 31}, {137, 31}, {138, 31},
-    {139, 31}, {139, 31}, {140, 32}, {141, 32}, {141, 32}, {142, 32}, {143, 32}, {144, 33},
-    {144, 33}, {145, 33}, {146, 33}, {146, 33}, {147, 34}, {148, 34}, {149, 34}, {149, 34},
-    {150, 34}, {151, 34}, {152, 35}, {152, 35}, {153, 35}, {154, 35}, {155, 35}, {155, 36},
-    {156, 36}, {157, 36}, {158, 36}, {159, 36}, {159, 36}, {160, 37}, {161, 37}, {162, 37}
-  },
-  {  // mag,nra for x=101 and y=0:127
-    {101,  0}, {101,  0}, {101,  1}, {101,  1}, {101,  2}, {101,  2}, {101,  2}, {101,  3},
-    {101,  3}, {101,  4}, {101,  4}, {102,  4}, {102,  5}, {102,  5}, {102,  6}, {102,  6},
-    {102,  6}, {102,  7}, {103,  7}, {103,  8}, {103,  8}, {103,  8}, {103,  9}, {104,  9},
-    {104, 10}, {104, 10}, {104, 10}, {105, 11}, {105, 11}, {105, 11}, {105, 12}, {106, 12},
-    {106, 13}, {106, 13}, {107, 13}, {107, 14}, {107, 14}, {108, 14}, {108, 15}, {108, 15},
-    {109, 15}, {109, 16}, {109, 16}, {110, 16}, {110, 17}, {111, 17}, {111, 17}, {111, 18},
-    {112, 18}, {112, 18}, {113, 19}, {113, 19}, {114, 19}, {114, 20}, {115, 20}, {115, 20},
-    {115, 21}, {116, 21}, {116, 21}, {117, 22}, {117, 22}, {118, 22}, {119, 22}, {119, 23},
-    {120, 23}, {120, 23}, {121, 24}, {121, 24}, {122, 24}, {122, 24}, {123, 25}, {123, 25},
-    {124, 25}, {125, 25}, {125, 26}, {126, 26}, {126, 26}, {127, 27}, {128, 27}, {128, 27},
-    {129, 27}, {129, 28}, {130, 28}, {131, 28}, {131, 28}, {132, 29}, {133, 29}, {133, 29},
-    {134, 29}, {135, 29}, {135, 30}, {136, 30}, {137, 30}, {137, 30}, {138, 31}, {139, 31},
-    {139, 31}, {140, 31}, {141, 31}, {141, 32}, {142, 32}, {143, 32}, {144, 32}, {144, 32},
-    {145, 33}, {146, 33}, {146, 33}, {147, 33}, {148, 33}, {149, 34}, {149, 34}, {150, 34},
-    {151, 34}, {152, 34}, {152, 34}, {153, 35}, {154, 35}, {155, 35}, {155, 35}, {156, 35},
-    {157, 35}, {158, 36}, {158, 36}, {159, 36}, {160, 36}, {161, 36}, {161, 36}, {162, 37}
-  },
-  {  // mag,nra for x=102 and y=0:127
-    {102,  0}, {102,  0}, {102,  1}, {102,  1}, {102,  2}, {102,  2}, {102,  2}, {102,  3},
-    {102,  3}, {102,  4}, {102,  4}, {103,  4}, {103,  5}, {103,  5}, {103,  6}, {103,  6},
-    {103,  6}, {103,  7}, {104,  7}, {104,  8}, {104,  8}, {104,  8}, {104,  9}, {105,  9},
-    {105,  9}, {105, 10}, {105, 10}, {106, 11}, {106, 11}, {106, 11}, {106, 12}, {107, 12},
-    {107, 12}, {107, 13}, {108, 13}, {108, 13}, {108, 14}, {109, 14}, {109, 15}, {109, 15},
-    {110, 15}, {110, 16}, {110, 16}, {111, 16}, {111, 17}, {111, 17}, {112, 17}, {112, 18},
-    {113, 18}, {113, 18}, {114, 19}, {114, 19}, {114, 19}, {115, 20}, {115, 20}, {116, 20},
-    {116, 20}, {117, 21}, {117, 21}, {118, 21}, {118, 22}, {119, 22}, {119, 22}, {120, 23},
-    {120, 23}, {121, 23}, {121, 23}, {122, 24}, {123, 24}, {123, 24}, {124, 25}, {124, 25},
-    {125, 25}, {125, 25}, {126, 26}, {127, 26}, {127, 26}, {128, 26}, {128, 27}, {129, 27},
-    {130, 27}, {130, 27}, {131, 28}, {132, 28}, {132, 28}, {133, 28}, {133, 29}, {134, 29},
-    {135, 29}, {135, 29}, {136, 29}, {137, 30}, {137, 30}, {138, 30}, {139, 30}, {139, 31},
-    {140, 31}, {141, 31}, {141, 31}, {142, 31}, {143, 32}, {144, 32}, {144, 32}, {145, 32},
-    {146, 32}, {146, 33}, {147, 33}, {148, 33}, {149, 33}, {149, 33}, {150, 34}, {151, 34},
-    {151, 34}, {152, 34}, {153, 34}, {154, 34}, {154, 35}, {155, 35}, {156, 35}, {157, 35},
-    {157, 35}, {158, 35}, {159, 36}, {160, 36}, {161, 36}, {161, 36}, {162, 36}, {163, 36}
-  },
-  {  // mag,nra for x=103 and y=0:127
-    {103,  0}, {103,  0}, {103,  1}, {103,  1}, {103,  2}, {103,  2}, {103,  2}, {103,  3},
-    {103,  3}, {103,  4}, {103,  4}, {104,  4}, {104,  5}, {104,  5}, {104,  6}, {104,  6},
-    {104,  6}, {104,  7}, {105,  7}, {105,  7}, {105,  8}, {105,  8}, {105,  9}, {106,  9},
-    {106,  9}, {106, 10}, {106, 10}, {106, 10}, {107, 11}, {107, 11}, {107, 12}, {108, 12},
-    {108, 12}, {108, 13}, {108, 13}, {109, 13}, {109, 14}, {109, 14}, {110, 14}, {110, 15},
-    {110, 15}, {111, 15}, {111, 16}, {112, 16}, {112, 16}, {112, 17}, {113, 17}, {113, 17},
-    {114, 18}, {114, 18}, {114, 18}, {115, 19}, {115, 19}, {116, 19}, {116, 20}, {117, 20},
-    {117, 20}, {118, 21}, {118, 21}, {119, 21}, {119, 21}, {120, 22}, {120, 22}, {121, 22},
-    {121, 23}, {122, 23}, {122, 23}, {123, 23}, {123, 24}, {124, 24}, {125, 24}, {125, 25},
-    {126, 25}, {126, 25}, {127, 25}, {127, 26}, {128, 26}, {129, 26}, {129, 26}, {130, 27},
-    {130, 27}, {131, 27}, {132, 27}, {132, 28}, {133, 28}, {134, 28}, {134, 28}, {135, 29},
-    {135, 29}, {136, 29}, {137, 29}, {137, 29}, {138, 30}, {139, 30}, {139, 30}, {140, 30},
-    {141, 31}, {141, 31}, {142, 31}, {143, 31}, {144, 31}, {144, 32}, {145, 32}, {146, 32},
-    {146, 32}, {147, 32}, {148, 33}, {149, 33}, {149, 33}, {150, 33}, {151, 33}, {151, 34},
-    {152, 34}, {153, 34}, {154, 34}, {154, 34}, {155, 34}, {156, 35}, {157, 35}, {157, 35},
-    {158, 35}, {159, 35}, {160, 35}, {160, 36}, {161, 36}, {162, 36}, {163, 36}, {164, 36}
-  },
-  {  // mag,nra for x=104 and y=0:127
-    {104,  0}, {104,  0}, {104,  1}, {104,  1}, {104,  2}, {104,  2}, {104,  2}, {104,  3},
-    {104,  3}, {104,  4}, {104,  4}, {105,  4}, {105,  5}, {105,  5}, {105,  5}, {105,  6},
-    {105,  6}, {105,  7}, {106,  7}, {106,  7}, {106,  8}, {106,  8}, {106,  8}, {107,  9},
-    {107,  9}, {107, 10}, {107, 10}, {107, 10}, {108, 11}, {108, 11}, {108, 11}, {109, 12},
-    {109, 12}, {109, 13}, {109, 13}, {110, 13}, {110, 14}, {110, 14}, {111, 14}, {111, 15},
-    {111, 15}, {112, 15}, {112, 16}, {113, 16}, {113, 16}, {113, 17}, {114, 17}, {114, 17},
-    {115, 18}, {115, 18}, {115, 18}, {116, 19}, {116, 19}, {117, 19}, {117, 20}, {118, 20},
-    {118, 20}, {119, 20}, {119, 21}, {120, 21}, {120, 21}, {121, 22}, {121, 22}, {122, 22},
-    {122, 22}, {123, 23}, {123, 23}, {124, 23}, {124, 24}, {125, 24}, {125, 24}, {126, 24},
-    {126, 25}, {127, 25}, {128, 25}, {128, 25}, {129, 26}, {129, 26}, {130, 26}, {131, 26},
-    {131, 27}, {132, 27}, {132, 27}, {133, 27}, {134, 28}, {134, 28}, {135, 28}, {136, 28},
-    {136, 29}, {137, 29}, {138, 29}, {138, 29}, {139, 30}, {140, 30}, {140, 30}, {141, 30},
-    {142, 30}, {142, 31}, {143, 31}, {144, 31}, {144, 31}, {145, 31}, {146, 32}, {146, 32},
-    {147, 32}, {148, 32}, {148, 32}, {149, 33}, {150, 33}, {151, 33}, {151, 33}, {152, 33},
-    {153, 34}, {154, 34}, {154, 34}, {155, 34}, {156, 34}, {157, 34}, {157, 35}, {158, 35},
-    {159, 35}, {160, 35}, {160, 35}, {161, 35}, {162, 36}, {163, 36}, {163, 36}, {164, 36}
-  },
-  {  // mag,nra for x=105 and y=0:127
-    {105,  0}, {105,  0}, {105,  1}, {105,  1}, {105,  2}, {105,  2}, {105,  2}, {105,  3},
-    {105,  3}, {105,  3}, {105,  4}, {106,  4}, {106,  5}, {106,  5}, {106,  5}, {106,  6},
-    {106,  6}, {106,  7}, {107,  7}, {107,  7}, {107,  8}, {107,  8}, {107,  8}, {107,  9},
-    {108,  9}, {108, 10}, {108, 10}, {108, 10}, {109, 11}, {109, 11}, {109, 11}, {109, 12},
-    {110, 12}, {110, 12}, {110, 13}, {111, 13}, {111, 13}, {111, 14}, {112, 14}, {112, 14},
-    {112, 15}, {113, 15}, {113, 16}, {113, 16}, {114, 16}, {114, 16}, {115, 17}, {115, 17},
-    {115, 17}, {116, 18}, {116, 18}, {117, 18}, {117, 19}, {118, 19}, {118, 19}, {119, 20},
-    {119, 20}, {119, 20}, {120, 21}, {120, 21}, {121, 21}, {121, 21}, {122, 22}, {122, 22},
-    {123, 22}, {123, 23}, {124, 23}, {125, 23}, {125, 23}, {126, 24}, {126, 24}, {127, 24},
-    {127, 24}, {128, 25}, {128, 25}, {129, 25}, {130, 26}, {130, 26}, {131, 26}, {131, 26},
-    {132, 27}, {133, 27}, {133, 27}, {134, 27}, {134, 27}, {135, 28}, {136, 28}, {136, 28},
-    {137, 28}, {138, 29}, {138, 29}, {139, 29}, {140, 29}, {140, 30}, {141, 30}, {142, 30},
-    {142, 30}, {143, 30}, {144, 31}, {144, 31}, {145, 31}, {146, 31}, {146, 31}, {147, 32},
-    {148, 32}, {148, 32}, {149, 32}, {150, 32}, {151, 33}, {151, 33}, {152, 33}, {153, 33},
-    {154, 33}, {154, 33}, {155, 34}, {156, 34}, {156, 34}, {157, 34}, {158, 34}, {159, 35},
-    {159, 35}, {160, 35}, {161, 35}, {162, 35}, {162, 35}, {163, 36}, {164, 36}, {165, 36}
-  },
-  {  // mag,nra for x=106 and y=0:127
-    {106,  0}, {106,  0}, {106,  1}, {106,  1}, {106,  2}, {106,  2}, {106,  2}, {106,  3},
-    {106,  3}, {106,  3}, {106,  4}, {107,  4}, {107,  5}, {107,  5}, {107,  5}, {107,  6},
-    {107,  6}, {107,  6}, {108,  7}, {108,  7}, {108,  8}, {108,  8}, {108,  8}, {108,  9},
-    {109,  9}, {109,  9}, {109, 10}, {109, 10}, {110, 11}, {110, 11}, {110, 11}, {110, 12},
-    {111, 12}, {111, 12}, {111, 13}, {112, 13}, {112, 13}, {112, 14}, {113, 14}, {113, 14},
-    {113, 15}, {114, 15}, {114, 15}, {114, 16}, {115, 16}, {115, 16}, {116, 17}, {116, 17},
-    {116, 17}, {117, 18}, {117, 18}, {118, 18}, {118, 19}, {119, 19}, {119, 19}, {119, 20},
-    {120, 20}, {120, 20}, {121, 20}, {121, 21}, {122, 21}, {122, 21}, {123, 22}, {123, 22},
-    {124, 22}, {124, 22}, {125, 23}, {125, 23}, {126, 23}, {126, 24}, {127, 24}, {128, 24},
-    {128, 24}, {129, 25}, {129, 25}, {130, 25}, {130, 25}, {131, 26}, {132, 26}, {132, 26},
-    {133, 26}, {133, 27}, {134, 27}, {135, 27}, {135, 27}, {136, 28}, {136, 28}, {137, 28},
-    {138, 28}, {138, 28}, {139, 29}, {140, 29}, {140, 29}, {141, 29}, {142, 30}, {142, 30},
-    {143, 30}, {144, 30}, {144, 30}, {145, 31}, {146, 31}, {146, 31}, {147, 31}, {148, 31},
-    {148, 32}, {149, 32}, {150, 32}, {151, 32}, {151, 32}, {152, 33}, {153, 33}, {153, 33},
-    {154, 33}, {155, 33}, {156, 33}, {156, 34}, {157, 34}, {158, 34}, {159, 34}, {159, 34},
-    {160, 35}, {161, 35}, {162, 35}, {162, 35}, {163, 35}, {164, 35}, {165, 36}, {165, 36}
-  },
-  {  // mag,nra for x=107 and y=0:127
-    {107,  0}, {107,  0}, {107,  1}, {107,  1}, {107,  2}, {107,  2}, {107,  2}, {107,  3},
-    {107,  3}, {107,  3}, {107,  4}, {108,  4}, {108,  5}, {108,  5}, {108,  5}, {108,  6},
-    {108,  6}, {108,  6}, {109,  7}, {109,  7}, {109,  8}, {109,  8}, {109,  8}, {109,  9},
-    {110,  9}, {110,  9}, {110, 10}, {110, 10}, {111, 10}, {111, 11}, {111, 11}, {111, 11},
-    {112, 12}, {112, 12}, {112, 13}, {113, 13}, {113, 13}, {113, 14}, {114, 14}, {114, 14},
-    {114, 15}, {115, 15}, {115, 15}, {115, 16}, {116, 16}, {116, 16}, {116, 17}, {117, 17},
-    {117, 17}, {118, 17}, {118, 18}, {119, 18}, {119, 18}, {119, 19}, {120, 19}, {120, 19},
-    {121, 20}, {121, 20}, {122, 20}, {122, 21}, {123, 21}, {123, 21}, {124, 21}, {124, 22},
-    {125, 22}, {125, 22}, {126, 23}, {126, 23}, {127, 23}, {127, 23}, {128, 24}, {128, 24},
-    {129, 24}, {130, 24}, {130, 25}, {131, 25}, {131, 25}, {132, 25}, {132, 26}, {133, 26},
-    {134, 26}, {134, 26}, {135, 27}, {135, 27}, {136, 27}, {137, 27}, {137, 28}, {138, 28},
-    {139, 28}, {139, 28}, {140, 28}, {140, 29}, {141, 29}, {142, 29}, {142, 29}, {143, 30},
-    {144, 30}, {144, 30}, {145, 30}, {146, 30}, {146, 31}, {147, 31}, {148, 31}, {149, 31},
-    {149, 31}, {150, 32}, {151, 32}, {151, 32}, {152, 32}, {153, 32}, {153, 33}, {154, 33},
-    {155, 33}, {156, 33}, {156, 33}, {157, 33}, {158, 34}, {159, 34}, {159, 34}, {160, 34},
-    {161, 34}, {162, 34}, {162, 35}, {163, 35}, {164, 35}, {165, 35}, {165, 35}, {166, 35}
-  },
-  {  // mag,nra for x=108 and y=0:127
-    {108,  0}, {108,  0}, {108,  1}, {108,  1}, {108,  2}, {108,  2}, {108,  2}, {108,  3},
-    {108,  3}, {108,  3}, {108,  4}, {109,  4}, {109,  5}, {109,  5}, {109,  5}, {109,  6},
-    {109,  6}, {109,  6}, {109,  7}, {110,  7}, {110,  7}, {110,  8}, {110,  8}, {110,  9},
-    {111,  9}, {111,  9}, {111, 10}, {111, 10}, {112, 10}, {112, 11}, {112, 11}, {112, 11},
-    {113, 12}, {113, 12}, {113, 12}, {114, 13}, {114, 13}, {114, 13}, {114, 14}, {115, 14},
-    {115, 14}, {116, 15}, {116, 15}, {116, 15}, {117, 16}, {117, 16}, {117, 16}, {118, 17},
-    {118, 17}, {119, 17}, {119, 18}, {119, 18}, {120, 18}, {120, 19}, {121, 19}, {121, 19},
-    {122, 19}, {122, 20}, {123, 20}, {123, 20}, {124, 21}, {124, 21}, {125, 21}, {125, 22},
-    {126, 22}, {126, 22}, {127, 22}, {127, 23}, {128, 23}, {128, 23}, {129, 23}, {129, 24},
-    {130, 24}, {130, 24}, {131, 24}, {131, 25}, {132, 25}, {133, 25}, {133, 25}, {134, 26},
-    {134, 26}, {135, 26}, {136, 26}, {136, 27}, {137, 27}, {137, 27}, {138, 27}, {139, 28},
-    {139, 28}, {140, 28}, {141, 28}, {141, 29}, {142, 29}, {143, 29}, {143, 29}, {144, 29},
-    {144, 30}, {145, 30}, {146, 30}, {147, 30}, {147, 30}, {148, 31}, {149, 31}, {149, 31},
-    {150, 31}, {151, 31}, {151, 32}, {152, 32}, {153, 32}, {153, 32}, {154, 32}, {155, 33},
-    {156, 33}, {156, 33}, {157, 33}, {158, 33}, {158, 33}, {159, 34}, {160, 34}, {161, 34},
-    {161, 34}, {162, 34}, {163, 34}, {164, 35}, {164, 35}, {165, 35}, {166, 35}, {167, 35}
-  },
-  {  // mag,nra for x=109 and y=0:127
-    {109,  0}, {109,  0}, {109,  1}, {109,  1}, {109,  1}, {109,  2}, {109,  2}, {109,  3},
-    {109,  3}, {109,  3}, {109,  4}, {110,  4}, {110,  4}, {110,  5}, {110,  5}, {110,  6},
-    {110,  6}, {110,  6}, {110,  7}, {111,  7}, {111,  7}, {111,  8}, {111,  8}, {111,  8},
-    {112,  9}, {112,  9}, {112, 10}, {112, 10}, {113, 10}, {113, 11}, {113, 11}, {113, 11},
-    {114, 12}, {114, 12}, {114, 12}, {114, 13}, {115, 13}, {115, 13}, {115, 14}, {116, 14},
-    {116, 14}, {116, 15}, {117, 15}, {117, 15}, {118, 16}, {118, 16}, {118, 16}, {119, 17},
-    {119, 17}, {120, 17}, {120, 18}, {120, 18}, {121, 18}, {121, 18}, {122, 19}, {122, 19},
-    {123, 19}, {123, 20}, {123, 20}, {124, 20}, {124, 21}, {125, 21}, {125, 21}, {126, 21},
-    {126, 22}, {127, 22}, {127, 22}, {128, 22}, {128, 23}, {129, 23}, {130, 23}, {130, 24},
-    {131, 24}, {131, 24}, {132, 24}, {132, 25}, {133, 25}, {133, 25}, {134, 25}, {135, 26},
-    {135, 26}, {136, 26}, {136, 26}, {137, 27}, {138, 27}, {138, 27}, {139, 27}, {139, 27},
-    {140, 28}, {141, 28}, {141, 28}, {142, 28}, {143, 29}, {143, 29}, {144, 29}, {145, 29},
-    {145, 29}, {146, 30}, {147, 30}, {147, 30}, {148, 30}, {149, 30}, {149, 31}, {150, 31},
-    {151, 31}, {151, 31}, {152, 31}, {153, 32}, {153, 32}, {154, 32}, {155, 32}, {156, 32},
-    {156, 33}, {157, 33}, {158, 33}, {158, 33}, {159, 33}, {160, 33}, {161, 34}, {161, 34},
-    {162, 34}, {163, 34}, {164, 34}, {164, 34}, {165, 35}, {166, 35}, {167, 35}, {167, 35}
-  },
-  {  // mag,nra for x=110 and y=0:127
-    {110,  0}, {110,  0}, {110,  1}, {110,  1}, {110,  1}, {110,  2}, {110,  2}, {110,  3},
-    {110,  3}, {110,  3}, {110,  4}, {111,  4}, {111,  4}, {111,  5}, {111,  5}, {111,  6},
-    {111,  6}, {111,  6}, {111,  7}, {112,  7}, {112,  7}, {112,  8}, {112,  8}, {112,  8},
-    {113,  9}, {113,  9}, {113,  9}, {113, 10}, {114, 10}, {114, 11}, {114, 11}, {114, 11},
-    {115, 12}, {115, 12}, {115, 12}, {115, 13}, {116, 13}, {116, 13}, {116, 14}, {117, 14},
-    {117, 14}, {117, 15}, {118, 15}, {118, 15}, {118, 16}, {119, 16}, {119, 16}, {120, 16},
-    {120, 17}, {120, 17}, {121, 17}, {121, 18}, {122, 18}, {122, 18}, {123, 19}, {123, 19},
-    {123, 19}, {124, 19}, {124, 20}, {125, 20}, {125, 20}, {126, 21}, {126, 21}, {127, 21},
-    {127, 21}, {128, 22}, {128, 22}, {129, 22}, {129, 23}, {130, 23}, {130, 23}, {131, 23},
-    {131, 24}, {132, 24}, {133, 24}, {133, 24}, {134, 25}, {134, 25}, {135, 25}, {135, 25},
-    {136, 26}, {137, 26}, {137, 26}, {138, 26}, {138, 27}, {139, 27}, {140, 27}, {140, 27},
-    {141, 27}, {141, 28}, {142, 28}, {143, 28}, {143, 28}, {144, 29}, {145, 29}, {145, 29},
-    {146, 29}, {147, 29}, {147, 30}, {148, 30}, {149, 30}, {149, 30}, {150, 30}, {151, 31},
-    {151, 31}, {152, 31}, {153, 31}, {153, 31}, {154, 32}, {155, 32}, {156, 32}, {156, 32},
-    {157, 32}, {158, 33}, {158, 33}, {159, 33}, {160, 33}, {161, 33}, {161, 33}, {162, 34},
-    {163, 34}, {164, 34}, {164, 34}, {165, 34}, {166, 34}, {167, 35}, {167, 35}, {168, 35}
-  },
-  {  // mag,nra for x=111 and y=0:127
-    {111,  0}, {111,  0}, {111,  1}, {111,  1}, {111,  1}, {111,  2}, {111,  2}, {111,  3},
-    {111,  3}, {111,  3}, {111,  4}, {112,  4}, {112,  4}, {112,  5}, {112,  5}, {112,  5},
-    {112,  6}, {112,  6}, {112,  7}, {113,  7}, {113,  7}, {113,  8}, {113,  8}, {113,  8},
-    {114,  9}, {114,  9}, {114,  9}, {114, 10}, {114, 10}, {115, 10}, {115, 11}, {115, 11},
-    {116, 11}, {116, 12}, {116, 12}, {116, 12}, {117, 13}, {117, 13}, {117, 13}, {118, 14},
-    {118, 14}, {118, 14}, {119, 15}, {119, 15}, {119, 15}, {120, 16}, {120, 16}, {121, 16},
-    {121, 17}, {121, 17}, {122, 17}, {122, 18}, {123, 18}, {123, 18}, {123, 18}, {124, 19},
-    {124, 19}, {125, 19}, {125, 20}, {126, 20}, {126, 20}, {127, 20}, {127, 21}, {128, 21},
-    {128, 21}, {129, 22}, {129, 22}, {130, 22}, {130, 22}, {131, 23}, {131, 23}, {132, 23},
-    {132, 23}, {133, 24}, {133, 24}, {134, 24}, {135, 24}, {135, 25}, {136, 25}, {136, 25},
-    {137, 25}, {137, 26}, {138, 26}, {139, 26}, {139, 26}, {140, 27}, {140, 27}, {141, 27},
-    {142, 27}, {142, 28}, {143, 28}, {144, 28}, {144, 28}, {145, 28}, {145, 29}, {146, 29},
-    {147, 29}, {147, 29}, {148, 29}, {149, 30}, {149, 30}, {150, 30}, {151, 30}, {151, 30},
-    {152, 31}, {153, 31}, {153, 31}, {154, 31}, {155, 31}, {156, 32}, {156, 32}, {157, 32},
-    {158, 32}, {158, 32}, {159, 33}, {160, 33}, {161, 33}, {161, 33}, {162, 33}, {163, 33},
-    {163, 34}, {164, 34}, {165, 34}, {166, 34}, {166, 34}, {167, 34}, {168, 35}, {169, 35}
-  },
-  {  // mag,nra for x=112 and y=0:127
-    {112,  0}, {112,  0}, {112,  1}, {112,  1}, {112,  1}, {112,  2}, {112,  2}, {112,  3},
-    {112,  3}, {112,  3}, {112,  4}, {113,  4}, {113,  4}, {113,  5}, {113,  5}, {113,  5},
-    {113,  6}, {113,  6}, {113,  6}, {114,  7}, {114,  7}, {114,  8}, {114,  8}, {114,  8},
-    {115,  9}, {115,  9}, {115,  9}, {115, 10}, {115, 10}, {116, 10}, {116, 11}, {116, 11},
-    {116, 11}, {117, 12}, {117, 12}, {117, 12}, {118, 13}, {118, 13}, {118, 13}, {119, 14},
-    {119, 14}, {119, 14}, {120, 15}, {120, 15}, {120, 15}, {121, 16}, {121, 16}, {121, 16},
-    {122, 16}, {122, 17}, {123, 17}, {123, 17}, {123, 18}, {124, 18}, {124, 18}, {125, 19},
-    {125, 19}, {126, 19}, {126, 19}, {127, 20}, {127, 20}, {128, 20}, {128, 21}, {129, 21},
-    {129, 21}, {129, 21}, {130, 22}, {131, 22}, {131, 22}, {132, 22}, {132, 23}, {133, 23},
-    {133, 23}, {134, 24}, {134, 24}, {135, 24}, {135, 24}, {136, 25}, {136, 25}, {137, 25},
-    {138, 25}, {138, 26}, {139, 26}, {139, 26}, {140, 26}, {141, 26}, {141, 27}, {142, 27},
-    {142, 27}, {143, 27}, {144, 28}, {144, 28}, {145, 28}, {146, 28}, {146, 28}, {147, 29},
-    {148, 29}, {148, 29}, {149, 29}, {149, 29}, {150, 30}, {151, 30}, {151, 30}, {152, 30},
-    {153, 30}, {154, 31}, {154, 31}, {155, 31}, {156, 31}, {156, 31}, {157, 32}, {158, 32},
-    {158, 32}, {159, 32}, {160, 32}, {161, 33}, {161, 33}, {162, 33}, {163, 33}, {163, 33},
-    {164, 33}, {165, 34}, {166, 34}, {166, 34}, {167, 34}, {168, 34}, {169, 34}, {169, 35}
-  },
-  {  // mag,nra for x=113 and y=0:127
-    {113,  0}, {113,  0}, {113,  1}, {113,  1}, {113,  1}, {113,  2}, {113,  2}, {113,  3},
-    {113,  3}, {113,  3}, {113,  4}, {114,  4}, {114,  4}, {114,  5}, {114,  5}, {114,  5},
-    {114,  6}, {114,  6}, {114,  6}, {115,  7}, {115,  7}, {115,  7}, {115,  8}, {115,  8},
-    {116,  9}, {116,  9}, {116,  9}, {116, 10}, {116, 10}, {117, 10}, {117, 11}, {117, 11},
-    {117, 11}, {118, 12}, {118, 12}, {118, 12}, {119, 13}, {119, 13}, {119, 13}, {120, 14},
-    {120, 14}, {120, 14}, {121, 14}, {121, 15}, {121, 15}, {122, 15}, {122, 16}, {122, 16},
-    {123, 16}, {123, 17}, {124, 17}, {124, 17}, {124, 18}, {125, 18}, {125, 18}, {126, 18},
-    {126, 19}, {127, 19}, {127, 19}, {127, 20}, {128, 20}, {128, 20}, {129, 20}, {129, 21},
-    {130, 21}, {130, 21}, {131, 22}, {131, 22}, {132, 22}, {132, 22}, {133, 23}, {133, 23},
-    {134, 23}, {135, 23}, {135, 24}, {136, 24}, {136, 24}, {137, 24}, {137, 25}, {138, 25},
-    {138, 25}, {139, 25}, {140, 26}, {140, 26}, {141, 26}, {141, 26}, {142, 27}, {143, 27},
-    {143, 27}, {144, 27}, {144, 27}, {145, 28}, {146, 28}, {146, 28}, {147, 28}, {148, 28},
-    {148, 29}, {149, 29}, {150, 29}, {150, 29}, {151, 30}, {152, 30}, {152, 30}, {153, 30},
-    {154, 30}, {154, 31}, {155, 31}, {156, 31}, {156, 31}, {157, 31}, {158, 31}, {158, 32},
-    {159, 32}, {160, 32}, {161, 32}, {161, 32}, {162, 33}, {163, 33}, {163, 33}, {164, 33},
-    {165, 33}, {166, 33}, {166, 34}, {167, 34}, {168, 34}, {169, 34}, {169, 34}, {170, 34}
-  },
-  {  // mag,nra for x=114 and y=0:127
-    {114,  0}, {114,  0}, {114,  1}, {114,  1}, {114,  1}, {114,  2}, {114,  2}, {114,  2},
-    {114,  3}, {114,  3}, {114,  4}, {115,  4}, {115,  4}, {115,  5}, {115,  5}, {115,  5},
-    {115,  6}, {115,  6}, {115,  6}, {116,  7}, {116,  7}, {116,  7}, {116,  8}, {116,  8},
-    {116,  8}, {117,  9}, {117,  9}, {117,  9}, {117, 10}, {118, 10}, {118, 10}, {118, 11},
-    {118, 11}, {119, 11}, {119, 12}, {119, 12}, {120, 12}, {120, 13}, {120, 13}, {120, 13},
-    {121, 14}, {121, 14}, {121, 14}, {122, 15}, {122, 15}, {123, 15}, {123, 16}, {123, 16},
-    {124, 16}, {124, 17}, {124, 17}, {125, 17}, {125, 17}, {126, 18}, {126, 18}, {127, 18},
-    {127, 19}, {127, 19}, {128, 19}, {128, 19}, {129, 20}, {129, 20}, {130, 20}, {130, 21},
-    {131, 21}, {131, 21}, {132, 21}, {132, 22}, {133, 22}, {133, 22}, {134, 22}, {134, 23},
-    {135, 23}, {135, 23}, {136, 23}, {136, 24}, {137, 24}, {138, 24}, {138, 24}, {139, 25},
-    {139, 25}, {140, 25}, {140, 25}, {141, 26}, {142, 26}, {142, 26}, {143, 26}, {143, 27},
-    {144, 27}, {145, 27}, {145, 27}, {146, 27}, {146, 28}, {147, 28}, {148, 28}, {148, 28},
-    {149, 29}, {150, 29}, {150, 29}, {151, 29}, {152, 29}, {152, 30}, {153, 30}, {154, 30},
-    {154, 30}, {155, 30}, {156, 31}, {156, 31}, {157, 31}, {158, 31}, {158, 31}, {159, 31},
-    {160, 32}, {161, 32}, {161, 32}, {162, 32}, {163, 32}, {163, 33}, {164, 33}, {165, 33},
-    {166, 33}, {166, 33}, {167, 33}, {168, 34}, {168, 34}, {169, 34}, {170, 34}, {171, 34}
-  },
-  {  // mag,nra for x=115 and y=0:127
-    {115,  0}, {115,  0}, {115,  1}, {115,  1}, {115,  1}, {115,  2}, {115,  2}, {115,  2},
-    {115,  3}, {115,  3}, {115,  4}, {116,  4}, {116,  4}, {116,  5}, {116,  5}, {116,  5},
-    {116,  6}, {116,  6}, {116,  6}, {117,  7}, {117,  7}, {117,  7}, {117,  8}, {117,  8},
-    {117,  8}, {118,  9}, {118,  9}, {118,  9}, {118, 10}, {119, 10}, {119, 10}, {119, 11},
-    {119, 11}, {120, 11}, {120, 12}, {120, 12}, {121, 12}, {121, 13}, {121, 13}, {121, 13},
-    {122, 14}, {122, 14}, {122, 14}, {123, 15}, {123, 15}, {123, 15}, {124, 16}, {124, 16},
-    {125, 16}, {125, 16}, {125, 17}, {126, 17}, {126, 17}, {127, 18}, {127, 18}, {127, 18},
-    {128, 18}, {128, 19}, {129, 19}, {129, 19}, {130, 20}, {130, 20}, {131, 20}, {131, 20},
-    {132, 21}, {132, 21}, {133, 21}, {133, 21}, {134, 22}, {134, 22}, {135, 22}, {135, 23},
-    {136, 23}, {136, 23}, {137, 23}, {137, 24}, {138, 24}, {138, 24}, {139, 24}, {140, 25},
-    {140, 25}, {141, 25}, {141, 25}, {142, 25}, {142, 26}, {143, 26}, {144, 26}, {144, 26},
-    {145, 27}, {145, 27}, {146, 27}, {147, 27}, {147, 27}, {148, 28}, {149, 28}, {149, 28},
-    {150, 28}, {150, 29}, {151, 29}, {152, 29}, {152, 29}, {153, 29}, {154, 30}, {154, 30},
-    {155, 30}, {156, 30}, {156, 30}, {157, 31}, {158, 31}, {158, 31}, {159, 31}, {160, 31},
-    {161, 31}, {161, 32}, {162, 32}, {163, 32}, {163, 32}, {164, 32}, {165, 33}, {165, 33},
-    {166, 33}, {167, 33}, {168, 33}, {168, 33}, {169, 34}, {170, 34}, {171, 34}, {171, 34}
-  },
-  {  // mag,nra for x=116 and y=0:127
-    {116,  0}, {116,  0}, {116,  1}, {116,  1}, {116,  1}, {116,  2}, {116,  2}, {116,  2},
-    {116,  3}, {116,  3}, {116,  4}, {117,  4}, {117,  4}, {117,  5}, {117,  5}, {117,  5},
-    {117,  6}, {117,  6}, {117,  6}, {118,  7}, {118,  7}, {118,  7}, {118,  8}, {118,  8},
-    {118,  8}, {119,  9}, {119,  9}, {119,  9}, {119, 10}, {120, 10}, {120, 10}, {120, 11},
-    {120, 11}, {121, 11}, {121, 12}, {121, 12}, {121, 12}, {122, 13}, {122, 13}, {122, 13},
-    {123, 14}, {123, 14}, {123, 14}, {124, 14}, {124, 15}, {124, 15}, {125, 15}, {125, 16},
-    {126, 16}, {126, 16}, {126, 17}, {127, 17}, {127, 17}, {128, 17}, {128, 18}, {128, 18},
-    {129, 18}, {129, 19}, {130, 19}, {130, 19}, {131, 19}, {131, 20}, {132, 20}, {132, 20},
-    {132, 21}, {133, 21}, {133, 21}, {134, 21}, {134, 22}, {135, 22}, {135, 22}, {136, 22},
-    {137, 23}, {137, 23}, {138, 23}, {138, 23}, {139, 24}, {139, 24}, {140, 24}, {140, 24},
-    {141, 25}, {141, 25}, {142, 25}, {143, 25}, {143, 26}, {144, 26}, {144, 26}, {145, 26},
-    {146, 26}, {146, 27}, {147, 27}, {147, 27}, {148, 27}, {149, 28}, {149, 28}, {150, 28},
-    {151, 28}, {151, 28}, {152, 29}, {153, 29}, {153, 29}, {154, 29}, {154, 29}, {155, 30},
-    {156, 30}, {156, 30}, {157, 30}, {158, 30}, {158, 31}, {159, 31}, {160, 31}, {161, 31},
-    {161, 31}, {162, 31}, {163, 32}, {163, 32}, {164, 32}, {165, 32}, {165, 32}, {166, 33},
-    {167, 33}, {168, 33}, {168, 33}, {169, 33}, {170, 33}, {171, 34}, {171, 34}, {172, 34}
-  },
-  {  // mag,nra for x=117 and y=0:127
-    {117,  0}, {117,  0}, {117,  1}, {117,  1}, {117,  1}, {117,  2}, {117,  2}, {117,  2},
-    {117,  3}, {117,  3}, {117,  3}, {118,  4}, {118,  4}, {118,  5}, {118,  5}, {118,  5},
-    {118,  6}, {118,  6}, {118,  6}, {119,  7}, {119,  7}, {119,  7}, {119,  8}, {119,  8},
-    {119,  8}, {120,  9}, {120,  9}, {120,  9}, {120, 10}, {121, 10}, {121, 10}, {121, 11},
-    {121, 11}, {122, 11}, {122, 12}, {122, 12}, {122, 12}, {123, 12}, {123, 13}, {123, 13},
-    {124, 13}, {124, 14}, {124, 14}, {125, 14}, {125, 15}, {125, 15}, {126, 15}, {126, 16},
-    {126, 16}, {127, 16}, {127, 16}, {128, 17}, {128, 17}, {128, 17}, {129, 18}, {129, 18},
-    {130, 18}, {130, 18}, {131, 19}, {131, 19}, {131, 19}, {132, 20}, {132, 20}, {133, 20},
-    {133, 20}, {134, 21}, {134, 21}, {135, 21}, {135, 21}, {136, 22}, {136, 22}, {137, 22},
-    {137, 22}, {138, 23}, {138, 23}, {139, 23}, {140, 23}, {140, 24}, {141, 24}, {141, 24},
-    {142, 24}, {142, 25}, {143, 25}, {143, 25}, {144, 25}, {145, 26}, {145, 26}, {146, 26},
-    {146, 26}, {147, 26}, {148, 27}, {148, 27}, {149, 27}, {149, 27}, {150, 28}, {151, 28},
-    {151, 28}, {152, 28}, {153, 28}, {153, 29}, {154, 29}, {155, 29}, {155, 29}, {156, 29},
-    {157, 30}, {157, 30}, {158, 30}, {159, 30}, {159, 30}, {160, 31}, {161, 31}, {161, 31},
-    {162, 31}, {163, 31}, {163, 31}, {164, 32}, {165, 32}, {165, 32}, {166, 32}, {167, 32},
-    {168, 33}, {168, 33}, {169, 33}, {170, 33}, {170, 33}, {171, 33}, {172, 34}, {173, 34}
-  },
-  {  // mag,nra for x=118 and y=0:127
-    {118,  0}, {118,  0}, {118,  1}, {118,  1}, {118,  1}, {118,  2}, {118,  2}, {118,  2},
-    {118,  3}, {118,  3}, {118,  3}, {119,  4}, {119,  4}, {119,  4}, {119,  5}, {119,  5},
-    {119,  5}, {119,  6}, {119,  6}, {120,  7}, {120,  7}, {120,  7}, {120,  8}, {120,  8},
-    {120,  8}, {121,  9}, {121,  9}, {121,  9}, {121,  9}, {122, 10}, {122, 10}, {122, 10},
-    {122, 11}, {123, 11}, {123, 11}, {123, 12}, {123, 12}, {124, 12}, {124, 13}, {124, 13},
-    {125, 13}, {125, 14}, {125, 14}, {126, 14}, {126, 15}, {126, 15}, {127, 15}, {127, 15},
-    {127, 16}, {128, 16}, {128, 16}, {129, 17}, {129, 17}, {129, 17}, {130, 17}, {130, 18},
-    {131, 18}, {131, 18}, {131, 19}, {132, 19}, {132, 19}, {133, 19}, {133, 20}, {134, 20},
-    {134, 20}, {135, 21}, {135, 21}, {136, 21}, {136, 21}, {137, 22}, {137, 22}, {138, 22},
-    {138, 22}, {139, 23}, {139, 23}, {140, 23}, {140, 23}, {141, 24}, {141, 24}, {142, 24},
-    {143, 24}, {143, 25}, {144, 25}, {144, 25}, {145, 25}, {145, 25}, {146, 26}, {147, 26},
-    {147, 26}, {148, 26}, {148, 27}, {149, 27}, {150, 27}, {150, 27}, {151, 27}, {151, 28},
-    {152, 28}, {153, 28}, {153, 28}, {154, 28}, {155, 29}, {155, 29}, {156, 29}, {157, 29},
-    {157, 29}, {158, 30}, {159, 30}, {159, 30}, {160, 30}, {161, 30}, {161, 31}, {162, 31},
-    {163, 31}, {163, 31}, {164, 31}, {165, 31}, {165, 32}, {166, 32}, {167, 32}, {168, 32},
-    {168, 32}, {169, 33}, {170, 33}, {170, 33}, {171, 33}, {172, 33}, {173, 33}, {173, 33}
-  },
-  {  // mag,nra for x=119 and y=0:127
-    {119,  0}, {119,  0}, {119,  1}, {119,  1}, {119,  1}, {119,  2}, {119,  2}, {119,  2},
-    {119,  3}, {119,  3}, {119,  3}, {120,  4}, {120,  4}, {120,  4}, {120,  5}, {120,  5},
-    {120,  5}, {120,  6}, {120,  6}, {121,  6}, {121,  7}, {121,  7}, {121,  7}, {121,  8},
-    {121,  8}, {122,  8}, {122,  9}, {122,  9}, {122,  9}, {122, 10}, {123, 10}, {123, 10},
-    {123, 11}, {123, 11}, {124, 11}, {124, 12}, {124, 12}, {125, 12}, {125, 13}, {125, 13},
-    {126, 13}, {126, 14}, {126, 14}, {127, 14}, {127, 14}, {127, 15}, {128, 15}, {128, 15},
-    {128, 16}, {129, 16}, {129, 16}, {129, 16}, {130, 17}, {130, 17}, {131, 17}, {131, 18},
-    {132, 18}, {132, 18}, {132, 18}, {133, 19}, {133, 19}, {134, 19}, {134, 20}, {135, 20},
-    {135, 20}, {136, 20}, {136, 21}, {137, 21}, {137, 21}, {138, 21}, {138, 22}, {139, 22},
-    {139, 22}, {140, 22}, {140, 23}, {141, 23}, {141, 23}, {142, 23}, {142, 24}, {143, 24},
-    {143, 24}, {144, 24}, {145, 25}, {145, 25}, {146, 25}, {146, 25}, {147, 25}, {147, 26},
-    {148, 26}, {149, 26}, {149, 26}, {150, 27}, {150, 27}, {151, 27}, {152, 27}, {152, 27},
-    {153, 28}, {154, 28}, {154, 28}, {155, 28}, {155, 28}, {156, 29}, {157, 29}, {157, 29},
-    {158, 29}, {159, 29}, {159, 30}, {160, 30}, {161, 30}, {161, 30}, {162, 30}, {163, 31},
-    {163, 31}, {164, 31}, {165, 31}, {165, 31}, {166, 31}, {167, 32}, {168, 32}, {168, 32},
-    {169, 32}, {170, 32}, {170, 33}, {171, 33}, {172, 33}, {173, 33}, {173, 33}, {174, 33}
-  },
-  {  // mag,nra for x=120 and y=0:127
-    {120,  0}, {120,  0}, {120,  1}, {120,  1}, {120,  1}, {120,  2}, {120,  2}, {120,  2},
-    {120,  3}, {120,  3}, {120,  3}, {121,  4}, {121,  4}, {121,  4}, {121,  5}, {121,  5},
-    {121,  5}, {121,  6}, {121,  6}, {121,  6}, {122,  7}, {122,  7}, {122,  7}, {122,  8},
-    {122,  8}, {123,  8}, {123,  9}, {123,  9}, {123,  9}, {123, 10}, {124, 10}, {124, 10},
-    {124, 11}, {124, 11}, {125, 11}, {125, 12}, {125, 12}, {126, 12}, {126, 12}, {126, 13},
-    {126, 13}, {127, 13}, {127, 14}, {127, 14}, {128, 14}, {128, 15}, {129, 15}, {129, 15},
-    {129, 16}, {130, 16}, {130, 16}, {130, 16}, {131, 17}, {131, 17}, {132, 17}, {132, 18},
-    {132, 18}, {133, 18}, {133, 18}, {134, 19}, {134, 19}, {135, 19}, {135, 19}, {136, 20},
-    {136, 20}, {136, 20}, {137, 20}, {137, 21}, {138, 21}, {138, 21}, {139, 22}, {139, 22},
-    {140, 22}, {140, 22}, {141, 23}, {142, 23}, {142, 23}, {143, 23}, {143, 23}, {144, 24},
-    {144, 24}, {145, 24}, {145, 24}, {146, 25}, {146, 25}, {147, 25}, {148, 25}, {148, 26},
-    {149, 26}, {149, 26}, {150, 26}, {151, 26}, {151, 27}, {152, 27}, {152, 27}, {153, 27},
-    {154, 27}, {154, 28}, {155, 28}, {156, 28}, {156, 28}, {157, 29}, {157, 29}, {158, 29},
-    {159, 29}, {159, 29}, {160, 29}, {161, 30}, {161, 30}, {162, 30}, {163, 30}, {163, 30},
-    {164, 31}, {165, 31}, {166, 31}, {166, 31}, {167, 31}, {168, 31}, {168, 32}, {169, 32},
-    {170, 32}, {170, 32}, {171, 32}, {172, 33}, {173, 33}, {173, 33}, {174, 33}, {175, 33}
-  },
-  {  // mag,nra for x=121 and y=0:127
-    {121,  0}, {121,  0}, {121,  1}, {121,  1}, {121,  1}, {121,  2}, {121,  2}, {121,  2},
-    {121,  3}, {121,  3}, {121,  3}, {121,  4}, {122,  4}, {122,  4}, {122,  5}, {122,  5},
-    {122,  5}, {122,  6}, {122,  6}, {122,  6}, {123,  7}, {123,  7}, {123,  7}, {123,  8},
-    {123,  8}, {124,  8}, {124,  9}, {124,  9}, {124,  9}, {124, 10}, {125, 10}, {125, 10},
-    {125, 11}, {125, 11}, {126, 11}, {126, 11}, {126, 12}, {127, 12}, {127, 12}, {127, 13},
-    {127, 13}, {128, 13}, {128, 14}, {128, 14}, {129, 14}, {129, 15}, {129, 15}, {130, 15},
-    {130, 15}, {131, 16}, {131, 16}, {131, 16}, {132, 17}, {132, 17}, {133, 17}, {133, 17},
-    {133, 18}, {134, 18}, {134, 18}, {135, 18}, {135, 19}, {136, 19}, {136, 19}, {136, 20},
-    {137, 20}, {137, 20}, {138, 20}, {138, 21}, {139, 21}, {139, 21}, {140, 21}, {140, 22},
-    {141, 22}, {141, 22}, {142, 22}, {142, 23}, {143, 23}, {143, 23}, {144, 23}, {145, 24},
-    {145, 24}, {146, 24}, {146, 24}, {147, 24}, {147, 25}, {148, 25}, {148, 25}, {149, 25},
-    {150, 26}, {150, 26}, {151, 26}, {151, 26}, {152, 26}, {153, 27}, {153, 27}, {154, 27},
-    {154, 27}, {155, 28}, {156, 28}, {156, 28}, {157, 28}, {158, 28}, {158, 29}, {159, 29},
-    {160, 29}, {160, 29}, {161, 29}, {162, 30}, {162, 30}, {163, 30}, {164, 30}, {164, 30},
-    {165, 30}, {166, 31}, {166, 31}, {167, 31}, {168, 31}, {168, 31}, {169, 31}, {170, 32},
-    {170, 32}, {171, 32}, {172, 32}, {173, 32}, {173, 32}, {174, 33}, {175, 33}, {175, 33}
-  },
-  {  // mag,nra for x=122 and y=0:127
-    {122,  0}, {122,  0}, {122,  1}, {122,  1}, {122,  1}, {122,  2}, {122,  2}, {122,  2},
-    {122,  3}, {122,  3}, {122,  3}, {122,  4}, {123,  4}, {123,  4}, {123,  5}, {123,  5},
-    {123,  5}, {123,  6}, {123,  6}, {123,  6}, {124,  7}, {124,  7}, {124,  7}, {124,  8},
-    {124,  8}, {125,  8}, {125,  9}, {125,  9}, {125,  9}, {125, 10}, {126, 10}, {126, 10},
-    {126, 10}, {126, 11}, {127, 11}, {127, 11}, {127, 12}, {127, 12}, {128, 12}, {128, 13},
-    {128, 13}, {129, 13}, {129, 14}, {129, 14}, {130, 14}, {130, 14}, {130, 15}, {131, 15},
-    {131, 15}, {131, 16}, {132, 16}, {132, 16}, {133, 16}, {133, 17}, {133, 17}, {134, 17},
-    {134, 18}, {135, 18}, {135, 18}, {136, 18}, {136, 19}, {136, 19}, {137, 19}, {137, 19},
-    {138, 20}, {138, 20}, {139, 20}, {139, 20}, {140, 21}, {140, 21}, {141, 21}, {141, 21},
-    {142, 22}, {142, 22}, {143, 22}, {143, 22}, {144, 23}, {144, 23}, {145, 23}, {145, 23},
-    {146, 24}, {146, 24}, {147, 24}, {148, 24}, {148, 25}, {149, 25}, {149, 25}, {150, 25},
-    {150, 25}, {151, 26}, {152, 26}, {152, 26}, {153, 26}, {153, 27}, {154, 27}, {155, 27},
-    {155, 27}, {156, 27}, {156, 28}, {157, 28}, {158, 28}, {158, 28}, {159, 28}, {160, 29},
-    {160, 29}, {161, 29}, {162, 29}, {162, 29}, {163, 30}, {164, 30}, {164, 30}, {165, 30},
-    {166, 30}, {166, 30}, {167, 31}, {168, 31}, {168, 31}, {169, 31}, {170, 31}, {170, 31},
-    {171, 32}, {172, 32}, {173, 32}, {173, 32}, {174, 32}, {175, 32}, {175, 33}, {176, 33}
-  },
-  {  // mag,nra for x=123 and y=0:127
-    {123,  0}, {123,  0}, {123,  1}, {123,  1}, {123,  1}, {123,  2}, {123,  2}, {123,  2},
-    {123,  3}, {123,  3}, {123,  3}, {123,  4}, {124,  4}, {124,  4}, {124,  5}, {124,  5},
-    {124,  5}, {124,  6}, {124,  6}, {124,  6}, {125,  7}, {125,  7}, {125,  7}, {125,  8},
-    {125,  8}, {126,  8}, {126,  8}, {126,  9}, {126,  9}, {126,  9}, {127, 10}, {127, 10},
-    {127, 10}, {127, 11}, {128, 11}, {128, 11}, {128, 12}, {128, 12}, {129, 12}, {129, 13},
-    {129, 13}, {130, 13}, {130, 13}, {130, 14}, {131, 14}, {131, 14}, {131, 15}, {132, 15},
-    {132, 15}, {132, 15}, {133, 16}, {133, 16}, {134, 16}, {134, 17}, {134, 17}, {135, 17},
-    {135, 17}, {136, 18}, {136, 18}, {136, 18}, {137, 18}, {137, 19}, {138, 19}, {138, 19},
-    {139, 20}, {139, 20}, {140, 20}, {140, 20}, {141, 21}, {141, 21}, {142, 21}, {142, 21},
-    {143, 22}, {143, 22}, {144, 22}, {144, 22}, {145, 23}, {145, 23}, {146, 23}, {146, 23},
-    {147, 23}, {147, 24}, {148, 24}, {148, 24}, {149, 24}, {150, 25}, {150, 25}, {151, 25},
-    {151, 25}, {152, 26}, {152, 26}, {153, 26}, {154, 26}, {154, 26}, {155, 27}, {155, 27},
-    {156, 27}, {157, 27}, {157, 27}, {158, 28}, {159, 28}, {159, 28}, {160, 28}, {160, 28},
-    {161, 29}, {162, 29}, {162, 29}, {163, 29}, {164, 29}, {164, 30}, {165, 30}, {166, 30},
-    {166, 30}, {167, 30}, {168, 30}, {168, 31}, {169, 31}, {170, 31}, {170, 31}, {171, 31},
-    {172, 31}, {173, 32}, {173, 32}, {174, 32}, {175, 32}, {175, 32}, {176, 32}, {177, 33}
-  },
-  {  // mag,nra for x=124 and y=0:127
-    {124,  0}, {124,  0}, {124,  1}, {124,  1}, {124,  1}, {124,  2}, {124,  2}, {124,  2},
-    {124,  3}, {124,  3}, {124,  3}, {124,  4}, {125,  4}, {125,  4}, {125,  5}, {125,  5},
-    {125,  5}, {125,  6}, {125,  6}, {125,  6}, {126,  7}, {126,  7}, {126,  7}, {126,  7},
-    {126,  8}, {126,  8}, {127,  8}, {127,  9}, {127,  9}, {127,  9}, {128, 10}, {128, 10},
-    {128, 10}, {128, 11}, {129, 11}, {129, 11}, {129, 12}, {129, 12}, {130, 12}, {130, 12},
-    {130, 13}, {131, 13}, {131, 13}, {131, 14}, {132, 14}, {132, 14}, {132, 14}, {133, 15},
-    {133, 15}, {133, 15}, {134, 16}, {134, 16}, {134, 16}, {135, 16}, {135, 17}, {136, 17},
-    {136, 17}, {136, 18}, {137, 18}, {137, 18}, {138, 18}, {138, 19}, {139, 19}, {139, 19},
-    {140, 19}, {140, 20}, {140, 20}, {141, 20}, {141, 20}, {142, 21}, {142, 21}, {143, 21},
-    {143, 21}, {144, 22}, {144, 22}, {145, 22}, {145, 22}, {146, 23}, {146, 23}, {147, 23},
-    {148, 23}, {148, 24}, {149, 24}, {149, 24}, {150, 24}, {150, 24}, {151, 25}, {151, 25},
-    {152, 25}, {153, 25}, {153, 26}, {154, 26}, {154, 26}, {155, 26}, {156, 26}, {156, 27},
-    {157, 27}, {157, 27}, {158, 27}, {159, 27}, {159, 28}, {160, 28}, {161, 28}, {161, 28},
-    {162, 28}, {162, 29}, {163, 29}, {164, 29}, {164, 29}, {165, 29}, {166, 30}, {166, 30},
-    {167, 30}, {168, 30}, {168, 30}, {169, 30}, {170, 31}, {170, 31}, {171, 31}, {172, 31},
-    {173, 31}, {173, 32}, {174, 32}, {175, 32}, {175, 32}, {176, 32}, {177, 32}, {177, 32}
-  },
-  {  // mag,nra for x=125 and y=0:127
-    {125,  0}, {125,  0}, {125,  1}, {125,  1}, {125,  1}, {125,  2}, {125,  2}, {125,  2},
-    {125,  3}, {125,  3}, {125,  3}, {125,  4}, {126,  4}, {126,  4}, {126,  5}, {126,  5},
-    {126,  5}, {126,  6}, {126,  6}, {126,  6}, {127,  6}, {127,  7}, {127,  7}, {127,  7},
-    {127,  8}, {127,  8}, {128,  8}, {128,  9}, {128,  9}, {128,  9}, {129, 10}, {129, 10},
-    {129, 10}, {129, 11}, {130, 11}, {130, 11}, {130, 11}, {130, 12}, {131, 12}, {131, 12},
-    {131, 13}, {132, 13}, {132, 13}, {132, 13}, {133, 14}, {133, 14}, {133, 14}, {134, 15},
-    {134, 15}, {134, 15}, {135, 16}, {135, 16}, {135, 16}, {136, 16}, {136, 17}, {137, 17},
-    {137, 17}, {137, 17}, {138, 18}, {138, 18}, {139, 18}, {139, 18}, {140, 19}, {140, 19},
-    {140, 19}, {141, 20}, {141, 20}, {142, 20}, {142, 20}, {143, 21}, {143, 21}, {144, 21},
-    {144, 21}, {145, 22}, {145, 22}, {146, 22}, {146, 22}, {147, 22}, {147, 23}, {148, 23},
-    {148, 23}, {149, 23}, {149, 24}, {150, 24}, {151, 24}, {151, 24}, {152, 25}, {152, 25},
-    {153, 25}, {153, 25}, {154, 25}, {155, 26}, {155, 26}, {156, 26}, {156, 26}, {157, 26},
-    {158, 27}, {158, 27}, {159, 27}, {159, 27}, {160, 27}, {161, 28}, {161, 28}, {162, 28},
-    {163, 28}, {163, 28}, {164, 29}, {165, 29}, {165, 29}, {166, 29}, {167, 29}, {167, 30},
-    {168, 30}, {169, 30}, {169, 30}, {170, 30}, {171, 30}, {171, 31}, {172, 31}, {173, 31},
-    {173, 31}, {174, 31}, {175, 32}, {175, 32}, {176, 32}, {177, 32}, {177, 32}, {178, 32}
-  },
-  {  // mag,nra for x=126 and y=0:127
-    {126,  0}, {126,  0}, {126,  1}, {126,  1}, {126,  1}, {126,  2}, {126,  2}, {126,  2},
-    {126,  3}, {126,  3}, {126,  3}, {126,  4}, {127,  4}, {127,  4}, {127,  5}, {127,  5},
-    {127,  5}, {127,  5}, {127,  6}, {127,  6}, {128,  6}, {128,  7}, {128,  7}, {128,  7},
-    {128,  8}, {128,  8}, {129,  8}, {129,  9}, {129,  9}, {129,  9}, {130, 10}, {130, 10},
-    {130, 10}, {130, 10}, {131, 11}, {131, 11}, {131, 11}, {131, 12}, {132, 12}, {132, 12},
-    {132, 13}, {133, 13}, {133, 13}, {133, 13}, {133, 14}, {134, 14}, {134, 14}, {134, 15},
-    {135, 15}, {135, 15}, {136, 15}, {136, 16}, {136, 16}, {137, 16}, {137, 16}, {137, 17},
-    {138, 17}, {138, 17}, {139, 18}, {139, 18}, {140, 18}, {140, 18}, {140, 19}, {141, 19},
-    {141, 19}, {142, 19}, {142, 20}, {143, 20}, {143, 20}, {144, 20}, {144, 21}, {145, 21},
-    {145, 21}, {146, 21}, {146, 22}, {147, 22}, {147, 22}, {148, 22}, {148, 23}, {149, 23},
-    {149, 23}, {150, 23}, {150, 24}, {151, 24}, {151, 24}, {152, 24}, {153, 24}, {153, 25},
-    {154, 25}, {154, 25}, {155, 25}, {155, 25}, {156, 26}, {157, 26}, {157, 26}, {158, 26},
-    {158, 27}, {159, 27}, {160, 27}, {160, 27}, {161, 27}, {161, 28}, {162, 28}, {163, 28},
-    {163, 28}, {164, 28}, {165, 28}, {165, 29}, {166, 29}, {167, 29}, {167, 29}, {168, 29},
-    {169, 30}, {169, 30}, {170, 30}, {171, 30}, {171, 30}, {172, 30}, {173, 31}, {173, 31},
-    {174, 31}, {175, 31}, {175, 31}, {176, 32}, {177, 32}, {177, 32}, {178, 32}, {179, 32}
-  },
-  {  // mag,nra for x=127 and y=0:127
-    {127,  0}, {127,  0}, {127,  1}, {127,  1}, {127,  1}, {127,  2}, {127,  2}, {127,  2},
-    {127,  3}, {127,  3}, {127,  3}, {127,  4}, {128,  4}, {128,  4}, {128,  4}, {128,  5},
-    {128,  5}, {128,  5}, {128,  6}, {128,  6}, {129,  6}, {129,  7}, {129,  7}, {129,  7},
-    {129,  8}, {129,  8}, {130,  8}, {130,  9}, {130,  9}, {130,  9}, {130,  9}, {131, 10},
-    {131, 10}, {131, 10}, {131, 11}, {132, 11}, {132, 11}, {132, 12}, {133, 12}, {133, 12},
-    {133, 12}, {133, 13}, {134, 13}, {134, 13}, {134, 14}, {135, 14}, {135, 14}, {135, 14},
-    {136, 15}, {136, 15}, {136, 15}, {137, 16}, {137, 16}, {138, 16}, {138, 16}, {138, 17},
-    {139, 17}, {139, 17}, {140, 17}, {140, 18}, {140, 18}, {141, 18}, {141, 19}, {142, 19},
-    {142, 19}, {143, 19}, {143, 20}, {144, 20}, {144, 20}, {145, 20}, {145, 21}, {145, 21},
-    {146, 21}, {146, 21}, {147, 21}, {147, 22}, {148, 22}, {149, 22}, {149, 22}, {150, 23},
-    {150, 23}, {151, 23}, {151, 23}, {152, 24}, {152, 24}, {153, 24}, {153, 24}, {154, 24},
-    {155, 25}, {155, 25}, {156, 25}, {156, 25}, {157, 26}, {157, 26}, {158, 26}, {159, 26},
-    {159, 26}, {160, 27}, {160, 27}, {161, 27}, {162, 27}, {162, 27}, {163, 28}, {164, 28},
-    {164, 28}, {165, 28}, {165, 28}, {166, 29}, {167, 29}, {167, 29}, {168, 29}, {169, 29},
-    {169, 29}, {170, 30}, {171, 30}, {171, 30}, {172, 30}, {173, 30}, {173, 31}, {174, 31},
-    {175, 31}, {175, 31}, {176, 31}, {177, 31}, {177, 32}, {178, 32}, {179, 32}, {180, 32}
-  }
-};
-
-/* Lookup table for Polar to Rect Conversions */
-struct rect_vector polar_2_rect_lut[181][64] = 
-{ 
-  {  // x,y for mag=0 and nra=0:63
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}
-  },
-  {  // x,y for mag=1 and nra=0:63
-    {   1,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0},
-    {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}, {   0,   0}
-  },
-  {  // x,y for mag=2 and nra=0:63
-    {   2,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0},
-    {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0},
-    {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   0}, {   1,   1}, {   1,   1},
-    {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1},
-    {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1}, {   1,   1},
-    {   1,   1}, {   1,   1}, {   1,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1},
-    {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1},
-    {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}, {   0,   1}
-  },
-  {  // x,y for mag=3 and nra=0:63
-    {   3,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0},
-    {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   0}, {   2,   1}, {   2,   1},
-    {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1},
-    {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   1}, {   2,   2}, {   2,   2},
-    {   2,   2}, {   2,   2}, {   2,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2},
-    {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2}, {   1,   2},
-    {   1,   2}, {   1,   2}, {   1,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2},
-    {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}, {   0,   2}
-  },
-  {  // x,y for mag=4 and nra=0:63
-    {   4,   0}, {   3,   0}, {   3,   0}, {   3,   0}, {   3,   0}, {   3,   0}, {   3,   0}, {   3,   0},
-    {   3,   0}, {   3,   0}, {   3,   0}, {   3,   1}, {   3,   1}, {   3,   1}, {   3,   1}, {   3,   1},
-    {   3,   1}, {   3,   1}, {   3,   1}, {   3,   1}, {   3,   1}, {   3,   1}, {   3,   2}, {   3,   2},
-    {   3,   2}, {   3,   2}, {   3,   2}, {   3,   2}, {   3,   2}, {   3,   2}, {   2,   2}, {   2,   2},
-    {   2,   2}, {   2,   2}, {   2,   2}, {   2,   3}, {   2,   3}, {   2,   3}, {   2,   3}, {   2,   3},
-    {   2,   3}, {   2,   3}, {   2,   3}, {   1,   3}, {   1,   3}, {   1,   3}, {   1,   3}, {   1,   3},
-    {   1,   3}, {   1,   3}, {   1,   3}, {   1,   3}, {   1,   3}, {   1,   3}, {   0,   3}, {   0,   3},
-    {   0,   3}, {   0,   3}, {   0,   3}, {   0,   3}, {   0,   3}, {   0,   3}, {   0,   3}, {   0,   3}
-  },
-  {  // x,y for mag=5 and nra=0:63
-    {   5,   0}, {   4,   0}, {   4,   0}, {   4,   0}, {   4,   0}, {   4,   0}, {   4,   0}, {   4,   0},
-    {   4,   0}, {   4,   1}, {   4,   1}, {   4,   1}, {   4,   1}, {   4,   1}, {   4,   1}, {   4,   1},
-    {   4,   1}, {   4,   2}, {   4,   2}, {   4,   2}, {   4,   2}, {   4,   2}, {   4,   2}, {   4,   2},
-    {   4,   2}, {   4,   2}, {   4,   2}, {   3,   3}, {   3,   3}, {   3,   3}, {   3,   3}, {   3,   3},
-    {   3,   3}, {   3,   3}, {   3,   3}, {   3,   3}, {   3,   3}, {   3,   3}, {   2,   4}, {   2,   4},
-    {   2,   4}, {   2,   4}, {   2,   4}, {   2,   4}, {   2,   4}, {   2,   4}, {   2,   4}, {   2,   4},
-    {   1,   4}, {   1,   4}, {   1,   4}, {   1,   4}, {   1,   4}, {   1,   4}, {   1,   4}, {   1,   4},
-    {   0,   4}, {   0,   4}, {   0,   4}, {   0,   4}, {   0,   4}, {   0,   4}, {   0,   4}, {   0,   4}
-  },
-  {  // x,y for mag=6 and nra=0:63
-    {   6,   0}, {   5,   0}, {   5,   0}, {   5,   0}, {   5,   0}, {   5,   0}, {   5,   0}, {   5,   1},
-    {   5,   1}, {   5,   1}, {   5,   1}, {   5,   1}, {   5,   1}, {   5,   1}, {   5,   2}, {   5,   2},
-    {   5,   2}, {   5,   2}, {   5,   2}, {   5,   2}, {   5,   2}, {   5,   2}, {   5,   3}, {   5,   3},
-    {   4,   3}, {   4,   3}, {   4,   3}, {   4,   3}, {   4,   3}, {   4,   3}, {   4,   4}, {   4,   4},
-    {   4,   4}, {   4,   4}, {   4,   4}, {   3,   4}, {   3,   4}, {   3,   4}, {   3,   4}, {   3,   4},
-    {   3,   4}, {   3,   5}, {   3,   5}, {   2,   5}, {   2,   5}, {   2,   5}, {   2,   5}, {   2,   5},
-    {   2,   5}, {   2,   5}, {   2,   5}, {   1,   5}, {   1,   5}, {   1,   5}, {   1,   5}, {   1,   5},
-    {   1,   5}, {   1,   5}, {   0,   5}, {   0,   5}, {   0,   5}, {   0,   5}, {   0,   5}, {   0,   5}
-  },
-  {  // x,y for mag=7 and nra=0:63
-    {   7,   0}, {   6,   0}, {   6,   0}, {   6,   0}, {   6,   0}, {   6,   0}, {   6,   1}, {   6,   1},
-    {   6,   1}, {   6,   1}, {   6,   1}, {   6,   1}, {   6,   2}, {   6,   2}, {   6,   2}, {   6,   2},
-    {   6,   2}, {   6,   2}, {   6,   2}, {   6,   3}, {   6,   3}, {   6,   3}, {   6,   3}, {   5,   3},
-    {   5,   3}, {   5,   4}, {   5,   4}, {   5,   4}, {   5,   4}, {   5,   4}, {   5,   4}, {   5,   4},
-    {   4,   4}, {   4,   5}, {   4,   5}, {   4,   5}, {   4,   5}, {   4,   5}, {   4,   5}, {   4,   5},
-    {   3,   5}, {   3,   5}, {   3,   6}, {   3,   6}, {   3,   6}, {   3,   6}, {   2,   6}, {   2,   6},
-    {   2,   6}, {   2,   6}, {   2,   6}, {   2,   6}, {   2,   6}, {   1,   6}, {   1,   6}, {   1,   6},
-    {   1,   6}, {   1,   6}, {   1,   6}, {   0,   6}, {   0,   6}, {   0,   6}, {   0,   6}, {   0,   6}
-  },
-  {  // x,y for mag=8 and nra=0:63
-    {   8,   0}, {   7,   0}, {   7,   0}, {   7,   0}, {   7,   0}, {   7,   0}, {   7,   1}, {   7,   1},
-    {   7,   1}, {   7,   1}, {   7,   1}, {   7,   2}, {   7,   2}, {   7,   2}, {   7,   2}, {   7,   2},
-    {   7,   3}, {   7,   3}, {   7,   3}, {   7,   3}, {   7,   3}, {   6,   3}, {   6,   4}, {   6,   4},
-    {   6,   4}, {   6,   4}, {   6,   4}, {   6,   4}, {   6,   5}, {   6,   5}, {   5,   5}, {   5,   5},
-    {   5,   5}, {   5,   5}, {   5,   5}, {   5,   6}, {   5,   6}, {   4,   6}, {   4,   6}, {   4,   6},
-    {   4,   6}, {   4,   6}, {   4,   6}, {   3,   6}, {   3,   7}, {   3,   7}, {   3,   7}, {   3,   7},
-    {   3,   7}, {   2,   7}, {   2,   7}, {   2,   7}, {   2,   7}, {   2,   7}, {   1,   7}, {   1,   7},
-    {   1,   7}, {   1,   7}, {   1,   7}, {   0,   7}, {   0,   7}, {   0,   7}, {   0,   7}, {   0,   7}
-  },
-  {  // x,y for mag=9 and nra=0:63
-    {   9,   0}, {   8,   0}, {   8,   0}, {   8,   0}, {   8,   0}, {   8,   1}, {   8,   1}, {   8,   1},
-    {   8,   1}, {   8,   1}, {   8,   2}, {   8,   2}, {   8,   2}, {   8,   2}, {   8,   3}, {   8,   3},
-    {   8,   3}, {   8,   3}, {   8,   3}, {   8,   4}, {   7,   4}, {   7,   4}, {   7,   4}, {   7,   4},
-    {   7,   5}, {   7,   5}, {   7,   5}, {   7,   5}, {   6,   5}, {   6,   5}, {   6,   6}, {   6,   6},
-    {   6,   6}, {   6,   6}, {   6,   6}, {   5,   6}, {   5,   6}, {   5,   7}, {   5,   7}, {   5,   7},
-    {   5,   7}, {   4,   7}, {   4,   7}, {   4,   7}, {   4,   7}, {   4,   8}, {   3,   8}, {   3,   8},
-    {   3,   8}, {   3,   8}, {   3,   8}, {   2,   8}, {   2,   8}, {   2,   8}, {   2,   8}, {   1,   8},
-    {   1,   8}, {   1,   8}, {   1,   8}, {   1,   8}, {   0,   8}, {   0,   8}, {   0,   8}, {   0,   8}
-  },
-  {  // x,y for mag=10 and nra=0:63
-    {  10,   0}, {   9,   0}, {   9,   0}, {   9,   0}, {   9,   0}, {   9,   1}, {   9,   1}, {   9,   1},
-    {   9,   1}, {   9,   2}, {   9,   2}, {   9,   2}, {   9,   2}, {   9,   3}, {   9,   3}, {   9,   3},
-    {   9,   3}, {   9,   4}, {   9,   4}, {   8,   4}, {   8,   4}, {   8,   4}, {   8,   5}, {   8,   5},
-    {   8,   5}, {   8,   5}, {   8,   5}, {   7,   6}, {   7,   6}, {   7,   6}, {   7,   6}, {   7,   6},
-    {   7,   7}, {   6,   7}, {   6,   7}, {   6,   7}, {   6,   7}, {   6,   7}, {   5,   8}, {   5,   8},
-    {   5,   8}, {   5,   8}, {   5,   8}, {   4,   8}, {   4,   8}, {   4,   8}, {   4,   9}, {   4,   9},
-    {   3,   9}, {   3,   9}, {   3,   9}, {   3,   9}, {   2,   9}, {   2,   9}, {   2,   9}, {   2,   9},
-    {   1,   9}, {   1,   9}, {   1,   9}, {   1,   9}, {   0,   9}, {   0,   9}, {   0,   9}, {   0,   9}
-  },
-  {  // x,y for mag=11 and nra=0:63
-    {  11,   0}, {  10,   0}, {  10,   0}, {  10,   0}, {  10,   1}, {  10,   1}, {  10,   1}, {  10,   1},
-    {  10,   2}, {  10,   2}, {  10,   2}, {  10,   2}, {  10,   3}, {  10,   3}, {  10,   3}, {  10,   3},
-    {  10,   4}, {  10,   4}, {   9,   4}, {   9,   4}, {   9,   5}, {   9,   5}, {   9,   5}, {   9,   5},
-    {   9,   6}, {   8,   6}, {   8,   6}, {   8,   6}, {   8,   6}, {   8,   7}, {   8,   7}, {   7,   7},
-    {   7,   7}, {   7,   7}, {   7,   8}, {   7,   8}, {   6,   8}, {   6,   8}, {   6,   8}, {   6,   8},
-    {   6,   9}, {   5,   9}, {   5,   9}, {   5,   9}, {   5,   9}, {   4,   9}, {   4,   9}, {   4,  10},
-    {   4,  10}, {   3,  10}, {   3,  10}, {   3,  10}, {   3,  10}, {   2,  10}, {   2,  10}, {   2,  10},
-    {   2,  10}, {   1,  10}, {   1,  10}, {   1,  10}, {   1,  10}, {   0,  10}, {   0,  10}, {   0,  10}
-  },
-  {  // x,y for mag=12 and nra=0:63
-    {  12,   0}, {  11,   0}, {  11,   0}, {  11,   0}, {  11,   1}, {  11,   1}, {  11,   1}, {  11,   2},
-    {  11,   2}, {  11,   2}, {  11,   2}, {  11,   3}, {  11,   3}, {  11,   3}, {  11,   4}, {  11,   4},
-    {  11,   4}, {  10,   4}, {  10,   5}, {  10,   5}, {  10,   5}, {  10,   5}, {  10,   6}, {  10,   6},
-    {   9,   6}, {   9,   6}, {   9,   7}, {   9,   7}, {   9,   7}, {   9,   7}, {   8,   8}, {   8,   8},
-    {   8,   8}, {   8,   8}, {   8,   8}, {   7,   9}, {   7,   9}, {   7,   9}, {   7,   9}, {   6,   9},
-    {   6,   9}, {   6,  10}, {   6,  10}, {   5,  10}, {   5,  10}, {   5,  10}, {   5,  10}, {   4,  10},
-    {   4,  11}, {   4,  11}, {   4,  11}, {   3,  11}, {   3,  11}, {   3,  11}, {   2,  11}, {   2,  11},
-    {   2,  11}, {   2,  11}, {   1,  11}, {   1,  11}, {   1,  11}, {   0,  11}, {   0,  11}, {   0,  11}
-  },
-  {  // x,y for mag=13 and nra=0:63
-    {  13,   0}, {  12,   0}, {  12,   0}, {  12,   0}, {  12,   1}, {  12,   1}, {  12,   1}, {  12,   2},
-    {  12,   2}, {  12,   2}, {  12,   3}, {  12,   3}, {  12,   3}, {  12,   4}, {  12,   4}, {  12,   4},
-    {  12,   4}, {  11,   5}, {  11,   5}, {  11,   5}, {  11,   6}, {  11,   6}, {  11,   6}, {  10,   6},
-    {  10,   7}, {  10,   7}, {  10,   7}, {  10,   7}, {  10,   8}, {   9,   8}, {   9,   8}, {   9,   8},
-    {   9,   9}, {   8,   9}, {   8,   9}, {   8,   9}, {   8,  10}, {   7,  10}, {   7,  10}, {   7,  10},
-    {   7,  10}, {   6,  10}, {   6,  11}, {   6,  11}, {   6,  11}, {   5,  11}, {   5,  11}, {   5,  11},
-    {   4,  12}, {   4,  12}, {   4,  12}, {   4,  12}, {   3,  12}, {   3,  12}, {   3,  12}, {   2,  12},
-    {   2,  12}, {   2,  12}, {   1,  12}, {   1,  12}, {   1,  12}, {   0,  12}, {   0,  12}, {   0,  12}
-  },
-  {  // x,y for mag=14 and nra=0:63
-    {  14,   0}, {  13,   0}, {  13,   0}, {  13,   1}, {  13,   1}, {  13,   1}, {  13,   2}, {  13,   2},
-    {  13,   2}, {  13,   3}, {  13,   3}, {  13,   3}, {  13,   4}, {  13,   4}, {  13,   4}, {  13,   5},
-    {  12,   5}, {  12,   5}, {  12,   5}, {  12,   6}, {  12,   6}, {  12,   6}, {  12,   7}, {  11,   7},
-    {  11,   7}, {  11,   8}, {  11,   8}, {  11,   8}, {  10,   8}, {  10,   9}, {  10,   9}, {  10,   9},
-    {   9,   9}, {   9,  10}, {   9,  10}, {   9,  10}, {   8,  10}, {   8,  11}, {   8,  11}, {   8,  11},
-    {   7,  11}, {   7,  11}, {   7,  12}, {   6,  12}, {   6,  12}, {   6,  12}, {   5,  12}, {   5,  12},
-    {   5,  12}, {   5,  13}, {   4,  13}, {   4,  13}, {   4,  13}, {   3,  13}, {   3,  13}, {   3,  13},
-    {   2,  13}, {   2,  13}, {   2,  13}, {   1,  13}, {   1,  13}, {   1,  13}, {   0,  13}, {   0,  13}
-  },
-  {  // x,y for mag=15 and nra=0:63
-    {  15,   0}, {  14,   0}, {  14,   0}, {  14,   1}, {  14,   1}, {  14,   1}, {  14,   2}, {  14,   2},
-    {  14,   2}, {  14,   3}, {  14,   3}, {  14,   4}, {  14,   4}, {  14,   4}, {  14,   5}, {  13,   5},
-    {  13,   5}, {  13,   6}, {  13,   6}, {  13,   6}, {  13,   7}, {  13,   7}, {  12,   7}, {  12,   8},
-    {  12,   8}, {  12,   8}, {  12,   8}, {  11,   9}, {  11,   9}, {  11,   9}, {  11,  10}, {  10,  10},
-    {  10,  10}, {  10,  10}, {  10,  11}, {   9,  11}, {   9,  11}, {   9,  11}, {   8,  12}, {   8,  12},
-    {   8,  12}, {   8,  12}, {   7,  12}, {   7,  13}, {   7,  13}, {   6,  13}, {   6,  13}, {   6,  13},
-    {   5,  13}, {   5,  13}, {   5,  14}, {   4,  14}, {   4,  14}, {   4,  14}, {   3,  14}, {   3,  14},
-    {   2,  14}, {   2,  14}, {   2,  14}, {   1,  14}, {   1,  14}, {   1,  14}, {   0,  14}, {   0,  14}
-  },
-  {  // x,y for mag=16 and nra=0:63
-    {  16,   0}, {  15,   0}, {  15,   0}, {  15,   1}, {  15,   1}, {  15,   1}, {  15,   2}, {  15,   2},
-    {  15,   3}, {  15,   3}, {  15,   3}, {  15,   4}, {  15,   4}, {  15,   5}, {  15,   5}, {  14,   5},
-    {  14,   6}, {  14,   6}, {  14,   6}, {  14,   7}, {  14,   7}, {  13,   7}, {  13,   8}, {  13,   8},
-    {  13,   8}, {  13,   9}, {  12,   9}, {  12,   9}, {  12,  10}, {  12,  10}, {  11,  10}, {  11,  11},
-    {  11,  11}, {  11,  11}, {  10,  11}, {  10,  12}, {  10,  12}, {   9,  12}, {   9,  12}, {   9,  13},
-    {   8,  13}, {   8,  13}, {   8,  13}, {   7,  13}, {   7,  14}, {   7,  14}, {   6,  14}, {   6,  14},
-    {   6,  14}, {   5,  14}, {   5,  15}, {   5,  15}, {   4,  15}, {   4,  15}, {   3,  15}, {   3,  15},
-    {   3,  15}, {   2,  15}, {   2,  15}, {   1,  15}, {   1,  15}, {   1,  15}, {   0,  15}, {   0,  15}
-  },
-  {  // x,y for mag=17 and nra=0:63
-    {  17,   0}, {  16,   0}, {  16,   0}, {  16,   1}, {  16,   1}, {  16,   2}, {  16,   2}, {  16,   2},
-    {  16,   3}, {  16,   3}, {  16,   4}, {  16,   4}, {  16,   4}, {  16,   5}, {  16,   5}, {  15,   6},
-    {  15,   6}, {  15,   6}, {  15,   7}, {  15,   7}, {  14,   8}, {  14,   8}, {  14,   8}, {  14,   9},
-    {  14,   9}, {  13,   9}, {  13,  10}, {  13,  10}, {  13,  10}, {  12,  11}, {  12,  11}, {  12,  11},
-    {  12,  12}, {  11,  12}, {  11,  12}, {  11,  12}, {  10,  13}, {  10,  13}, {  10,  13}, {   9,  13},
-    {   9,  14}, {   9,  14}, {   8,  14}, {   8,  14}, {   8,  14}, {   7,  15}, {   7,  15}, {   6,  15},
-    {   6,  15}, {   6,  15}, {   5,  16}, {   5,  16}, {   4,  16}, {   4,  16}, {   4,  16}, {   3,  16},
-    {   3,  16}, {   2,  16}, {   2,  16}, {   2,  16}, {   1,  16}, {   1,  16}, {   0,  16}, {   0,  16}
-  },
-  {  // x,y for mag=18 and nra=0:63
-    {  18,   0}, {  17,   0}, {  17,   0}, {  17,   1}, {  17,   1}, {  17,   2}, {  17,   2}, {  17,   3},
-    {  17,   3}, {  17,   3}, {  17,   4}, {  17,   4}, {  17,   5}, {  17,   5}, {  16,   6}, {  16,   6},
-    {  16,   6}, {  16,   7}, {  16,   7}, {  16,   8}, {  15,   8}, {  15,   8}, {  15,   9}, {  15,   9},
-    {  14,  10}, {  14,  10}, {  14,  10}, {  14,  11}, {  13,  11}, {  13,  11}, {  13,  12}, {  13,  12},
-    {  12,  12}, {  12,  13}, {  12,  13}, {  11,  13}, {  11,  13}, {  11,  14}, {  10,  14}, {  10,  14},
-    {  10,  14}, {   9,  15}, {   9,  15}, {   8,  15}, {   8,  15}, {   8,  16}, {   7,  16}, {   7,  16},
-    {   6,  16}, {   6,  16}, {   6,  16}, {   5,  17}, {   5,  17}, {   4,  17}, {   4,  17}, {   3,  17},
-    {   3,  17}, {   3,  17}, {   2,  17}, {   2,  17}, {   1,  17}, {   1,  17}, {   0,  17}, {   0,  17}
-  },
-  {  // x,y for mag=19 and nra=0:63
-    {  19,   0}, {  18,   0}, {  18,   0}, {  18,   1}, {  18,   1}, {  18,   2}, {  18,   2}, {  18,   3},
-    {  18,   3}, {  18,   4}, {  18,   4}, {  18,   5}, {  18,   5}, {  18,   5}, {  17,   6}, {  17,   6},
-    {  17,   7}, {  17,   7}, {  17,   8}, {  16,   8}, {  16,   8}, {  16,   9}, {  16,   9}, {  16,  10},
-    {  15,  10}, {  15,  10}, {  15,  11}, {  14,  11}, {  14,  12}, {  14,  12}, {  14,  12}, {  13,  13},
-    {  13,  13}, {  13,  13}, {  12,  14}, {  12,  14}, {  12,  14}, {  11,  14}, {  11,  15}, {  10,  15},
-    {  10,  15}, {  10,  16}, {   9,  16}, {   9,  16}, {   8,  16}, {   8,  16}, {   8,  17}, {   7,  17},
-    {   7,  17}, {   6,  17}, {   6,  17}, {   5,  18}, {   5,  18}, {   5,  18}, {   4,  18}, {   4,  18},
-    {   3,  18}, {   3,  18}, {   2,  18}, {   2,  18}, {   1,  18}, {   1,  18}, {   0,  18}, {   0,  18}
-  },
-  {  // x,y for mag=20 and nra=0:63
-    {  20,   0}, {  19,   0}, {  19,   0}, {  19,   1}, {  19,   1}, {  19,   2}, {  19,   2}, {  19,   3},
-    {  19,   3}, {  19,   4}, {  19,   4}, {  19,   5}, {  19,   5}, {  18,   6}, {  18,   6}, {  18,   7},
-    {  18,   7}, {  18,   8}, {  18,   8}, {  17,   8}, {  17,   9}, {  17,   9}, {  17,  10}, {  16,  10},
-    {  16,  11}, {  16,  11}, {  16,  11}, {  15,  12}, {  15,  12}, {  15,  13}, {  14,  13}, {  14,  13},
-    {  14,  14}, {  13,  14}, {  13,  14}, {  13,  15}, {  12,  15}, {  12,  15}, {  11,  16}, {  11,  16},
-    {  11,  16}, {  10,  16}, {  10,  17}, {   9,  17}, {   9,  17}, {   8,  17}, {   8,  18}, {   8,  18},
-    {   7,  18}, {   7,  18}, {   6,  18}, {   6,  18}, {   5,  19}, {   5,  19}, {   4,  19}, {   4,  19},
-    {   3,  19}, {   3,  19}, {   2,  19}, {   2,  19}, {   1,  19}, {   1,  19}, {   0,  19}, {   0,  19}
-  },
-  {  // x,y for mag=21 and nra=0:63
-    {  21,   0}, {  20,   0}, {  20,   1}, {  20,   1}, {  20,   2}, {  20,   2}, {  20,   3}, {  20,   3},
-    {  20,   4}, {  20,   4}, {  20,   5}, {  20,   5}, {  20,   6}, {  19,   6}, {  19,   7}, {  19,   7},
-    {  19,   8}, {  19,   8}, {  18,   8}, {  18,   9}, {  18,   9}, {  18,  10}, {  18,  10}, {  17,  11},
-    {  17,  11}, {  17,  12}, {  16,  12}, {  16,  12}, {  16,  13}, {  15,  13}, {  15,  14}, {  15,  14},
-    {  14,  14}, {  14,  15}, {  14,  15}, {  13,  15}, {  13,  16}, {  12,  16}, {  12,  16}, {  12,  17},
-    {  11,  17}, {  11,  17}, {  10,  18}, {  10,  18}, {   9,  18}, {   9,  18}, {   8,  18}, {   8,  19},
-    {   8,  19}, {   7,  19}, {   7,  19}, {   6,  19}, {   6,  20}, {   5,  20}, {   5,  20}, {   4,  20},
-    {   4,  20}, {   3,  20}, {   3,  20}, {   2,  20}, {   2,  20}, {   1,  20}, {   1,  20}, {   0,  20}
-  },
-  {  // x,y for mag=22 and nra=0:63
-    {  22,   0}, {  21,   0}, {  21,   1}, {  21,   1}, {  21,   2}, {  21,   2}, {  21,   3}, {  21,   3},
-    {  21,   4}, {  21,   4}, {  21,   5}, {  21,   5}, {  21,   6}, {  20,   6}, {  20,   7}, {  20,   7},
-    {  20,   8}, {  20,   8}, {  19,   9}, {  19,   9}, {  19,  10}, {  19,  10}, {  18,  11}, {  18,  11},
-    {  18,  12}, {  17,  12}, {  17,  13}, {  17,  13}, {  17,  13}, {  16,  14}, {  16,  14}, {  15,  15},
-    {  15,  15}, {  15,  15}, {  14,  16}, {  14,  16}, {  13,  17}, {  13,  17}, {  13,  17}, {  12,  17},
-    {  12,  18}, {  11,  18}, {  11,  18}, {  10,  19}, {  10,  19}, {   9,  19}, {   9,  19}, {   8,  20},
-    {   8,  20}, {   7,  20}, {   7,  20}, {   6,  20}, {   6,  21}, {   5,  21}, {   5,  21}, {   4,  21},
-    {   4,  21}, {   3,  21}, {   3,  21}, {   2,  21}, {   2,  21}, {   1,  21}, {   1,  21}, {   0,  21}
-  },
-  {  // x,y for mag=23 and nra=0:63
-    {  23,   0}, {  22,   0}, {  22,   1}, {  22,   1}, {  22,   2}, {  22,   2}, {  22,   3}, {  22,   3},
-    {  22,   4}, {  22,   5}, {  22,   5}, {  22,   6}, {  22,   6}, {  21,   7}, {  21,   7}, {  21,   8},
-    {  21,   8}, {  21,   9}, {  20,   9}, {  20,  10}, {  20,  10}, {  20,  11}, {  19,  11}, {  19,  12},
-    {  19,  12}, {  18,  13}, {  18,  13}, {  18,  14}, {  17,  14}, {  17,  15}, {  17,  15}, {  16,  15},
-    {  16,  16}, {  15,  16}, {  15,  17}, {  15,  17}, {  14,  17}, {  14,  18}, {  13,  18}, {  13,  18},
-    {  12,  19}, {  12,  19}, {  11,  19}, {  11,  20}, {  10,  20}, {  10,  20}, {   9,  20}, {   9,  21},
-    {   8,  21}, {   8,  21}, {   7,  21}, {   7,  21}, {   6,  22}, {   6,  22}, {   5,  22}, {   5,  22},
-    {   4,  22}, {   3,  22}, {   3,  22}, {   2,  22}, {   2,  22}, {   1,  22}, {   1,  22}, {   0,  22}
-  },
-  {  // x,y for mag=24 and nra=0:63
-    {  24,   0}, {  23,   0}, {  23,   1}, {  23,   1}, {  23,   2}, {  23,   2}, {  23,   3}, {  23,   4},
-    {  23,   4}, {  23,   5}, {  23,   5}, {  23,   6}, {  22,   6}, {  22,   7}, {  22,   8}, {  22,   8},
-    {  22,   9}, {  21,   9}, {  21,  10}, {  21,  10}, {  21,  11}, {  20,  11}, {  20,  12}, {  20,  12},
-    {  19,  13}, {  19,  13}, {  19,  14}, {  18,  14}, {  18,  15}, {  18,  15}, {  17,  16}, {  17,  16},
-    {  16,  16}, {  16,  17}, {  16,  17}, {  15,  18}, {  15,  18}, {  14,  18}, {  14,  19}, {  13,  19},
-    {  13,  19}, {  12,  20}, {  12,  20}, {  11,  20}, {  11,  21}, {  10,  21}, {  10,  21}, {   9,  21},
-    {   9,  22}, {   8,  22}, {   8,  22}, {   7,  22}, {   6,  22}, {   6,  23}, {   5,  23}, {   5,  23},
-    {   4,  23}, {   4,  23}, {   3,  23}, {   2,  23}, {   2,  23}, {   1,  23}, {   1,  23}, {   0,  23}
-  },
-  {  // x,y for mag=25 and nra=0:63
-    {  25,   0}, {  24,   0}, {  24,   1}, {  24,   1}, {  24,   2}, {  24,   3}, {  24,   3}, {  24,   4},
-    {  24,   4}, {  24,   5}, {  24,   6}, {  24,   6}, {  23,   7}, {  23,   7}, {  23,   8}, {  23,   8},
-    {  23,   9}, {  22,  10}, {  22,  10}, {  22,  11}, {  22,  11}, {  21,  12}, {  21,  12}, {  21,  13},
-    {  20,  13}, {  20,  14}, {  20,  14}, {  19,  15}, {  19,  15}, {  18,  16}, {  18,  16}, {  18,  17},
-    {  17,  17}, {  17,  18}, {  16,  18}, {  16,  18}, {  15,  19}, {  15,  19}, {  14,  20}, {  14,  20},
-    {  13,  20}, {  13,  21}, {  12,  21}, {  12,  21}, {  11,  22}, {  11,  22}, {  10,  22}, {  10,  22},
-    {   9,  23}, {   8,  23}, {   8,  23}, {   7,  23}, {   7,  23}, {   6,  24}, {   6,  24}, {   5,  24},
-    {   4,  24}, {   4,  24}, {   3,  24}, {   3,  24}, {   2,  24}, {   1,  24}, {   1,  24}, {   0,  24}
-  },
-  {  // x,y for mag=26 and nra=0:63
-    {  26,   0}, {  25,   0}, {  25,   1}, {  25,   1}, {  25,   2}, {  25,   3}, {  25,   3}, {  25,   4},
-    {  25,   5}, {  25,   5}, {  25,   6}, {  25,   6}, {  24,   7}, {  24,   8}, {  24,   8}, {  24,   9},
-    {  24,   9}, {  23,  10}, {  23,  11}, {  23,  11}, {  22,  12}, {  22,  12}, {  22,  13}, {  21,  13},
-    {  21,  14}, {  21,  14}, {  20,  15}, {  20,  15}, {  20,  16}, {  19,  16}, {  19,  17}, {  18,  17},
-    {  18,  18}, {  17,  18}, {  17,  19}, {  16,  19}, {  16,  20}, {  15,  20}, {  15,  20}, {  14,  21},
-    {  14,  21}, {  13,  21}, {  13,  22}, {  12,  22}, {  12,  22}, {  11,  23}, {  11,  23}, {  10,  23},
-    {   9,  24}, {   9,  24}, {   8,  24}, {   8,  24}, {   7,  24}, {   6,  25}, {   6,  25}, {   5,  25},
-    {   5,  25}, {   4,  25}, {   3,  25}, {   3,  25}, {   2,  25}, {   1,  25}, {   1,  25}, {   0,  25}
-  },
-  {  // x,y for mag=27 and nra=0:63
-    {  27,   0}, {  26,   0}, {  26,   1}, {  26,   1}, {  26,   2}, {  26,   3}, {  26,   3}, {  26,   4},
-    {  26,   5}, {  26,   5}, {  26,   6}, {  26,   7}, {  25,   7}, {  25,   8}, {  25,   9}, {  25,   9},
-    {  24,  10}, {  24,  10}, {  24,  11}, {  24,  12}, {  23,  12}, {  23,  13}, {  23,  13}, {  22,  14},
-    {  22,  15}, {  22,  15}, {  21,  16}, {  21,  16}, {  20,  17}, {  20,  17}, {  20,  18}, {  19,  18},
-    {  19,  19}, {  18,  19}, {  18,  20}, {  17,  20}, {  17,  20}, {  16,  21}, {  16,  21}, {  15,  22},
-    {  15,  22}, {  14,  22}, {  13,  23}, {  13,  23}, {  12,  23}, {  12,  24}, {  11,  24}, {  10,  24},
-    {  10,  24}, {   9,  25}, {   9,  25}, {   8,  25}, {   7,  25}, {   7,  26}, {   6,  26}, {   5,  26},
-    {   5,  26}, {   4,  26}, {   3,  26}, {   3,  26}, {   2,  26}, {   1,  26}, {   1,  26}, {   0,  26}
-  },
-  {  // x,y for mag=28 and nra=0:63
-    {  28,   0}, {  27,   0}, {  27,   1}, {  27,   2}, {  27,   2}, {  27,   3}, {  27,   4}, {  27,   4},
-    {  27,   5}, {  27,   6}, {  27,   6}, {  26,   7}, {  26,   8}, {  26,   8}, {  26,   9}, {  26,  10},
-    {  25,  10}, {  25,  11}, {  25,  11}, {  25,  12}, {  24,  13}, {  24,  13}, {  24,  14}, {  23,  14},
-    {  23,  15}, {  22,  16}, {  22,  16}, {  22,  17}, {  21,  17}, {  21,  18}, {  20,  18}, {  20,  19},
-    {  19,  19}, {  19,  20}, {  18,  20}, {  18,  21}, {  17,  21}, {  17,  22}, {  16,  22}, {  16,  22},
-    {  15,  23}, {  14,  23}, {  14,  24}, {  13,  24}, {  13,  24}, {  12,  25}, {  11,  25}, {  11,  25},
-    {  10,  25}, {  10,  26}, {   9,  26}, {   8,  26}, {   8,  26}, {   7,  26}, {   6,  27}, {   6,  27},
-    {   5,  27}, {   4,  27}, {   4,  27}, {   3,  27}, {   2,  27}, {   2,  27}, {   1,  27}, {   0,  27}
-  },
-  {  // x,y for mag=29 and nra=0:63
-    {  29,   0}, {  28,   0}, {  28,   1}, {  28,   2}, {  28,   2}, {  28,   3}, {  28,   4}, {  28,   4},
-    {  28,   5}, {  28,   6}, {  28,   7}, {  27,   7}, {  27,   8}, {  27,   9}, {  27,   9}, {  27,  10},
-    {  26,  11}, {  26,  11}, {  26,  12}, {  25,  13}, {  25,  13}, {  25,  14}, {  24,  14}, {  24,  15},
-    {  24,  16}, {  23,  16}, {  23,  17}, {  22,  17}, {  22,  18}, {  21,  18}, {  21,  19}, {  21,  19},
-    {  20,  20}, {  19,  21}, {  19,  21}, {  18,  21}, {  18,  22}, {  17,  22}, {  17,  23}, {  16,  23},
-    {  16,  24}, {  15,  24}, {  14,  24}, {  14,  25}, {  13,  25}, {  13,  25}, {  12,  26}, {  11,  26},
-    {  11,  26}, {  10,  27}, {   9,  27}, {   9,  27}, {   8,  27}, {   7,  27}, {   7,  28}, {   6,  28},
-    {   5,  28}, {   4,  28}, {   4,  28}, {   3,  28}, {   2,  28}, {   2,  28}, {   1,  28}, {   0,  28}
-  },
-  {  // x,y for mag=30 and nra=0:63
-    {  30,   0}, {  29,   0}, {  29,   1}, {  29,   2}, {  29,   2}, {  29,   3}, {  29,   4}, {  29,   5},
-    {  29,   5}, {  29,   6}, {  29,   7}, {  28,   8}, {  28,   8}, {  28,   9}, {  28,  10}, {  27,  10},
-    {  27,  11}, {  27,  12}, {  27,  12}, {  26,  13}, {  26,  14}, {  26,  14}, {  25,  15}, {  25,  16},
-    {  24,  16}, {  24,  17}, {  24,  17}, {  23,  18}, {  23,  19}, {  22,  19}, {  22,  20}, {  21,  20},
-    {  21,  21}, {  20,  21}, {  20,  22}, {  19,  22}, {  19,  23}, {  18,  23}, {  17,  24}, {  17,  24},
-    {  16,  24}, {  16,  25}, {  15,  25}, {  14,  26}, {  14,  26}, {  13,  26}, {  12,  27}, {  12,  27},
-    {  11,  27}, {  10,  27}, {  10,  28}, {   9,  28}, {   8,  28}, {   8,  28}, {   7,  29}, {   6,  29},
-    {   5,  29}, {   5,  29}, {   4,  29}, {   3,  29}, {   2,  29}, {   2,  29}, {   1,  29}, {   0,  29}
-  },
-  {  // x,y for mag=31 and nra=0:63
-    {  31,   0}, {  30,   0}, {  30,   1}, {  30,   2}, {  30,   3}, {  30,   3}, {  30,   4}, {  30,   5},
-    {  30,   6}, {  30,   6}, {  30,   7}, {  29,   8}, {  29,   8}, {  29,   9}, {  29,  10}, {  28,  11},
-    {  28,  11}, {  28,  12}, {  28,  13}, {  27,  13}, {  27,  14}, {  26,  15}, {  26,  15}, {  26,  16},
-    {  25,  17}, {  25,  17}, {  24,  18}, {  24,  19}, {  23,  19}, {  23,  20}, {  22,  20}, {  22,  21},
-    {  21,  21}, {  21,  22}, {  20,  22}, {  20,  23}, {  19,  23}, {  19,  24}, {  18,  24}, {  17,  25},
-    {  17,  25}, {  16,  26}, {  15,  26}, {  15,  26}, {  14,  27}, {  13,  27}, {  13,  28}, {  12,  28},
-    {  11,  28}, {  11,  28}, {  10,  29}, {   9,  29}, {   8,  29}, {   8,  29}, {   7,  30}, {   6,  30},
-    {   6,  30}, {   5,  30}, {   4,  30}, {   3,  30}, {   3,  30}, {   2,  30}, {   1,  30}, {   0,  30}
-  },
-  {  // x,y for mag=32 and nra=0:63
-    {  32,   0}, {  31,   0}, {  31,   1}, {  31,   2}, {  31,   3}, {  31,   3}, {  31,   4}, {  31,   5},
-    {  31,   6}, {  31,   7}, {  31,   7}, {  30,   8}, {  30,   9}, {  30,  10}, {  30,  10}, {  29,  11},
-    {  29,  12}, {  29,  12}, {  28,  13}, {  28,  14}, {  28,  15}, {  27,  15}, {  27,  16}, {  27,  17},
-    {  26,  17}, {  26,  18}, {  25,  19}, {  25,  19}, {  24,  20}, {  24,  20}, {  23,  21}, {  23,  22},
-    {  22,  22}, {  22,  23}, {  21,  23}, {  20,  24}, {  20,  24}, {  19,  25}, {  19,  25}, {  18,  26},
-    {  17,  26}, {  17,  27}, {  16,  27}, {  15,  27}, {  15,  28}, {  14,  28}, {  13,  28}, {  12,  29},
-    {  12,  29}, {  11,  29}, {  10,  30}, {  10,  30}, {   9,  30}, {   8,  30}, {   7,  31}, {   7,  31},
-    {   6,  31}, {   5,  31}, {   4,  31}, {   3,  31}, {   3,  31}, {   2,  31}, {   1,  31}, {   0,  31}
-  },
-  {  // x,y for mag=33 and nra=0:63
-    {  33,   0}, {  32,   0}, {  32,   1}, {  32,   2}, {  32,   3}, {  32,   4}, {  32,   4}, {  32,   5},
-    {  32,   6}, {  32,   7}, {  32,   8}, {  31,   8}, {  31,   9}, {  31,  10}, {  31,  11}, {  30,  11},
-    {  30,  12}, {  30,  13}, {  29,  14}, {  29,  14}, {  29,  15}, {  28,  16}, {  28,  16}, {  27,  17},
-    {  27,  18}, {  26,  19}, {  26,  19}, {  26,  20}, {  25,  20}, {  24,  21}, {  24,  22}, {  23,  22},
-    {  23,  23}, {  22,  23}, {  22,  24}, {  21,  24}, {  20,  25}, {  20,  26}, {  19,  26}, {  19,  26},
-    {  18,  27}, {  17,  27}, {  16,  28}, {  16,  28}, {  15,  29}, {  14,  29}, {  14,  29}, {  13,  30},
-    {  12,  30}, {  11,  30}, {  11,  31}, {  10,  31}, {   9,  31}, {   8,  31}, {   8,  32}, {   7,  32},
-    {   6,  32}, {   5,  32}, {   4,  32}, {   4,  32}, {   3,  32}, {   2,  32}, {   1,  32}, {   0,  32}
-  },
-  {  // x,y for mag=34 and nra=0:63
-    {  34,   0}, {  33,   0}, {  33,   1}, {  33,   2}, {  33,   3}, {  33,   4}, {  33,   4}, {  33,   5},
-    {  33,   6}, {  33,   7}, {  32,   8}, {  32,   9}, {  32,   9}, {  32,  10}, {  32,  11}, {  31,  12},
-    {  31,  13}, {  31,  13}, {  30,  14}, {  30,  15}, {  29,  16}, {  29,  16}, {  29,  17}, {  28,  18},
-    {  28,  18}, {  27,  19}, {  27,  20}, {  26,  20}, {  26,  21}, {  25,  22}, {  25,  22}, {  24,  23},
-    {  24,  24}, {  23,  24}, {  22,  25}, {  22,  25}, {  21,  26}, {  20,  26}, {  20,  27}, {  19,  27},
-    {  18,  28}, {  18,  28}, {  17,  29}, {  16,  29}, {  16,  29}, {  15,  30}, {  14,  30}, {  13,  31},
-    {  13,  31}, {  12,  31}, {  11,  32}, {  10,  32}, {   9,  32}, {   9,  32}, {   8,  32}, {   7,  33},
-    {   6,  33}, {   5,  33}, {   4,  33}, {   4,  33}, {   3,  33}, {   2,  33}, {   1,  33}, {   0,  33}
-  },
-  {  // x,y for mag=35 and nra=0:63
-    {  35,   0}, {  34,   0}, {  34,   1}, {  34,   2}, {  34,   3}, {  34,   4}, {  34,   5}, {  34,   5},
-    {  34,   6}, {  34,   7}, {  33,   8}, {  33,   9}, {  33,  10}, {  33,  10}, {  32,  11}, {  32,  12},
-    {  32,  13}, {  31,  14}, {  31,  14}, {  31,  15}, {  30,  16}, {  30,  17}, {  30,  17}, {  29,  18},
-    {  29,  19}, {  28,  20}, {  28,  20}, {  27,  21}, {  27,  22}, {  26,  22}, {  25,  23}, {  25,  24},
-    {  24,  24}, {  24,  25}, {  23,  25}, {  22,  26}, {  22,  27}, {  21,  27}, {  20,  28}, {  20,  28},
-    {  19,  29}, {  18,  29}, {  17,  30}, {  17,  30}, {  16,  30}, {  15,  31}, {  14,  31}, {  14,  31},
-    {  13,  32}, {  12,  32}, {  11,  32}, {  10,  33}, {  10,  33}, {   9,  33}, {   8,  33}, {   7,  34},
-    {   6,  34}, {   5,  34}, {   5,  34}, {   4,  34}, {   3,  34}, {   2,  34}, {   1,  34}, {   0,  34}
-  },
-  {  // x,y for mag=36 and nra=0:63
-    {  36,   0}, {  35,   0}, {  35,   1}, {  35,   2}, {  35,   3}, {  35,   4}, {  35,   5}, {  35,   6},
-    {  35,   7}, {  35,   7}, {  34,   8}, {  34,   9}, {  34,  10}, {  34,  11}, {  33,  12}, {  33,  12},
-    {  33,  13}, {  32,  14}, {  32,  15}, {  32,  16}, {  31,  16}, {  31,  17}, {  30,  18}, {  30,  19},
-    {  29,  20}, {  29,  20}, {  28,  21}, {  28,  22}, {  27,  22}, {  27,  23}, {  26,  24}, {  26,  24},
-    {  25,  25}, {  24,  26}, {  24,  26}, {  23,  27}, {  22,  27}, {  22,  28}, {  21,  28}, {  20,  29},
-    {  20,  29}, {  19,  30}, {  18,  30}, {  17,  31}, {  16,  31}, {  16,  32}, {  15,  32}, {  14,  32},
-    {  13,  33}, {  12,  33}, {  12,  33}, {  11,  34}, {  10,  34}, {   9,  34}, {   8,  34}, {   7,  35},
-    {   7,  35}, {   6,  35}, {   5,  35}, {   4,  35}, {   3,  35}, {   2,  35}, {   1,  35}, {   0,  35}
-  },
-  {  // x,y for mag=37 and nra=0:63
-    {  37,   0}, {  36,   0}, {  36,   1}, {  36,   2}, {  36,   3}, {  36,   4}, {  36,   5}, {  36,   6},
-    {  36,   7}, {  36,   8}, {  35,   8}, {  35,   9}, {  35,  10}, {  35,  11}, {  34,  12}, {  34,  13},
-    {  34,  14}, {  33,  14}, {  33,  15}, {  33,  16}, {  32,  17}, {  32,  18}, {  31,  19}, {  31,  19},
-    {  30,  20}, {  30,  21}, {  29,  22}, {  29,  22}, {  28,  23}, {  28,  24}, {  27,  24}, {  26,  25},
-    {  26,  26}, {  25,  26}, {  24,  27}, {  24,  28}, {  23,  28}, {  22,  29}, {  22,  29}, {  21,  30},
-    {  20,  30}, {  19,  31}, {  19,  31}, {  18,  32}, {  17,  32}, {  16,  33}, {  15,  33}, {  14,  33},
-    {  14,  34}, {  13,  34}, {  12,  34}, {  11,  35}, {  10,  35}, {   9,  35}, {   8,  35}, {   8,  36},
-    {   7,  36}, {   6,  36}, {   5,  36}, {   4,  36}, {   3,  36}, {   2,  36}, {   1,  36}, {   0,  36}
-  },
-  {  // x,y for mag=38 and nra=0:63
-    {  38,   0}, {  37,   0}, {  37,   1}, {  37,   2}, {  37,   3}, {  37,   4}, {  37,   5}, {  37,   6},
-    {  37,   7}, {  37,   8}, {  36,   9}, {  36,  10}, {  36,  11}, {  36,  11}, {  35,  12}, {  35,  13},
-    {  35,  14}, {  34,  15}, {  34,  16}, {  33,  17}, {  33,  17}, {  33,  18}, {  32,  19}, {  32,  20},
-    {  31,  21}, {  31,  21}, {  30,  22}, {  29,  23}, {  29,  24}, {  28,  24}, {  28,  25}, {  27,  26},
-    {  26,  26}, {  26,  27}, {  25,  28}, {  24,  28}, {  24,  29}, {  23,  29}, {  22,  30}, {  21,  31},
-    {  21,  31}, {  20,  32}, {  19,  32}, {  18,  33}, {  17,  33}, {  17,  33}, {  16,  34}, {  15,  34},
-    {  14,  35}, {  13,  35}, {  12,  35}, {  11,  36}, {  11,  36}, {  10,  36}, {   9,  36}, {   8,  37},
-    {   7,  37}, {   6,  37}, {   5,  37}, {   4,  37}, {   3,  37}, {   2,  37}, {   1,  37}, {   0,  37}
-  },
-  {  // x,y for mag=39 and nra=0:63
-    {  39,   0}, {  38,   0}, {  38,   1}, {  38,   2}, {  38,   3}, {  38,   4}, {  38,   5}, {  38,   6},
-    {  38,   7}, {  38,   8}, {  37,   9}, {  37,  10}, {  37,  11}, {  37,  12}, {  36,  13}, {  36,  14},
-    {  36,  14}, {  35,  15}, {  35,  16}, {  34,  17}, {  34,  18}, {  33,  19}, {  33,  20}, {  32,  20},
-    {  32,  21}, {  31,  22}, {  31,  23}, {  30,  23}, {  30,  24}, {  29,  25}, {  28,  26}, {  28,  26},
-    {  27,  27}, {  26,  28}, {  26,  28}, {  25,  29}, {  24,  30}, {  23,  30}, {  23,  31}, {  22,  31},
-    {  21,  32}, {  20,  32}, {  20,  33}, {  19,  33}, {  18,  34}, {  17,  34}, {  16,  35}, {  15,  35},
-    {  14,  36}, {  14,  36}, {  13,  36}, {  12,  37}, {  11,  37}, {  10,  37}, {   9,  37}, {   8,  38},
-    {   7,  38}, {   6,  38}, {   5,  38}, {   4,  38}, {   3,  38}, {   2,  38}, {   1,  38}, {   0,  38}
-  },
-  {  // x,y for mag=40 and nra=0:63
-    {  40,   0}, {  39,   0}, {  39,   1}, {  39,   2}, {  39,   3}, {  39,   4}, {  39,   5}, {  39,   6},
-    {  39,   7}, {  39,   8}, {  38,   9}, {  38,  10}, {  38,  11}, {  37,  12}, {  37,  13}, {  37,  14},
-    {  36,  15}, {  36,  16}, {  36,  17}, {  35,  17}, {  35,  18}, {  34,  19}, {  34,  20}, {  33,  21},
-    {  33,  22}, {  32,  23}, {  32,  23}, {  31,  24}, {  30,  25}, {  30,  26}, {  29,  26}, {  28,  27},
-    {  28,  28}, {  27,  28}, {  26,  29}, {  26,  30}, {  25,  30}, {  24,  31}, {  23,  32}, {  23,  32},
-    {  22,  33}, {  21,  33}, {  20,  34}, {  19,  34}, {  18,  35}, {  17,  35}, {  17,  36}, {  16,  36},
-    {  15,  36}, {  14,  37}, {  13,  37}, {  12,  37}, {  11,  38}, {  10,  38}, {   9,  38}, {   8,  39},
-    {   7,  39}, {   6,  39}, {   5,  39}, {   4,  39}, {   3,  39}, {   2,  39}, {   1,  39}, {   0,  39}
-  },
-  {  // x,y for mag=41 and nra=0:63
-    {  41,   0}, {  40,   1}, {  40,   2}, {  40,   3}, {  40,   4}, {  40,   5}, {  40,   6}, {  40,   7},
-    {  40,   7}, {  40,   8}, {  39,   9}, {  39,  10}, {  39,  11}, {  38,  12}, {  38,  13}, {  38,  14},
-    {  37,  15}, {  37,  16}, {  37,  17}, {  36,  18}, {  36,  19}, {  35,  20}, {  35,  21}, {  34,  21},
-    {  34,  22}, {  33,  23}, {  32,  24}, {  32,  25}, {  31,  26}, {  31,  26}, {  30,  27}, {  29,  28},
-    {  28,  28}, {  28,  29}, {  27,  30}, {  26,  31}, {  26,  31}, {  25,  32}, {  24,  32}, {  23,  33},
-    {  22,  34}, {  21,  34}, {  21,  35}, {  20,  35}, {  19,  36}, {  18,  36}, {  17,  37}, {  16,  37},
-    {  15,  37}, {  14,  38}, {  13,  38}, {  12,  38}, {  11,  39}, {  10,  39}, {   9,  39}, {   8,  40},
-    {   7,  40}, {   7,  40}, {   6,  40}, {   5,  40}, {   4,  40}, {   3,  40}, {   2,  40}, {   1,  40}
-  },
-  {  // x,y for mag=42 and nra=0:63
-    {  42,   0}, {  41,   1}, {  41,   2}, {  41,   3}, {  41,   4}, {  41,   5}, {  41,   6}, {  41,   7},
-    {  41,   8}, {  40,   9}, {  40,  10}, {  40,  11}, {  40,  12}, {  39,  13}, {  39,  14}, {  39,  15},
-    {  38,  16}, {  38,  17}, {  37,  17}, {  37,  18}, {  37,  19}, {  36,  20}, {  36,  21}, {  35,  22},
-    {  34,  23}, {  34,  24}, {  33,  25}, {  33,  25}, {  32,  26}, {  31,  27}, {  31,  28}, {  30,  28},
-    {  29,  29}, {  28,  30}, {  28,  31}, {  27,  31}, {  26,  32}, {  25,  33}, {  25,  33}, {  24,  34},
-    {  23,  34}, {  22,  35}, {  21,  36}, {  20,  36}, {  19,  37}, {  18,  37}, {  17,  37}, {  17,  38},
-    {  16,  38}, {  15,  39}, {  14,  39}, {  13,  39}, {  12,  40}, {  11,  40}, {  10,  40}, {   9,  40},
-    {   8,  41}, {   7,  41}, {   6,  41}, {   5,  41}, {   4,  41}, {   3,  41}, {   2,  41}, {   1,  41}
-  },
-  {  // x,y for mag=43 and nra=0:63
-    {  43,   0}, {  42,   1}, {  42,   2}, {  42,   3}, {  42,   4}, {  42,   5}, {  42,   6}, {  42,   7},
-    {  42,   8}, {  41,   9}, {  41,  10}, {  41,  11}, {  41,  12}, {  40,  13}, {  40,  14}, {  40,  15},
-    {  39,  16}, {  39,  17}, {  38,  18}, {  38,  19}, {  37,  20}, {  37,  21}, {  36,  22}, {  36,  23},
-    {  35,  23}, {  35,  24}, {  34,  25}, {  33,  26}, {  33,  27}, {  32,  28}, {  31,  28}, {  31,  29},
-    {  30,  30}, {  29,  31}, {  28,  31}, {  28,  32}, {  27,  33}, {  26,  33}, {  25,  34}, {  24,  35},
-    {  23,  35}, {  23,  36}, {  22,  36}, {  21,  37}, {  20,  37}, {  19,  38}, {  18,  38}, {  17,  39},
-    {  16,  39}, {  15,  40}, {  14,  40}, {  13,  40}, {  12,  41}, {  11,  41}, {  10,  41}, {   9,  41},
-    {   8,  42}, {   7,  42}, {   6,  42}, {   5,  42}, {   4,  42}, {   3,  42}, {   2,  42}, {   1,  42}
-  },
-  {  // x,y for mag=44 and nra=0:63
-    {  44,   0}, {  43,   1}, {  43,   2}, {  43,   3}, {  43,   4}, {  43,   5}, {  43,   6}, {  43,   7},
-    {  43,   8}, {  42,   9}, {  42,  10}, {  42,  11}, {  42,  12}, {  41,  13}, {  41,  14}, {  41,  15},
-    {  40,  16}, {  40,  17}, {  39,  18}, {  39,  19}, {  38,  20}, {  38,  21}, {  37,  22}, {  37,  23},
-    {  36,  24}, {  35,  25}, {  35,  26}, {  34,  27}, {  34,  27}, {  33,  28}, {  32,  29}, {  31,  30},
-    {  31,  31}, {  30,  31}, {  29,  32}, {  28,  33}, {  27,  34}, {  27,  34}, {  26,  35}, {  25,  35},
-    {  24,  36}, {  23,  37}, {  22,  37}, {  21,  38}, {  20,  38}, {  19,  39}, {  18,  39}, {  17,  40},
-    {  16,  40}, {  15,  41}, {  14,  41}, {  13,  41}, {  12,  42}, {  11,  42}, {  10,  42}, {   9,  42},
-    {   8,  43}, {   7,  43}, {   6,  43}, {   5,  43}, {   4,  43}, {   3,  43}, {   2,  43}, {   1,  43}
-  },
-  {  // x,y for mag=45 and nra=0:63
-    {  45,   0}, {  44,   1}, {  44,   2}, {  44,   3}, {  44,   4}, {  44,   5}, {  44,   6}, {  44,   7},
-    {  44,   8}, {  43,   9}, {  43,  10}, {  43,  12}, {  43,  13}, {  42,  14}, {  42,  15}, {  41,  16},
-    {  41,  17}, {  41,  18}, {  40,  19}, {  40,  20}, {  39,  21}, {  39,  22}, {  38,  23}, {  38,  24},
-    {  37,  25}, {  36,  25}, {  36,  26}, {  35,  27}, {  34,  28}, {  34,  29}, {  33,  30}, {  32,  31},
-    {  31,  31}, {  31,  32}, {  30,  33}, {  29,  34}, {  28,  34}, {  27,  35}, {  26,  36}, {  25,  36},
-    {  25,  37}, {  24,  38}, {  23,  38}, {  22,  39}, {  21,  39}, {  20,  40}, {  19,  40}, {  18,  41},
-    {  17,  41}, {  16,  41}, {  15,  42}, {  14,  42}, {  13,  43}, {  12,  43}, {  10,  43}, {   9,  43},
-    {   8,  44}, {   7,  44}, {   6,  44}, {   5,  44}, {   4,  44}, {   3,  44}, {   2,  44}, {   1,  44}
-  },
-  {  // x,y for mag=46 and nra=0:63
-    {  46,   0}, {  45,   1}, {  45,   2}, {  45,   3}, {  45,   4}, {  45,   5}, {  45,   6}, {  45,   7},
-    {  45,   8}, {  44,  10}, {  44,  11}, {  44,  12}, {  44,  13}, {  43,  14}, {  43,  15}, {  42,  16},
-    {  42,  17}, {  42,  18}, {  41,  19}, {  41,  20}, {  40,  21}, {  40,  22}, {  39,  23}, {  38,  24},
-    {  38,  25}, {  37,  26}, {  36,  27}, {  36,  28}, {  35,  29}, {  34,  30}, {  34,  30}, {  33,  31},
-    {  32,  32}, {  31,  33}, {  30,  34}, {  30,  34}, {  29,  35}, {  28,  36}, {  27,  36}, {  26,  37},
-    {  25,  38}, {  24,  38}, {  23,  39}, {  22,  40}, {  21,  40}, {  20,  41}, {  19,  41}, {  18,  42},
-    {  17,  42}, {  16,  42}, {  15,  43}, {  14,  43}, {  13,  44}, {  12,  44}, {  11,  44}, {  10,  44},
-    {   8,  45}, {   7,  45}, {   6,  45}, {   5,  45}, {   4,  45}, {   3,  45}, {   2,  45}, {   1,  45}
-  },
-  {  // x,y for mag=47 and nra=0:63
-    {  47,   0}, {  46,   1}, {  46,   2}, {  46,   3}, {  46,   4}, {  46,   5}, {  46,   6}, {  46,   8},
-    {  46,   9}, {  45,  10}, {  45,  11}, {  45,  12}, {  44,  13}, {  44,  14}, {  44,  15}, {  43,  16},
-    {  43,  17}, {  42,  19}, {  42,  20}, {  41,  21}, {  41,  22}, {  40,  23}, {  40,  24}, {  39,  25},
-    {  39,  26}, {  38,  27}, {  37,  27}, {  37,  28}, {  36,  29}, {  35,  30}, {  34,  31}, {  34,  32},
-    {  33,  33}, {  32,  34}, {  31,  34}, {  30,  35}, {  29,  36}, {  28,  37}, {  27,  37}, {  27,  38},
-    {  26,  39}, {  25,  39}, {  24,  40}, {  23,  40}, {  22,  41}, {  21,  41}, {  20,  42}, {  19,  42},
-    {  17,  43}, {  16,  43}, {  15,  44}, {  14,  44}, {  13,  44}, {  12,  45}, {  11,  45}, {  10,  45},
-    {   9,  46}, {   8,  46}, {   6,  46}, {   5,  46}, {   4,  46}, {   3,  46}, {   2,  46}, {   1,  46}
-  },
-  {  // x,y for mag=48 and nra=0:63
-    {  48,   0}, {  47,   1}, {  47,   2}, {  47,   3}, {  47,   4}, {  47,   5}, {  47,   7}, {  47,   8},
-    {  47,   9}, {  46,  10}, {  46,  11}, {  46,  12}, {  45,  13}, {  45,  15}, {  45,  16}, {  44,  17},
-    {  44,  18}, {  43,  19}, {  43,  20}, {  42,  21}, {  42,  22}, {  41,  23}, {  41,  24}, {  40,  25},
-    {  39,  26}, {  39,  27}, {  38,  28}, {  37,  29}, {  37,  30}, {  36,  31}, {  35,  32}, {  34,  33},
-    {  33,  33}, {  33,  34}, {  32,  35}, {  31,  36}, {  30,  37}, {  29,  37}, {  28,  38}, {  27,  39},
-    {  26,  39}, {  25,  40}, {  24,  41}, {  23,  41}, {  22,  42}, {  21,  42}, {  20,  43}, {  19,  43},
-    {  18,  44}, {  17,  44}, {  16,  45}, {  15,  45}, {  13,  45}, {  12,  46}, {  11,  46}, {  10,  46},
-    {   9,  47}, {   8,  47}, {   7,  47}, {   5,  47}, {   4,  47}, {   3,  47}, {   2,  47}, {   1,  47}
-  },
-  {  // x,y for mag=49 and nra=0:63
-    {  49,   0}, {  48,   1}, {  48,   2}, {  48,   3}, {  48,   4}, {  48,   5}, {  48,   7}, {  48,   8},
-    {  48,   9}, {  47,  10}, {  47,  11}, {  47,  13}, {  46,  14}, {  46,  15}, {  46,  16}, {  45,  17},
-    {  45,  18}, {  44,  19}, {  44,  20}, {  43,  22}, {  43,  23}, {  42,  24}, {  42,  25}, {  41,  26},
-    {  40,  27}, {  40,  28}, {  39,  29}, {  38,  30}, {  37,  31}, {  37,  32}, {  36,  32}, {  35,  33},
-    {  34,  34}, {  33,  35}, {  32,  36}, {  32,  37}, {  31,  37}, {  30,  38}, {  29,  39}, {  28,  40},
-    {  27,  40}, {  26,  41}, {  25,  42}, {  24,  42}, {  23,  43}, {  22,  43}, {  20,  44}, {  19,  44},
-    {  18,  45}, {  17,  45}, {  16,  46}, {  15,  46}, {  14,  46}, {  13,  47}, {  11,  47}, {  10,  47},
-    {   9,  48}, {   8,  48}, {   7,  48}, {   5,  48}, {   4,  48}, {   3,  48}, {   2,  48}, {   1,  48}
-  },
-  {  // x,y for mag=50 and nra=0:63
-    {  50,   0}, {  49,   1}, {  49,   2}, {  49,   3}, {  49,   4}, {  49,   6}, {  49,   7}, {  49,   8},
-    {  49,   9}, {  48,  10}, {  48,  12}, {  48,  13}, {  47,  14}, {  47,  15}, {  47,  16}, {  46,  17},
-    {  46,  19}, {  45,  20}, {  45,  21}, {  44,  22}, {  44,  23}, {  43,  24}, {  42,  25}, {  42,  26},
-    {  41,  27}, {  40,  28}, {  40,  29}, {  39,  30}, {  38,  31}, {  37,  32}, {  37,  33}, {  36,  34},
-    {  35,  35}, {  34,  36}, {  33,  37}, {  32,  37}, {  31,  38}, {  30,  39}, {  29,  40}, {  28,  40},
-    {  27,  41}, {  26,  42}, {  25,  42}, {  24,  43}, {  23,  44}, {  22,  44}, {  21,  45}, {  20,  45},
-    {  19,  46}, {  17,  46}, {  16,  47}, {  15,  47}, {  14,  47}, {  13,  48}, {  12,  48}, {  10,  48},
-    {   9,  49}, {   8,  49}, {   7,  49}, {   6,  49}, {   4,  49}, {   3,  49}, {   2,  49}, {   1,  49}
-  },
-  {  // x,y for mag=51 and nra=0:63
-    {  51,   0}, {  50,   1}, {  50,   2}, {  50,   3}, {  50,   4}, {  50,   6}, {  50,   7}, {  50,   8},
-    {  50,   9}, {  49,  11}, {  49,  12}, {  49,  13}, {  48,  14}, {  48,  15}, {  48,  17}, {  47,  18},
-    {  47,  19}, {  46,  20}, {  46,  21}, {  45,  22}, {  44,  24}, {  44,  25}, {  43,  26}, {  43,  27},
-    {  42,  28}, {  41,  29}, {  40,  30}, {  40,  31}, {  39,  32}, {  38,  33}, {  37,  34}, {  36,  35},
-    {  36,  36}, {  35,  36}, {  34,  37}, {  33,  38}, {  32,  39}, {  31,  40}, {  30,  40}, {  29,  41},
-    {  28,  42}, {  27,  43}, {  26,  43}, {  25,  44}, {  24,  44}, {  22,  45}, {  21,  46}, {  20,  46},
-    {  19,  47}, {  18,  47}, {  17,  48}, {  15,  48}, {  14,  48}, {  13,  49}, {  12,  49}, {  11,  49},
-    {   9,  50}, {   8,  50}, {   7,  50}, {   6,  50}, {   4,  50}, {   3,  50}, {   2,  50}, {   1,  50}
-  },
-  {  // x,y for mag=52 and nra=0:63
-    {  52,   0}, {  51,   1}, {  51,   2}, {  51,   3}, {  51,   5}, {  51,   6}, {  51,   7}, {  51,   8},
-    {  51,  10}, {  50,  11}, {  50,  12}, {  50,  13}, {  49,  15}, {  49,  16}, {  48,  17}, {  48,  18},
-    {  48,  19}, {  47,  21}, {  47,  22}, {  46,  23}, {  45,  24}, {  45,  25}, {  44,  26}, {  43,  27},
-    {  43,  28}, {  42,  29}, {  41,  30}, {  40,  31}, {  40,  32}, {  39,  33}, {  38,  34}, {  37,  35},
-    {  36,  36}, {  35,  37}, {  34,  38}, {  33,  39}, {  32,  40}, {  31,  40}, {  30,  41}, {  29,  42},
-    {  28,  43}, {  27,  43}, {  26,  44}, {  25,  45}, {  24,  45}, {  23,  46}, {  22,  47}, {  21,  47},
-    {  19,  48}, {  18,  48}, {  17,  48}, {  16,  49}, {  15,  49}, {  13,  50}, {  12,  50}, {  11,  50},
-    {  10,  51}, {   8,  51}, {   7,  51}, {   6,  51}, {   5,  51}, {   3,  51}, {   2,  51}, {   1,  51}
-  },
-  {  // x,y for mag=53 and nra=0:63
-    {  53,   0}, {  52,   1}, {  52,   2}, {  52,   3}, {  52,   5}, {  52,   6}, {  52,   7}, {  52,   9},
-    {  51,  10}, {  51,  11}, {  51,  12}, {  51,  14}, {  50,  15}, {  50,  16}, {  49,  17}, {  49,  19},
-    {  48,  20}, {  48,  21}, {  47,  22}, {  47,  23}, {  46,  24}, {  46,  26}, {  45,  27}, {  44,  28},
-    {  44,  29}, {  43,  30}, {  42,  31}, {  41,  32}, {  40,  33}, {  40,  34}, {  39,  35}, {  38,  36},
-    {  37,  37}, {  36,  38}, {  35,  39}, {  34,  40}, {  33,  40}, {  32,  41}, {  31,  42}, {  30,  43},
-    {  29,  44}, {  28,  44}, {  27,  45}, {  26,  46}, {  24,  46}, {  23,  47}, {  22,  47}, {  21,  48},
-    {  20,  48}, {  19,  49}, {  17,  49}, {  16,  50}, {  15,  50}, {  14,  51}, {  12,  51}, {  11,  51},
-    {  10,  51}, {   9,  52}, {   7,  52}, {   6,  52}, {   5,  52}, {   3,  52}, {   2,  52}, {   1,  52}
-  },
-  {  // x,y for mag=54 and nra=0:63
-    {  54,   0}, {  53,   1}, {  53,   2}, {  53,   3}, {  53,   5}, {  53,   6}, {  53,   7}, {  53,   9},
-    {  52,  10}, {  52,  11}, {  52,  13}, {  52,  14}, {  51,  15}, {  51,  16}, {  50,  18}, {  50,  19},
-    {  49,  20}, {  49,  21}, {  48,  23}, {  48,  24}, {  47,  25}, {  46,  26}, {  46,  27}, {  45,  28},
-    {  44,  30}, {  44,  31}, {  43,  32}, {  42,  33}, {  41,  34}, {  40,  35}, {  40,  36}, {  39,  37},
-    {  38,  38}, {  37,  39}, {  36,  40}, {  35,  40}, {  34,  41}, {  33,  42}, {  32,  43}, {  31,  44},
-    {  30,  44}, {  28,  45}, {  27,  46}, {  26,  46}, {  25,  47}, {  24,  48}, {  23,  48}, {  21,  49},
-    {  20,  49}, {  19,  50}, {  18,  50}, {  16,  51}, {  15,  51}, {  14,  52}, {  13,  52}, {  11,  52},
-    {  10,  52}, {   9,  53}, {   7,  53}, {   6,  53}, {   5,  53}, {   3,  53}, {   2,  53}, {   1,  53}
-  },
-  {  // x,y for mag=55 and nra=0:63
-    {  55,   0}, {  54,   1}, {  54,   2}, {  54,   4}, {  54,   5}, {  54,   6}, {  54,   8}, {  54,   9},
-    {  53,  10}, {  53,  12}, {  53,  13}, {  53,  14}, {  52,  15}, {  52,  17}, {  51,  18}, {  51,  19},
-    {  50,  21}, {  50,  22}, {  49,  23}, {  49,  24}, {  48,  25}, {  47,  27}, {  47,  28}, {  46,  29},
-    {  45,  30}, {  44,  31}, {  44,  32}, {  43,  33}, {  42,  34}, {  41,  35}, {  40,  36}, {  39,  37},
-    {  38,  38}, {  37,  39}, {  36,  40}, {  35,  41}, {  34,  42}, {  33,  43}, {  32,  44}, {  31,  44},
-    {  30,  45}, {  29,  46}, {  28,  47}, {  27,  47}, {  25,  48}, {  24,  49}, {  23,  49}, {  22,  50},
-    {  21,  50}, {  19,  51}, {  18,  51}, {  17,  52}, {  15,  52}, {  14,  53}, {  13,  53}, {  12,  53},
-    {  10,  53}, {   9,  54}, {   8,  54}, {   6,  54}, {   5,  54}, {   4,  54}, {   2,  54}, {   1,  54}
-  },
-  {  // x,y for mag=56 and nra=0:63
-    {  56,   0}, {  55,   1}, {  55,   2}, {  55,   4}, {  55,   5}, {  55,   6}, {  55,   8}, {  55,   9},
-    {  54,  10}, {  54,  12}, {  54,  13}, {  53,  14}, {  53,  16}, {  53,  17}, {  52,  18}, {  52,  20},
-    {  51,  21}, {  51,  22}, {  50,  23}, {  50,  25}, {  49,  26}, {  48,  27}, {  48,  28}, {  47,  29},
-    {  46,  31}, {  45,  32}, {  44,  33}, {  44,  34}, {  43,  35}, {  42,  36}, {  41,  37}, {  40,  38},
-    {  39,  39}, {  38,  40}, {  37,  41}, {  36,  42}, {  35,  43}, {  34,  44}, {  33,  44}, {  32,  45},
-    {  31,  46}, {  29,  47}, {  28,  48}, {  27,  48}, {  26,  49}, {  25,  50}, {  23,  50}, {  22,  51},
-    {  21,  51}, {  20,  52}, {  18,  52}, {  17,  53}, {  16,  53}, {  14,  53}, {  13,  54}, {  12,  54},
-    {  10,  54}, {   9,  55}, {   8,  55}, {   6,  55}, {   5,  55}, {   4,  55}, {   2,  55}, {   1,  55}
-  },
-  {  // x,y for mag=57 and nra=0:63
-    {  57,   0}, {  56,   1}, {  56,   2}, {  56,   4}, {  56,   5}, {  56,   6}, {  56,   8}, {  56,   9},
-    {  55,  11}, {  55,  12}, {  55,  13}, {  54,  15}, {  54,  16}, {  54,  17}, {  53,  19}, {  53,  20},
-    {  52,  21}, {  52,  23}, {  51,  24}, {  50,  25}, {  50,  26}, {  49,  28}, {  48,  29}, {  48,  30},
-    {  47,  31}, {  46,  32}, {  45,  33}, {  44,  35}, {  44,  36}, {  43,  37}, {  42,  38}, {  41,  39},
-    {  40,  40}, {  39,  41}, {  38,  42}, {  37,  43}, {  36,  44}, {  35,  44}, {  33,  45}, {  32,  46},
-    {  31,  47}, {  30,  48}, {  29,  48}, {  28,  49}, {  26,  50}, {  25,  50}, {  24,  51}, {  23,  52},
-    {  21,  52}, {  20,  53}, {  19,  53}, {  17,  54}, {  16,  54}, {  15,  54}, {  13,  55}, {  12,  55},
-    {  11,  55}, {   9,  56}, {   8,  56}, {   6,  56}, {   5,  56}, {   4,  56}, {   2,  56}, {   1,  56}
-  },
-  {  // x,y for mag=58 and nra=0:63
-    {  58,   0}, {  57,   1}, {  57,   2}, {  57,   4}, {  57,   5}, {  57,   7}, {  57,   8}, {  57,   9},
-    {  56,  11}, {  56,  12}, {  56,  14}, {  55,  15}, {  55,  16}, {  55,  18}, {  54,  19}, {  54,  20},
-    {  53,  22}, {  53,  23}, {  52,  24}, {  51,  26}, {  51,  27}, {  50,  28}, {  49,  29}, {  49,  31},
-    {  48,  32}, {  47,  33}, {  46,  34}, {  45,  35}, {  44,  36}, {  43,  37}, {  42,  38}, {  42,  39},
-    {  41,  41}, {  39,  42}, {  38,  42}, {  37,  43}, {  36,  44}, {  35,  45}, {  34,  46}, {  33,  47},
-    {  32,  48}, {  31,  49}, {  29,  49}, {  28,  50}, {  27,  51}, {  26,  51}, {  24,  52}, {  23,  53},
-    {  22,  53}, {  20,  54}, {  19,  54}, {  18,  55}, {  16,  55}, {  15,  55}, {  14,  56}, {  12,  56},
-    {  11,  56}, {   9,  57}, {   8,  57}, {   7,  57}, {   5,  57}, {   4,  57}, {   2,  57}, {   1,  57}
-  },
-  {  // x,y for mag=59 and nra=0:63
-    {  59,   0}, {  58,   1}, {  58,   2}, {  58,   4}, {  58,   5}, {  58,   7}, {  58,   8}, {  58,  10},
-    {  57,  11}, {  57,  12}, {  57,  14}, {  56,  15}, {  56,  17}, {  56,  18}, {  55,  19}, {  55,  21},
-    {  54,  22}, {  53,  23}, {  53,  25}, {  52,  26}, {  52,  27}, {  51,  29}, {  50,  30}, {  49,  31},
-    {  49,  32}, {  48,  33}, {  47,  35}, {  46,  36}, {  45,  37}, {  44,  38}, {  43,  39}, {  42,  40},
-    {  41,  41}, {  40,  42}, {  39,  43}, {  38,  44}, {  37,  45}, {  36,  46}, {  35,  47}, {  33,  48},
-    {  32,  49}, {  31,  49}, {  30,  50}, {  29,  51}, {  27,  52}, {  26,  52}, {  25,  53}, {  23,  53},
-    {  22,  54}, {  21,  55}, {  19,  55}, {  18,  56}, {  17,  56}, {  15,  56}, {  14,  57}, {  12,  57},
-    {  11,  57}, {  10,  58}, {   8,  58}, {   7,  58}, {   5,  58}, {   4,  58}, {   2,  58}, {   1,  58}
-  },
-  {  // x,y for mag=60 and nra=0:63
-    {  60,   0}, {  59,   1}, {  59,   2}, {  59,   4}, {  59,   5}, {  59,   7}, {  59,   8}, {  59,  10},
-    {  58,  11}, {  58,  13}, {  58,  14}, {  57,  16}, {  57,  17}, {  56,  18}, {  56,  20}, {  55,  21},
-    {  55,  22}, {  54,  24}, {  54,  25}, {  53,  26}, {  52,  28}, {  52,  29}, {  51,  30}, {  50,  32},
-    {  49,  33}, {  49,  34}, {  48,  35}, {  47,  36}, {  46,  38}, {  45,  39}, {  44,  40}, {  43,  41},
-    {  42,  42}, {  41,  43}, {  40,  44}, {  39,  45}, {  38,  46}, {  36,  47}, {  35,  48}, {  34,  49},
-    {  33,  49}, {  32,  50}, {  30,  51}, {  29,  52}, {  28,  52}, {  26,  53}, {  25,  54}, {  24,  54},
-    {  22,  55}, {  21,  55}, {  20,  56}, {  18,  56}, {  17,  57}, {  16,  57}, {  14,  58}, {  13,  58},
-    {  11,  58}, {  10,  59}, {   8,  59}, {   7,  59}, {   5,  59}, {   4,  59}, {   2,  59}, {   1,  59}
-  },
-  {  // x,y for mag=61 and nra=0:63
-    {  61,   0}, {  60,   1}, {  60,   2}, {  60,   4}, {  60,   5}, {  60,   7}, {  60,   8}, {  60,  10},
-    {  59,  11}, {  59,  13}, {  59,  14}, {  58,  16}, {  58,  17}, {  57,  19}, {  57,  20}, {  56,  21},
-    {  56,  23}, {  55,  24}, {  55,  26}, {  54,  27}, {  53,  28}, {  53,  30}, {  52,  31}, {  51,  32},
-    {  50,  33}, {  49,  35}, {  48,  36}, {  48,  37}, {  47,  38}, {  46,  39}, {  45,  40}, {  44,  42},
-    {  43,  43}, {  42,  44}, {  40,  45}, {  39,  46}, {  38,  47}, {  37,  48}, {  36,  48}, {  35,  49},
-    {  33,  50}, {  32,  51}, {  31,  52}, {  30,  53}, {  28,  53}, {  27,  54}, {  26,  55}, {  24,  55},
-    {  23,  56}, {  21,  56}, {  20,  57}, {  19,  57}, {  17,  58}, {  16,  58}, {  14,  59}, {  13,  59},
-    {  11,  59}, {  10,  60}, {   8,  60}, {   7,  60}, {   5,  60}, {   4,  60}, {   2,  60}, {   1,  60}
-  },
-  {  // x,y for mag=62 and nra=0:63
-    {  62,   0}, {  61,   1}, {  61,   3}, {  61,   4}, {  61,   6}, {  61,   7}, {  61,   9}, {  61,  10},
-    {  60,  12}, {  60,  13}, {  60,  15}, {  59,  16}, {  59,  17}, {  58,  19}, {  58,  20}, {  57,  22},
-    {  57,  23}, {  56,  25}, {  56,  26}, {  55,  27}, {  54,  29}, {  53,  30}, {  53,  31}, {  52,  33},
-    {  51,  34}, {  50,  35}, {  49,  36}, {  48,  38}, {  47,  39}, {  46,  40}, {  45,  41}, {  44,  42},
-    {  43,  43}, {  42,  44}, {  41,  45}, {  40,  46}, {  39,  47}, {  38,  48}, {  36,  49}, {  35,  50},
-    {  34,  51}, {  33,  52}, {  31,  53}, {  30,  53}, {  29,  54}, {  27,  55}, {  26,  56}, {  25,  56},
-    {  23,  57}, {  22,  57}, {  20,  58}, {  19,  58}, {  17,  59}, {  16,  59}, {  15,  60}, {  13,  60},
-    {  12,  60}, {  10,  61}, {   9,  61}, {   7,  61}, {   6,  61}, {   4,  61}, {   3,  61}, {   1,  61}
-  },
-  {  // x,y for mag=63 and nra=0:63
-    {  63,   0}, {  62,   1}, {  62,   3}, {  62,   4}, {  62,   6}, {  62,   7}, {  62,   9}, {  62,  10},
-    {  61,  12}, {  61,  13}, {  61,  15}, {  60,  16}, {  60,  18}, {  59,  19}, {  59,  21}, {  58,  22},
-    {  58,  24}, {  57,  25}, {  56,  26}, {  56,  28}, {  55,  29}, {  54,  31}, {  54,  32}, {  53,  33},
-    {  52,  35}, {  51,  36}, {  50,  37}, {  49,  38}, {  48,  39}, {  47,  41}, {  46,  42}, {  45,  43},
-    {  44,  44}, {  43,  45}, {  42,  46}, {  41,  47}, {  39,  48}, {  38,  49}, {  37,  50}, {  36,  51},
-    {  35,  52}, {  33,  53}, {  32,  54}, {  31,  54}, {  29,  55}, {  28,  56}, {  26,  56}, {  25,  57},
-    {  24,  58}, {  22,  58}, {  21,  59}, {  19,  59}, {  18,  60}, {  16,  60}, {  15,  61}, {  13,  61},
-    {  12,  61}, {  10,  62}, {   9,  62}, {   7,  62}, {   6,  62}, {   4,  62}, {   3,  62}, {   1,  62}
-  },
-  {  // x,y for mag=64 and nra=0:63
-    {  64,   0}, {  63,   1}, {  63,   3}, {  63,   4}, {  63,   6}, {  63,   7}, {  63,   9}, {  63,  10},
-    {  62,  12}, {  62,  14}, {  62,  15}, {  61,  17}, {  61,  18}, {  60,  20}, {  60,  21}, {  59,  23},
-    {  59,  24}, {  58,  25}, {  57,  27}, {  57,  28}, {  56,  30}, {  55,  31}, {  54,  32}, {  54,  34},
-    {  53,  35}, {  52,  36}, {  51,  38}, {  50,  39}, {  49,  40}, {  48,  41}, {  47,  42}, {  46,  44},
-    {  45,  45}, {  44,  46}, {  42,  47}, {  41,  48}, {  40,  49}, {  39,  50}, {  38,  51}, {  36,  52},
-    {  35,  53}, {  34,  54}, {  32,  54}, {  31,  55}, {  30,  56}, {  28,  57}, {  27,  57}, {  25,  58},
-    {  24,  59}, {  23,  59}, {  21,  60}, {  20,  60}, {  18,  61}, {  17,  61}, {  15,  62}, {  14,  62},
-    {  12,  62}, {  10,  63}, {   9,  63}, {   7,  63}, {   6,  63}, {   4,  63}, {   3,  63}, {   1,  63}
-  },
-  {  // x,y for mag=65 and nra=0:63
-    {  65,   0}, {  64,   1}, {  64,   3}, {  64,   4}, {  64,   6}, {  64,   7}, {  64,   9}, {  64,  11},
-    {  63,  12}, {  63,  14}, {  63,  15}, {  62,  17}, {  62,  18}, {  61,  20}, {  61,  21}, {  60,  23},
-    {  60,  24}, {  59,  26}, {  58,  27}, {  58,  29}, {  57,  30}, {  56,  32}, {  55,  33}, {  54,  34},
-    {  54,  36}, {  53,  37}, {  52,  38}, {  51,  39}, {  50,  41}, {  49,  42}, {  48,  43}, {  47,  44},
-    {  45,  45}, {  44,  47}, {  43,  48}, {  42,  49}, {  41,  50}, {  39,  51}, {  38,  52}, {  37,  53},
-    {  36,  54}, {  34,  54}, {  33,  55}, {  32,  56}, {  30,  57}, {  29,  58}, {  27,  58}, {  26,  59},
-    {  24,  60}, {  23,  60}, {  21,  61}, {  20,  61}, {  18,  62}, {  17,  62}, {  15,  63}, {  14,  63},
-    {  12,  63}, {  11,  64}, {   9,  64}, {   7,  64}, {   6,  64}, {   4,  64}, {   3,  64}, {   1,  64}
-  },
-  {  // x,y for mag=66 and nra=0:63
-    {  66,   0}, {  65,   1}, {  65,   3}, {  65,   4}, {  65,   6}, {  65,   8}, {  65,   9}, {  65,  11},
-    {  64,  12}, {  64,  14}, {  64,  16}, {  63,  17}, {  63,  19}, {  62,  20}, {  62,  22}, {  61,  23},
-    {  60,  25}, {  60,  26}, {  59,  28}, {  58,  29}, {  58,  31}, {  57,  32}, {  56,  33}, {  55,  35},
-    {  54,  36}, {  53,  38}, {  53,  39}, {  52,  40}, {  51,  41}, {  49,  43}, {  48,  44}, {  47,  45},
-    {  46,  46}, {  45,  47}, {  44,  48}, {  43,  49}, {  41,  51}, {  40,  52}, {  39,  53}, {  38,  53},
-    {  36,  54}, {  35,  55}, {  33,  56}, {  32,  57}, {  31,  58}, {  29,  58}, {  28,  59}, {  26,  60},
-    {  25,  60}, {  23,  61}, {  22,  62}, {  20,  62}, {  19,  63}, {  17,  63}, {  16,  64}, {  14,  64},
-    {  12,  64}, {  11,  65}, {   9,  65}, {   8,  65}, {   6,  65}, {   4,  65}, {   3,  65}, {   1,  65}
-  },
-  {  // x,y for mag=67 and nra=0:63
-    {  67,   0}, {  66,   1}, {  66,   3}, {  66,   4}, {  66,   6}, {  66,   8}, {  66,   9}, {  66,  11},
-    {  65,  13}, {  65,  14}, {  64,  16}, {  64,  17}, {  64,  19}, {  63,  21}, {  63,  22}, {  62,  24},
-    {  61,  25}, {  61,  27}, {  60,  28}, {  59,  30}, {  59,  31}, {  58,  33}, {  57,  34}, {  56,  35},
-    {  55,  37}, {  54,  38}, {  53,  39}, {  52,  41}, {  51,  42}, {  50,  43}, {  49,  44}, {  48,  46},
-    {  47,  47}, {  46,  48}, {  44,  49}, {  43,  50}, {  42,  51}, {  41,  52}, {  39,  53}, {  38,  54},
-    {  37,  55}, {  35,  56}, {  34,  57}, {  33,  58}, {  31,  59}, {  30,  59}, {  28,  60}, {  27,  61},
-    {  25,  61}, {  24,  62}, {  22,  63}, {  21,  63}, {  19,  64}, {  17,  64}, {  16,  64}, {  14,  65},
-    {  13,  65}, {  11,  66}, {   9,  66}, {   8,  66}, {   6,  66}, {   4,  66}, {   3,  66}, {   1,  66}
-  },
-  {  // x,y for mag=68 and nra=0:63
-    {  68,   0}, {  67,   1}, {  67,   3}, {  67,   5}, {  67,   6}, {  67,   8}, {  67,   9}, {  66,  11},
-    {  66,  13}, {  66,  14}, {  65,  16}, {  65,  18}, {  65,  19}, {  64,  21}, {  64,  22}, {  63,  24},
-    {  62,  26}, {  62,  27}, {  61,  29}, {  60,  30}, {  59,  32}, {  59,  33}, {  58,  34}, {  57,  36},
-    {  56,  37}, {  55,  39}, {  54,  40}, {  53,  41}, {  52,  43}, {  51,  44}, {  50,  45}, {  49,  46},
-    {  48,  48}, {  46,  49}, {  45,  50}, {  44,  51}, {  43,  52}, {  41,  53}, {  40,  54}, {  39,  55},
-    {  37,  56}, {  36,  57}, {  34,  58}, {  33,  59}, {  32,  59}, {  30,  60}, {  29,  61}, {  27,  62},
-    {  26,  62}, {  24,  63}, {  22,  64}, {  21,  64}, {  19,  65}, {  18,  65}, {  16,  65}, {  14,  66},
-    {  13,  66}, {  11,  66}, {   9,  67}, {   8,  67}, {   6,  67}, {   5,  67}, {   3,  67}, {   1,  67}
-  },
-  {  // x,y for mag=69 and nra=0:63
-    {  69,   0}, {  68,   1}, {  68,   3}, {  68,   5}, {  68,   6}, {  68,   8}, {  68,  10}, {  67,  11},
-    {  67,  13}, {  67,  15}, {  66,  16}, {  66,  18}, {  66,  20}, {  65,  21}, {  64,  23}, {  64,  24},
-    {  63,  26}, {  63,  27}, {  62,  29}, {  61,  31}, {  60,  32}, {  60,  34}, {  59,  35}, {  58,  36},
-    {  57,  38}, {  56,  39}, {  55,  41}, {  54,  42}, {  53,  43}, {  52,  45}, {  51,  46}, {  49,  47},
-    {  48,  48}, {  47,  49}, {  46,  51}, {  45,  52}, {  43,  53}, {  42,  54}, {  41,  55}, {  39,  56},
-    {  38,  57}, {  36,  58}, {  35,  59}, {  34,  60}, {  32,  60}, {  31,  61}, {  29,  62}, {  27,  63},
-    {  26,  63}, {  24,  64}, {  23,  64}, {  21,  65}, {  20,  66}, {  18,  66}, {  16,  66}, {  15,  67},
-    {  13,  67}, {  11,  67}, {  10,  68}, {   8,  68}, {   6,  68}, {   5,  68}, {   3,  68}, {   1,  68}
-  },
-  {  // x,y for mag=70 and nra=0:63
-    {  70,   0}, {  69,   1}, {  69,   3}, {  69,   5}, {  69,   6}, {  69,   8}, {  69,  10}, {  68,  11},
-    {  68,  13}, {  68,  15}, {  67,  17}, {  67,  18}, {  66,  20}, {  66,  21}, {  65,  23}, {  65,  25},
-    {  64,  26}, {  63,  28}, {  63,  29}, {  62,  31}, {  61,  32}, {  60,  34}, {  60,  35}, {  59,  37},
-    {  58,  38}, {  57,  40}, {  56,  41}, {  55,  43}, {  54,  44}, {  53,  45}, {  51,  47}, {  50,  48},
-    {  49,  49}, {  48,  50}, {  47,  51}, {  45,  53}, {  44,  54}, {  43,  55}, {  41,  56}, {  40,  57},
-    {  38,  58}, {  37,  59}, {  35,  60}, {  34,  60}, {  32,  61}, {  31,  62}, {  29,  63}, {  28,  63},
-    {  26,  64}, {  25,  65}, {  23,  65}, {  21,  66}, {  20,  66}, {  18,  67}, {  17,  67}, {  15,  68},
-    {  13,  68}, {  11,  68}, {  10,  69}, {   8,  69}, {   6,  69}, {   5,  69}, {   3,  69}, {   1,  69}
-  },
-  {  // x,y for mag=71 and nra=0:63
-    {  71,   0}, {  70,   1}, {  70,   3}, {  70,   5}, {  70,   6}, {  70,   8}, {  70,  10}, {  69,  12},
-    {  69,  13}, {  69,  15}, {  68,  17}, {  68,  18}, {  67,  20}, {  67,  22}, {  66,  23}, {  66,  25},
-    {  65,  27}, {  64,  28}, {  64,  30}, {  63,  31}, {  62,  33}, {  61,  34}, {  60,  36}, {  59,  37},
-    {  59,  39}, {  58,  40}, {  57,  42}, {  55,  43}, {  54,  45}, {  53,  46}, {  52,  47}, {  51,  48},
-    {  50,  50}, {  48,  51}, {  47,  52}, {  46,  53}, {  45,  54}, {  43,  55}, {  42,  57}, {  40,  58},
-    {  39,  59}, {  37,  59}, {  36,  60}, {  34,  61}, {  33,  62}, {  31,  63}, {  30,  64}, {  28,  64},
-    {  27,  65}, {  25,  66}, {  23,  66}, {  22,  67}, {  20,  67}, {  18,  68}, {  17,  68}, {  15,  69},
-    {  13,  69}, {  12,  69}, {  10,  70}, {   8,  70}, {   6,  70}, {   5,  70}, {   3,  70}, {   1,  70}
-  },
-  {  // x,y for mag=72 and nra=0:63
-    {  72,   0}, {  71,   1}, {  71,   3}, {  71,   5}, {  71,   7}, {  71,   8}, {  71,  10}, {  70,  12},
-    {  70,  14}, {  70,  15}, {  69,  17}, {  69,  19}, {  68,  20}, {  68,  22}, {  67,  24}, {  67,  25},
-    {  66,  27}, {  65,  29}, {  65,  30}, {  64,  32}, {  63,  33}, {  62,  35}, {  61,  37}, {  60,  38},
-    {  59,  40}, {  58,  41}, {  57,  42}, {  56,  44}, {  55,  45}, {  54,  47}, {  53,  48}, {  52,  49},
-    {  50,  50}, {  49,  52}, {  48,  53}, {  47,  54}, {  45,  55}, {  44,  56}, {  42,  57}, {  41,  58},
-    {  40,  59}, {  38,  60}, {  37,  61}, {  35,  62}, {  33,  63}, {  32,  64}, {  30,  65}, {  29,  65},
-    {  27,  66}, {  25,  67}, {  24,  67}, {  22,  68}, {  20,  68}, {  19,  69}, {  17,  69}, {  15,  70},
-    {  14,  70}, {  12,  70}, {  10,  71}, {   8,  71}, {   7,  71}, {   5,  71}, {   3,  71}, {   1,  71}
-  },
-  {  // x,y for mag=73 and nra=0:63
-    {  73,   0}, {  72,   1}, {  72,   3}, {  72,   5}, {  72,   7}, {  72,   8}, {  72,  10}, {  71,  12},
-    {  71,  14}, {  71,  15}, {  70,  17}, {  70,  19}, {  69,  21}, {  69,  22}, {  68,  24}, {  68,  26},
-    {  67,  27}, {  66,  29}, {  65,  31}, {  65,  32}, {  64,  34}, {  63,  35}, {  62,  37}, {  61,  39},
-    {  60,  40}, {  59,  42}, {  58,  43}, {  57,  44}, {  56,  46}, {  55,  47}, {  54,  49}, {  52,  50},
-    {  51,  51}, {  50,  52}, {  49,  54}, {  47,  55}, {  46,  56}, {  44,  57}, {  43,  58}, {  42,  59},
-    {  40,  60}, {  39,  61}, {  37,  62}, {  35,  63}, {  34,  64}, {  32,  65}, {  31,  65}, {  29,  66},
-    {  27,  67}, {  26,  68}, {  24,  68}, {  22,  69}, {  21,  69}, {  19,  70}, {  17,  70}, {  15,  71},
-    {  14,  71}, {  12,  71}, {  10,  72}, {   8,  72}, {   7,  72}, {   5,  72}, {   3,  72}, {   1,  72}
-  },
-  {  // x,y for mag=74 and nra=0:63
-    {  74,   0}, {  73,   1}, {  73,   3}, {  73,   5}, {  73,   7}, {  73,   9}, {  73,  10}, {  72,  12},
-    {  72,  14}, {  72,  16}, {  71,  17}, {  71,  19}, {  70,  21}, {  70,  23}, {  69,  24}, {  69,  26},
-    {  68,  28}, {  67,  29}, {  66,  31}, {  66,  33}, {  65,  34}, {  64,  36}, {  63,  38}, {  62,  39},
-    {  61,  41}, {  60,  42}, {  59,  44}, {  58,  45}, {  57,  46}, {  56,  48}, {  54,  49}, {  53,  51},
-    {  52,  52}, {  51,  53}, {  49,  54}, {  48,  56}, {  46,  57}, {  45,  58}, {  44,  59}, {  42,  60},
-    {  41,  61}, {  39,  62}, {  38,  63}, {  36,  64}, {  34,  65}, {  33,  66}, {  31,  66}, {  29,  67},
-    {  28,  68}, {  26,  69}, {  24,  69}, {  23,  70}, {  21,  70}, {  19,  71}, {  17,  71}, {  16,  72},
-    {  14,  72}, {  12,  72}, {  10,  73}, {   9,  73}, {   7,  73}, {   5,  73}, {   3,  73}, {   1,  73}
-  },
-  {  // x,y for mag=75 and nra=0:63
-    {  75,   0}, {  74,   1}, {  74,   3}, {  74,   5}, {  74,   7}, {  74,   9}, {  74,  11}, {  73,  12},
-    {  73,  14}, {  73,  16}, {  72,  18}, {  72,  20}, {  71,  21}, {  71,  23}, {  70,  25}, {  69,  26},
-    {  69,  28}, {  68,  30}, {  67,  32}, {  66,  33}, {  66,  35}, {  65,  36}, {  64,  38}, {  63,  40},
-    {  62,  41}, {  61,  43}, {  60,  44}, {  59,  46}, {  57,  47}, {  56,  48}, {  55,  50}, {  54,  51},
-    {  53,  53}, {  51,  54}, {  50,  55}, {  48,  56}, {  47,  57}, {  46,  59}, {  44,  60}, {  43,  61},
-    {  41,  62}, {  40,  63}, {  38,  64}, {  36,  65}, {  35,  66}, {  33,  66}, {  32,  67}, {  30,  68},
-    {  28,  69}, {  26,  69}, {  25,  70}, {  23,  71}, {  21,  71}, {  20,  72}, {  18,  72}, {  16,  73},
-    {  14,  73}, {  12,  73}, {  11,  74}, {   9,  74}, {   7,  74}, {   5,  74}, {   3,  74}, {   1,  74}
-  },
-  {  // x,y for mag=76 and nra=0:63
-    {  76,   0}, {  75,   1}, {  75,   3}, {  75,   5}, {  75,   7}, {  75,   9}, {  75,  11}, {  74,  12},
-    {  74,  14}, {  74,  16}, {  73,  18}, {  73,  20}, {  72,  22}, {  72,  23}, {  71,  25}, {  70,  27},
-    {  70,  29}, {  69,  30}, {  68,  32}, {  67,  34}, {  67,  35}, {  66,  37}, {  65,  39}, {  64,  40},
-    {  63,  42}, {  62,  43}, {  61,  45}, {  59,  46}, {  58,  48}, {  57,  49}, {  56,  51}, {  55,  52},
-    {  53,  53}, {  52,  55}, {  51,  56}, {  49,  57}, {  48,  58}, {  46,  59}, {  45,  61}, {  43,  62},
-    {  42,  63}, {  40,  64}, {  39,  65}, {  37,  66}, {  35,  67}, {  34,  67}, {  32,  68}, {  30,  69},
-    {  29,  70}, {  27,  70}, {  25,  71}, {  23,  72}, {  22,  72}, {  20,  73}, {  18,  73}, {  16,  74},
-    {  14,  74}, {  12,  74}, {  11,  75}, {   9,  75}, {   7,  75}, {   5,  75}, {   3,  75}, {   1,  75}
-  },
-  {  // x,y for mag=77 and nra=0:63
-    {  77,   0}, {  76,   1}, {  76,   3}, {  76,   5}, {  76,   7}, {  76,   9}, {  76,  11}, {  75,  13},
-    {  75,  15}, {  75,  16}, {  74,  18}, {  74,  20}, {  73,  22}, {  73,  24}, {  72,  25}, {  71,  27},
-    {  71,  29}, {  70,  31}, {  69,  32}, {  68,  34}, {  67,  36}, {  66,  37}, {  66,  39}, {  65,  41},
-    {  64,  42}, {  62,  44}, {  61,  45}, {  60,  47}, {  59,  48}, {  58,  50}, {  57,  51}, {  55,  53},
-    {  54,  54}, {  53,  55}, {  51,  57}, {  50,  58}, {  48,  59}, {  47,  60}, {  45,  61}, {  44,  62},
-    {  42,  64}, {  41,  65}, {  39,  66}, {  37,  66}, {  36,  67}, {  34,  68}, {  32,  69}, {  31,  70},
-    {  29,  71}, {  27,  71}, {  25,  72}, {  24,  73}, {  22,  73}, {  20,  74}, {  18,  74}, {  16,  75},
-    {  15,  75}, {  13,  75}, {  11,  76}, {   9,  76}, {   7,  76}, {   5,  76}, {   3,  76}, {   1,  76}
-  },
-  {  // x,y for mag=78 and nra=0:63
-    {  78,   0}, {  77,   1}, {  77,   3}, {  77,   5}, {  77,   7}, {  77,   9}, {  77,  11}, {  76,  13},
-    {  76,  15}, {  76,  17}, {  75,  18}, {  75,  20}, {  74,  22}, {  74,  24}, {  73,  26}, {  72,  28},
-    {  72,  29}, {  71,  31}, {  70,  33}, {  69,  35}, {  68,  36}, {  67,  38}, {  66,  40}, {  65,  41},
-    {  64,  43}, {  63,  44}, {  62,  46}, {  61,  47}, {  60,  49}, {  59,  50}, {  57,  52}, {  56,  53},
-    {  55,  55}, {  53,  56}, {  52,  57}, {  50,  59}, {  49,  60}, {  47,  61}, {  46,  62}, {  44,  63},
-    {  43,  64}, {  41,  65}, {  40,  66}, {  38,  67}, {  36,  68}, {  35,  69}, {  33,  70}, {  31,  71},
-    {  29,  72}, {  28,  72}, {  26,  73}, {  24,  74}, {  22,  74}, {  20,  75}, {  18,  75}, {  17,  76},
-    {  15,  76}, {  13,  76}, {  11,  77}, {   9,  77}, {   7,  77}, {   5,  77}, {   3,  77}, {   1,  77}
-  },
-  {  // x,y for mag=79 and nra=0:63
-    {  79,   0}, {  78,   1}, {  78,   3}, {  78,   5}, {  78,   7}, {  78,   9}, {  78,  11}, {  77,  13},
-    {  77,  15}, {  77,  17}, {  76,  19}, {  76,  21}, {  75,  22}, {  75,  24}, {  74,  26}, {  73,  28},
-    {  72,  30}, {  72,  32}, {  71,  33}, {  70,  35}, {  69,  37}, {  68,  38}, {  67,  40}, {  66,  42},
-    {  65,  43}, {  64,  45}, {  63,  47}, {  62,  48}, {  61,  50}, {  59,  51}, {  58,  53}, {  57,  54},
-    {  55,  55}, {  54,  57}, {  53,  58}, {  51,  59}, {  50,  61}, {  48,  62}, {  47,  63}, {  45,  64},
-    {  43,  65}, {  42,  66}, {  40,  67}, {  38,  68}, {  37,  69}, {  35,  70}, {  33,  71}, {  32,  72},
-    {  30,  72}, {  28,  73}, {  26,  74}, {  24,  75}, {  22,  75}, {  21,  76}, {  19,  76}, {  17,  77},
-    {  15,  77}, {  13,  77}, {  11,  78}, {   9,  78}, {   7,  78}, {   5,  78}, {   3,  78}, {   1,  78}
-  },
-  {  // x,y for mag=80 and nra=0:63
-    {  80,   0}, {  79,   1}, {  79,   3}, {  79,   5}, {  79,   7}, {  79,   9}, {  79,  11}, {  78,  13},
-    {  78,  15}, {  78,  17}, {  77,  19}, {  77,  21}, {  76,  23}, {  75,  25}, {  75,  26}, {  74,  28},
-    {  73,  30}, {  73,  32}, {  72,  34}, {  71,  35}, {  70,  37}, {  69,  39}, {  68,  41}, {  67,  42},
-    {  66,  44}, {  65,  46}, {  64,  47}, {  63,  49}, {  61,  50}, {  60,  52}, {  59,  53}, {  57,  55},
-    {  56,  56}, {  55,  57}, {  53,  59}, {  52,  60}, {  50,  61}, {  49,  63}, {  47,  64}, {  46,  65},
-    {  44,  66}, {  42,  67}, {  41,  68}, {  39,  69}, {  37,  70}, {  35,  71}, {  34,  72}, {  32,  73},
-    {  30,  73}, {  28,  74}, {  26,  75}, {  25,  75}, {  23,  76}, {  21,  77}, {  19,  77}, {  17,  78},
-    {  15,  78}, {  13,  78}, {  11,  79}, {   9,  79}, {   7,  79}, {   5,  79}, {   3,  79}, {   1,  79}
-  },
-  {  // x,y for mag=81 and nra=0:63
-    {  81,   0}, {  80,   1}, {  80,   3}, {  80,   5}, {  80,   7}, {  80,   9}, {  80,  11}, {  79,  13},
-    {  79,  15}, {  79,  17}, {  78,  19}, {  78,  21}, {  77,  23}, {  76,  25}, {  76,  27}, {  75,  29},
-    {  74,  30}, {  74,  32}, {  73,  34}, {  72,  36}, {  71,  38}, {  70,  39}, {  69,  41}, {  68,  43},
-    {  67,  45}, {  66,  46}, {  65,  48}, {  63,  49}, {  62,  51}, {  61,  52}, {  60,  54}, {  58,  55},
-    {  57,  57}, {  55,  58}, {  54,  60}, {  52,  61}, {  51,  62}, {  49,  63}, {  48,  65}, {  46,  66},
-    {  45,  67}, {  43,  68}, {  41,  69}, {  39,  70}, {  38,  71}, {  36,  72}, {  34,  73}, {  32,  74},
-    {  30,  74}, {  29,  75}, {  27,  76}, {  25,  76}, {  23,  77}, {  21,  78}, {  19,  78}, {  17,  79},
-    {  15,  79}, {  13,  79}, {  11,  80}, {   9,  80}, {   7,  80}, {   5,  80}, {   3,  80}, {   1,  80}
-  },
-  {  // x,y for mag=82 and nra=0:63
-    {  82,   0}, {  81,   2}, {  81,   4}, {  81,   6}, {  81,   8}, {  81,  10}, {  81,  12}, {  80,  14},
-    {  80,  15}, {  80,  17}, {  79,  19}, {  79,  21}, {  78,  23}, {  77,  25}, {  77,  27}, {  76,  29},
-    {  75,  31}, {  74,  33}, {  74,  35}, {  73,  36}, {  72,  38}, {  71,  40}, {  70,  42}, {  69,  43},
-    {  68,  45}, {  67,  47}, {  65,  48}, {  64,  50}, {  63,  52}, {  62,  53}, {  60,  55}, {  59,  56},
-    {  57,  57}, {  56,  59}, {  55,  60}, {  53,  62}, {  52,  63}, {  50,  64}, {  48,  65}, {  47,  67},
-    {  45,  68}, {  43,  69}, {  42,  70}, {  40,  71}, {  38,  72}, {  36,  73}, {  35,  74}, {  33,  74},
-    {  31,  75}, {  29,  76}, {  27,  77}, {  25,  77}, {  23,  78}, {  21,  79}, {  19,  79}, {  17,  80},
-    {  15,  80}, {  14,  80}, {  12,  81}, {  10,  81}, {   8,  81}, {   6,  81}, {   4,  81}, {   2,  81}
-  },
-  {  // x,y for mag=83 and nra=0:63
-    {  83,   0}, {  82,   2}, {  82,   4}, {  82,   6}, {  82,   8}, {  82,  10}, {  82,  12}, {  81,  14},
-    {  81,  16}, {  80,  18}, {  80,  20}, {  79,  22}, {  79,  24}, {  78,  26}, {  78,  27}, {  77,  29},
-    {  76,  31}, {  75,  33}, {  75,  35}, {  74,  37}, {  73,  39}, {  72,  40}, {  71,  42}, {  70,  44},
-    {  69,  46}, {  67,  47}, {  66,  49}, {  65,  51}, {  64,  52}, {  62,  54}, {  61,  55}, {  60,  57},
-    {  58,  58}, {  57,  60}, {  55,  61}, {  54,  62}, {  52,  64}, {  51,  65}, {  49,  66}, {  47,  67},
-    {  46,  69}, {  44,  70}, {  42,  71}, {  40,  72}, {  39,  73}, {  37,  74}, {  35,  75}, {  33,  75},
-    {  31,  76}, {  29,  77}, {  27,  78}, {  26,  78}, {  24,  79}, {  22,  79}, {  20,  80}, {  18,  80},
-    {  16,  81}, {  14,  81}, {  12,  82}, {  10,  82}, {   8,  82}, {   6,  82}, {   4,  82}, {   2,  82}
-  },
-  {  // x,y for mag=84 and nra=0:63
-    {  84,   0}, {  83,   2}, {  83,   4}, {  83,   6}, {  83,   8}, {  83,  10}, {  83,  12}, {  82,  14},
-    {  82,  16}, {  81,  18}, {  81,  20}, {  80,  22}, {  80,  24}, {  79,  26}, {  79,  28}, {  78,  30},
-    {  77,  32}, {  76,  34}, {  75,  35}, {  75,  37}, {  74,  39}, {  73,  41}, {  72,  43}, {  70,  44},
-    {  69,  46}, {  68,  48}, {  67,  50}, {  66,  51}, {  64,  53}, {  63,  54}, {  62,  56}, {  60,  57},
-    {  59,  59}, {  57,  60}, {  56,  62}, {  54,  63}, {  53,  64}, {  51,  66}, {  50,  67}, {  48,  68},
-    {  46,  69}, {  44,  70}, {  43,  72}, {  41,  73}, {  39,  74}, {  37,  75}, {  35,  75}, {  34,  76},
-    {  32,  77}, {  30,  78}, {  28,  79}, {  26,  79}, {  24,  80}, {  22,  80}, {  20,  81}, {  18,  81},
-    {  16,  82}, {  14,  82}, {  12,  83}, {  10,  83}, {   8,  83}, {   6,  83}, {   4,  83}, {   2,  83}
-  },
-  {  // x,y for mag=85 and nra=0:63
-    {  85,   0}, {  84,   2}, {  84,   4}, {  84,   6}, {  84,   8}, {  84,  10}, {  84,  12}, {  83,  14},
-    {  83,  16}, {  82,  18}, {  82,  20}, {  81,  22}, {  81,  24}, {  80,  26}, {  80,  28}, {  79,  30},
-    {  78,  32}, {  77,  34}, {  76,  36}, {  75,  38}, {  74,  40}, {  73,  41}, {  72,  43}, {  71,  45},
-    {  70,  47}, {  69,  48}, {  68,  50}, {  67,  52}, {  65,  53}, {  64,  55}, {  62,  57}, {  61,  58},
-    {  60,  60}, {  58,  61}, {  57,  62}, {  55,  64}, {  53,  65}, {  52,  67}, {  50,  68}, {  48,  69},
-    {  47,  70}, {  45,  71}, {  43,  72}, {  41,  73}, {  40,  74}, {  38,  75}, {  36,  76}, {  34,  77},
-    {  32,  78}, {  30,  79}, {  28,  80}, {  26,  80}, {  24,  81}, {  22,  81}, {  20,  82}, {  18,  82},
-    {  16,  83}, {  14,  83}, {  12,  84}, {  10,  84}, {   8,  84}, {   6,  84}, {   4,  84}, {   2,  84}
-  },
-  {  // x,y for mag=86 and nra=0:63
-    {  86,   0}, {  85,   2}, {  85,   4}, {  85,   6}, {  85,   8}, {  85,  10}, {  85,  12}, {  84,  14},
-    {  84,  16}, {  83,  18}, {  83,  20}, {  82,  22}, {  82,  24}, {  81,  26}, {  80,  28}, {  80,  30},
-    {  79,  32}, {  78,  34}, {  77,  36}, {  76,  38}, {  75,  40}, {  74,  42}, {  73,  44}, {  72,  46},
-    {  71,  47}, {  70,  49}, {  69,  51}, {  67,  52}, {  66,  54}, {  65,  56}, {  63,  57}, {  62,  59},
-    {  60,  60}, {  59,  62}, {  57,  63}, {  56,  65}, {  54,  66}, {  52,  67}, {  51,  69}, {  49,  70},
-    {  47,  71}, {  46,  72}, {  44,  73}, {  42,  74}, {  40,  75}, {  38,  76}, {  36,  77}, {  34,  78},
-    {  32,  79}, {  30,  80}, {  28,  80}, {  26,  81}, {  24,  82}, {  22,  82}, {  20,  83}, {  18,  83},
-    {  16,  84}, {  14,  84}, {  12,  85}, {  10,  85}, {   8,  85}, {   6,  85}, {   4,  85}, {   2,  85}
-  },
-  {  // x,y for mag=87 and nra=0:63
-    {  87,   0}, {  86,   2}, {  86,   4}, {  86,   6}, {  86,   8}, {  86,  10}, {  86,  12}, {  85,  14},
-    {  85,  16}, {  84,  19}, {  84,  21}, {  83,  23}, {  83,  25}, {  82,  27}, {  81,  29}, {  81,  31},
-    {  80,  33}, {  79,  35}, {  78,  37}, {  77,  39}, {  76,  41}, {  75,  42}, {  74,  44}, {  73,  46},
-    {  72,  48}, {  71,  50}, {  69,  51}, {  68,  53}, {  67,  55}, {  65,  56}, {  64,  58}, {  63,  59},
-    {  61,  61}, {  59,  63}, {  58,  64}, {  56,  65}, {  55,  67}, {  53,  68}, {  51,  69}, {  50,  71},
-    {  48,  72}, {  46,  73}, {  44,  74}, {  42,  75}, {  41,  76}, {  39,  77}, {  37,  78}, {  35,  79},
-    {  33,  80}, {  31,  81}, {  29,  81}, {  27,  82}, {  25,  83}, {  23,  83}, {  21,  84}, {  19,  84},
-    {  16,  85}, {  14,  85}, {  12,  86}, {  10,  86}, {   8,  86}, {   6,  86}, {   4,  86}, {   2,  86}
-  },
-  {  // x,y for mag=88 and nra=0:63
-    {  88,   0}, {  87,   2}, {  87,   4}, {  87,   6}, {  87,   8}, {  87,  10}, {  87,  12}, {  86,  15},
-    {  86,  17}, {  85,  19}, {  85,  21}, {  84,  23}, {  84,  25}, {  83,  27}, {  82,  29}, {  82,  31},
-    {  81,  33}, {  80,  35}, {  79,  37}, {  78,  39}, {  77,  41}, {  76,  43}, {  75,  45}, {  74,  47},
-    {  73,  48}, {  71,  50}, {  70,  52}, {  69,  54}, {  68,  55}, {  66,  57}, {  65,  59}, {  63,  60},
-    {  62,  62}, {  60,  63}, {  59,  65}, {  57,  66}, {  55,  68}, {  54,  69}, {  52,  70}, {  50,  71},
-    {  48,  73}, {  47,  74}, {  45,  75}, {  43,  76}, {  41,  77}, {  39,  78}, {  37,  79}, {  35,  80},
-    {  33,  81}, {  31,  82}, {  29,  82}, {  27,  83}, {  25,  84}, {  23,  84}, {  21,  85}, {  19,  85},
-    {  17,  86}, {  15,  86}, {  12,  87}, {  10,  87}, {   8,  87}, {   6,  87}, {   4,  87}, {   2,  87}
-  },
-  {  // x,y for mag=89 and nra=0:63
-    {  89,   0}, {  88,   2}, {  88,   4}, {  88,   6}, {  88,   8}, {  88,  10}, {  88,  13}, {  87,  15},
-    {  87,  17}, {  86,  19}, {  86,  21}, {  85,  23}, {  85,  25}, {  84,  27}, {  83,  29}, {  83,  32},
-    {  82,  34}, {  81,  36}, {  80,  38}, {  79,  40}, {  78,  41}, {  77,  43}, {  76,  45}, {  75,  47},
-    {  74,  49}, {  72,  51}, {  71,  53}, {  70,  54}, {  68,  56}, {  67,  58}, {  65,  59}, {  64,  61},
-    {  62,  62}, {  61,  64}, {  59,  65}, {  58,  67}, {  56,  68}, {  54,  70}, {  53,  71}, {  51,  72},
-    {  49,  74}, {  47,  75}, {  45,  76}, {  43,  77}, {  41,  78}, {  40,  79}, {  38,  80}, {  36,  81},
-    {  34,  82}, {  32,  83}, {  29,  83}, {  27,  84}, {  25,  85}, {  23,  85}, {  21,  86}, {  19,  86},
-    {  17,  87}, {  15,  87}, {  13,  88}, {  10,  88}, {   8,  88}, {   6,  88}, {   4,  88}, {   2,  88}
-  },
-  {  // x,y for mag=90 and nra=0:63
-    {  90,   0}, {  89,   2}, {  89,   4}, {  89,   6}, {  89,   8}, {  89,  11}, {  89,  13}, {  88,  15},
-    {  88,  17}, {  87,  19}, {  87,  21}, {  86,  24}, {  86,  26}, {  85,  28}, {  84,  30}, {  83,  32},
-    {  83,  34}, {  82,  36}, {  81,  38}, {  80,  40}, {  79,  42}, {  78,  44}, {  77,  46}, {  76,  48},
-    {  74,  50}, {  73,  51}, {  72,  53}, {  70,  55}, {  69,  57}, {  68,  58}, {  66,  60}, {  65,  62},
-    {  63,  63}, {  62,  65}, {  60,  66}, {  58,  68}, {  57,  69}, {  55,  70}, {  53,  72}, {  51,  73},
-    {  50,  74}, {  48,  76}, {  46,  77}, {  44,  78}, {  42,  79}, {  40,  80}, {  38,  81}, {  36,  82},
-    {  34,  83}, {  32,  83}, {  30,  84}, {  28,  85}, {  26,  86}, {  24,  86}, {  21,  87}, {  19,  87},
-    {  17,  88}, {  15,  88}, {  13,  89}, {  11,  89}, {   8,  89}, {   6,  89}, {   4,  89}, {   2,  89}
-  },
-  {  // x,y for mag=91 and nra=0:63
-    {  91,   0}, {  90,   2}, {  90,   4}, {  90,   6}, {  90,   8}, {  90,  11}, {  90,  13}, {  89,  15},
-    {  89,  17}, {  88,  19}, {  88,  22}, {  87,  24}, {  87,  26}, {  86,  28}, {  85,  30}, {  84,  32},
-    {  84,  34}, {  83,  36}, {  82,  38}, {  81,  40}, {  80,  42}, {  79,  44}, {  78,  46}, {  76,  48},
-    {  75,  50}, {  74,  52}, {  73,  54}, {  71,  55}, {  70,  57}, {  68,  59}, {  67,  61}, {  65,  62},
-    {  64,  64}, {  62,  65}, {  61,  67}, {  59,  68}, {  57,  70}, {  55,  71}, {  54,  73}, {  52,  74},
-    {  50,  75}, {  48,  76}, {  46,  78}, {  44,  79}, {  42,  80}, {  40,  81}, {  38,  82}, {  36,  83},
-    {  34,  84}, {  32,  84}, {  30,  85}, {  28,  86}, {  26,  87}, {  24,  87}, {  22,  88}, {  19,  88},
-    {  17,  89}, {  15,  89}, {  13,  90}, {  11,  90}, {   8,  90}, {   6,  90}, {   4,  90}, {   2,  90}
-  },
-  {  // x,y for mag=92 and nra=0:63
-    {  92,   0}, {  91,   2}, {  91,   4}, {  91,   6}, {  91,   9}, {  91,  11}, {  91,  13}, {  90,  15},
-    {  90,  17}, {  89,  20}, {  89,  22}, {  88,  24}, {  88,  26}, {  87,  28}, {  86,  30}, {  85,  33},
-    {  84,  35}, {  84,  37}, {  83,  39}, {  82,  41}, {  81,  43}, {  80,  45}, {  78,  47}, {  77,  49},
-    {  76,  51}, {  75,  52}, {  73,  54}, {  72,  56}, {  71,  58}, {  69,  60}, {  68,  61}, {  66,  63},
-    {  65,  65}, {  63,  66}, {  61,  68}, {  60,  69}, {  58,  71}, {  56,  72}, {  54,  73}, {  52,  75},
-    {  51,  76}, {  49,  77}, {  47,  78}, {  45,  80}, {  43,  81}, {  41,  82}, {  39,  83}, {  37,  84},
-    {  35,  84}, {  33,  85}, {  30,  86}, {  28,  87}, {  26,  88}, {  24,  88}, {  22,  89}, {  20,  89},
-    {  17,  90}, {  15,  90}, {  13,  91}, {  11,  91}, {   9,  91}, {   6,  91}, {   4,  91}, {   2,  91}
-  },
-  {  // x,y for mag=93 and nra=0:63
-    {  93,   0}, {  92,   2}, {  92,   4}, {  92,   6}, {  92,   9}, {  92,  11}, {  91,  13}, {  91,  15},
-    {  91,  18}, {  90,  20}, {  90,  22}, {  89,  24}, {  88,  26}, {  88,  29}, {  87,  31}, {  86,  33},
-    {  85,  35}, {  85,  37}, {  84,  39}, {  83,  41}, {  82,  43}, {  80,  45}, {  79,  47}, {  78,  49},
-    {  77,  51}, {  76,  53}, {  74,  55}, {  73,  57}, {  71,  58}, {  70,  60}, {  68,  62}, {  67,  64},
-    {  65,  65}, {  64,  67}, {  62,  68}, {  60,  70}, {  58,  71}, {  57,  73}, {  55,  74}, {  53,  76},
-    {  51,  77}, {  49,  78}, {  47,  79}, {  45,  80}, {  43,  82}, {  41,  83}, {  39,  84}, {  37,  85},
-    {  35,  85}, {  33,  86}, {  31,  87}, {  29,  88}, {  26,  88}, {  24,  89}, {  22,  90}, {  20,  90},
-    {  18,  91}, {  15,  91}, {  13,  91}, {  11,  92}, {   9,  92}, {   6,  92}, {   4,  92}, {   2,  92}
-  },
-  {  // x,y for mag=94 and nra=0:63
-    {  94,   0}, {  93,   2}, {  93,   4}, {  93,   6}, {  93,   9}, {  93,  11}, {  92,  13}, {  92,  16},
-    {  92,  18}, {  91,  20}, {  91,  22}, {  90,  25}, {  89,  27}, {  89,  29}, {  88,  31}, {  87,  33},
-    {  86,  35}, {  85,  38}, {  84,  40}, {  83,  42}, {  82,  44}, {  81,  46}, {  80,  48}, {  79,  50},
-    {  78,  52}, {  76,  54}, {  75,  55}, {  74,  57}, {  72,  59}, {  71,  61}, {  69,  63}, {  68,  64},
-    {  66,  66}, {  64,  68}, {  63,  69}, {  61,  71}, {  59,  72}, {  57,  74}, {  55,  75}, {  54,  76},
-    {  52,  78}, {  50,  79}, {  48,  80}, {  46,  81}, {  44,  82}, {  42,  83}, {  40,  84}, {  38,  85},
-    {  35,  86}, {  33,  87}, {  31,  88}, {  29,  89}, {  27,  89}, {  25,  90}, {  22,  91}, {  20,  91},
-    {  18,  92}, {  16,  92}, {  13,  92}, {  11,  93}, {   9,  93}, {   6,  93}, {   4,  93}, {   2,  93}
-  },
-  {  // x,y for mag=95 and nra=0:63
-    {  95,   0}, {  94,   2}, {  94,   4}, {  94,   6}, {  94,   9}, {  94,  11}, {  93,  13}, {  93,  16},
-    {  93,  18}, {  92,  20}, {  92,  23}, {  91,  25}, {  90,  27}, {  90,  29}, {  89,  32}, {  88,  34},
-    {  87,  36}, {  86,  38}, {  85,  40}, {  84,  42}, {  83,  44}, {  82,  46}, {  81,  48}, {  80,  50},
-    {  78,  52}, {  77,  54}, {  76,  56}, {  74,  58}, {  73,  60}, {  71,  62}, {  70,  63}, {  68,  65},
-    {  67,  67}, {  65,  68}, {  63,  70}, {  62,  71}, {  60,  73}, {  58,  74}, {  56,  76}, {  54,  77},
-    {  52,  78}, {  50,  80}, {  48,  81}, {  46,  82}, {  44,  83}, {  42,  84}, {  40,  85}, {  38,  86},
-    {  36,  87}, {  34,  88}, {  32,  89}, {  29,  90}, {  27,  90}, {  25,  91}, {  23,  92}, {  20,  92},
-    {  18,  93}, {  16,  93}, {  13,  93}, {  11,  94}, {   9,  94}, {   6,  94}, {   4,  94}, {   2,  94}
-  },
-  {  // x,y for mag=96 and nra=0:63
-    {  96,   0}, {  95,   2}, {  95,   4}, {  95,   7}, {  95,   9}, {  95,  11}, {  94,  14}, {  94,  16},
-    {  94,  18}, {  93,  21}, {  93,  23}, {  92,  25}, {  91,  27}, {  91,  30}, {  90,  32}, {  89,  34},
-    {  88,  36}, {  87,  38}, {  86,  41}, {  85,  43}, {  84,  45}, {  83,  47}, {  82,  49}, {  81,  51},
-    {  79,  53}, {  78,  55}, {  77,  57}, {  75,  59}, {  74,  60}, {  72,  62}, {  71,  64}, {  69,  66},
-    {  67,  67}, {  66,  69}, {  64,  71}, {  62,  72}, {  60,  74}, {  59,  75}, {  57,  77}, {  55,  78},
-    {  53,  79}, {  51,  81}, {  49,  82}, {  47,  83}, {  45,  84}, {  43,  85}, {  41,  86}, {  38,  87},
-    {  36,  88}, {  34,  89}, {  32,  90}, {  30,  91}, {  27,  91}, {  25,  92}, {  23,  93}, {  21,  93},
-    {  18,  94}, {  16,  94}, {  14,  94}, {  11,  95}, {   9,  95}, {   7,  95}, {   4,  95}, {   2,  95}
-  },
-  {  // x,y for mag=97 and nra=0:63
-    {  97,   0}, {  96,   2}, {  96,   4}, {  96,   7}, {  96,   9}, {  96,  11}, {  95,  14}, {  95,  16},
-    {  95,  18}, {  94,  21}, {  94,  23}, {  93,  25}, {  92,  28}, {  92,  30}, {  91,  32}, {  90,  34},
-    {  89,  37}, {  88,  39}, {  87,  41}, {  86,  43}, {  85,  45}, {  84,  47}, {  83,  49}, {  81,  51},
-    {  80,  53}, {  79,  55}, {  77,  57}, {  76,  59}, {  74,  61}, {  73,  63}, {  71,  65}, {  70,  66},
-    {  68,  68}, {  66,  70}, {  65,  71}, {  63,  73}, {  61,  74}, {  59,  76}, {  57,  77}, {  55,  79},
-    {  53,  80}, {  51,  81}, {  49,  83}, {  47,  84}, {  45,  85}, {  43,  86}, {  41,  87}, {  39,  88},
-    {  37,  89}, {  34,  90}, {  32,  91}, {  30,  92}, {  28,  92}, {  25,  93}, {  23,  94}, {  21,  94},
-    {  18,  95}, {  16,  95}, {  14,  95}, {  11,  96}, {   9,  96}, {   7,  96}, {   4,  96}, {   2,  96}
-  },
-  {  // x,y for mag=98 and nra=0:63
-    {  98,   0}, {  97,   2}, {  97,   4}, {  97,   7}, {  97,   9}, {  97,  11}, {  96,  14}, {  96,  16},
-    {  96,  19}, {  95,  21}, {  95,  23}, {  94,  26}, {  93,  28}, {  93,  30}, {  92,  33}, {  91,  35},
-    {  90,  37}, {  89,  39}, {  88,  41}, {  87,  44}, {  86,  46}, {  85,  48}, {  84,  50}, {  82,  52},
-    {  81,  54}, {  80,  56}, {  78,  58}, {  77,  60}, {  75,  62}, {  74,  64}, {  72,  65}, {  70,  67},
-    {  69,  69}, {  67,  70}, {  65,  72}, {  64,  74}, {  62,  75}, {  60,  77}, {  58,  78}, {  56,  80},
-    {  54,  81}, {  52,  82}, {  50,  84}, {  48,  85}, {  46,  86}, {  44,  87}, {  41,  88}, {  39,  89},
-    {  37,  90}, {  35,  91}, {  33,  92}, {  30,  93}, {  28,  93}, {  26,  94}, {  23,  95}, {  21,  95},
-    {  19,  96}, {  16,  96}, {  14,  96}, {  11,  97}, {   9,  97}, {   7,  97}, {   4,  97}, {   2,  97}
-  },
-  {  // x,y for mag=99 and nra=0:63
-    {  99,   0}, {  98,   2}, {  98,   4}, {  98,   7}, {  98,   9}, {  98,  12}, {  97,  14}, {  97,  16},
-    {  97,  19}, {  96,  21}, {  96,  24}, {  95,  26}, {  94,  28}, {  94,  31}, {  93,  33}, {  92,  35},
-    {  91,  37}, {  90,  40}, {  89,  42}, {  88,  44}, {  87,  46}, {  86,  48}, {  84,  50}, {  83,  52},
-    {  82,  55}, {  80,  57}, {  79,  58}, {  78,  60}, {  76,  62}, {  74,  64}, {  73,  66}, {  71,  68},
-    {  70,  70}, {  68,  71}, {  66,  73}, {  64,  74}, {  62,  76}, {  60,  78}, {  58,  79}, {  57,  80},
-    {  55,  82}, {  52,  83}, {  50,  84}, {  48,  86}, {  46,  87}, {  44,  88}, {  42,  89}, {  40,  90},
-    {  37,  91}, {  35,  92}, {  33,  93}, {  31,  94}, {  28,  94}, {  26,  95}, {  24,  96}, {  21,  96},
-    {  19,  97}, {  16,  97}, {  14,  97}, {  12,  98}, {   9,  98}, {   7,  98}, {   4,  98}, {   2,  98}
-  },
-  {  // x,y for mag=100 and nra=0:63
-    { 100,   0}, {  99,   2}, {  99,   4}, {  99,   7}, {  99,   9}, {  99,  12}, {  98,  14}, {  98,  17},
-    {  98,  19}, {  97,  21}, {  97,  24}, {  96,  26}, {  95,  29}, {  94,  31}, {  94,  33}, {  93,  35},
-    {  92,  38}, {  91,  40}, {  90,  42}, {  89,  44}, {  88,  47}, {  87,  49}, {  85,  51}, {  84,  53},
-    {  83,  55}, {  81,  57}, {  80,  59}, {  78,  61}, {  77,  63}, {  75,  65}, {  74,  67}, {  72,  68},
-    {  70,  70}, {  68,  72}, {  67,  74}, {  65,  75}, {  63,  77}, {  61,  78}, {  59,  80}, {  57,  81},
-    {  55,  83}, {  53,  84}, {  51,  85}, {  49,  87}, {  47,  88}, {  44,  89}, {  42,  90}, {  40,  91},
-    {  38,  92}, {  35,  93}, {  33,  94}, {  31,  94}, {  29,  95}, {  26,  96}, {  24,  97}, {  21,  97},
-    {  19,  98}, {  17,  98}, {  14,  98}, {  12,  99}, {   9,  99}, {   7,  99}, {   4,  99}, {   2,  99}
-  },
-  {  // x,y for mag=101 and nra=0:63
-    { 101,   0}, { 100,   2}, { 100,   4}, { 100,   7}, { 100,   9}, { 100,  12}, {  99,  14}, {  99,  17},
-    {  99,  19}, {  98,  22}, {  97,  24}, {  97,  26}, {  96,  29}, {  95,  31}, {  95,  34}, {  94,  36},
-    {  93,  38}, {  92,  40}, {  91,  43}, {  90,  45}, {  89,  47}, {  87,  49}, {  86,  51}, {  85,  54},
-    {  83,  56}, {  82,  58}, {  81,  60}, {  79,  62}, {  78,  64}, {  76,  65}, {  74,  67}, {  73,  69},
-    {  71,  71}, {  69,  73}, {  67,  74}, {  65,  76}, {  64,  78}, {  62,  79}, {  60,  81}, {  58,  82},
-    {  56,  83}, {  54,  85}, {  51,  86}, {  49,  87}, {  47,  89}, {  45,  90}, {  43,  91}, {  40,  92},
-    {  38,  93}, {  36,  94}, {  34,  95}, {  31,  95}, {  29,  96}, {  26,  97}, {  24,  97}, {  22,  98},
-    {  19,  99}, {  17,  99}, {  14,  99}, {  12, 100}, {   9, 100}, {   7, 100}, {   4, 100}, {   2, 100}
-  },
-  {  // x,y for mag=102 and nra=0:63
-    { 102,   0}, { 101,   2}, { 101,   5}, { 101,   7}, { 101,   9}, { 101,  12}, { 100,  14}, { 100,  17},
-    { 100,  19}, {  99,  22}, {  98,  24}, {  98,  27}, {  97,  29}, {  96,  31}, {  96,  34}, {  95,  36},
-    {  94,  39}, {  93,  41}, {  92,  43}, {  91,  45}, {  89,  48}, {  88,  50}, {  87,  52}, {  86,  54},
-    {  84,  56}, {  83,  58}, {  81,  60}, {  80,  62}, {  78,  64}, {  77,  66}, {  75,  68}, {  73,  70},
-    {  72,  72}, {  70,  73}, {  68,  75}, {  66,  77}, {  64,  78}, {  62,  80}, {  60,  81}, {  58,  83},
-    {  56,  84}, {  54,  86}, {  52,  87}, {  50,  88}, {  48,  89}, {  45,  91}, {  43,  92}, {  41,  93},
-    {  39,  94}, {  36,  95}, {  34,  96}, {  31,  96}, {  29,  97}, {  27,  98}, {  24,  98}, {  22,  99},
-    {  19, 100}, {  17, 100}, {  14, 100}, {  12, 101}, {   9, 101}, {   7, 101}, {   5, 101}, {   2, 101}
-  },
-  {  // x,y for mag=103 and nra=0:63
-    { 103,   0}, { 102,   2}, { 102,   5}, { 102,   7}, { 102,  10}, { 102,  12}, { 101,  15}, { 101,  17},
-    { 101,  20}, { 100,  22}, {  99,  25}, {  99,  27}, {  98,  29}, {  97,  32}, {  96,  34}, {  96,  37},
-    {  95,  39}, {  94,  41}, {  93,  44}, {  92,  46}, {  90,  48}, {  89,  50}, {  88,  52}, {  87,  55},
-    {  85,  57}, {  84,  59}, {  82,  61}, {  81,  63}, {  79,  65}, {  77,  67}, {  76,  69}, {  74,  71},
-    {  72,  72}, {  71,  74}, {  69,  76}, {  67,  77}, {  65,  79}, {  63,  81}, {  61,  82}, {  59,  84},
-    {  57,  85}, {  55,  87}, {  52,  88}, {  50,  89}, {  48,  90}, {  46,  92}, {  44,  93}, {  41,  94},
-    {  39,  95}, {  37,  96}, {  34,  96}, {  32,  97}, {  29,  98}, {  27,  99}, {  25,  99}, {  22, 100},
-    {  20, 101}, {  17, 101}, {  15, 101}, {  12, 102}, {  10, 102}, {   7, 102}, {   5, 102}, {   2, 102}
-  },
-  {  // x,y for mag=104 and nra=0:63
-    { 104,   0}, { 103,   2}, { 103,   5}, { 103,   7}, { 103,  10}, { 103,  12}, { 102,  15}, { 102,  17},
-    { 102,  20}, { 101,  22}, { 100,  25}, { 100,  27}, {  99,  30}, {  98,  32}, {  97,  35}, {  97,  37},
-    {  96,  39}, {  95,  42}, {  94,  44}, {  92,  46}, {  91,  49}, {  90,  51}, {  89,  53}, {  87,  55},
-    {  86,  57}, {  85,  59}, {  83,  61}, {  81,  63}, {  80,  65}, {  78,  67}, {  77,  69}, {  75,  71},
-    {  73,  73}, {  71,  75}, {  69,  77}, {  67,  78}, {  65,  80}, {  63,  81}, {  61,  83}, {  59,  85},
-    {  57,  86}, {  55,  87}, {  53,  89}, {  51,  90}, {  49,  91}, {  46,  92}, {  44,  94}, {  42,  95},
-    {  39,  96}, {  37,  97}, {  35,  97}, {  32,  98}, {  30,  99}, {  27, 100}, {  25, 100}, {  22, 101},
-    {  20, 102}, {  17, 102}, {  15, 102}, {  12, 103}, {  10, 103}, {   7, 103}, {   5, 103}, {   2, 103}
-  },
-  {  // x,y for mag=105 and nra=0:63
-    { 105,   0}, { 104,   2}, { 104,   5}, { 104,   7}, { 104,  10}, { 104,  12}, { 103,  15}, { 103,  17},
-    { 102,  20}, { 102,  23}, { 101,  25}, { 101,  28}, { 100,  30}, {  99,  32}, {  98,  35}, {  97,  37},
-    {  97,  40}, {  95,  42}, {  94,  44}, {  93,  47}, {  92,  49}, {  91,  51}, {  90,  53}, {  88,  56},
-    {  87,  58}, {  85,  60}, {  84,  62}, {  82,  64}, {  81,  66}, {  79,  68}, {  77,  70}, {  76,  72},
-    {  74,  74}, {  72,  76}, {  70,  77}, {  68,  79}, {  66,  81}, {  64,  82}, {  62,  84}, {  60,  85},
-    {  58,  87}, {  56,  88}, {  53,  90}, {  51,  91}, {  49,  92}, {  47,  93}, {  44,  94}, {  42,  95},
-    {  40,  97}, {  37,  97}, {  35,  98}, {  32,  99}, {  30, 100}, {  28, 101}, {  25, 101}, {  23, 102},
-    {  20, 102}, {  17, 103}, {  15, 103}, {  12, 104}, {  10, 104}, {   7, 104}, {   5, 104}, {   2, 104}
-  },
-  {  // x,y for mag=106 and nra=0:63
-    { 106,   0}, { 105,   2}, { 105,   5}, { 105,   7}, { 105,  10}, { 105,  12}, { 104,  15}, { 104,  18},
-    { 103,  20}, { 103,  23}, { 102,  25}, { 102,  28}, { 101,  30}, { 100,  33}, {  99,  35}, {  98,  38},
-    {  97,  40}, {  96,  42}, {  95,  45}, {  94,  47}, {  93,  49}, {  92,  52}, {  90,  54}, {  89,  56},
-    {  88,  58}, {  86,  61}, {  85,  63}, {  83,  65}, {  81,  67}, {  80,  69}, {  78,  71}, {  76,  73},
-    {  74,  74}, {  73,  76}, {  71,  78}, {  69,  80}, {  67,  81}, {  65,  83}, {  63,  85}, {  61,  86},
-    {  58,  88}, {  56,  89}, {  54,  90}, {  52,  92}, {  49,  93}, {  47,  94}, {  45,  95}, {  42,  96},
-    {  40,  97}, {  38,  98}, {  35,  99}, {  33, 100}, {  30, 101}, {  28, 102}, {  25, 102}, {  23, 103},
-    {  20, 103}, {  18, 104}, {  15, 104}, {  12, 105}, {  10, 105}, {   7, 105}, {   5, 105}, {   2, 105}
-  },
-  {  // x,y for mag=107 and nra=0:63
-    { 107,   0}, { 106,   2}, { 106,   5}, { 106,   7}, { 106,  10}, { 106,  13}, { 105,  15}, { 105,  18},
-    { 104,  20}, { 104,  23}, { 103,  25}, { 103,  28}, { 102,  31}, { 101,  33}, { 100,  36}, {  99,  38},
-    {  98,  40}, {  97,  43}, {  96,  45}, {  95,  48}, {  94,  50}, {  93,  52}, {  91,  55}, {  90,  57},
-    {  88,  59}, {  87,  61}, {  85,  63}, {  84,  65}, {  82,  67}, {  81,  69}, {  79,  71}, {  77,  73},
-    {  75,  75}, {  73,  77}, {  71,  79}, {  69,  81}, {  67,  82}, {  65,  84}, {  63,  85}, {  61,  87},
-    {  59,  88}, {  57,  90}, {  55,  91}, {  52,  93}, {  50,  94}, {  48,  95}, {  45,  96}, {  43,  97},
-    {  40,  98}, {  38,  99}, {  36, 100}, {  33, 101}, {  31, 102}, {  28, 103}, {  25, 103}, {  23, 104},
-    {  20, 104}, {  18, 105}, {  15, 105}, {  13, 106}, {  10, 106}, {   7, 106}, {   5, 106}, {   2, 106}
-  },
-  {  // x,y for mag=108 and nra=0:63
-    { 108,   0}, { 107,   2}, { 107,   5}, { 107,   7}, { 107,  10}, { 107,  13}, { 106,  15}, { 106,  18},
-    { 105,  21}, { 105,  23}, { 104,  26}, { 104,  28}, { 103,  31}, { 102,  33}, { 101,  36}, { 100,  38},
-    {  99,  41}, {  98,  43}, {  97,  46}, {  96,  48}, {  95,  50}, {  93,  53}, {  92,  55}, {  91,  57},
-    {  89,  60}, {  88,  62}, {  86,  64}, {  85,  66}, {  83,  68}, {  81,  70}, {  80,  72}, {  78,  74},
-    {  76,  76}, {  74,  78}, {  72,  80}, {  70,  81}, {  68,  83}, {  66,  85}, {  64,  86}, {  62,  88},
-    {  60,  89}, {  57,  91}, {  55,  92}, {  53,  93}, {  50,  95}, {  48,  96}, {  46,  97}, {  43,  98},
-    {  41,  99}, {  38, 100}, {  36, 101}, {  33, 102}, {  31, 103}, {  28, 104}, {  26, 104}, {  23, 105},
-    {  21, 105}, {  18, 106}, {  15, 106}, {  13, 107}, {  10, 107}, {   7, 107}, {   5, 107}, {   2, 107}
-  },
-  {  // x,y for mag=109 and nra=0:63
-    { 109,   0}, { 108,   2}, { 108,   5}, { 108,   8}, { 108,  10}, { 108,  13}, { 107,  15}, { 107,  18},
-    { 106,  21}, { 106,  23}, { 105,  26}, { 105,  29}, { 104,  31}, { 103,  34}, { 102,  36}, { 101,  39},
-    { 100,  41}, {  99,  44}, {  98,  46}, {  97,  49}, {  96,  51}, {  94,  53}, {  93,  56}, {  92,  58},
-    {  90,  60}, {  89,  62}, {  87,  64}, {  85,  67}, {  84,  69}, {  82,  71}, {  80,  73}, {  78,  75},
-    {  77,  77}, {  75,  78}, {  73,  80}, {  71,  82}, {  69,  84}, {  67,  85}, {  64,  87}, {  62,  89},
-    {  60,  90}, {  58,  92}, {  56,  93}, {  53,  94}, {  51,  96}, {  49,  97}, {  46,  98}, {  44,  99},
-    {  41, 100}, {  39, 101}, {  36, 102}, {  34, 103}, {  31, 104}, {  29, 105}, {  26, 105}, {  23, 106},
-    {  21, 106}, {  18, 107}, {  15, 107}, {  13, 108}, {  10, 108}, {   8, 108}, {   5, 108}, {   2, 108}
-  },
-  {  // x,y for mag=110 and nra=0:63
-    { 110,   0}, { 109,   2}, { 109,   5}, { 109,   8}, { 109,  10}, { 109,  13}, { 108,  16}, { 108,  18},
-    { 107,  21}, { 107,  24}, { 106,  26}, { 106,  29}, { 105,  31}, { 104,  34}, { 103,  37}, { 102,  39},
-    { 101,  42}, { 100,  44}, {  99,  47}, {  98,  49}, {  97,  51}, {  95,  54}, {  94,  56}, {  92,  58},
-    {  91,  61}, {  89,  63}, {  88,  65}, {  86,  67}, {  85,  69}, {  83,  71}, {  81,  73}, {  79,  75},
-    {  77,  77}, {  75,  79}, {  73,  81}, {  71,  83}, {  69,  85}, {  67,  86}, {  65,  88}, {  63,  89},
-    {  61,  91}, {  58,  92}, {  56,  94}, {  54,  95}, {  51,  97}, {  49,  98}, {  47,  99}, {  44, 100},
-    {  42, 101}, {  39, 102}, {  37, 103}, {  34, 104}, {  31, 105}, {  29, 106}, {  26, 106}, {  24, 107},
-    {  21, 107}, {  18, 108}, {  16, 108}, {  13, 109}, {  10, 109}, {   8, 109}, {   5, 109}, {   2, 109}
-  },
-  {  // x,y for mag=111 and nra=0:63
-    { 111,   0}, { 110,   2}, { 110,   5}, { 110,   8}, { 110,  10}, { 110,  13}, { 109,  16}, { 109,  18},
-    { 108,  21}, { 108,  24}, { 107,  26}, { 106,  29}, { 106,  32}, { 105,  34}, { 104,  37}, { 103,  39},
-    { 102,  42}, { 101,  44}, { 100,  47}, {  99,  49}, {  97,  52}, {  96,  54}, {  95,  57}, {  93,  59},
-    {  92,  61}, {  90,  63}, {  89,  66}, {  87,  68}, {  85,  70}, {  84,  72}, {  82,  74}, {  80,  76},
-    {  78,  78}, {  76,  80}, {  74,  82}, {  72,  84}, {  70,  85}, {  68,  87}, {  66,  89}, {  63,  90},
-    {  61,  92}, {  59,  93}, {  57,  95}, {  54,  96}, {  52,  97}, {  49,  99}, {  47, 100}, {  44, 101},
-    {  42, 102}, {  39, 103}, {  37, 104}, {  34, 105}, {  32, 106}, {  29, 106}, {  26, 107}, {  24, 108},
-    {  21, 108}, {  18, 109}, {  16, 109}, {  13, 110}, {  10, 110}, {   8, 110}, {   5, 110}, {   2, 110}
-  },
-  {  // x,y for mag=112 and nra=0:63
-    { 112,   0}, { 111,   2}, { 111,   5}, { 111,   8}, { 111,  10}, { 111,  13}, { 110,  16}, { 110,  19},
-    { 109,  21}, { 109,  24}, { 108,  27}, { 107,  29}, { 107,  32}, { 106,  35}, { 105,  37}, { 104,  40},
-    { 103,  42}, { 102,  45}, { 101,  47}, { 100,  50}, {  98,  52}, {  97,  55}, {  96,  57}, {  94,  59},
-    {  93,  62}, {  91,  64}, {  89,  66}, {  88,  68}, {  86,  71}, {  84,  73}, {  82,  75}, {  81,  77},
-    {  79,  79}, {  77,  81}, {  75,  82}, {  73,  84}, {  71,  86}, {  68,  88}, {  66,  89}, {  64,  91},
-    {  62,  93}, {  59,  94}, {  57,  96}, {  55,  97}, {  52,  98}, {  50, 100}, {  47, 101}, {  45, 102},
-    {  42, 103}, {  40, 104}, {  37, 105}, {  35, 106}, {  32, 107}, {  29, 107}, {  27, 108}, {  24, 109},
-    {  21, 109}, {  19, 110}, {  16, 110}, {  13, 111}, {  10, 111}, {   8, 111}, {   5, 111}, {   2, 111}
-  },
-  {  // x,y for mag=113 and nra=0:63
-    { 113,   0}, { 112,   2}, { 112,   5}, { 112,   8}, { 112,  11}, { 112,  13}, { 111,  16}, { 111,  19},
-    { 110,  22}, { 110,  24}, { 109,  27}, { 108,  30}, { 108,  32}, { 107,  35}, { 106,  38}, { 105,  40},
-    { 104,  43}, { 103,  45}, { 102,  48}, { 100,  50}, {  99,  53}, {  98,  55}, {  96,  58}, {  95,  60},
-    {  93,  62}, {  92,  65}, {  90,  67}, {  89,  69}, {  87,  71}, {  85,  73}, {  83,  75}, {  81,  77},
-    {  79,  79}, {  77,  81}, {  75,  83}, {  73,  85}, {  71,  87}, {  69,  89}, {  67,  90}, {  65,  92},
-    {  62,  93}, {  60,  95}, {  58,  96}, {  55,  98}, {  53,  99}, {  50, 100}, {  48, 102}, {  45, 103},
-    {  43, 104}, {  40, 105}, {  38, 106}, {  35, 107}, {  32, 108}, {  30, 108}, {  27, 109}, {  24, 110},
-    {  22, 110}, {  19, 111}, {  16, 111}, {  13, 112}, {  11, 112}, {   8, 112}, {   5, 112}, {   2, 112}
-  },
-  {  // x,y for mag=114 and nra=0:63
-    { 114,   0}, { 113,   2}, { 113,   5}, { 113,   8}, { 113,  11}, { 113,  13}, { 112,  16}, { 112,  19},
-    { 111,  22}, { 111,  24}, { 110,  27}, { 109,  30}, { 109,  33}, { 108,  35}, { 107,  38}, { 106,  41},
-    { 105,  43}, { 104,  46}, { 103,  48}, { 101,  51}, { 100,  53}, {  99,  56}, {  97,  58}, {  96,  60},
-    {  94,  63}, {  93,  65}, {  91,  67}, {  89,  70}, {  88,  72}, {  86,  74}, {  84,  76}, {  82,  78},
-    {  80,  80}, {  78,  82}, {  76,  84}, {  74,  86}, {  72,  88}, {  70,  89}, {  67,  91}, {  65,  93},
-    {  63,  94}, {  60,  96}, {  58,  97}, {  56,  99}, {  53, 100}, {  51, 101}, {  48, 103}, {  46, 104},
-    {  43, 105}, {  41, 106}, {  38, 107}, {  35, 108}, {  33, 109}, {  30, 109}, {  27, 110}, {  24, 111},
-    {  22, 111}, {  19, 112}, {  16, 112}, {  13, 113}, {  11, 113}, {   8, 113}, {   5, 113}, {   2, 113}
-  },
-  {  // x,y for mag=115 and nra=0:63
-    { 115,   0}, { 114,   2}, { 114,   5}, { 114,   8}, { 114,  11}, { 114,  14}, { 113,  16}, { 113,  19},
-    { 112,  22}, { 112,  25}, { 111,  27}, { 110,  30}, { 110,  33}, { 109,  36}, { 108,  38}, { 107,  41},
-    { 106,  44}, { 105,  46}, { 103,  49}, { 102,  51}, { 101,  54}, { 100,  56}, {  98,  59}, {  97,  61},
-    {  95,  63}, {  94,  66}, {  92,  68}, {  90,  70}, {  88,  72}, {  87,  75}, {  85,  77}, {  83,  79},
-    {  81,  81}, {  79,  83}, {  77,  85}, {  75,  87}, {  72,  88}, {  70,  90}, {  68,  92}, {  66,  94},
-    {  63,  95}, {  61,  97}, {  59,  98}, {  56, 100}, {  54, 101}, {  51, 102}, {  49, 103}, {  46, 105},
-    {  44, 106}, {  41, 107}, {  38, 108}, {  36, 109}, {  33, 110}, {  30, 110}, {  27, 111}, {  25, 112},
-    {  22, 112}, {  19, 113}, {  16, 113}, {  14, 114}, {  11, 114}, {   8, 114}, {   5, 114}, {   2, 114}
-  },
-  {  // x,y for mag=116 and nra=0:63
-    { 116,   0}, { 115,   2}, { 115,   5}, { 115,   8}, { 115,  11}, { 115,  14}, { 114,  17}, { 114,  19},
-    { 113,  22}, { 113,  25}, { 112,  28}, { 111,  30}, { 111,  33}, { 110,  36}, { 109,  39}, { 108,  41},
-    { 107,  44}, { 106,  47}, { 104,  49}, { 103,  52}, { 102,  54}, { 100,  57}, {  99,  59}, {  98,  62},
-    {  96,  64}, {  94,  66}, {  93,  69}, {  91,  71}, {  89,  73}, {  87,  75}, {  85,  77}, {  84,  79},
-    {  82,  82}, {  79,  84}, {  77,  85}, {  75,  87}, {  73,  89}, {  71,  91}, {  69,  93}, {  66,  94},
-    {  64,  96}, {  62,  98}, {  59,  99}, {  57, 100}, {  54, 102}, {  52, 103}, {  49, 104}, {  47, 106},
-    {  44, 107}, {  41, 108}, {  39, 109}, {  36, 110}, {  33, 111}, {  30, 111}, {  28, 112}, {  25, 113},
-    {  22, 113}, {  19, 114}, {  17, 114}, {  14, 115}, {  11, 115}, {   8, 115}, {   5, 115}, {   2, 115}
-  },
-  {  // x,y for mag=117 and nra=0:63
-    { 117,   0}, { 116,   2}, { 116,   5}, { 116,   8}, { 116,  11}, { 116,  14}, { 115,  17}, { 115,  20},
-    { 114,  22}, { 114,  25}, { 113,  28}, { 112,  31}, { 111,  33}, { 111,  36}, { 110,  39}, { 109,  42},
-    { 108,  44}, { 106,  47}, { 105,  50}, { 104,  52}, { 103,  55}, { 101,  57}, { 100,  60}, {  98,  62},
-    {  97,  65}, {  95,  67}, {  93,  69}, {  92,  71}, {  90,  74}, {  88,  76}, {  86,  78}, {  84,  80},
-    {  82,  82}, {  80,  84}, {  78,  86}, {  76,  88}, {  74,  90}, {  71,  92}, {  69,  93}, {  67,  95},
-    {  65,  97}, {  62,  98}, {  60, 100}, {  57, 101}, {  55, 103}, {  52, 104}, {  50, 105}, {  47, 106},
-    {  44, 108}, {  42, 109}, {  39, 110}, {  36, 111}, {  33, 111}, {  31, 112}, {  28, 113}, {  25, 114},
-    {  22, 114}, {  20, 115}, {  17, 115}, {  14, 116}, {  11, 116}, {   8, 116}, {   5, 116}, {   2, 116}
-  },
-  {  // x,y for mag=118 and nra=0:63
-    { 118,   0}, { 117,   2}, { 117,   5}, { 117,   8}, { 117,  11}, { 117,  14}, { 116,  17}, { 116,  20},
-    { 115,  23}, { 115,  25}, { 114,  28}, { 113,  31}, { 112,  34}, { 112,  37}, { 111,  39}, { 110,  42},
-    { 109,  45}, { 107,  47}, { 106,  50}, { 105,  53}, { 104,  55}, { 102,  58}, { 101,  60}, {  99,  63},
-    {  98,  65}, {  96,  67}, {  94,  70}, {  93,  72}, {  91,  74}, {  89,  77}, {  87,  79}, {  85,  81},
-    {  83,  83}, {  81,  85}, {  79,  87}, {  77,  89}, {  74,  91}, {  72,  93}, {  70,  94}, {  67,  96},
-    {  65,  98}, {  63,  99}, {  60, 101}, {  58, 102}, {  55, 104}, {  53, 105}, {  50, 106}, {  47, 107},
-    {  45, 109}, {  42, 110}, {  39, 111}, {  37, 112}, {  34, 112}, {  31, 113}, {  28, 114}, {  25, 115},
-    {  23, 115}, {  20, 116}, {  17, 116}, {  14, 117}, {  11, 117}, {   8, 117}, {   5, 117}, {   2, 117}
-  },
-  {  // x,y for mag=119 and nra=0:63
-    { 119,   0}, { 118,   2}, { 118,   5}, { 118,   8}, { 118,  11}, { 118,  14}, { 117,  17}, { 117,  20},
-    { 116,  23}, { 116,  26}, { 115,  28}, { 114,  31}, { 113,  34}, { 112,  37}, { 112,  40}, { 111,  42},
-    { 109,  45}, { 108,  48}, { 107,  50}, { 106,  53}, { 104,  56}, { 103,  58}, { 102,  61}, { 100,  63},
-    {  98,  66}, {  97,  68}, {  95,  70}, {  93,  73}, {  91,  75}, {  90,  77}, {  88,  79}, {  86,  82},
-    {  84,  84}, {  82,  86}, {  79,  88}, {  77,  90}, {  75,  91}, {  73,  93}, {  70,  95}, {  68,  97},
-    {  66,  98}, {  63, 100}, {  61, 102}, {  58, 103}, {  56, 104}, {  53, 106}, {  50, 107}, {  48, 108},
-    {  45, 109}, {  42, 111}, {  40, 112}, {  37, 112}, {  34, 113}, {  31, 114}, {  28, 115}, {  26, 116},
-    {  23, 116}, {  20, 117}, {  17, 117}, {  14, 118}, {  11, 118}, {   8, 118}, {   5, 118}, {   2, 118}
-  },
-  {  // x,y for mag=120 and nra=0:63
-    { 120,   0}, { 119,   2}, { 119,   5}, { 119,   8}, { 119,  11}, { 119,  14}, { 118,  17}, { 118,  20},
-    { 117,  23}, { 117,  26}, { 116,  29}, { 115,  32}, { 114,  34}, { 113,  37}, { 112,  40}, { 111,  43},
-    { 110,  45}, { 109,  48}, { 108,  51}, { 107,  53}, { 105,  56}, { 104,  59}, { 102,  61}, { 101,  64},
-    {  99,  66}, {  98,  69}, {  96,  71}, {  94,  73}, {  92,  76}, {  90,  78}, {  88,  80}, {  86,  82},
-    {  84,  84}, {  82,  86}, {  80,  88}, {  78,  90}, {  76,  92}, {  73,  94}, {  71,  96}, {  69,  98},
-    {  66,  99}, {  64, 101}, {  61, 102}, {  59, 104}, {  56, 105}, {  53, 107}, {  51, 108}, {  48, 109},
-    {  45, 110}, {  43, 111}, {  40, 112}, {  37, 113}, {  34, 114}, {  32, 115}, {  29, 116}, {  26, 117},
-    {  23, 117}, {  20, 118}, {  17, 118}, {  14, 119}, {  11, 119}, {   8, 119}, {   5, 119}, {   2, 119}
-  },
-  {  // x,y for mag=121 and nra=0:63
-    { 121,   0}, { 120,   2}, { 120,   5}, { 120,   8}, { 120,  11}, { 120,  14}, { 119,  17}, { 119,  20},
-    { 118,  23}, { 118,  26}, { 117,  29}, { 116,  32}, { 115,  35}, { 114,  37}, { 113,  40}, { 112,  43},
-    { 111,  46}, { 110,  49}, { 109,  51}, { 108,  54}, { 106,  57}, { 105,  59}, { 103,  62}, { 102,  64},
-    { 100,  67}, {  98,  69}, {  97,  72}, {  95,  74}, {  93,  76}, {  91,  79}, {  89,  81}, {  87,  83},
-    {  85,  85}, {  83,  87}, {  81,  89}, {  79,  91}, {  76,  93}, {  74,  95}, {  72,  97}, {  69,  98},
-    {  67, 100}, {  64, 102}, {  62, 103}, {  59, 105}, {  57, 106}, {  54, 108}, {  51, 109}, {  49, 110},
-    {  46, 111}, {  43, 112}, {  40, 113}, {  37, 114}, {  35, 115}, {  32, 116}, {  29, 117}, {  26, 118},
-    {  23, 118}, {  20, 119}, {  17, 119}, {  14, 120}, {  11, 120}, {   8, 120}, {   5, 120}, {   2, 120}
-  },
-  {  // x,y for mag=122 and nra=0:63
-    { 122,   0}, { 121,   2}, { 121,   5}, { 121,   8}, { 121,  11}, { 121,  14}, { 120,  17}, { 120,  20},
-    { 119,  23}, { 119,  26}, { 118,  29}, { 117,  32}, { 116,  35}, { 115,  38}, { 114,  41}, { 113,  43},
-    { 112,  46}, { 111,  49}, { 110,  52}, { 108,  54}, { 107,  57}, { 106,  60}, { 104,  62}, { 103,  65},
-    { 101,  67}, {  99,  70}, {  97,  72}, {  96,  75}, {  94,  77}, {  92,  79}, {  90,  81}, {  88,  84},
-    {  86,  86}, {  84,  88}, {  81,  90}, {  79,  92}, {  77,  94}, {  75,  96}, {  72,  97}, {  70,  99},
-    {  67, 101}, {  65, 103}, {  62, 104}, {  60, 106}, {  57, 107}, {  54, 108}, {  52, 110}, {  49, 111},
-    {  46, 112}, {  43, 113}, {  41, 114}, {  38, 115}, {  35, 116}, {  32, 117}, {  29, 118}, {  26, 119},
-    {  23, 119}, {  20, 120}, {  17, 120}, {  14, 121}, {  11, 121}, {   8, 121}, {   5, 121}, {   2, 121}
-  },
-  {  // x,y for mag=123 and nra=0:63
-    { 123,   0}, { 122,   3}, { 122,   6}, { 122,   9}, { 122,  12}, { 122,  15}, { 121,  18}, { 121,  21},
-    { 120,  23}, { 120,  26}, { 119,  29}, { 118,  32}, { 117,  35}, { 116,  38}, { 115,  41}, { 114,  44},
-    { 113,  47}, { 112,  49}, { 111,  52}, { 109,  55}, { 108,  57}, { 107,  60}, { 105,  63}, { 103,  65},
-    { 102,  68}, { 100,  70}, {  98,  73}, {  96,  75}, {  95,  78}, {  93,  80}, {  91,  82}, {  89,  84},
-    {  86,  86}, {  84,  89}, {  82,  91}, {  80,  93}, {  78,  95}, {  75,  96}, {  73,  98}, {  70, 100},
-    {  68, 102}, {  65, 103}, {  63, 105}, {  60, 107}, {  57, 108}, {  55, 109}, {  52, 111}, {  49, 112},
-    {  47, 113}, {  44, 114}, {  41, 115}, {  38, 116}, {  35, 117}, {  32, 118}, {  29, 119}, {  26, 120},
-    {  23, 120}, {  21, 121}, {  18, 121}, {  15, 122}, {  12, 122}, {   9, 122}, {   6, 122}, {   3, 122}
-  },
-  {  // x,y for mag=124 and nra=0:63
-    { 124,   0}, { 123,   3}, { 123,   6}, { 123,   9}, { 123,  12}, { 123,  15}, { 122,  18}, { 122,  21},
-    { 121,  24}, { 120,  27}, { 120,  30}, { 119,  33}, { 118,  35}, { 117,  38}, { 116,  41}, { 115,  44},
-    { 114,  47}, { 113,  50}, { 112,  53}, { 110,  55}, { 109,  58}, { 107,  61}, { 106,  63}, { 104,  66},
-    { 103,  68}, { 101,  71}, {  99,  73}, {  97,  76}, {  95,  78}, {  93,  80}, {  91,  83}, {  89,  85},
-    {  87,  87}, {  85,  89}, {  83,  91}, {  80,  93}, {  78,  95}, {  76,  97}, {  73,  99}, {  71, 101},
-    {  68, 103}, {  66, 104}, {  63, 106}, {  61, 107}, {  58, 109}, {  55, 110}, {  53, 112}, {  50, 113},
-    {  47, 114}, {  44, 115}, {  41, 116}, {  38, 117}, {  35, 118}, {  33, 119}, {  30, 120}, {  27, 120},
-    {  24, 121}, {  21, 122}, {  18, 122}, {  15, 123}, {  12, 123}, {   9, 123}, {   6, 123}, {   3, 123}
-  },
-  {  // x,y for mag=125 and nra=0:63
-    { 125,   0}, { 124,   3}, { 124,   6}, { 124,   9}, { 124,  12}, { 124,  15}, { 123,  18}, { 123,  21},
-    { 122,  24}, { 121,  27}, { 121,  30}, { 120,  33}, { 119,  36}, { 118,  39}, { 117,  42}, { 116,  44},
-    { 115,  47}, { 114,  50}, { 112,  53}, { 111,  56}, { 110,  58}, { 108,  61}, { 107,  64}, { 105,  66},
-    { 103,  69}, { 102,  71}, { 100,  74}, {  98,  76}, {  96,  79}, {  94,  81}, {  92,  83}, {  90,  86},
-    {  88,  88}, {  86,  90}, {  83,  92}, {  81,  94}, {  79,  96}, {  76,  98}, {  74, 100}, {  71, 102},
-    {  69, 103}, {  66, 105}, {  64, 107}, {  61, 108}, {  58, 110}, {  56, 111}, {  53, 112}, {  50, 114},
-    {  47, 115}, {  44, 116}, {  42, 117}, {  39, 118}, {  36, 119}, {  33, 120}, {  30, 121}, {  27, 121},
-    {  24, 122}, {  21, 123}, {  18, 123}, {  15, 124}, {  12, 124}, {   9, 124}, {   6, 124}, {   3, 124}
-  },
-  {  // x,y for mag=126 and nra=0:63
-    { 126,   0}, { 125,   3}, { 125,   6}, { 125,   9}, { 125,  12}, { 125,  15}, { 124,  18}, { 124,  21},
-    { 123,  24}, { 122,  27}, { 122,  30}, { 121,  33}, { 120,  36}, { 119,  39}, { 118,  42}, { 117,  45},
-    { 116,  48}, { 115,  51}, { 113,  53}, { 112,  56}, { 111,  59}, { 109,  62}, { 108,  64}, { 106,  67},
-    { 104,  70}, { 103,  72}, { 101,  75}, {  99,  77}, {  97,  79}, {  95,  82}, {  93,  84}, {  91,  86},
-    {  89,  89}, {  86,  91}, {  84,  93}, {  82,  95}, {  79,  97}, {  77,  99}, {  75, 101}, {  72, 103},
-    {  70, 104}, {  67, 106}, {  64, 108}, {  62, 109}, {  59, 111}, {  56, 112}, {  53, 113}, {  51, 115},
-    {  48, 116}, {  45, 117}, {  42, 118}, {  39, 119}, {  36, 120}, {  33, 121}, {  30, 122}, {  27, 122},
-    {  24, 123}, {  21, 124}, {  18, 124}, {  15, 125}, {  12, 125}, {   9, 125}, {   6, 125}, {   3, 125}
-  },
-  {  // x,y for mag=127 and nra=0:63
-    { 127,   0}, { 126,   3}, { 126,   6}, { 126,   9}, { 126,  12}, { 126,  15}, { 125,  18}, { 125,  21},
-    { 124,  24}, { 123,  27}, { 123,  30}, { 122,  33}, { 121,  36}, { 120,  39}, { 119,  42}, { 118,  45},
-    { 117,  48}, { 116,  51}, { 114,  54}, { 113,  57}, { 112,  59}, { 110,  62}, { 108,  65}, { 107,  67},
-    { 105,  70}, { 103,  73}, { 102,  75}, { 100,  78}, {  98,  80}, {  96,  82}, {  94,  85}, {  91,  87},
-    {  89,  89}, {  87,  91}, {  85,  94}, {  82,  96}, {  80,  98}, {  78, 100}, {  75, 102}, {  73, 103},
-    {  70, 105}, {  67, 107}, {  65, 108}, {  62, 110}, {  59, 112}, {  57, 113}, {  54, 114}, {  51, 116},
-    {  48, 117}, {  45, 118}, {  42, 119}, {  39, 120}, {  36, 121}, {  33, 122}, {  30, 123}, {  27, 123},
-    {  24, 124}, {  21, 125}, {  18, 125}, {  15, 126}, {  12, 126}, {   9, 126}, {   6, 126}, {   3, 126}
-  },
-  {  // x,y for mag=128 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  12}, { 127,  15}, { 126,  18}, { 126,  21},
-    { 125,  24}, { 124,  28}, { 124,  31}, { 123,  34}, { 122,  37}, { 121,  40}, { 120,  43}, { 119,  46},
-    { 118,  48}, { 117,  51}, { 115,  54}, { 114,  57}, { 112,  60}, { 111,  63}, { 109,  65}, { 108,  68},
-    { 106,  71}, { 104,  73}, { 102,  76}, { 100,  78}, {  98,  81}, {  96,  83}, {  94,  85}, {  92,  88},
-    {  90,  90}, {  88,  92}, {  85,  94}, {  83,  96}, {  81,  98}, {  78, 100}, {  76, 102}, {  73, 104},
-    {  71, 106}, {  68, 108}, {  65, 109}, {  63, 111}, {  60, 112}, {  57, 114}, {  54, 115}, {  51, 117},
-    {  48, 118}, {  46, 119}, {  43, 120}, {  40, 121}, {  37, 122}, {  34, 123}, {  31, 124}, {  28, 124},
-    {  24, 125}, {  21, 126}, {  18, 126}, {  15, 127}, {  12, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=129 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  12}, { 127,  15}, { 127,  18}, { 127,  22},
-    { 126,  25}, { 125,  28}, { 125,  31}, { 124,  34}, { 123,  37}, { 122,  40}, { 121,  43}, { 120,  46},
-    { 119,  49}, { 117,  52}, { 116,  55}, { 115,  57}, { 113,  60}, { 112,  63}, { 110,  66}, { 108,  69},
-    { 107,  71}, { 105,  74}, { 103,  76}, { 101,  79}, {  99,  81}, {  97,  84}, {  95,  86}, {  93,  88},
-    {  91,  91}, {  88,  93}, {  86,  95}, {  84,  97}, {  81,  99}, {  79, 101}, {  76, 103}, {  74, 105},
-    {  71, 107}, {  69, 108}, {  66, 110}, {  63, 112}, {  60, 113}, {  57, 115}, {  55, 116}, {  52, 117},
-    {  49, 119}, {  46, 120}, {  43, 121}, {  40, 122}, {  37, 123}, {  34, 124}, {  31, 125}, {  28, 125},
-    {  25, 126}, {  22, 127}, {  18, 127}, {  15, 127}, {  12, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=130 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  12}, { 127,  15}, { 127,  19}, { 127,  22},
-    { 127,  25}, { 126,  28}, { 126,  31}, { 125,  34}, { 124,  37}, { 123,  40}, { 122,  43}, { 121,  46},
-    { 120,  49}, { 118,  52}, { 117,  55}, { 116,  58}, { 114,  61}, { 113,  64}, { 111,  66}, { 109,  69},
-    { 108,  72}, { 106,  74}, { 104,  77}, { 102,  79}, { 100,  82}, {  98,  84}, {  96,  87}, {  94,  89},
-    {  91,  91}, {  89,  94}, {  87,  96}, {  84,  98}, {  82, 100}, {  79, 102}, {  77, 104}, {  74, 106},
-    {  72, 108}, {  69, 109}, {  66, 111}, {  64, 113}, {  61, 114}, {  58, 116}, {  55, 117}, {  52, 118},
-    {  49, 120}, {  46, 121}, {  43, 122}, {  40, 123}, {  37, 124}, {  34, 125}, {  31, 126}, {  28, 126},
-    {  25, 127}, {  22, 127}, {  19, 127}, {  15, 127}, {  12, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=131 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  12}, { 127,  16}, { 127,  19}, { 127,  22},
-    { 127,  25}, { 127,  28}, { 127,  31}, { 126,  34}, { 125,  38}, { 124,  41}, { 123,  44}, { 122,  47},
-    { 121,  50}, { 119,  53}, { 118,  56}, { 117,  58}, { 115,  61}, { 113,  64}, { 112,  67}, { 110,  70},
-    { 108,  72}, { 107,  75}, { 105,  78}, { 103,  80}, { 101,  83}, {  99,  85}, {  97,  87}, {  94,  90},
-    {  92,  92}, {  90,  94}, {  87,  97}, {  85,  99}, {  83, 101}, {  80, 103}, {  78, 105}, {  75, 107},
-    {  72, 108}, {  70, 110}, {  67, 112}, {  64, 113}, {  61, 115}, {  58, 117}, {  56, 118}, {  53, 119},
-    {  50, 121}, {  47, 122}, {  44, 123}, {  41, 124}, {  38, 125}, {  34, 126}, {  31, 127}, {  28, 127},
-    {  25, 127}, {  22, 127}, {  19, 127}, {  16, 127}, {  12, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=132 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  12}, { 127,  16}, { 127,  19}, { 127,  22},
-    { 127,  25}, { 127,  28}, { 127,  32}, { 127,  35}, { 126,  38}, { 125,  41}, { 124,  44}, { 123,  47},
-    { 121,  50}, { 120,  53}, { 119,  56}, { 117,  59}, { 116,  62}, { 114,  65}, { 113,  67}, { 111,  70},
-    { 109,  73}, { 107,  76}, { 106,  78}, { 104,  81}, { 102,  83}, {  99,  86}, {  97,  88}, {  95,  91},
-    {  93,  93}, {  91,  95}, {  88,  97}, {  86,  99}, {  83, 102}, {  81, 104}, {  78, 106}, {  76, 107},
-    {  73, 109}, {  70, 111}, {  67, 113}, {  65, 114}, {  62, 116}, {  59, 117}, {  56, 119}, {  53, 120},
-    {  50, 121}, {  47, 123}, {  44, 124}, {  41, 125}, {  38, 126}, {  35, 127}, {  32, 127}, {  28, 127},
-    {  25, 127}, {  22, 127}, {  19, 127}, {  16, 127}, {  12, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=133 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  13}, { 127,  16}, { 127,  19}, { 127,  22},
-    { 127,  25}, { 127,  29}, { 127,  32}, { 127,  35}, { 127,  38}, { 126,  41}, { 125,  44}, { 124,  47},
-    { 122,  50}, { 121,  53}, { 120,  56}, { 118,  59}, { 117,  62}, { 115,  65}, { 114,  68}, { 112,  71},
-    { 110,  73}, { 108,  76}, { 106,  79}, { 104,  81}, { 102,  84}, { 100,  86}, {  98,  89}, {  96,  91},
-    {  94,  94}, {  91,  96}, {  89,  98}, {  86, 100}, {  84, 102}, {  81, 104}, {  79, 106}, {  76, 108},
-    {  73, 110}, {  71, 112}, {  68, 114}, {  65, 115}, {  62, 117}, {  59, 118}, {  56, 120}, {  53, 121},
-    {  50, 122}, {  47, 124}, {  44, 125}, {  41, 126}, {  38, 127}, {  35, 127}, {  32, 127}, {  29, 127},
-    {  25, 127}, {  22, 127}, {  19, 127}, {  16, 127}, {  13, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=134 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  13}, { 127,  16}, { 127,  19}, { 127,  22},
-    { 127,  26}, { 127,  29}, { 127,  32}, { 127,  35}, { 127,  38}, { 127,  42}, { 126,  45}, { 125,  48},
-    { 123,  51}, { 122,  54}, { 121,  57}, { 119,  60}, { 118,  63}, { 116,  66}, { 114,  68}, { 113,  71},
-    { 111,  74}, { 109,  77}, { 107,  79}, { 105,  82}, { 103,  85}, { 101,  87}, {  99,  89}, {  97,  92},
-    {  94,  94}, {  92,  97}, {  89,  99}, {  87, 101}, {  85, 103}, {  82, 105}, {  79, 107}, {  77, 109},
-    {  74, 111}, {  71, 113}, {  68, 114}, {  66, 116}, {  63, 118}, {  60, 119}, {  57, 121}, {  54, 122},
-    {  51, 123}, {  48, 125}, {  45, 126}, {  42, 127}, {  38, 127}, {  35, 127}, {  32, 127}, {  29, 127},
-    {  26, 127}, {  22, 127}, {  19, 127}, {  16, 127}, {  13, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=135 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,   9}, { 127,  13}, { 127,  16}, { 127,  19}, { 127,  23},
-    { 127,  26}, { 127,  29}, { 127,  32}, { 127,  36}, { 127,  39}, { 127,  42}, { 127,  45}, { 125,  48},
-    { 124,  51}, { 123,  54}, { 122,  57}, { 120,  60}, { 119,  63}, { 117,  66}, { 115,  69}, { 114,  72},
-    { 112,  75}, { 110,  77}, { 108,  80}, { 106,  83}, { 104,  85}, { 102,  88}, { 100,  90}, {  97,  93},
-    {  95,  95}, {  93,  97}, {  90, 100}, {  88, 102}, {  85, 104}, {  83, 106}, {  80, 108}, {  77, 110},
-    {  75, 112}, {  72, 114}, {  69, 115}, {  66, 117}, {  63, 119}, {  60, 120}, {  57, 122}, {  54, 123},
-    {  51, 124}, {  48, 125}, {  45, 127}, {  42, 127}, {  39, 127}, {  36, 127}, {  32, 127}, {  29, 127},
-    {  26, 127}, {  23, 127}, {  19, 127}, {  16, 127}, {  13, 127}, {   9, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=136 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  16}, { 127,  19}, { 127,  23},
-    { 127,  26}, { 127,  29}, { 127,  33}, { 127,  36}, { 127,  39}, { 127,  42}, { 127,  45}, { 126,  48},
-    { 125,  52}, { 124,  55}, { 122,  58}, { 121,  61}, { 119,  64}, { 118,  67}, { 116,  69}, { 114,  72},
-    { 113,  75}, { 111,  78}, { 109,  81}, { 107,  83}, { 105,  86}, { 102,  88}, { 100,  91}, {  98,  93},
-    {  96,  96}, {  93,  98}, {  91, 100}, {  88, 102}, {  86, 105}, {  83, 107}, {  81, 109}, {  78, 111},
-    {  75, 113}, {  72, 114}, {  69, 116}, {  67, 118}, {  64, 119}, {  61, 121}, {  58, 122}, {  55, 124},
-    {  52, 125}, {  48, 126}, {  45, 127}, {  42, 127}, {  39, 127}, {  36, 127}, {  33, 127}, {  29, 127},
-    {  26, 127}, {  23, 127}, {  19, 127}, {  16, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=137 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  16}, { 127,  20}, { 127,  23},
-    { 127,  26}, { 127,  30}, { 127,  33}, { 127,  36}, { 127,  39}, { 127,  42}, { 127,  46}, { 127,  49},
-    { 126,  52}, { 125,  55}, { 123,  58}, { 122,  61}, { 120,  64}, { 119,  67}, { 117,  70}, { 115,  73},
-    { 113,  76}, { 112,  78}, { 110,  81}, { 108,  84}, { 105,  86}, { 103,  89}, { 101,  92}, {  99,  94},
-    {  96,  96}, {  94,  99}, {  92, 101}, {  89, 103}, {  86, 105}, {  84, 108}, {  81, 110}, {  78, 112},
-    {  76, 113}, {  73, 115}, {  70, 117}, {  67, 119}, {  64, 120}, {  61, 122}, {  58, 123}, {  55, 125},
-    {  52, 126}, {  49, 127}, {  46, 127}, {  42, 127}, {  39, 127}, {  36, 127}, {  33, 127}, {  30, 127},
-    {  26, 127}, {  23, 127}, {  20, 127}, {  16, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=138 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  16}, { 127,  20}, { 127,  23},
-    { 127,  26}, { 127,  30}, { 127,  33}, { 127,  36}, { 127,  40}, { 127,  43}, { 127,  46}, { 127,  49},
-    { 127,  52}, { 126,  55}, { 124,  59}, { 123,  62}, { 121,  65}, { 120,  68}, { 118,  70}, { 116,  73},
-    { 114,  76}, { 112,  79}, { 110,  82}, { 108,  84}, { 106,  87}, { 104,  90}, { 102,  92}, {  99,  95},
-    {  97,  97}, {  95,  99}, {  92, 102}, {  90, 104}, {  87, 106}, {  84, 108}, {  82, 110}, {  79, 112},
-    {  76, 114}, {  73, 116}, {  70, 118}, {  68, 120}, {  65, 121}, {  62, 123}, {  59, 124}, {  55, 126},
-    {  52, 127}, {  49, 127}, {  46, 127}, {  43, 127}, {  40, 127}, {  36, 127}, {  33, 127}, {  30, 127},
-    {  26, 127}, {  23, 127}, {  20, 127}, {  16, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=139 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  17}, { 127,  20}, { 127,  23},
-    { 127,  27}, { 127,  30}, { 127,  33}, { 127,  37}, { 127,  40}, { 127,  43}, { 127,  46}, { 127,  50},
-    { 127,  53}, { 127,  56}, { 125,  59}, { 124,  62}, { 122,  65}, { 120,  68}, { 119,  71}, { 117,  74},
-    { 115,  77}, { 113,  80}, { 111,  82}, { 109,  85}, { 107,  88}, { 105,  90}, { 102,  93}, { 100,  95},
-    {  98,  98}, {  95, 100}, {  93, 102}, {  90, 105}, {  88, 107}, {  85, 109}, {  82, 111}, {  80, 113},
-    {  77, 115}, {  74, 117}, {  71, 119}, {  68, 120}, {  65, 122}, {  62, 124}, {  59, 125}, {  56, 127},
-    {  53, 127}, {  50, 127}, {  46, 127}, {  43, 127}, {  40, 127}, {  37, 127}, {  33, 127}, {  30, 127},
-    {  27, 127}, {  23, 127}, {  20, 127}, {  17, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=140 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  17}, { 127,  20}, { 127,  23},
-    { 127,  27}, { 127,  30}, { 127,  34}, { 127,  37}, { 127,  40}, { 127,  43}, { 127,  47}, { 127,  50},
-    { 127,  53}, { 127,  56}, { 126,  59}, { 125,  62}, { 123,  65}, { 121,  69}, { 120,  71}, { 118,  74},
-    { 116,  77}, { 114,  80}, { 112,  83}, { 110,  86}, { 108,  88}, { 106,  91}, { 103,  94}, { 101,  96},
-    {  98,  98}, {  96, 101}, {  94, 103}, {  91, 106}, {  88, 108}, {  86, 110}, {  83, 112}, {  80, 114},
-    {  77, 116}, {  74, 118}, {  71, 120}, {  69, 121}, {  65, 123}, {  62, 125}, {  59, 126}, {  56, 127},
-    {  53, 127}, {  50, 127}, {  47, 127}, {  43, 127}, {  40, 127}, {  37, 127}, {  34, 127}, {  30, 127},
-    {  27, 127}, {  23, 127}, {  20, 127}, {  17, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=141 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  17}, { 127,  20}, { 127,  24},
-    { 127,  27}, { 127,  30}, { 127,  34}, { 127,  37}, { 127,  40}, { 127,  44}, { 127,  47}, { 127,  50},
-    { 127,  53}, { 127,  57}, { 127,  60}, { 125,  63}, { 124,  66}, { 122,  69}, { 120,  72}, { 119,  75},
-    { 117,  78}, { 115,  81}, { 113,  83}, { 111,  86}, { 108,  89}, { 106,  92}, { 104,  94}, { 102,  97},
-    {  99,  99}, {  97, 102}, {  94, 104}, {  92, 106}, {  89, 108}, {  86, 111}, {  83, 113}, {  81, 115},
-    {  78, 117}, {  75, 119}, {  72, 120}, {  69, 122}, {  66, 124}, {  63, 125}, {  60, 127}, {  57, 127},
-    {  53, 127}, {  50, 127}, {  47, 127}, {  44, 127}, {  40, 127}, {  37, 127}, {  34, 127}, {  30, 127},
-    {  27, 127}, {  24, 127}, {  20, 127}, {  17, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=142 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   6}, { 127,  10}, { 127,  13}, { 127,  17}, { 127,  20}, { 127,  24},
-    { 127,  27}, { 127,  31}, { 127,  34}, { 127,  37}, { 127,  41}, { 127,  44}, { 127,  47}, { 127,  51},
-    { 127,  54}, { 127,  57}, { 127,  60}, { 126,  63}, { 125,  66}, { 123,  69}, { 121,  73}, { 119,  75},
-    { 118,  78}, { 116,  81}, { 114,  84}, { 111,  87}, { 109,  90}, { 107,  92}, { 105,  95}, { 102,  97},
-    { 100, 100}, {  97, 102}, {  95, 105}, {  92, 107}, {  90, 109}, {  87, 111}, {  84, 114}, {  81, 116},
-    {  78, 118}, {  75, 119}, {  73, 121}, {  69, 123}, {  66, 125}, {  63, 126}, {  60, 127}, {  57, 127},
-    {  54, 127}, {  51, 127}, {  47, 127}, {  44, 127}, {  41, 127}, {  37, 127}, {  34, 127}, {  31, 127},
-    {  27, 127}, {  24, 127}, {  20, 127}, {  17, 127}, {  13, 127}, {  10, 127}, {   6, 127}, {   3, 127}
-  },
-  {  // x,y for mag=143 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  17}, { 127,  20}, { 127,  24},
-    { 127,  27}, { 127,  31}, { 127,  34}, { 127,  38}, { 127,  41}, { 127,  44}, { 127,  48}, { 127,  51},
-    { 127,  54}, { 127,  57}, { 127,  61}, { 127,  64}, { 126,  67}, { 124,  70}, { 122,  73}, { 120,  76},
-    { 118,  79}, { 116,  82}, { 114,  85}, { 112,  87}, { 110,  90}, { 108,  93}, { 105,  96}, { 103,  98},
-    { 101, 101}, {  98, 103}, {  96, 105}, {  93, 108}, {  90, 110}, {  87, 112}, {  85, 114}, {  82, 116},
-    {  79, 118}, {  76, 120}, {  73, 122}, {  70, 124}, {  67, 126}, {  64, 127}, {  61, 127}, {  57, 127},
-    {  54, 127}, {  51, 127}, {  48, 127}, {  44, 127}, {  41, 127}, {  38, 127}, {  34, 127}, {  31, 127},
-    {  27, 127}, {  24, 127}, {  20, 127}, {  17, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=144 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  17}, { 127,  21}, { 127,  24},
-    { 127,  28}, { 127,  31}, { 127,  34}, { 127,  38}, { 127,  41}, { 127,  45}, { 127,  48}, { 127,  51},
-    { 127,  55}, { 127,  58}, { 127,  61}, { 127,  64}, { 126,  67}, { 125,  70}, { 123,  74}, { 121,  77},
-    { 119,  80}, { 117,  82}, { 115,  85}, { 113,  88}, { 111,  91}, { 109,  94}, { 106,  96}, { 104,  99},
-    { 101, 101}, {  99, 104}, {  96, 106}, {  94, 109}, {  91, 111}, {  88, 113}, {  85, 115}, {  82, 117},
-    {  80, 119}, {  77, 121}, {  74, 123}, {  70, 125}, {  67, 126}, {  64, 127}, {  61, 127}, {  58, 127},
-    {  55, 127}, {  51, 127}, {  48, 127}, {  45, 127}, {  41, 127}, {  38, 127}, {  34, 127}, {  31, 127},
-    {  28, 127}, {  24, 127}, {  21, 127}, {  17, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=145 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  17}, { 127,  21}, { 127,  24},
-    { 127,  28}, { 127,  31}, { 127,  35}, { 127,  38}, { 127,  42}, { 127,  45}, { 127,  48}, { 127,  52},
-    { 127,  55}, { 127,  58}, { 127,  61}, { 127,  65}, { 127,  68}, { 126,  71}, { 124,  74}, { 122,  77},
-    { 120,  80}, { 118,  83}, { 116,  86}, { 114,  89}, { 112,  91}, { 109,  94}, { 107,  97}, { 105,  99},
-    { 102, 102}, {  99, 105}, {  97, 107}, {  94, 109}, {  91, 112}, {  89, 114}, {  86, 116}, {  83, 118},
-    {  80, 120}, {  77, 122}, {  74, 124}, {  71, 126}, {  68, 127}, {  65, 127}, {  61, 127}, {  58, 127},
-    {  55, 127}, {  52, 127}, {  48, 127}, {  45, 127}, {  42, 127}, {  38, 127}, {  35, 127}, {  31, 127},
-    {  28, 127}, {  24, 127}, {  21, 127}, {  17, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=146 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  17}, { 127,  21}, { 127,  24},
-    { 127,  28}, { 127,  31}, { 127,  35}, { 127,  38}, { 127,  42}, { 127,  45}, { 127,  49}, { 127,  52},
-    { 127,  55}, { 127,  59}, { 127,  62}, { 127,  65}, { 127,  68}, { 127,  71}, { 125,  75}, { 123,  78},
-    { 121,  81}, { 119,  84}, { 117,  86}, { 115,  89}, { 112,  92}, { 110,  95}, { 108,  98}, { 105, 100},
-    { 103, 103}, { 100, 105}, {  98, 108}, {  95, 110}, {  92, 112}, {  89, 115}, {  86, 117}, {  84, 119},
-    {  81, 121}, {  78, 123}, {  75, 125}, {  71, 127}, {  68, 127}, {  65, 127}, {  62, 127}, {  59, 127},
-    {  55, 127}, {  52, 127}, {  49, 127}, {  45, 127}, {  42, 127}, {  38, 127}, {  35, 127}, {  31, 127},
-    {  28, 127}, {  24, 127}, {  21, 127}, {  17, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=147 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  17}, { 127,  21}, { 127,  25},
-    { 127,  28}, { 127,  32}, { 127,  35}, { 127,  39}, { 127,  42}, { 127,  46}, { 127,  49}, { 127,  52},
-    { 127,  56}, { 127,  59}, { 127,  62}, { 127,  66}, { 127,  69}, { 127,  72}, { 126,  75}, { 124,  78},
-    { 122,  81}, { 120,  84}, { 118,  87}, { 115,  90}, { 113,  93}, { 111,  96}, { 108,  98}, { 106, 101},
-    { 103, 103}, { 101, 106}, {  98, 108}, {  96, 111}, {  93, 113}, {  90, 115}, {  87, 118}, {  84, 120},
-    {  81, 122}, {  78, 124}, {  75, 126}, {  72, 127}, {  69, 127}, {  66, 127}, {  62, 127}, {  59, 127},
-    {  56, 127}, {  52, 127}, {  49, 127}, {  46, 127}, {  42, 127}, {  39, 127}, {  35, 127}, {  32, 127},
-    {  28, 127}, {  25, 127}, {  21, 127}, {  17, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=148 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  18}, { 127,  21}, { 127,  25},
-    { 127,  28}, { 127,  32}, { 127,  35}, { 127,  39}, { 127,  42}, { 127,  46}, { 127,  49}, { 127,  53},
-    { 127,  56}, { 127,  59}, { 127,  63}, { 127,  66}, { 127,  69}, { 127,  72}, { 126,  76}, { 125,  79},
-    { 123,  82}, { 121,  85}, { 118,  88}, { 116,  91}, { 114,  93}, { 112,  96}, { 109,  99}, { 107, 102},
-    { 104, 104}, { 102, 107}, {  99, 109}, {  96, 112}, {  93, 114}, {  91, 116}, {  88, 118}, {  85, 121},
-    {  82, 123}, {  79, 125}, {  76, 126}, {  72, 127}, {  69, 127}, {  66, 127}, {  63, 127}, {  59, 127},
-    {  56, 127}, {  53, 127}, {  49, 127}, {  46, 127}, {  42, 127}, {  39, 127}, {  35, 127}, {  32, 127},
-    {  28, 127}, {  25, 127}, {  21, 127}, {  18, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=149 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  10}, { 127,  14}, { 127,  18}, { 127,  21}, { 127,  25},
-    { 127,  29}, { 127,  32}, { 127,  36}, { 127,  39}, { 127,  43}, { 127,  46}, { 127,  50}, { 127,  53},
-    { 127,  57}, { 127,  60}, { 127,  63}, { 127,  66}, { 127,  70}, { 127,  73}, { 127,  76}, { 125,  79},
-    { 123,  82}, { 121,  85}, { 119,  88}, { 117,  91}, { 115,  94}, { 112,  97}, { 110, 100}, { 107, 102},
-    { 105, 105}, { 102, 107}, { 100, 110}, {  97, 112}, {  94, 115}, {  91, 117}, {  88, 119}, {  85, 121},
-    {  82, 123}, {  79, 125}, {  76, 127}, {  73, 127}, {  70, 127}, {  66, 127}, {  63, 127}, {  60, 127},
-    {  57, 127}, {  53, 127}, {  50, 127}, {  46, 127}, {  43, 127}, {  39, 127}, {  36, 127}, {  32, 127},
-    {  29, 127}, {  25, 127}, {  21, 127}, {  18, 127}, {  14, 127}, {  10, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=150 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  14}, { 127,  18}, { 127,  22}, { 127,  25},
-    { 127,  29}, { 127,  32}, { 127,  36}, { 127,  40}, { 127,  43}, { 127,  47}, { 127,  50}, { 127,  53},
-    { 127,  57}, { 127,  60}, { 127,  64}, { 127,  67}, { 127,  70}, { 127,  73}, { 127,  77}, { 126,  80},
-    { 124,  83}, { 122,  86}, { 120,  89}, { 118,  92}, { 115,  95}, { 113,  97}, { 111, 100}, { 108, 103},
-    { 106, 106}, { 103, 108}, { 100, 111}, {  97, 113}, {  95, 115}, {  92, 118}, {  89, 120}, {  86, 122},
-    {  83, 124}, {  80, 126}, {  77, 127}, {  73, 127}, {  70, 127}, {  67, 127}, {  64, 127}, {  60, 127},
-    {  57, 127}, {  53, 127}, {  50, 127}, {  47, 127}, {  43, 127}, {  40, 127}, {  36, 127}, {  32, 127},
-    {  29, 127}, {  25, 127}, {  22, 127}, {  18, 127}, {  14, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=151 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  14}, { 127,  18}, { 127,  22}, { 127,  25},
-    { 127,  29}, { 127,  33}, { 127,  36}, { 127,  40}, { 127,  43}, { 127,  47}, { 127,  50}, { 127,  54},
-    { 127,  57}, { 127,  61}, { 127,  64}, { 127,  67}, { 127,  71}, { 127,  74}, { 127,  77}, { 127,  80},
-    { 125,  83}, { 123,  86}, { 121,  89}, { 119,  92}, { 116,  95}, { 114,  98}, { 111, 101}, { 109, 104},
-    { 106, 106}, { 104, 109}, { 101, 111}, {  98, 114}, {  95, 116}, {  92, 119}, {  89, 121}, {  86, 123},
-    {  83, 125}, {  80, 127}, {  77, 127}, {  74, 127}, {  71, 127}, {  67, 127}, {  64, 127}, {  61, 127},
-    {  57, 127}, {  54, 127}, {  50, 127}, {  47, 127}, {  43, 127}, {  40, 127}, {  36, 127}, {  33, 127},
-    {  29, 127}, {  25, 127}, {  22, 127}, {  18, 127}, {  14, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=152 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  14}, { 127,  18}, { 127,  22}, { 127,  25},
-    { 127,  29}, { 127,  33}, { 127,  36}, { 127,  40}, { 127,  44}, { 127,  47}, { 127,  51}, { 127,  54},
-    { 127,  58}, { 127,  61}, { 127,  64}, { 127,  68}, { 127,  71}, { 127,  74}, { 127,  78}, { 127,  81},
-    { 126,  84}, { 124,  87}, { 122,  90}, { 119,  93}, { 117,  96}, { 115,  99}, { 112, 102}, { 110, 104},
-    { 107, 107}, { 104, 110}, { 102, 112}, {  99, 115}, {  96, 117}, {  93, 119}, {  90, 122}, {  87, 124},
-    {  84, 126}, {  81, 127}, {  78, 127}, {  74, 127}, {  71, 127}, {  68, 127}, {  64, 127}, {  61, 127},
-    {  58, 127}, {  54, 127}, {  51, 127}, {  47, 127}, {  44, 127}, {  40, 127}, {  36, 127}, {  33, 127},
-    {  29, 127}, {  25, 127}, {  22, 127}, {  18, 127}, {  14, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=153 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  14}, { 127,  18}, { 127,  22}, { 127,  26},
-    { 127,  29}, { 127,  33}, { 127,  37}, { 127,  40}, { 127,  44}, { 127,  47}, { 127,  51}, { 127,  55},
-    { 127,  58}, { 127,  62}, { 127,  65}, { 127,  68}, { 127,  72}, { 127,  75}, { 127,  78}, { 127,  81},
-    { 127,  85}, { 125,  88}, { 122,  91}, { 120,  94}, { 118,  97}, { 115,  99}, { 113, 102}, { 110, 105},
-    { 108, 108}, { 105, 110}, { 102, 113}, {  99, 115}, {  97, 118}, {  94, 120}, {  91, 122}, {  88, 125},
-    {  85, 127}, {  81, 127}, {  78, 127}, {  75, 127}, {  72, 127}, {  68, 127}, {  65, 127}, {  62, 127},
-    {  58, 127}, {  55, 127}, {  51, 127}, {  47, 127}, {  44, 127}, {  40, 127}, {  37, 127}, {  33, 127},
-    {  29, 127}, {  26, 127}, {  22, 127}, {  18, 127}, {  14, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=154 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  18}, { 127,  22}, { 127,  26},
-    { 127,  30}, { 127,  33}, { 127,  37}, { 127,  41}, { 127,  44}, { 127,  48}, { 127,  51}, { 127,  55},
-    { 127,  58}, { 127,  62}, { 127,  65}, { 127,  69}, { 127,  72}, { 127,  75}, { 127,  79}, { 127,  82},
-    { 127,  85}, { 125,  88}, { 123,  91}, { 121,  94}, { 119,  97}, { 116, 100}, { 114, 103}, { 111, 106},
-    { 108, 108}, { 106, 111}, { 103, 114}, { 100, 116}, {  97, 119}, {  94, 121}, {  91, 123}, {  88, 125},
-    {  85, 127}, {  82, 127}, {  79, 127}, {  75, 127}, {  72, 127}, {  69, 127}, {  65, 127}, {  62, 127},
-    {  58, 127}, {  55, 127}, {  51, 127}, {  48, 127}, {  44, 127}, {  41, 127}, {  37, 127}, {  33, 127},
-    {  30, 127}, {  26, 127}, {  22, 127}, {  18, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=155 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  18}, { 127,  22}, { 127,  26},
-    { 127,  30}, { 127,  33}, { 127,  37}, { 127,  41}, { 127,  44}, { 127,  48}, { 127,  52}, { 127,  55},
-    { 127,  59}, { 127,  62}, { 127,  66}, { 127,  69}, { 127,  73}, { 127,  76}, { 127,  79}, { 127,  82},
-    { 127,  86}, { 126,  89}, { 124,  92}, { 122,  95}, { 119,  98}, { 117, 101}, { 114, 104}, { 112, 106},
-    { 109, 109}, { 106, 112}, { 104, 114}, { 101, 117}, {  98, 119}, {  95, 122}, {  92, 124}, {  89, 126},
-    {  86, 127}, {  82, 127}, {  79, 127}, {  76, 127}, {  73, 127}, {  69, 127}, {  66, 127}, {  62, 127},
-    {  59, 127}, {  55, 127}, {  52, 127}, {  48, 127}, {  44, 127}, {  41, 127}, {  37, 127}, {  33, 127},
-    {  30, 127}, {  26, 127}, {  22, 127}, {  18, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=156 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  22}, { 127,  26},
-    { 127,  30}, { 127,  34}, { 127,  37}, { 127,  41}, { 127,  45}, { 127,  48}, { 127,  52}, { 127,  56},
-    { 127,  59}, { 127,  63}, { 127,  66}, { 127,  70}, { 127,  73}, { 127,  76}, { 127,  80}, { 127,  83},
-    { 127,  86}, { 127,  89}, { 125,  92}, { 122,  95}, { 120,  98}, { 118, 101}, { 115, 104}, { 112, 107},
-    { 110, 110}, { 107, 112}, { 104, 115}, { 101, 118}, {  98, 120}, {  95, 122}, {  92, 125}, {  89, 127},
-    {  86, 127}, {  83, 127}, {  80, 127}, {  76, 127}, {  73, 127}, {  70, 127}, {  66, 127}, {  63, 127},
-    {  59, 127}, {  56, 127}, {  52, 127}, {  48, 127}, {  45, 127}, {  41, 127}, {  37, 127}, {  34, 127},
-    {  30, 127}, {  26, 127}, {  22, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=157 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  26},
-    { 127,  30}, { 127,  34}, { 127,  38}, { 127,  41}, { 127,  45}, { 127,  49}, { 127,  52}, { 127,  56},
-    { 127,  60}, { 127,  63}, { 127,  67}, { 127,  70}, { 127,  74}, { 127,  77}, { 127,  80}, { 127,  83},
-    { 127,  87}, { 127,  90}, { 126,  93}, { 123,  96}, { 121,  99}, { 118, 102}, { 116, 105}, { 113, 108},
-    { 111, 111}, { 108, 113}, { 105, 116}, { 102, 118}, {  99, 121}, {  96, 123}, {  93, 126}, {  90, 127},
-    {  87, 127}, {  83, 127}, {  80, 127}, {  77, 127}, {  74, 127}, {  70, 127}, {  67, 127}, {  63, 127},
-    {  60, 127}, {  56, 127}, {  52, 127}, {  49, 127}, {  45, 127}, {  41, 127}, {  38, 127}, {  34, 127},
-    {  30, 127}, {  26, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=158 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  30}, { 127,  34}, { 127,  38}, { 127,  42}, { 127,  45}, { 127,  49}, { 127,  53}, { 127,  56},
-    { 127,  60}, { 127,  64}, { 127,  67}, { 127,  71}, { 127,  74}, { 127,  77}, { 127,  81}, { 127,  84},
-    { 127,  87}, { 127,  90}, { 126,  94}, { 124,  97}, { 122, 100}, { 119, 103}, { 117, 106}, { 114, 108},
-    { 111, 111}, { 108, 114}, { 106, 117}, { 103, 119}, { 100, 122}, {  97, 124}, {  94, 126}, {  90, 127},
-    {  87, 127}, {  84, 127}, {  81, 127}, {  77, 127}, {  74, 127}, {  71, 127}, {  67, 127}, {  64, 127},
-    {  60, 127}, {  56, 127}, {  53, 127}, {  49, 127}, {  45, 127}, {  42, 127}, {  38, 127}, {  34, 127},
-    {  30, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=159 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  31}, { 127,  34}, { 127,  38}, { 127,  42}, { 127,  46}, { 127,  49}, { 127,  53}, { 127,  57},
-    { 127,  60}, { 127,  64}, { 127,  67}, { 127,  71}, { 127,  74}, { 127,  78}, { 127,  81}, { 127,  85},
-    { 127,  88}, { 127,  91}, { 127,  94}, { 125,  97}, { 122, 100}, { 120, 103}, { 117, 106}, { 115, 109},
-    { 112, 112}, { 109, 115}, { 106, 117}, { 103, 120}, { 100, 122}, {  97, 125}, {  94, 127}, {  91, 127},
-    {  88, 127}, {  85, 127}, {  81, 127}, {  78, 127}, {  74, 127}, {  71, 127}, {  67, 127}, {  64, 127},
-    {  60, 127}, {  57, 127}, {  53, 127}, {  49, 127}, {  46, 127}, {  42, 127}, {  38, 127}, {  34, 127},
-    {  31, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=160 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  31}, { 127,  35}, { 127,  38}, { 127,  42}, { 127,  46}, { 127,  50}, { 127,  53}, { 127,  57},
-    { 127,  61}, { 127,  64}, { 127,  68}, { 127,  71}, { 127,  75}, { 127,  78}, { 127,  82}, { 127,  85},
-    { 127,  88}, { 127,  92}, { 127,  95}, { 126,  98}, { 123, 101}, { 121, 104}, { 118, 107}, { 115, 110},
-    { 113, 113}, { 110, 115}, { 107, 118}, { 104, 121}, { 101, 123}, {  98, 126}, {  95, 127}, {  92, 127},
-    {  88, 127}, {  85, 127}, {  82, 127}, {  78, 127}, {  75, 127}, {  71, 127}, {  68, 127}, {  64, 127},
-    {  61, 127}, {  57, 127}, {  53, 127}, {  50, 127}, {  46, 127}, {  42, 127}, {  38, 127}, {  35, 127},
-    {  31, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=161 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  31}, { 127,  35}, { 127,  39}, { 127,  42}, { 127,  46}, { 127,  50}, { 127,  54}, { 127,  57},
-    { 127,  61}, { 127,  65}, { 127,  68}, { 127,  72}, { 127,  75}, { 127,  79}, { 127,  82}, { 127,  86},
-    { 127,  89}, { 127,  92}, { 127,  95}, { 126,  99}, { 124, 102}, { 121, 105}, { 119, 108}, { 116, 111},
-    { 113, 113}, { 111, 116}, { 108, 119}, { 105, 121}, { 102, 124}, {  99, 126}, {  95, 127}, {  92, 127},
-    {  89, 127}, {  86, 127}, {  82, 127}, {  79, 127}, {  75, 127}, {  72, 127}, {  68, 127}, {  65, 127},
-    {  61, 127}, {  57, 127}, {  54, 127}, {  50, 127}, {  46, 127}, {  42, 127}, {  39, 127}, {  35, 127},
-    {  31, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=162 and nra=0:63
-    { 127,   0}, { 127,   3}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  31}, { 127,  35}, { 127,  39}, { 127,  43}, { 127,  47}, { 127,  50}, { 127,  54}, { 127,  58},
-    { 127,  61}, { 127,  65}, { 127,  69}, { 127,  72}, { 127,  76}, { 127,  79}, { 127,  83}, { 127,  86},
-    { 127,  90}, { 127,  93}, { 127,  96}, { 127,  99}, { 125, 102}, { 122, 105}, { 120, 108}, { 117, 111},
-    { 114, 114}, { 111, 117}, { 108, 120}, { 105, 122}, { 102, 125}, {  99, 127}, {  96, 127}, {  93, 127},
-    {  90, 127}, {  86, 127}, {  83, 127}, {  79, 127}, {  76, 127}, {  72, 127}, {  69, 127}, {  65, 127},
-    {  61, 127}, {  58, 127}, {  54, 127}, {  50, 127}, {  47, 127}, {  43, 127}, {  39, 127}, {  35, 127},
-    {  31, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   3, 127}
-  },
-  {  // x,y for mag=163 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   7}, { 127,  11}, { 127,  15}, { 127,  19}, { 127,  23}, { 127,  27},
-    { 127,  31}, { 127,  35}, { 127,  39}, { 127,  43}, { 127,  47}, { 127,  51}, { 127,  54}, { 127,  58},
-    { 127,  62}, { 127,  66}, { 127,  69}, { 127,  73}, { 127,  76}, { 127,  80}, { 127,  83}, { 127,  87},
-    { 127,  90}, { 127,  93}, { 127,  97}, { 127, 100}, { 126, 103}, { 123, 106}, { 120, 109}, { 118, 112},
-    { 115, 115}, { 112, 118}, { 109, 120}, { 106, 123}, { 103, 126}, { 100, 127}, {  97, 127}, {  93, 127},
-    {  90, 127}, {  87, 127}, {  83, 127}, {  80, 127}, {  76, 127}, {  73, 127}, {  69, 127}, {  66, 127},
-    {  62, 127}, {  58, 127}, {  54, 127}, {  51, 127}, {  47, 127}, {  43, 127}, {  39, 127}, {  35, 127},
-    {  31, 127}, {  27, 127}, {  23, 127}, {  19, 127}, {  15, 127}, {  11, 127}, {   7, 127}, {   4, 127}
-  },
-  {  // x,y for mag=164 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  31}, { 127,  35}, { 127,  39}, { 127,  43}, { 127,  47}, { 127,  51}, { 127,  55}, { 127,  59},
-    { 127,  62}, { 127,  66}, { 127,  70}, { 127,  73}, { 127,  77}, { 127,  80}, { 127,  84}, { 127,  87},
-    { 127,  91}, { 127,  94}, { 127,  97}, { 127, 100}, { 126, 104}, { 124, 107}, { 121, 110}, { 118, 113},
-    { 115, 115}, { 113, 118}, { 110, 121}, { 107, 124}, { 104, 126}, { 100, 127}, {  97, 127}, {  94, 127},
-    {  91, 127}, {  87, 127}, {  84, 127}, {  80, 127}, {  77, 127}, {  73, 127}, {  70, 127}, {  66, 127},
-    {  62, 127}, {  59, 127}, {  55, 127}, {  51, 127}, {  47, 127}, {  43, 127}, {  39, 127}, {  35, 127},
-    {  31, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=165 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  32}, { 127,  36}, { 127,  40}, { 127,  44}, { 127,  47}, { 127,  51}, { 127,  55}, { 127,  59},
-    { 127,  63}, { 127,  66}, { 127,  70}, { 127,  74}, { 127,  77}, { 127,  81}, { 127,  84}, { 127,  88},
-    { 127,  91}, { 127,  95}, { 127,  98}, { 127, 101}, { 127, 104}, { 124, 107}, { 122, 110}, { 119, 113},
-    { 116, 116}, { 113, 119}, { 110, 122}, { 107, 124}, { 104, 127}, { 101, 127}, {  98, 127}, {  95, 127},
-    {  91, 127}, {  88, 127}, {  84, 127}, {  81, 127}, {  77, 127}, {  74, 127}, {  70, 127}, {  66, 127},
-    {  63, 127}, {  59, 127}, {  55, 127}, {  51, 127}, {  47, 127}, {  44, 127}, {  40, 127}, {  36, 127},
-    {  32, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=166 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  32}, { 127,  36}, { 127,  40}, { 127,  44}, { 127,  48}, { 127,  52}, { 127,  55}, { 127,  59},
-    { 127,  63}, { 127,  67}, { 127,  70}, { 127,  74}, { 127,  78}, { 127,  81}, { 127,  85}, { 127,  88},
-    { 127,  92}, { 127,  95}, { 127,  98}, { 127, 102}, { 127, 105}, { 125, 108}, { 122, 111}, { 120, 114},
-    { 117, 117}, { 114, 120}, { 111, 122}, { 108, 125}, { 105, 127}, { 102, 127}, {  98, 127}, {  95, 127},
-    {  92, 127}, {  88, 127}, {  85, 127}, {  81, 127}, {  78, 127}, {  74, 127}, {  70, 127}, {  67, 127},
-    {  63, 127}, {  59, 127}, {  55, 127}, {  52, 127}, {  48, 127}, {  44, 127}, {  40, 127}, {  36, 127},
-    {  32, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=167 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  32}, { 127,  36}, { 127,  40}, { 127,  44}, { 127,  48}, { 127,  52}, { 127,  56}, { 127,  60},
-    { 127,  63}, { 127,  67}, { 127,  71}, { 127,  75}, { 127,  78}, { 127,  82}, { 127,  85}, { 127,  89},
-    { 127,  92}, { 127,  96}, { 127,  99}, { 127, 102}, { 127, 105}, { 126, 109}, { 123, 112}, { 120, 115},
-    { 118, 118}, { 115, 120}, { 112, 123}, { 109, 126}, { 105, 127}, { 102, 127}, {  99, 127}, {  96, 127},
-    {  92, 127}, {  89, 127}, {  85, 127}, {  82, 127}, {  78, 127}, {  75, 127}, {  71, 127}, {  67, 127},
-    {  63, 127}, {  60, 127}, {  56, 127}, {  52, 127}, {  48, 127}, {  44, 127}, {  40, 127}, {  36, 127},
-    {  32, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=168 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  32}, { 127,  36}, { 127,  40}, { 127,  44}, { 127,  48}, { 127,  52}, { 127,  56}, { 127,  60},
-    { 127,  64}, { 127,  68}, { 127,  71}, { 127,  75}, { 127,  79}, { 127,  82}, { 127,  86}, { 127,  89},
-    { 127,  93}, { 127,  96}, { 127, 100}, { 127, 103}, { 127, 106}, { 127, 109}, { 124, 112}, { 121, 115},
-    { 118, 118}, { 115, 121}, { 112, 124}, { 109, 127}, { 106, 127}, { 103, 127}, { 100, 127}, {  96, 127},
-    {  93, 127}, {  89, 127}, {  86, 127}, {  82, 127}, {  79, 127}, {  75, 127}, {  71, 127}, {  68, 127},
-    {  64, 127}, {  60, 127}, {  56, 127}, {  52, 127}, {  48, 127}, {  44, 127}, {  40, 127}, {  36, 127},
-    {  32, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=169 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  28},
-    { 127,  32}, { 127,  37}, { 127,  41}, { 127,  45}, { 127,  49}, { 127,  53}, { 127,  56}, { 127,  60},
-    { 127,  64}, { 127,  68}, { 127,  72}, { 127,  75}, { 127,  79}, { 127,  83}, { 127,  86}, { 127,  90},
-    { 127,  93}, { 127,  97}, { 127, 100}, { 127, 103}, { 127, 107}, { 127, 110}, { 125, 113}, { 122, 116},
-    { 119, 119}, { 116, 122}, { 113, 125}, { 110, 127}, { 107, 127}, { 103, 127}, { 100, 127}, {  97, 127},
-    {  93, 127}, {  90, 127}, {  86, 127}, {  83, 127}, {  79, 127}, {  75, 127}, {  72, 127}, {  68, 127},
-    {  64, 127}, {  60, 127}, {  56, 127}, {  53, 127}, {  49, 127}, {  45, 127}, {  41, 127}, {  37, 127},
-    {  32, 127}, {  28, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=170 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  24}, { 127,  29},
-    { 127,  33}, { 127,  37}, { 127,  41}, { 127,  45}, { 127,  49}, { 127,  53}, { 127,  57}, { 127,  61},
-    { 127,  65}, { 127,  68}, { 127,  72}, { 127,  76}, { 127,  80}, { 127,  83}, { 127,  87}, { 127,  90},
-    { 127,  94}, { 127,  97}, { 127, 101}, { 127, 104}, { 127, 107}, { 127, 111}, { 125, 114}, { 123, 117},
-    { 120, 120}, { 117, 123}, { 114, 125}, { 111, 127}, { 107, 127}, { 104, 127}, { 101, 127}, {  97, 127},
-    {  94, 127}, {  90, 127}, {  87, 127}, {  83, 127}, {  80, 127}, {  76, 127}, {  72, 127}, {  68, 127},
-    {  65, 127}, {  61, 127}, {  57, 127}, {  53, 127}, {  49, 127}, {  45, 127}, {  41, 127}, {  37, 127},
-    {  33, 127}, {  29, 127}, {  24, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=171 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  20}, { 127,  25}, { 127,  29},
-    { 127,  33}, { 127,  37}, { 127,  41}, { 127,  45}, { 127,  49}, { 127,  53}, { 127,  57}, { 127,  61},
-    { 127,  65}, { 127,  69}, { 127,  73}, { 127,  76}, { 127,  80}, { 127,  84}, { 127,  87}, { 127,  91},
-    { 127,  95}, { 127,  98}, { 127, 101}, { 127, 105}, { 127, 108}, { 127, 111}, { 126, 114}, { 123, 117},
-    { 120, 120}, { 117, 123}, { 114, 126}, { 111, 127}, { 108, 127}, { 105, 127}, { 101, 127}, {  98, 127},
-    {  95, 127}, {  91, 127}, {  87, 127}, {  84, 127}, {  80, 127}, {  76, 127}, {  73, 127}, {  69, 127},
-    {  65, 127}, {  61, 127}, {  57, 127}, {  53, 127}, {  49, 127}, {  45, 127}, {  41, 127}, {  37, 127},
-    {  33, 127}, {  29, 127}, {  25, 127}, {  20, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=172 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  21}, { 127,  25}, { 127,  29},
-    { 127,  33}, { 127,  37}, { 127,  41}, { 127,  45}, { 127,  49}, { 127,  53}, { 127,  57}, { 127,  61},
-    { 127,  65}, { 127,  69}, { 127,  73}, { 127,  77}, { 127,  81}, { 127,  84}, { 127,  88}, { 127,  92},
-    { 127,  95}, { 127,  99}, { 127, 102}, { 127, 105}, { 127, 109}, { 127, 112}, { 127, 115}, { 124, 118},
-    { 121, 121}, { 118, 124}, { 115, 127}, { 112, 127}, { 109, 127}, { 105, 127}, { 102, 127}, {  99, 127},
-    {  95, 127}, {  92, 127}, {  88, 127}, {  84, 127}, {  81, 127}, {  77, 127}, {  73, 127}, {  69, 127},
-    {  65, 127}, {  61, 127}, {  57, 127}, {  53, 127}, {  49, 127}, {  45, 127}, {  41, 127}, {  37, 127},
-    {  33, 127}, {  29, 127}, {  25, 127}, {  21, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=173 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  16}, { 127,  21}, { 127,  25}, { 127,  29},
-    { 127,  33}, { 127,  37}, { 127,  42}, { 127,  46}, { 127,  50}, { 127,  54}, { 127,  58}, { 127,  62},
-    { 127,  66}, { 127,  70}, { 127,  73}, { 127,  77}, { 127,  81}, { 127,  85}, { 127,  88}, { 127,  92},
-    { 127,  96}, { 127,  99}, { 127, 103}, { 127, 106}, { 127, 109}, { 127, 112}, { 127, 116}, { 125, 119},
-    { 122, 122}, { 119, 125}, { 116, 127}, { 112, 127}, { 109, 127}, { 106, 127}, { 103, 127}, {  99, 127},
-    {  96, 127}, {  92, 127}, {  88, 127}, {  85, 127}, {  81, 127}, {  77, 127}, {  73, 127}, {  70, 127},
-    {  66, 127}, {  62, 127}, {  58, 127}, {  54, 127}, {  50, 127}, {  46, 127}, {  42, 127}, {  37, 127},
-    {  33, 127}, {  29, 127}, {  25, 127}, {  21, 127}, {  16, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=174 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  17}, { 127,  21}, { 127,  25}, { 127,  29},
-    { 127,  33}, { 127,  38}, { 127,  42}, { 127,  46}, { 127,  50}, { 127,  54}, { 127,  58}, { 127,  62},
-    { 127,  66}, { 127,  70}, { 127,  74}, { 127,  78}, { 127,  82}, { 127,  85}, { 127,  89}, { 127,  93},
-    { 127,  96}, { 127, 100}, { 127, 103}, { 127, 107}, { 127, 110}, { 127, 113}, { 127, 116}, { 126, 119},
-    { 123, 123}, { 119, 126}, { 116, 127}, { 113, 127}, { 110, 127}, { 107, 127}, { 103, 127}, { 100, 127},
-    {  96, 127}, {  93, 127}, {  89, 127}, {  85, 127}, {  82, 127}, {  78, 127}, {  74, 127}, {  70, 127},
-    {  66, 127}, {  62, 127}, {  58, 127}, {  54, 127}, {  50, 127}, {  46, 127}, {  42, 127}, {  38, 127},
-    {  33, 127}, {  29, 127}, {  25, 127}, {  21, 127}, {  17, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=175 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  17}, { 127,  21}, { 127,  25}, { 127,  29},
-    { 127,  34}, { 127,  38}, { 127,  42}, { 127,  46}, { 127,  50}, { 127,  54}, { 127,  58}, { 127,  62},
-    { 127,  66}, { 127,  70}, { 127,  74}, { 127,  78}, { 127,  82}, { 127,  86}, { 127,  89}, { 127,  93},
-    { 127,  97}, { 127, 100}, { 127, 104}, { 127, 107}, { 127, 111}, { 127, 114}, { 127, 117}, { 126, 120},
-    { 123, 123}, { 120, 126}, { 117, 127}, { 114, 127}, { 111, 127}, { 107, 127}, { 104, 127}, { 100, 127},
-    {  97, 127}, {  93, 127}, {  89, 127}, {  86, 127}, {  82, 127}, {  78, 127}, {  74, 127}, {  70, 127},
-    {  66, 127}, {  62, 127}, {  58, 127}, {  54, 127}, {  50, 127}, {  46, 127}, {  42, 127}, {  38, 127},
-    {  34, 127}, {  29, 127}, {  25, 127}, {  21, 127}, {  17, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=176 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  12}, { 127,  17}, { 127,  21}, { 127,  25}, { 127,  30},
-    { 127,  34}, { 127,  38}, { 127,  42}, { 127,  46}, { 127,  51}, { 127,  55}, { 127,  59}, { 127,  63},
-    { 127,  67}, { 127,  71}, { 127,  75}, { 127,  79}, { 127,  82}, { 127,  86}, { 127,  90}, { 127,  94},
-    { 127,  97}, { 127, 101}, { 127, 104}, { 127, 108}, { 127, 111}, { 127, 114}, { 127, 118}, { 127, 121},
-    { 124, 124}, { 121, 127}, { 118, 127}, { 114, 127}, { 111, 127}, { 108, 127}, { 104, 127}, { 101, 127},
-    {  97, 127}, {  94, 127}, {  90, 127}, {  86, 127}, {  82, 127}, {  79, 127}, {  75, 127}, {  71, 127},
-    {  67, 127}, {  63, 127}, {  59, 127}, {  55, 127}, {  51, 127}, {  46, 127}, {  42, 127}, {  38, 127},
-    {  34, 127}, {  30, 127}, {  25, 127}, {  21, 127}, {  17, 127}, {  12, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=177 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  13}, { 127,  17}, { 127,  21}, { 127,  25}, { 127,  30},
-    { 127,  34}, { 127,  38}, { 127,  43}, { 127,  47}, { 127,  51}, { 127,  55}, { 127,  59}, { 127,  63},
-    { 127,  67}, { 127,  71}, { 127,  75}, { 127,  79}, { 127,  83}, { 127,  87}, { 127,  90}, { 127,  94},
-    { 127,  98}, { 127, 101}, { 127, 105}, { 127, 108}, { 127, 112}, { 127, 115}, { 127, 118}, { 127, 122},
-    { 125, 125}, { 122, 127}, { 118, 127}, { 115, 127}, { 112, 127}, { 108, 127}, { 105, 127}, { 101, 127},
-    {  98, 127}, {  94, 127}, {  90, 127}, {  87, 127}, {  83, 127}, {  79, 127}, {  75, 127}, {  71, 127},
-    {  67, 127}, {  63, 127}, {  59, 127}, {  55, 127}, {  51, 127}, {  47, 127}, {  43, 127}, {  38, 127},
-    {  34, 127}, {  30, 127}, {  25, 127}, {  21, 127}, {  17, 127}, {  13, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=178 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  13}, { 127,  17}, { 127,  21}, { 127,  26}, { 127,  30},
-    { 127,  34}, { 127,  39}, { 127,  43}, { 127,  47}, { 127,  51}, { 127,  55}, { 127,  59}, { 127,  64},
-    { 127,  68}, { 127,  72}, { 127,  76}, { 127,  80}, { 127,  83}, { 127,  87}, { 127,  91}, { 127,  95},
-    { 127,  98}, { 127, 102}, { 127, 106}, { 127, 109}, { 127, 112}, { 127, 116}, { 127, 119}, { 127, 122},
-    { 125, 125}, { 122, 127}, { 119, 127}, { 116, 127}, { 112, 127}, { 109, 127}, { 106, 127}, { 102, 127},
-    {  98, 127}, {  95, 127}, {  91, 127}, {  87, 127}, {  83, 127}, {  80, 127}, {  76, 127}, {  72, 127},
-    {  68, 127}, {  64, 127}, {  59, 127}, {  55, 127}, {  51, 127}, {  47, 127}, {  43, 127}, {  39, 127},
-    {  34, 127}, {  30, 127}, {  26, 127}, {  21, 127}, {  17, 127}, {  13, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=179 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  13}, { 127,  17}, { 127,  21}, { 127,  26}, { 127,  30},
-    { 127,  34}, { 127,  39}, { 127,  43}, { 127,  47}, { 127,  51}, { 127,  56}, { 127,  60}, { 127,  64},
-    { 127,  68}, { 127,  72}, { 127,  76}, { 127,  80}, { 127,  84}, { 127,  88}, { 127,  92}, { 127,  95},
-    { 127,  99}, { 127, 103}, { 127, 106}, { 127, 110}, { 127, 113}, { 127, 116}, { 127, 120}, { 127, 123},
-    { 126, 126}, { 123, 127}, { 120, 127}, { 116, 127}, { 113, 127}, { 110, 127}, { 106, 127}, { 103, 127},
-    {  99, 127}, {  95, 127}, {  92, 127}, {  88, 127}, {  84, 127}, {  80, 127}, {  76, 127}, {  72, 127},
-    {  68, 127}, {  64, 127}, {  60, 127}, {  56, 127}, {  51, 127}, {  47, 127}, {  43, 127}, {  39, 127},
-    {  34, 127}, {  30, 127}, {  26, 127}, {  21, 127}, {  17, 127}, {  13, 127}, {   8, 127}, {   4, 127}
-  },
-  {  // x,y for mag=180 and nra=0:63
-    { 127,   0}, { 127,   4}, { 127,   8}, { 127,  13}, { 127,  17}, { 127,  22}, { 127,  26}, { 127,  30},
-    { 127,  35}, { 127,  39}, { 127,  43}, { 127,  48}, { 127,  52}, { 127,  56}, { 127,  60}, { 127,  64},
-    { 127,  68}, { 127,  72}, { 127,  76}, { 127,  80}, { 127,  84}, { 127,  88}, { 127,  92}, { 127,  96},
-    { 127, 100}, { 127, 103}, { 127, 107}, { 127, 110}, { 127, 114}, { 127, 117}, { 127, 120}, { 127, 124},
-    { 127, 127}, { 124, 127}, { 120, 127}, { 117, 127}, { 114, 127}, { 110, 127}, { 107, 127}, { 103, 127},
-    { 100, 127}, {  96, 127}, {  92, 127}, {  88, 127}, {  84, 127}, {  80, 127}, {  76, 127}, {  72, 127},
-    {  68, 127}, {  64, 127}, {  60, 127}, {  56, 127}, {  52, 127}, {  48, 127}, {  43, 127}, {  39, 127},
-    {  35, 127}, {  30, 127}, {  26, 127}, {  22, 127}, {  17, 127}, {  13, 127}, {   8, 127}, {   4, 127}
-  }
-};
+#ifdef RECT_POLAR_LUT_BLOB
+/* Lookup tables, embedded from rect_polar_lut.bin by the assembler, see
+   gen_lookup_table --blob */
+#include "rect_polar_lut_blob.inc"
+#else
+/* Lookup tables, computed by the compiler from the constexpr builders in
+   rect_polar_tables.hpp (see rect_polar_lut.hpp for the layouts) */
+alignas(64) constexpr rect_2_polar_table<polar_vector> rect_2_polar_lut_data =
+    make_rect_2_polar_lut<polar_vector>();
+alignas(64) constexpr rect_2_polar_octant_table<polar_vector> rect_2_polar_octant_lut_data =
+    make_rect_2_polar_octant_lut( rect_2_polar_lut_data );
+alignas(64) constexpr rect_byte_table rect_2_mag_lut_data = make_rect_2_mag_lut( rect_2_polar_lut_data );
+alignas(64) constexpr rect_byte_table rect_2_nra_lut_data = make_rect_2_nra_lut( rect_2_polar_lut_data );
+alignas(64) constexpr rect_u8_2_polar_table<polar_vector> rect_u8_2_polar_lut_data =
+    make_rect_u8_2_polar_lut<polar_vector>();
+alignas(64) constexpr polar_2_rect_table<rect_vector> polar_2_rect_lut_data =
+    make_polar_2_rect_lut<rect_vector>();
+alignas(64) constexpr polar_2_rect_slices polar_2_rect_slices_data =
+    make_polar_2_rect_slices( polar_2_rect_lut_data );
+#endif
 
 // perform lookup operation
-struct rect_vector convert_polar_2_rect( polar_vector pv ) {
-    rect_vector rv;
-    if ( pv.nra < 64 ) {
-        // first quadrant lookup
-        rv = polar_2_rect_lut[pv.mag][pv.nra];
-    }
-    if ( (pv.nra >= 64) && (pv.nra < 128) ) {
-        // second quadrant
-        rv = polar_2_rect_lut[pv.mag][pv.nra-64];
-        uint8_t t = rv.x;
-        rv.x = rv.y*-1;
-        rv.y = t;
-    }
-    if ( (pv.nra >= 128) && ( pv.nra < 192) ) {
-        // third quadrant
-        rv = polar_2_rect_lut[pv.mag][pv.nra-128];
-        rv.x = rv.x*(-1);
-        rv.y = rv.y*(-1);
+struct rect_vector convert_polar_2_rect( polar_vector pv ) noexcept {
+    return convert_polar_2_rect_inline( pv );
+}
+
+struct rect_vector convert_polar_2_rect( polar_vector pv, lut_status *status ) noexcept {
+    *status = ( pv.mag >= polar_2_rect_sat_mag[pv.nra & 63] ) ? LUT_SATURATED : LUT_OK;
+    return convert_polar_2_rect_inline( pv );
+}
+
+// perform lookup operation on a block of n samples
+void convert_polar_2_rect_block_scalar( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i] = convert_polar_2_rect_inline( pv[i] );
     }
-    if ( (pv.nra >= 192) && ( pv.nra <= 255) ) {
-        rv = polar_2_rect_lut[pv.mag][pv.nra-192];
-        uint8_t t = rv.x;
-        rv.x = rv.y;
-        rv.y = t*-1;
+}
+
+struct polar_vector convert_rect_2_polar( rect_vector rv ) noexcept {
+    return convert_rect_2_polar_inline( rv );
+}
+
+void convert_rect_2_polar_block_scalar( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i] = convert_rect_2_polar_inline( rv[i] );
     }
-    return rv;
 }
 
-struct polar_vector convert_rect_2_polar( rect_vector rv ) {
-    polar_vector pv;
-    if (( rv.x > 127 ) || (rv.x < -127 )) {
-        pv.mag = 0;
-        pv.nra = 0;
-        //throw LUT_Exception( std::string("cannot lookup x (x>127 or x<-127)"));
+struct polar_vector convert_rect_u8_2_polar( uint8_t i, uint8_t q ) noexcept {
+    return convert_rect_u8_2_polar_inline( i, q );
+}
+
+void convert_rect_u8_2_polar_block_scalar( const uint8_t *iq, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i] = convert_rect_u8_2_polar_inline( iq[2*i], iq[2*i+1] );
     }
-    if (( rv.y > 127 ) || (rv.y < -127 )) {
-        pv.mag = 0;
-        pv.nra = 0;
-        //throw LUT_Exception( std::string("cannot lookup y (y>127 or y<-127)"));
+}
+
+// n frames of channel interleaved samples, frame t starts at rv[t*stride],
+// channel c of it goes to pv[c][t]
+void convert_rect_2_polar_channels_scalar( const rect_vector *rv, size_t channels, size_t stride,
+                                           polar_vector *const *pv, size_t n ) {
+    for ( size_t t=0; t < n; t++ ) {
+        for ( size_t c=0; c < channels; c++ ) {
+            pv[c][t] = convert_rect_2_polar_inline( rv[c] );
+        }
+        rv += stride;
     }
-    if ( (rv.x >= 0) && (rv.y >= 0 ) ) {
-        // first quad
-        pv = rect_2_polar_lut[rv.x][rv.y];
+}
+
+struct polar_vector convert_rect_2_polar_octant( rect_vector rv ) noexcept {
+    return convert_rect_2_polar_octant_inline( rv );
+}
+
+void convert_rect_2_polar_block_octant( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        pv[i] = convert_rect_2_polar_octant_inline( rv[i] );
     }
-    if ( (rv.x < 0) && (rv.y > 0 ) ) {
-        // second quad
-        pv = rect_2_polar_lut[(rv.x*-1)][rv.y];
-        pv.nra += 64;
+}
+
+struct rect_vector convert_polar_2_rect_sine( polar_vector pv ) noexcept {
+    return convert_polar_2_rect_sine_inline( pv );
+}
+
+void convert_polar_2_rect_block_sine( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        rv[i] = convert_polar_2_rect_sine_inline( pv[i] );
     }
-    if ( ( rv.x <= 0 ) && ( rv.y <= 0 ) ) {
-        // third quad
-        pv = rect_2_polar_lut[(rv.x*-1)][(rv.y*-1)];
-        pv.nra += 128;
+}
+
+uint8_t convert_rect_2_mag( rect_vector rv ) noexcept {
+    return convert_rect_2_mag_inline( rv );
+}
+
+uint8_t convert_rect_2_nra( rect_vector rv ) noexcept {
+    return convert_rect_2_nra_inline( rv );
+}
+
+void convert_rect_2_mag_block( const rect_vector *rv, uint8_t *mag, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        mag[i] = convert_rect_2_mag_inline( rv[i] );
     }
-    if ( ( rv.x > 0 ) && ( rv.y < 0) ) {
-        // forth quad
-        pv = rect_2_polar_lut[rv.x][(rv.y*-1)];
-        pv.nra += 192;
+}
+
+void convert_rect_2_nra_block( const rect_vector *rv, uint8_t *nra, size_t n ) {
+    for ( size_t i=0; i < n; i++ ) {
+        nra[i] = convert_rect_2_nra_inline( rv[i] );
     }
-    return pv;
 }
 
 #ifdef using_cpp
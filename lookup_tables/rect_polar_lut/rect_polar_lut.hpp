@@ -2,6 +2,9 @@
 #define __RECT_POLAR_LUT_HPP
 #define using_cpp
 
+#include <cstddef>
+#include <cstdint>
+
 // if using c++ enviroment enable exceptions...
 #ifdef using_cpp
 #include <exception>
@@ -32,9 +35,102 @@ std::ostream& operator <<(std::ostream& os, const polar_vector &v);
 #endif
 
 
+// Lookup tables for the first quadrant, built by the constexpr builders in
+// rect_polar_tables.hpp and defined in rect_polar_lut.cpp.  Read only
+// (.rodata, one copy shared by every process) and each starts on a 64 byte
+// cache line, so polar_2_rect_lut's 128 byte rows do too
+#include "rect_polar_tables.hpp"
+alignas(64) extern const rect_2_polar_table<polar_vector> rect_2_polar_lut_data;
+alignas(64) extern const rect_2_polar_octant_table<polar_vector> rect_2_polar_octant_lut_data;
+alignas(64) extern const rect_byte_table rect_2_mag_lut_data;
+alignas(64) extern const rect_byte_table rect_2_nra_lut_data;
+alignas(64) extern const rect_u8_2_polar_table<polar_vector> rect_u8_2_polar_lut_data;
+alignas(64) extern const polar_2_rect_table<rect_vector> polar_2_rect_lut_data;
+alignas(64) extern const polar_2_rect_slices polar_2_rect_slices_data;
+
+// The tables by name, these are the arrays in the objects above
+static constexpr const polar_vector (&rect_2_polar_lut)[129][130] = rect_2_polar_lut_data.lut;
+static constexpr const polar_vector (&rect_2_polar_octant_lut)[8385] = rect_2_polar_octant_lut_data.lut;
+static constexpr const uint8_t (&rect_2_mag_lut)[129][129] = rect_2_mag_lut_data.lut;
+static constexpr const uint8_t (&rect_2_nra_lut)[129][129] = rect_2_nra_lut_data.lut;
+static constexpr const polar_vector (&rect_u8_2_polar_lut)[128][128] = rect_u8_2_polar_lut_data.lut;
+static constexpr const rect_vector (&polar_2_rect_lut)[256][64] = polar_2_rect_lut_data.lut;
+
+// Q15 cos/sin for nra=0:63, polar_2_rect_lut[mag][nra] is exactly
+// { min( (mag*cos_q15[nra]) >> 15, 127 ), min( (mag*sin_q15[nra]) >> 15, 127 ) }
+static constexpr const uint16_t (&polar_2_rect_cos_q15)[64] = polar_2_rect_slices_data.cos_q15;
+static constexpr const uint16_t (&polar_2_rect_sin_q15)[64] = polar_2_rect_slices_data.sin_q15;
+static constexpr const uint16_t (&polar_2_rect_sat_mag)[64] = polar_2_rect_slices_data.sat_mag;
+
+// Status reported by the checked lookups
+enum lut_status {
+    LUT_OK = 0,
+    LUT_SATURATED = 1   // x or y was over 127 and saturated to 127
+};
+
 // Function prototypes for lookup operations
-struct polar_vector convert_rect_2_polar( rect_vector rv );
-struct rect_vector convert_polar_2_rect( polar_vector pv );
+// Every input is valid: -128 <= x,y <= 127 gives 0 <= mag <= 181, and any
+// mag converts back with x,y saturated at 127.  No branches, no exceptions.
+// The status version also reports whether x or y saturated.
+struct polar_vector convert_rect_2_polar( rect_vector rv ) noexcept;
+struct rect_vector convert_polar_2_rect( polar_vector pv ) noexcept;
+struct rect_vector convert_polar_2_rect( polar_vector pv, lut_status *status ) noexcept;
+
+// Block lookup operations, convert n samples from in[] to out[]
+// These dispatch to the fastest kernel the cpu supports, picked once
+// on first use (rect_polar_dispatch.cpp)
+void convert_rect_2_polar_block( const rect_vector *rv, polar_vector *pv, size_t n );
+void convert_polar_2_rect_block( const polar_vector *pv, rect_vector *rv, size_t n );
+
+// Planar (structure of arrays) lookup operations, x[],y[] <=> mag[],nra[]
+// for front ends and demodulators which keep I and Q apart.  Dispatched
+// like the block lookups (rect_polar_planar.cpp and the SIMD kernels)
+void convert_rect_2_polar_planar( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n );
+void convert_polar_2_rect_planar( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+
+// Rect to polar for multi channel receivers delivering channel interleaved
+// samples (I0 Q0 I1 Q1 ...).  Frame t starts at rv[t*stride] and holds
+// channels samples (stride >= channels allows padding), channel c of frame
+// t is written to pv[c][t].  n is the number of frames.  Dispatched.
+void convert_rect_2_polar_channels( const rect_vector *rv, size_t channels, size_t stride,
+                                    polar_vector *const *pv, size_t n );
+
+// Offset binary I/Q to polar, for dongles (RTL-SDR style) delivering
+// unsigned bytes centred at 127.5.  The bias is folded into
+// rect_u8_2_polar_lut so raw buffers need no pre-pass.  iq holds n
+// interleaved i,q byte pairs.  The block version is dispatched.
+struct polar_vector convert_rect_u8_2_polar( uint8_t i, uint8_t q ) noexcept;
+void convert_rect_u8_2_polar_block( const uint8_t *iq, polar_vector *pv, size_t n );
+
+// Name of the kernel each block lookup dispatches to, e.g. "avx2"
+const char *rect_2_polar_kernel_name();
+const char *polar_2_rect_kernel_name();
+
+// Portable block lookups, the fallback kernels for dispatch
+void convert_rect_2_polar_block_scalar( const rect_vector *rv, polar_vector *pv, size_t n );
+void convert_polar_2_rect_block_scalar( const polar_vector *pv, rect_vector *rv, size_t n );
+void convert_rect_2_polar_planar_scalar( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n );
+void convert_polar_2_rect_planar_scalar( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+void convert_rect_2_polar_channels_scalar( const rect_vector *rv, size_t channels, size_t stride,
+                                           polar_vector *const *pv, size_t n );
+void convert_rect_u8_2_polar_block_scalar( const uint8_t *iq, polar_vector *pv, size_t n );
+
+// Rect to polar through the first octant table (16.4 KiB instead of 32.8 KiB),
+// same results as convert_rect_2_polar()
+struct polar_vector convert_rect_2_polar_octant( rect_vector rv ) noexcept;
+void convert_rect_2_polar_block_octant( const rect_vector *rv, polar_vector *pv, size_t n );
+
+// Polar to rect from the Q15 cos/sin slices (256 bytes instead of the
+// 32 KiB polar_2_rect_lut), same results as convert_polar_2_rect().
+struct rect_vector convert_polar_2_rect_sine( polar_vector pv ) noexcept;
+void convert_polar_2_rect_block_sine( const polar_vector *pv, rect_vector *rv, size_t n );
+
+// Rect to magnitude only or angle only, from the split tables
+// rect_2_mag_lut/rect_2_nra_lut.  Same values as convert_rect_2_polar()
+uint8_t convert_rect_2_mag( rect_vector rv ) noexcept;
+uint8_t convert_rect_2_nra( rect_vector rv ) noexcept;
+void convert_rect_2_mag_block( const rect_vector *rv, uint8_t *mag, size_t n );
+void convert_rect_2_nra_block( const rect_vector *rv, uint8_t *nra, size_t n );
 
 #endif
 
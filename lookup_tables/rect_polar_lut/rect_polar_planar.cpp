@@ -0,0 +1,55 @@
+/* Planar (structure of arrays) rect/polar conversions
+   x[],y[] <=> mag[],nra[] with no interleave pass.  The loops are plain C++
+   with restrict pointers and no quadrant branches so the compiler can
+   vectorize them.  The polar to rect loop vectorizes with plain SSE2 at
+   -O3 (about 2x, gcc's -O2 cost model leaves it scalar), so build.sh
+   compiles this file on its own with -O3.  The rect to polar loop needs
+   byte gathers which x86 doesn't have, see rect_polar_avx2.cpp for that one.
+*/
+#include <cstdint>
+#include "rect_polar_simd.hpp"
+
+// rect to polar from the split mag and nra tables, same folds as
+// convert_rect_2_polar_block_scalar()
+void convert_rect_2_polar_planar_scalar( const int8_t *__restrict x, const int8_t *__restrict y,
+                                         uint8_t *__restrict mag, uint8_t *__restrict nra, size_t n ) {
+    const uint8_t *mag_lut = &rect_2_mag_lut[0][0];
+    const uint8_t *nra_lut = &rect_2_nra_lut[0][0];
+    for ( size_t i=0; i < n; i++ ) {
+        int xi = x[i];
+        int yi = y[i];
+        // mag is the same in every quad
+        int sx = xi >> 31;
+        int sy = yi >> 31;
+        mag[i] = mag_lut[ ( (xi ^ sx) - sx ) * 129 + ( (yi ^ sy) - sy ) ];
+        // fold lower half plane up by 180 degrees, then second quad by 90
+        int s = ( yi*256 + xi ) >> 31;
+        int fx = (xi ^ s) - s;
+        int fy = (yi ^ s) - s;
+        int m = fx >> 31;
+        int qx = ( fx & ~m ) | ( fy & m );
+        int qy = ( fy & ~m ) | ( -fx & m );
+        nra[i] = nra_lut[ qx * 129 + qy ] + ( ( 128 & s ) | ( 64 & m ) );
+    }
+}
+
+// polar to rect from the Q15 cos/sin slices, same as convert_polar_2_rect_block_sine()
+void convert_polar_2_rect_planar_scalar( const uint8_t *__restrict mag, const uint8_t *__restrict nra,
+                                         int8_t *__restrict x, int8_t *__restrict y, size_t n ) {
+    const uint16_t *cos_q15 = polar_2_rect_cos_q15;
+    const uint16_t *sin_q15 = polar_2_rect_sin_q15;
+    for ( size_t i=0; i < n; i++ ) {
+        int quad = nra[i] >> 6;
+        int a = nra[i] & 63;
+        int cx = ( mag[i] * cos_q15[a] ) >> 15;
+        int cy = ( mag[i] * sin_q15[a] ) >> 15;
+        cx = ( cx < 127 ) ? cx : 127;
+        cy = ( cy < 127 ) ? cy : 127;
+        int s = -(quad >> 1);
+        cx = (cx ^ s) - s;
+        cy = (cy ^ s) - s;
+        int m = -(quad & 1);
+        x[i] = ( cx & ~m ) | ( -cy & m );
+        y[i] = ( cy & ~m ) | ( cx & m );
+    }
+}
@@ -0,0 +1,653 @@
+#ifndef __RECT_POLAR_RES_HPP
+#define __RECT_POLAR_RES_HPP
+
+/* Rect/Polar conversions for other sample widths
+
+   rect_vector_n<IQ_BITS> holds IQ_BITS bit signed x,y and
+   polar_vector_n<IQ_BITS,NRA_BITS> holds mag (0 : 2^(IQ_BITS-1)*sqrt(2))
+   and an NRA_BITS bit nra (2*PI => 2^NRA_BITS).  8 <= IQ_BITS,NRA_BITS <= 16.
+   The 8/8 instantiation is the same number system as rect_polar_lut.hpp.
+
+   Each width pair is converted by an engine, a class template with
+   static to_polar()/to_rect() and block versions:
+     exact_engine   the library's 8-bit tables, 8/8 only
+     ratio_engine   quadrant folds as the 8-bit tables, then the octant
+                    angle and mag from atan/sec tables indexed by min/max,
+                    polar to rect from a quarter wave sine table, all
+                    computed at compile time
+     interp_engine  quadrant folds, then bilinear interpolation of mag and
+                    nra on a coarse normalized grid, polar to rect from a
+                    sine table interpolated on the fractional nra
+     cordic_engine  no tables, vectoring/rotation mode CORDIC on blocks of
+                    16 samples, precision set by the iteration count
+     hybrid_engine  polar to rect only, a coarse cos/sin step from a small
+                    table, then a few CORDIC micro-rotations
+   default_engine picks exact_engine for 8/8 and ratio_engine otherwise,
+   another engine can be given as the last template argument.
+
+   Like the 8-bit lookups every input is valid, x,y saturate at
+   2^(IQ_BITS-1)-1 on the way back from polar.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "rect_polar_lut.hpp"
+#include "rect_polar_tables.hpp"
+
+// smallest integer types holding BITS bits
+template <int BITS>
+struct res_int {
+    typedef typename std::conditional< ( BITS <= 8 ), int8_t, int16_t >::type type;
+};
+
+template <int BITS>
+struct res_uint {
+    typedef typename std::conditional< ( BITS <= 8 ), uint8_t, uint16_t >::type type;
+};
+
+// data struct for a rect vector in X,Y
+template <int IQ_BITS>
+struct rect_vector_n {
+    static_assert( ( IQ_BITS >= 8 ) && ( IQ_BITS <= 16 ), "IQ_BITS must be 8:16" );
+    typedef typename res_int<IQ_BITS>::type value_type;
+    value_type x;
+    value_type y;
+};
+
+// data struct for a polar vector in Mag,NRA
+template <int IQ_BITS, int NRA_BITS>
+struct polar_vector_n {
+    static_assert( ( IQ_BITS >= 8 ) && ( IQ_BITS <= 16 ), "IQ_BITS must be 8:16" );
+    static_assert( ( NRA_BITS >= 8 ) && ( NRA_BITS <= 16 ), "NRA_BITS must be 8:16" );
+    typedef typename res_uint<IQ_BITS>::type mag_type;
+    typedef typename res_uint<NRA_BITS>::type nra_type;
+    mag_type mag;
+    nra_type nra;
+};
+
+// 8/8 through the library's tables
+template <int IQ_BITS, int NRA_BITS>
+struct exact_engine {
+    static_assert( ( IQ_BITS == 8 ) && ( NRA_BITS == 8 ), "exact_engine only covers 8-bit x,y and nra" );
+    typedef rect_vector_n<8> rect;
+    typedef polar_vector_n<8,8> polar;
+
+    static polar to_polar( rect rv ) noexcept {
+        rect_vector r;
+        r.x = rv.x, r.y = rv.y;
+        polar_vector p = convert_rect_2_polar( r );
+        polar pv;
+        pv.mag = p.mag, pv.nra = p.nra;
+        return pv;
+    }
+
+    static rect to_rect( polar pv ) noexcept {
+        polar_vector p;
+        p.mag = pv.mag, p.nra = pv.nra;
+        rect_vector r = convert_polar_2_rect( p );
+        rect rv;
+        rv.x = r.x, rv.y = r.y;
+        return rv;
+    }
+
+    // rect_vector_n<8>/polar_vector_n<8,8> have the same layout as
+    // rect_vector/polar_vector, so blocks go to the dispatched SIMD kernels
+    static_assert( ( sizeof( rect ) == sizeof( rect_vector ) ) && ( offsetof( rect, y ) == offsetof( rect_vector, y ) ),
+                   "rect_vector_n<8> must match rect_vector" );
+    static_assert( ( sizeof( polar ) == sizeof( polar_vector ) ) && ( offsetof( polar, nra ) == offsetof( polar_vector, nra ) ),
+                   "polar_vector_n<8,8> must match polar_vector" );
+
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) noexcept {
+        convert_rect_2_polar_block( reinterpret_cast<const rect_vector *>( rv ), reinterpret_cast<polar_vector *>( pv ), n );
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        convert_polar_2_rect_block( reinterpret_cast<const polar_vector *>( pv ), reinterpret_cast<rect_vector *>( rv ), n );
+    }
+};
+
+// Rect to polar by folding to the first octant, 0 <= lo <= hi, and looking
+// up r = lo/hi quantized to RATIO_BITS:
+//   nra = atan( r ) and mag = hi * sqrt( 1 + r^2 )
+// Polar to rect multiplies mag by a quarter wave Q30 sine table.
+// Tables are computed by the compiler (rect_polar_tables.hpp) and live in
+// .rodata, there is no init at run time.
+template <int IQ_BITS, int NRA_BITS>
+struct ratio_engine {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+
+    // ratio index bits, the larger width up to 14 (2^14+1 entries)
+    static const int RATIO_BITS = ( ( IQ_BITS > NRA_BITS ) ? IQ_BITS : NRA_BITS ) < 14 ?
+                                  ( ( IQ_BITS > NRA_BITS ) ? IQ_BITS : NRA_BITS ) : 14;
+    static const int RATIO_SIZE = ( 1 << RATIO_BITS ) + 1;
+    static const int NRA_MASK = ( 1 << NRA_BITS ) - 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    static const int HALF = 1 << ( NRA_BITS - 1 );
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+
+    typedef ratio_tables<RATIO_BITS,NRA_BITS,typename polar::nra_type> tables;
+    static constexpr tables table = make_ratio_tables<RATIO_BITS,NRA_BITS,typename polar::nra_type>();
+
+    static const tables &lut() {
+        return table;
+    }
+
+    static polar to_polar( rect rv, const tables &t ) noexcept {
+        int x = rv.x;
+        int y = rv.y;
+        // same half plane and quad folds as the 8-bit tables, in 64 bits so
+        // y*2^IQ_BITS + x can't overflow at 16 bits
+        int s = (int)( ( (int64_t)y * ( 1 << IQ_BITS ) + x ) >> 63 );
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = x >> 31;
+        int fx = ( x & ~m ) | ( y & m );
+        int fy = ( y & ~m ) | ( -x & m );
+        // second octant is the first mirrored about x=y, nra => quarter-nra
+        int o = ( fx - fy ) >> 31;
+        int hi = ( fx & ~o ) | ( fy & o );
+        int lo = ( fy & ~o ) | ( fx & o );
+        // hi == 0 only at the origin, where lo is 0 too
+        int idx = (int)( (float)lo * ( (float)( 1 << RATIO_BITS ) / (float)( hi + ( hi == 0 ) ) ) + 0.5f );
+        int nra = t.atan[idx];
+        nra = ( ( nra ^ o ) - o ) + ( QUARTER & o ) + ( HALF & s ) + ( QUARTER & m );
+        polar pv;
+        pv.mag = ( (int64_t)hi * t.sec[idx] + ( 1 << 29 ) ) >> 30;
+        pv.nra = nra & NRA_MASK;
+        return pv;
+    }
+
+    static rect to_rect( polar pv, const tables &t ) noexcept {
+        int nra = pv.nra & NRA_MASK;
+        int quad = nra >> ( NRA_BITS - 2 );
+        int a = nra & ( QUARTER - 1 );
+        int64_t mag = pv.mag;
+        int x = (int)( ( mag * t.sin[QUARTER - a] + ( 1 << 29 ) ) >> 30 );
+        int y = (int)( ( mag * t.sin[a] + ( 1 << 29 ) ) >> 30 );
+        // saturate as the 8-bit table does
+        x = ( x < XY_MAX ) ? x : XY_MAX;
+        y = ( y < XY_MAX ) ? y : XY_MAX;
+        // quads 3,4 are quads 1,2 negated, quads 2,4 rotated by 90 degrees
+        int s = -(quad >> 1);
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = -(quad & 1);
+        rect rv;
+        rv.x = ( x & ~m ) | ( -y & m );
+        rv.y = ( y & ~m ) | ( x & m );
+        return rv;
+    }
+
+    static polar to_polar( rect rv ) noexcept {
+        return to_polar( rv, lut() );
+    }
+
+    static rect to_rect( polar pv ) noexcept {
+        return to_rect( pv, lut() );
+    }
+
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) noexcept {
+        const tables &t = lut();
+        for ( size_t i=0; i < n; i++ ) {
+            pv[i] = to_polar( rv[i], t );
+        }
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        const tables &t = lut();
+        for ( size_t i=0; i < n; i++ ) {
+            rv[i] = to_rect( pv[i], t );
+        }
+    }
+};
+
+template <int IQ_BITS, int NRA_BITS>
+constexpr typename ratio_engine<IQ_BITS,NRA_BITS>::tables ratio_engine<IQ_BITS,NRA_BITS>::table;
+
+// Rect to polar by bilinear interpolation on a coarse grid.  x,y are folded
+// to the first octant as in ratio_engine and shifted up until hi is in
+// 2^15:2^16, mag and nra are interpolated between the four surrounding
+// grid points and mag is shifted back down.  The grid is 65 rows of hi by
+// 257 columns of lo (lo is the direction mag curves in), 130 KiB, which
+// stays in L2.  The grid holds Q15 mag and 32-bit nra, so the result is
+// rounded once, at the output width.
+// Polar to rect interpolates a 2^10 point quarter wave Q30 sine table
+// linearly on the nra bits below its resolution.
+template <int IQ_BITS, int NRA_BITS>
+struct interp_engine {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+
+    static const int HI_BITS = 7;
+    static const int LO_BITS = 8;
+    static const int HI_CELL = 16 - HI_BITS;
+    static const int LO_CELL = 16 - LO_BITS;
+    static const int SIN_BITS = 10;
+    static const int NRA_MASK = ( 1 << NRA_BITS ) - 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    static const int HALF = 1 << ( NRA_BITS - 1 );
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+    // quarter wave nra bits over and under the sine table resolution
+    static const int SIN_DOWN = ( NRA_BITS - 2 > SIN_BITS ) ? NRA_BITS - 2 - SIN_BITS : 0;
+    static const int SIN_UP = ( NRA_BITS - 2 < SIN_BITS ) ? SIN_BITS - ( NRA_BITS - 2 ) : 0;
+
+    typedef interp_tables<HI_BITS,LO_BITS,SIN_BITS> tables;
+    static constexpr tables table = make_interp_tables<HI_BITS,LO_BITS,SIN_BITS>();
+
+    static const tables &lut() {
+        return table;
+    }
+
+    static polar to_polar( rect rv, const tables &t ) noexcept {
+        int x = rv.x;
+        int y = rv.y;
+        // half plane, quad and octant folds as ratio_engine
+        int s = (int)( ( (int64_t)y * ( 1 << IQ_BITS ) + x ) >> 63 );
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = x >> 31;
+        int fx = ( x & ~m ) | ( y & m );
+        int fy = ( y & ~m ) | ( -x & m );
+        int o = ( fx - fy ) >> 31;
+        int hi = ( fx & ~o ) | ( fy & o );
+        int lo = ( fy & ~o ) | ( fx & o );
+        // normalize, the origin goes through as hi = 1 and is masked to mag 0
+        int z = -( hi != 0 );
+        hi |= ~z & 1;
+        int sh = __builtin_clz( hi ) - 16;
+        uint32_t hn = (uint32_t)hi << sh;
+        uint32_t ln = (uint32_t)lo << sh;
+        int r = ( hn >> HI_CELL ) - ( 1 << ( HI_BITS - 1 ) );
+        int c = ln >> LO_CELL;
+        int64_t fh = hn & ( ( 1 << HI_CELL ) - 1 );
+        int64_t fl = ln & ( ( 1 << LO_CELL ) - 1 );
+        const typename tables::point *p0 = &t.grid[r][c];
+        const typename tables::point *p1 = &t.grid[r+1][c];
+        int64_t mag0 = ( (int64_t)p0[0].mag << LO_CELL ) + ( (int64_t)p0[1].mag - p0[0].mag ) * fl;
+        int64_t mag1 = ( (int64_t)p1[0].mag << LO_CELL ) + ( (int64_t)p1[1].mag - p1[0].mag ) * fl;
+        uint64_t mag = ( mag0 << HI_CELL ) + ( mag1 - mag0 ) * fh;
+        int64_t nra0 = ( (int64_t)p0[0].nra << LO_CELL ) + ( (int64_t)p0[1].nra - p0[0].nra ) * fl;
+        int64_t nra1 = ( (int64_t)p1[0].nra << LO_CELL ) + ( (int64_t)p1[1].nra - p1[0].nra ) * fl;
+        uint64_t nra = ( nra0 << HI_CELL ) + ( nra1 - nra0 ) * fh;
+        // grid mag is Q15 and nra 2^32 per circle, both scaled by the weights
+        const int mag_shift = 15 + HI_CELL + LO_CELL + sh;
+        const int nra_shift = 32 - NRA_BITS + HI_CELL + LO_CELL;
+        int on = (int)( ( nra + ( (uint64_t)1 << ( nra_shift - 1 ) ) ) >> nra_shift );
+        on = ( ( on ^ o ) - o ) + ( QUARTER & o ) + ( HALF & s ) + ( QUARTER & m );
+        polar pv;
+        pv.mag = (int)( ( mag + ( (uint64_t)1 << ( mag_shift - 1 ) ) ) >> mag_shift ) & z;
+        pv.nra = on & NRA_MASK;
+        return pv;
+    }
+
+    // Q30 sin of a quarter wave phase 0:QUARTER
+    static int64_t sin_q30( int a, const tables &t ) noexcept {
+        int i = ( a << SIN_UP ) >> SIN_DOWN;
+        int f = a & ( ( 1 << SIN_DOWN ) - 1 );
+        int64_t d = (int64_t)t.sin[i+1] - t.sin[i];
+        return t.sin[i] + ( ( d * f + ( ( 1 << SIN_DOWN ) >> 1 ) ) >> SIN_DOWN );
+    }
+
+    static rect to_rect( polar pv, const tables &t ) noexcept {
+        int nra = pv.nra & NRA_MASK;
+        int quad = nra >> ( NRA_BITS - 2 );
+        int a = nra & ( QUARTER - 1 );
+        int64_t mag = pv.mag;
+        int x = (int)( ( mag * sin_q30( QUARTER - a, t ) + ( 1 << 29 ) ) >> 30 );
+        int y = (int)( ( mag * sin_q30( a, t ) + ( 1 << 29 ) ) >> 30 );
+        x = ( x < XY_MAX ) ? x : XY_MAX;
+        y = ( y < XY_MAX ) ? y : XY_MAX;
+        int s = -(quad >> 1);
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = -(quad & 1);
+        rect rv;
+        rv.x = ( x & ~m ) | ( -y & m );
+        rv.y = ( y & ~m ) | ( x & m );
+        return rv;
+    }
+
+    static polar to_polar( rect rv ) noexcept {
+        return to_polar( rv, lut() );
+    }
+
+    static rect to_rect( polar pv ) noexcept {
+        return to_rect( pv, lut() );
+    }
+
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) noexcept {
+        const tables &t = lut();
+        for ( size_t i=0; i < n; i++ ) {
+            pv[i] = to_polar( rv[i], t );
+        }
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        const tables &t = lut();
+        for ( size_t i=0; i < n; i++ ) {
+            rv[i] = to_rect( pv[i], t );
+        }
+    }
+};
+
+template <int IQ_BITS, int NRA_BITS>
+constexpr typename interp_engine<IQ_BITS,NRA_BITS>::tables interp_engine<IQ_BITS,NRA_BITS>::table;
+
+// Table free conversion by CORDIC, vectoring mode for rect to polar and
+// rotation mode for polar to rect, ITERATIONS shift and add micro-rotations
+// each, about one bit of angle per iteration.  x,y are folded to the first
+// quadrant as the tables do and carried with 30-IQ_BITS guard bits in 32-bit
+// lanes, angles in 32-bit with the full circle as 2^32.
+// Block conversions run LANES samples side by side through each iteration,
+// the lane loops are plain C++ that the compiler vectorizes.
+template <int IQ_BITS, int NRA_BITS, int ITERATIONS>
+struct cordic_engine_n {
+    static_assert( ( ITERATIONS >= 1 ) && ( ITERATIONS <= 30 ), "ITERATIONS must be 1:30" );
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+
+    static const int LANES = 16;
+    static const int GUARD = 30 - IQ_BITS;
+    static const int NRA_MASK = ( 1 << NRA_BITS ) - 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    static const int HALF = 1 << ( NRA_BITS - 1 );
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+
+    typedef cordic_tables<ITERATIONS> tables;
+    static constexpr tables table = make_cordic_tables<ITERATIONS>();
+
+    // rect to polar for L samples side by side
+    template <int L>
+    static void to_polar_lanes( const rect *rv, polar *pv ) noexcept {
+        int32_t x[L], y[L], off[L];
+        uint32_t z[L];
+        for ( int k=0; k < L; k++ ) {
+            int xi = rv[k].x;
+            int yi = rv[k].y;
+            // same half plane and quad folds as the tables, s is y < 0 or
+            // y == 0 and x < 0
+            int s = ( yi >> 31 ) | ( -( yi == 0 ) & ( xi >> 31 ) );
+            xi = (xi ^ s) - s;
+            yi = (yi ^ s) - s;
+            int m = xi >> 31;
+            x[k] = ( ( xi & ~m ) | ( yi & m ) ) * ( 1 << GUARD );
+            y[k] = ( ( yi & ~m ) | ( -xi & m ) ) * ( 1 << GUARD );
+            // the origin would collect every micro-rotation angle
+            off[k] = ( ( HALF & s ) + ( QUARTER & m ) ) | ( ( ( xi | yi ) != 0 ) ? 0 : -1 );
+            z[k] = 0;
+        }
+        // rotate towards y = 0, summing the angles turned through
+        for ( int i=0; i < ITERATIONS; i++ ) {
+            uint32_t a = table.atan[i];
+            for ( int k=0; k < L; k++ ) {
+                int32_t m = y[k] >> 31;
+                int32_t dx = x[k] >> i;
+                int32_t dy = y[k] >> i;
+                x[k] += ( dy ^ m ) - m;
+                y[k] -= ( dx ^ m ) - m;
+                z[k] += ( a ^ m ) - m;
+            }
+        }
+        const int nra_shift = 32 - NRA_BITS;
+        for ( int k=0; k < L; k++ ) {
+            // x is the magnitude times the cordic gain
+            uint32_t mag = ( (uint64_t)(uint32_t)x[k] * table.inv_gain + ( (uint64_t)1 << ( 29 + GUARD ) ) ) >> ( 30 + GUARD );
+            uint32_t nra = ( z[k] + ( 1u << ( nra_shift - 1 ) ) ) >> nra_shift;
+            // off is -1 at the origin, where mag is already 0
+            nra = ( nra + off[k] ) & ( ~( off[k] >> 31 ) & NRA_MASK );
+            pv[k].mag = mag;
+            pv[k].nra = nra;
+        }
+    }
+
+    // polar to rect for L samples side by side
+    template <int L>
+    static void to_rect_lanes( const polar *pv, rect *rv ) noexcept {
+        int32_t x[L], y[L], z[L], quad[L];
+        for ( int k=0; k < L; k++ ) {
+            uint32_t mag = pv[k].mag;
+            int nra = pv[k].nra & NRA_MASK;
+            quad[k] = nra >> ( NRA_BITS - 2 );
+            // start at mag over the gain on the x axis, rotate by the angle
+            // within the quad
+            x[k] = ( (uint64_t)mag * table.inv_gain ) >> ( 30 - GUARD );
+            y[k] = 0;
+            z[k] = (uint32_t)( nra & ( QUARTER - 1 ) ) << ( 32 - NRA_BITS );
+        }
+        for ( int i=0; i < ITERATIONS; i++ ) {
+            int32_t a = table.atan[i];
+            for ( int k=0; k < L; k++ ) {
+                int32_t m = z[k] >> 31;
+                int32_t dx = x[k] >> i;
+                int32_t dy = y[k] >> i;
+                x[k] -= ( dy ^ m ) - m;
+                y[k] += ( dx ^ m ) - m;
+                z[k] -= ( a ^ m ) - m;
+            }
+        }
+        for ( int k=0; k < L; k++ ) {
+            int xi = ( x[k] + ( 1 << ( GUARD - 1 ) ) ) >> GUARD;
+            int yi = ( y[k] + ( 1 << ( GUARD - 1 ) ) ) >> GUARD;
+            xi = ( xi < XY_MAX ) ? xi : XY_MAX;
+            yi = ( yi < XY_MAX ) ? yi : XY_MAX;
+            int s = -(quad[k] >> 1);
+            xi = (xi ^ s) - s;
+            yi = (yi ^ s) - s;
+            int m = -(quad[k] & 1);
+            rv[k].x = ( xi & ~m ) | ( -yi & m );
+            rv[k].y = ( yi & ~m ) | ( xi & m );
+        }
+    }
+
+    static polar to_polar( rect rv ) noexcept {
+        polar pv;
+        to_polar_lanes<1>( &rv, &pv );
+        return pv;
+    }
+
+    static rect to_rect( polar pv ) noexcept {
+        rect rv;
+        to_rect_lanes<1>( &pv, &rv );
+        return rv;
+    }
+
+    // whole blocks of LANES, then the tail through a zero padded block
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) noexcept {
+        size_t i = 0;
+        for ( ; i + LANES <= n; i += LANES ) {
+            to_polar_lanes<LANES>( rv + i, pv + i );
+        }
+        if ( i < n ) {
+            rect in[LANES] = {};
+            polar out[LANES];
+            std::copy( rv + i, rv + n, in );
+            to_polar_lanes<LANES>( in, out );
+            std::copy( out, out + ( n - i ), pv + i );
+        }
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        size_t i = 0;
+        for ( ; i + LANES <= n; i += LANES ) {
+            to_rect_lanes<LANES>( pv + i, rv + i );
+        }
+        if ( i < n ) {
+            polar in[LANES] = {};
+            rect out[LANES];
+            std::copy( pv + i, pv + n, in );
+            to_rect_lanes<LANES>( in, out );
+            std::copy( out, out + ( n - i ), rv + i );
+        }
+    }
+};
+
+template <int IQ_BITS, int NRA_BITS, int ITERATIONS>
+constexpr typename cordic_engine_n<IQ_BITS,NRA_BITS,ITERATIONS>::tables cordic_engine_n<IQ_BITS,NRA_BITS,ITERATIONS>::table;
+
+// enough iterations for the wider of x,y and nra
+template <int IQ_BITS, int NRA_BITS>
+using cordic_engine = cordic_engine_n<IQ_BITS,NRA_BITS,( ( IQ_BITS > NRA_BITS ) ? IQ_BITS : NRA_BITS ) + 2>;
+
+// cordic_iterations<N>::engine, a CORDIC engine with N iterations to pass
+// as the ENGINE argument
+template <int ITERATIONS>
+struct cordic_iterations {
+    template <int IQ_BITS, int NRA_BITS>
+    using engine = cordic_engine_n<IQ_BITS,NRA_BITS,ITERATIONS>;
+};
+
+// Coarse table plus CORDIC refinement, polar to rect only.  It starts from
+// a 64 step quarter wave cos/sin table and refines with REFINE rotation
+// micro-rotations and a first order rotation by what is left, which is good
+// to the square of the angle left, so REFINE sets the precision, see the
+// bench.  Blocks run LANES samples at a time as cordic_engine_n.  There is
+// no rect to polar, the same coarse table scheme ran it no faster than
+// cordic_engine with any number of micro-rotations, see the readme.
+template <int IQ_BITS, int NRA_BITS, int REFINE>
+struct hybrid_engine_n {
+    static_assert( ( REFINE >= 0 ) && ( REFINE <= 8 ), "REFINE must be 0:8" );
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+
+    static const int LANES = 16;
+    static const int COARSE_BITS = 6;
+    static const int GUARD = 30 - IQ_BITS;
+    static const int NRA_MASK = ( 1 << NRA_BITS ) - 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+    // 2*PI in Q29, radians from 2^32 per circle angles
+    static const int64_t TWO_PI_Q29 = 3373259426LL;
+
+    typedef hybrid_tables<COARSE_BITS,REFINE> tables;
+    static constexpr tables table = make_hybrid_tables<COARSE_BITS,REFINE>();
+
+    static const tables &lut() {
+        return table;
+    }
+
+    // polar to rect for L samples side by side
+    template <int L>
+    static void to_rect_lanes( const polar *pv, rect *rv, const tables &t ) noexcept {
+        int32_t x[L], y[L], r[L], quad[L];
+        for ( int k=0; k < L; k++ ) {
+            int nra = pv[k].nra & NRA_MASK;
+            quad[k] = nra >> ( NRA_BITS - 2 );
+            // angle within the quad, 2^32 per circle, and its offset from the
+            // centre of its coarse step
+            int32_t a = ( nra & ( QUARTER - 1 ) ) << ( 32 - NRA_BITS );
+            int j = a >> ( 30 - COARSE_BITS );
+            r[k] = a - ( j << ( 30 - COARSE_BITS ) ) - ( 1 << ( 29 - COARSE_BITS ) );
+            // mag * 2^GUARD at the step centre, over the micro-rotation gain
+            int64_t mag = pv[k].mag;
+            x[k] = ( mag * t.rot[j].cos ) >> IQ_BITS;
+            y[k] = ( mag * t.rot[j].sin ) >> IQ_BITS;
+        }
+        for ( int i=0; i < REFINE; i++ ) {
+            int32_t at = t.p2r_atan[i];
+            for ( int k=0; k < L; k++ ) {
+                int32_t mr = r[k] >> 31;
+                int32_t dx = x[k] >> ( COARSE_BITS + 1 + i );
+                int32_t dy = y[k] >> ( COARSE_BITS + 1 + i );
+                x[k] -= ( dy ^ mr ) - mr;
+                y[k] += ( dx ^ mr ) - mr;
+                r[k] -= ( at ^ mr ) - mr;
+            }
+        }
+        for ( int k=0; k < L; k++ ) {
+            // rotate by what is left, to first order
+            int64_t rad = ( (int64_t)r[k] * TWO_PI_Q29 ) >> 29;
+            int64_t xf = x[k] - ( ( y[k] * rad ) >> 32 );
+            int64_t yf = y[k] + ( ( x[k] * rad ) >> 32 );
+            int xi = (int)( ( xf + ( 1 << ( GUARD - 1 ) ) ) >> GUARD );
+            int yi = (int)( ( yf + ( 1 << ( GUARD - 1 ) ) ) >> GUARD );
+            xi = ( xi < XY_MAX ) ? xi : XY_MAX;
+            yi = ( yi < XY_MAX ) ? yi : XY_MAX;
+            int s = -(quad[k] >> 1);
+            xi = (xi ^ s) - s;
+            yi = (yi ^ s) - s;
+            int m = -(quad[k] & 1);
+            rv[k].x = ( xi & ~m ) | ( -yi & m );
+            rv[k].y = ( yi & ~m ) | ( xi & m );
+        }
+    }
+
+    static rect to_rect( polar pv ) noexcept {
+        rect rv;
+        to_rect_lanes<1>( &pv, &rv, lut() );
+        return rv;
+    }
+
+    // whole blocks of LANES, then the tail through a zero padded block
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) noexcept {
+        const tables &t = lut();
+        size_t i = 0;
+        for ( ; i + LANES <= n; i += LANES ) {
+            to_rect_lanes<LANES>( pv + i, rv + i, t );
+        }
+        if ( i < n ) {
+            polar in[LANES] = {};
+            rect out[LANES];
+            std::copy( pv + i, pv + n, in );
+            to_rect_lanes<LANES>( in, out, t );
+            std::copy( out, out + ( n - i ), rv + i );
+        }
+    }
+};
+
+template <int IQ_BITS, int NRA_BITS, int REFINE>
+constexpr typename hybrid_engine_n<IQ_BITS,NRA_BITS,REFINE>::tables hybrid_engine_n<IQ_BITS,NRA_BITS,REFINE>::table;
+
+// none up to 12-bit x,y and nra, then one micro-rotation per bit, which
+// keeps it within 1 LSB
+template <int IQ_BITS, int NRA_BITS>
+using hybrid_engine = hybrid_engine_n<IQ_BITS,NRA_BITS,( ( ( IQ_BITS > NRA_BITS ) ? IQ_BITS : NRA_BITS ) > 12 ) ?
+                                                       ( ( IQ_BITS > NRA_BITS ) ? IQ_BITS : NRA_BITS ) - 12 : 0>;
+
+// hybrid_refine<N>::engine, a hybrid engine with N micro-rotations to pass
+// as the ENGINE argument
+template <int REFINE>
+struct hybrid_refine {
+    template <int IQ_BITS, int NRA_BITS>
+    using engine = hybrid_engine_n<IQ_BITS,NRA_BITS,REFINE>;
+};
+
+template <int IQ_BITS, int NRA_BITS>
+using default_engine = typename std::conditional< ( IQ_BITS == 8 ) && ( NRA_BITS == 8 ),
+                                                  exact_engine<IQ_BITS,NRA_BITS>,
+                                                  ratio_engine<IQ_BITS,NRA_BITS> >::type;
+
+// Lookup operations, e.g.
+//   polar_vector_n<12,16> pv = convert_rect_2_polar_n<12,16>( rv );
+//   rect_vector_n<12> rv = convert_polar_2_rect_n( pv );
+//   convert_rect_2_polar_block_n( rv, pv, n );
+// noexcept when the engine's conversion is, runtime_lut_engine's can throw
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE = default_engine>
+inline polar_vector_n<IQ_BITS,NRA_BITS> convert_rect_2_polar_n( rect_vector_n<IQ_BITS> rv )
+    noexcept( noexcept( ENGINE<IQ_BITS,NRA_BITS>::to_polar( rv ) ) ) {
+    return ENGINE<IQ_BITS,NRA_BITS>::to_polar( rv );
+}
+
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE = default_engine>
+inline rect_vector_n<IQ_BITS> convert_polar_2_rect_n( polar_vector_n<IQ_BITS,NRA_BITS> pv )
+    noexcept( noexcept( ENGINE<IQ_BITS,NRA_BITS>::to_rect( pv ) ) ) {
+    return ENGINE<IQ_BITS,NRA_BITS>::to_rect( pv );
+}
+
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE = default_engine>
+inline void convert_rect_2_polar_block_n( const rect_vector_n<IQ_BITS> *rv, polar_vector_n<IQ_BITS,NRA_BITS> *pv,
+                                          size_t n ) noexcept( noexcept( ENGINE<IQ_BITS,NRA_BITS>::to_polar_block( rv, pv, n ) ) ) {
+    ENGINE<IQ_BITS,NRA_BITS>::to_polar_block( rv, pv, n );
+}
+
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE = default_engine>
+inline void convert_polar_2_rect_block_n( const polar_vector_n<IQ_BITS,NRA_BITS> *pv, rect_vector_n<IQ_BITS> *rv,
+                                          size_t n ) noexcept( noexcept( ENGINE<IQ_BITS,NRA_BITS>::to_rect_block( pv, rv, n ) ) ) {
+    ENGINE<IQ_BITS,NRA_BITS>::to_rect_block( pv, rv, n );
+}
+
+#endif
+
+//EOF
@@ -0,0 +1,255 @@
+#ifndef __RECT_POLAR_RUNTIME_HPP
+#define __RECT_POLAR_RUNTIME_HPP
+
+/* Full resolution lookup tables built at run time
+
+   runtime_lut_engine<IQ_BITS,NRA_BITS> is an engine for rect_polar_res.hpp
+   which looks every conversion up directly, from
+     r2p  a quadrant of rect to polar, [x][y] for 0 <= x,y <= 2^(IQ_BITS-1)
+     p2r  a quarter wave of polar to rect, [mag][nra] for nra < 2^(NRA_BITS-2)
+   with the same folds, rounding and saturation as the library's 8-bit
+   tables: mag and nra rounded to nearest, x,y truncated toward zero and
+   saturated at 2^(IQ_BITS-1)-1.  At 8/8 the tables are bit for bit
+   rect_2_polar_lut and polar_2_rect_lut.
+
+   Nothing is in the binary.  The tables are built on first use, once,
+   the first caller builds them while any others wait (function local
+   static), the rows split across the cores.  They grow 4x per bit, 32 MiB
+   at 12/12, so only the widths a program uses are ever built.  The first
+   use allocates, so the lut() backed conversions can throw std::bad_alloc,
+   and are not noexcept.
+
+   No entry calls libm.  mag walks up each row in integers, rounding
+   compared exactly as 4(x^2+y^2) >= (2m+1)^2, nra comes in runs from
+   where each row crosses the nra boundaries, and x,y are a truncating
+   multiply by a cos/sin row (a loop the compiler vectorizes).  libm is
+   only called for the 2^(NRA_BITS-2) angles.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "rect_polar_res.hpp"
+
+template <int IQ_BITS, int NRA_BITS>
+struct runtime_lut_engine {
+    typedef rect_vector_n<IQ_BITS> rect;
+    typedef polar_vector_n<IQ_BITS,NRA_BITS> polar;
+    static const int SIDE = ( 1 << ( IQ_BITS - 1 ) ) + 1;
+    static const int MAGS = 1 << IQ_BITS;
+    // 12/12 is 32 MiB of tables, each bit more is 4x (16/16 would be 8 GiB)
+    static_assert( ( IQ_BITS <= 12 ) && ( NRA_BITS <= 12 ),
+                   "runtime_lut_engine covers up to 12-bit x,y and nra, use ratio_engine or interp_engine" );
+    static const int NRA_MASK = ( 1 << NRA_BITS ) - 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    static const int HALF = 1 << ( NRA_BITS - 1 );
+    static const int XY_MAX = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+
+    // rows handed to a thread at a time, and the fewest entries worth a thread
+    static const int CHUNK = 16;
+    static const size_t ENTRIES_PER_THREAD = 65536;
+
+    struct tables {
+        polar *r2p;         // [SIDE][SIDE]
+        rect *p2r;          // [MAGS][QUARTER]
+        int threads;        // threads the build ran on
+        double seconds;     // build time
+
+        // build on want threads, 0 picks them from the table size and cores
+        explicit tables( int want = 0 ) : r2p( 0 ), p2r( 0 ), threads( want ), seconds( 0 ) {
+            builds()++;
+            auto start = std::chrono::steady_clock::now();
+            try {
+                r2p = static_cast<polar *>( alloc( (size_t)SIDE * SIDE * sizeof( polar ) ) );
+                p2r = static_cast<rect *>( alloc( (size_t)MAGS * QUARTER * sizeof( rect ) ) );
+                if ( threads <= 0 ) {
+                    threads = default_threads();
+                }
+                build();
+            } catch ( ... ) {
+                // the destructor doesn't run for a throwing constructor
+                free( r2p );
+                free( p2r );
+                throw;
+            }
+            seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+        }
+        ~tables() {
+            free( r2p );
+            free( p2r );
+        }
+        tables( const tables & ) = delete;
+        tables &operator =( const tables & ) = delete;
+
+        size_t bytes() const {
+            return (size_t)SIDE * SIDE * sizeof( polar ) + (size_t)MAGS * QUARTER * sizeof( rect );
+        }
+
+    private:
+        static void *alloc( size_t bytes ) {
+            void *p = 0;
+            if ( posix_memalign( &p, 64, bytes ) != 0 ) {
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+
+        // rect to polar row x.  mag only grows along the row, from x at y=0,
+        // and rounds up to m+1 once 4(x^2+y^2) >= (2m+1)^2 (never equal).
+        // y <= x*tan( (k+0.5) * 2*PI/2^NRA_BITS ) rounds to nra k or below,
+        // so the row is runs of nra split at those y.
+        void r2p_row( int x, const double *tan_bound ) const {
+            polar *row = r2p + (size_t)x * SIDE;
+            const int64_t xx4 = 4 * (int64_t)x * x;
+            int64_t m = x;
+            for ( int y=0; y < SIDE; y++ ) {
+                const int64_t s4 = xx4 + 4 * (int64_t)y * y;
+                while ( ( 2*m + 1 ) * ( 2*m + 1 ) <= s4 ) {
+                    m++;
+                }
+                row[y].mag = (typename polar::mag_type)m;
+            }
+            int y = 0;
+            for ( int k=0; k < QUARTER; k++ ) {
+                double b = x * tan_bound[k];
+                int end = ( b >= SIDE - 1 ) ? SIDE : (int)b + 1;
+                for ( ; y < end; y++ ) {
+                    row[y].nra = k;
+                }
+            }
+            for ( ; y < SIDE; y++ ) {
+                row[y].nra = QUARTER;
+            }
+        }
+
+        // polar to rect row mag, x,y truncated and saturated
+        void p2r_row( int mag, const double *cos_row, const double *sin_row ) const {
+            rect *row = p2r + (size_t)mag * QUARTER;
+            for ( int a=0; a < QUARTER; a++ ) {
+                row[a].x = std::min( (int)( mag * cos_row[a] ), (int)XY_MAX );
+                row[a].y = std::min( (int)( mag * sin_row[a] ), (int)XY_MAX );
+            }
+        }
+
+        void build() {
+            std::vector<double> tan_bound( QUARTER ), cos_row( QUARTER ), sin_row( QUARTER );
+            for ( int k=0; k < QUARTER; k++ ) {
+                // as nra_2_radians() in gen_lookup_table.cpp, so 8/8 matches
+                double a = ( (double)k / ( 1 << NRA_BITS ) ) * ( 2.0*M_PI );
+                tan_bound[k] = tan( ( ( k + 0.5 ) / ( 1 << NRA_BITS ) ) * ( 2.0*M_PI ) );
+                cos_row[k] = cos( a );
+                sin_row[k] = sin( a );
+            }
+            // r2p rows then p2r rows, CHUNK at a time to whichever thread is free
+            const int rows = SIDE + MAGS;
+            std::atomic<int> next( 0 );
+            auto work = [&]() {
+                for ( int r; ( r = next.fetch_add( CHUNK ) ) < rows; ) {
+                    for ( int i=r; i < std::min( r + CHUNK, rows ); i++ ) {
+                        if ( i < SIDE ) {
+                            r2p_row( i, tan_bound.data() );
+                        } else {
+                            p2r_row( i - SIDE, cos_row.data(), sin_row.data() );
+                        }
+                    }
+                }
+            };
+            std::vector<std::thread> pool;
+            try {
+                for ( int t=1; t < threads; t++ ) {
+                    pool.emplace_back( work );
+                }
+            } catch ( const std::system_error & ) {
+                // fewer threads than asked, the ones running share the rows
+                threads = (int)pool.size() + 1;
+            }
+            work();
+            for ( auto &t : pool ) {
+                t.join();
+            }
+        }
+
+        int default_threads() const {
+            int cores = std::max( 1u, std::thread::hardware_concurrency() );
+            size_t want = bytes() / sizeof( polar ) / ENTRIES_PER_THREAD + 1;
+            return (int)std::min( (size_t)cores, want );
+        }
+    };
+
+    // tables constructed so far, lut()'s and any others, for the tests
+    static std::atomic<int> &builds() {
+        static std::atomic<int> n( 0 );
+        return n;
+    }
+
+    // built by the first caller, thread safe and once only
+    static const tables &lut() {
+        static const tables t;
+        return t;
+    }
+
+    static polar to_polar( rect rv, const polar *t ) noexcept {
+        int x = rv.x;
+        int y = rv.y;
+        int s = (int)( ( (int64_t)y * ( 1 << IQ_BITS ) + x ) >> 63 );
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = x >> 31;
+        int fx = ( x & ~m ) | ( y & m );
+        int fy = ( y & ~m ) | ( -x & m );
+        polar p = t[ (size_t)fx * SIDE + fy ];
+        p.nra = ( p.nra + ( HALF & s ) + ( QUARTER & m ) ) & NRA_MASK;
+        return p;
+    }
+
+    // mag past 2^IQ_BITS-1 is outside the number system, it is clamped there
+    static rect to_rect( polar pv, const rect *t ) noexcept {
+        int nra = pv.nra & NRA_MASK;
+        int quad = nra >> ( NRA_BITS - 2 );
+        int mag = std::min( (int)pv.mag, MAGS - 1 );
+        rect r = t[ (size_t)mag * QUARTER + ( nra & ( QUARTER - 1 ) ) ];
+        int x = r.x;
+        int y = r.y;
+        int s = -(quad >> 1);
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = -(quad & 1);
+        rect rv;
+        rv.x = ( x & ~m ) | ( -y & m );
+        rv.y = ( y & ~m ) | ( x & m );
+        return rv;
+    }
+
+    // the first call builds the tables, and throws if that fails
+    static polar to_polar( rect rv ) {
+        return to_polar( rv, lut().r2p );
+    }
+
+    static rect to_rect( polar pv ) {
+        return to_rect( pv, lut().p2r );
+    }
+
+    static void to_polar_block( const rect *rv, polar *pv, size_t n ) {
+        const polar *t = lut().r2p;
+        for ( size_t i=0; i < n; i++ ) {
+            pv[i] = to_polar( rv[i], t );
+        }
+    }
+
+    static void to_rect_block( const polar *pv, rect *rv, size_t n ) {
+        const rect *t = lut().p2r;
+        for ( size_t i=0; i < n; i++ ) {
+            rv[i] = to_rect( pv[i], t );
+        }
+    }
+};
+
+#endif
+
+//EOF
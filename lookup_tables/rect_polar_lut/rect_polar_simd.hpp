@@ -0,0 +1,36 @@
+#ifndef __RECT_POLAR_SIMD_HPP
+#define __RECT_POLAR_SIMD_HPP
+
+#include "rect_polar_lut.hpp"
+
+// SIMD versions of the block lookup operations.
+// Each lives in its own source file which must be compiled with the
+// matching -m flags, and must only be called on a cpu which supports it.
+// Results are identical to convert_*_block_scalar() for every input.
+// Callers normally use convert_*_block(), which dispatches to these.
+
+// rect_polar_avx2.cpp, compile with -mavx2
+void convert_rect_2_polar_block_avx2( const rect_vector *rv, polar_vector *pv, size_t n );
+void convert_polar_2_rect_block_avx2( const polar_vector *pv, rect_vector *rv, size_t n );
+// polar to rect from the Q15 cos/sin slices, see convert_polar_2_rect_block_sine()
+void convert_polar_2_rect_block_sine_avx2( const polar_vector *pv, rect_vector *rv, size_t n );
+
+// planar versions of the above
+void convert_rect_2_polar_planar_avx2( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n );
+void convert_polar_2_rect_planar_avx2( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+
+// channel interleaved rect to polar, see convert_rect_2_polar_channels()
+void convert_rect_2_polar_channels_avx2( const rect_vector *rv, size_t channels, size_t stride,
+                                         polar_vector *const *pv, size_t n );
+
+// offset binary I/Q to polar, see convert_rect_u8_2_polar_block()
+void convert_rect_u8_2_polar_block_avx2( const uint8_t *iq, polar_vector *pv, size_t n );
+
+// rect_polar_avx512.cpp, compile with -mavx512f -mavx512bw -mavx512vbmi
+// polar to rect with the Q15 cos/sin slices held in registers, no gathers
+void convert_polar_2_rect_block_avx512vbmi( const polar_vector *pv, rect_vector *rv, size_t n );
+void convert_polar_2_rect_planar_avx512vbmi( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+
+#endif
+
+//EOF
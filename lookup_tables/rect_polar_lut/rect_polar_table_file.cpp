@@ -0,0 +1,170 @@
+/* Loader for the binary table file (rect_polar_table_file.hpp)
+   The file is mapped shared and read only, so the page cache holds one copy
+   for every process using it.  The header, section directory and checksum
+   are checked once at map time, after that the lookups index the mapping
+   directly.
+*/
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "rect_polar_lut.hpp"
+#include "rect_polar_table_file.hpp"
+
+// the section each table pointer comes from, and the shape the lookups need
+struct section_shape {
+    uint32_t id;
+    uint32_t element_size;
+    uint32_t rows;
+    uint32_t cols;
+};
+
+static const section_shape expected[TABLE_FILE_SECTIONS] = {
+    { SECTION_RECT_2_POLAR, sizeof(polar_vector), 129, 130 },
+    { SECTION_RECT_2_POLAR_OCTANT, sizeof(polar_vector), 1, 129*130/2 },
+    { SECTION_RECT_2_MAG, 1, 129, 129 },
+    { SECTION_RECT_2_NRA, 1, 129, 129 },
+    { SECTION_RECT_U8_2_POLAR, sizeof(polar_vector), 128, 128 },
+    { SECTION_POLAR_2_RECT, sizeof(rect_vector), 256, 64 },
+    { SECTION_POLAR_2_RECT_COS_Q15, 2, 1, 64 },
+    { SECTION_POLAR_2_RECT_SIN_Q15, 2, 1, 64 },
+    { SECTION_POLAR_2_RECT_SAT_MAG, 2, 1, 64 }
+};
+
+// find section id in the directory, null if it's missing, the wrong shape,
+// misaligned or past the end of the file
+static const void *find_section( const uint8_t *base, size_t size, const table_file_section *dir,
+                                 uint32_t count, const section_shape &want ) {
+    for ( uint32_t i=0; i < count; i++ ) {
+        const table_file_section &s = dir[i];
+        if ( s.id != want.id ) continue;
+        if (( s.element_size != want.element_size ) || ( s.rows != want.rows ) || ( s.cols != want.cols ) ||
+            ( s.size != (uint64_t)want.element_size * want.rows * want.cols ) ||
+            ( s.offset % TABLE_FILE_ALIGN != 0 ) || ( s.offset > size ) || ( s.size > size - s.offset )) {
+            return 0;
+        }
+        return base + s.offset;
+    }
+    return 0;
+}
+
+table_file_status map_table_file( const char *path, rect_polar_table_file *tf ) noexcept {
+    int fd = open( path, O_RDONLY | O_CLOEXEC );
+    if ( fd < 0 ) {
+        return TABLE_FILE_OPEN_FAILED;
+    }
+    struct stat st;
+    if (( fstat( fd, &st ) != 0 ) || ( st.st_size <= 0 )) {
+        close( fd );
+        return TABLE_FILE_OPEN_FAILED;
+    }
+    size_t size = st.st_size;
+    void *map = mmap( 0, size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( map == MAP_FAILED ) {
+        return TABLE_FILE_OPEN_FAILED;
+    }
+    const uint8_t *base = static_cast<const uint8_t *>( map );
+    const table_file_header *h = static_cast<const table_file_header *>( map );
+    table_file_status status = TABLE_FILE_OK;
+    const void *table[TABLE_FILE_SECTIONS];
+    if (( size < sizeof(table_file_header) ) || ( memcmp( h->magic, TABLE_FILE_MAGIC, 8 ) != 0 )) {
+        status = TABLE_FILE_BAD_HEADER;
+    } else if ( h->version != TABLE_FILE_VERSION ) {
+        status = TABLE_FILE_BAD_VERSION;
+    } else if (( h->header_size != sizeof(table_file_header) ) || ( h->file_size != size ) ||
+               ( h->section_count > ( size - sizeof(table_file_header) ) / sizeof(table_file_section) )) {
+        status = TABLE_FILE_BAD_HEADER;
+    } else if (( h->iq_bits != 8 ) || ( h->nra_bits != 8 ) || ( h->alignment != TABLE_FILE_ALIGN ) ||
+               ( h->r2p_rounding > ROUND_TRUNCATE_SATURATE ) || ( h->p2r_rounding > ROUND_TRUNCATE_SATURATE )) {
+        status = TABLE_FILE_BAD_LAYOUT;
+    } else {
+        const table_file_section *dir = reinterpret_cast<const table_file_section *>( h + 1 );
+        for ( int t=0; t < TABLE_FILE_SECTIONS; t++ ) {
+            table[t] = find_section( base, size, dir, h->section_count, expected[t] );
+            if ( table[t] == 0 ) {
+                status = TABLE_FILE_BAD_LAYOUT;
+            }
+        }
+        if (( status == TABLE_FILE_OK ) &&
+            ( table_file_checksum( h + 1, size - sizeof(table_file_header) ) != h->checksum )) {
+            status = TABLE_FILE_BAD_CHECKSUM;
+        }
+    }
+    if ( status != TABLE_FILE_OK ) {
+        munmap( map, size );
+        return status;
+    }
+    tf->base = map;
+    tf->size = size;
+    tf->header = h;
+    tf->rect_2_polar = static_cast<const polar_vector *>( table[0] );
+    tf->rect_2_polar_octant = static_cast<const polar_vector *>( table[1] );
+    tf->rect_2_mag = static_cast<const uint8_t *>( table[2] );
+    tf->rect_2_nra = static_cast<const uint8_t *>( table[3] );
+    tf->rect_u8_2_polar = static_cast<const polar_vector *>( table[4] );
+    tf->polar_2_rect = static_cast<const rect_vector *>( table[5] );
+    tf->cos_q15 = static_cast<const uint16_t *>( table[6] );
+    tf->sin_q15 = static_cast<const uint16_t *>( table[7] );
+    tf->sat_mag = static_cast<const uint16_t *>( table[8] );
+    return TABLE_FILE_OK;
+}
+
+void unmap_table_file( rect_polar_table_file *tf ) noexcept {
+    if ( tf->base ) {
+        munmap( const_cast<void *>( tf->base ), tf->size );
+    }
+    memset( tf, 0, sizeof(*tf) );
+}
+
+const char *table_file_status_name( table_file_status status ) noexcept {
+    switch ( status ) {
+    case TABLE_FILE_OK: return "ok";
+    case TABLE_FILE_OPEN_FAILED: return "open failed";
+    case TABLE_FILE_BAD_HEADER: return "bad header";
+    case TABLE_FILE_BAD_VERSION: return "unsupported version";
+    case TABLE_FILE_BAD_LAYOUT: return "bad layout";
+    case TABLE_FILE_BAD_CHECKSUM: return "bad checksum";
+    }
+    return "unknown";
+}
+
+// same folds as convert_rect_2_polar_block_scalar(), from the mapped table
+void convert_rect_2_polar_block_mapped( const rect_polar_table_file *tf, const rect_vector *rv,
+                                        polar_vector *pv, size_t n ) noexcept {
+    const polar_vector *lut = tf->rect_2_polar;
+    for ( size_t i=0; i < n; i++ ) {
+        int x = rv[i].x;
+        int y = rv[i].y;
+        int s = ( y*256 + x ) >> 31;
+        int h = -s;
+        x = (x ^ s) - s;
+        y = (y ^ s) - s;
+        int m = x >> 31;
+        int r = -m;
+        int fx = ( x & ~m ) | ( y & m );
+        int fy = ( y & ~m ) | ( -x & m );
+        polar_vector t = lut[ fx*130 + fy ];
+        t.nra += ( h << 7 ) | ( r << 6 );
+        pv[i] = t;
+    }
+}
+
+// same quadrant rotations as convert_polar_2_rect_block_scalar()
+void convert_polar_2_rect_block_mapped( const rect_polar_table_file *tf, const polar_vector *pv,
+                                        rect_vector *rv, size_t n ) noexcept {
+    const rect_vector *lut = tf->polar_2_rect;
+    for ( size_t i=0; i < n; i++ ) {
+        int quad = pv[i].nra >> 6;
+        rect_vector t = lut[ pv[i].mag*64 + ( pv[i].nra & 63 ) ];
+        int s = -(quad >> 1);
+        int x = (t.x ^ s) - s;
+        int y = (t.y ^ s) - s;
+        int m = -(quad & 1);
+        rv[i].x = ( x & ~m ) | ( -y & m );
+        rv[i].y = ( y & ~m ) | ( x & m );
+    }
+}
+
+//EOF
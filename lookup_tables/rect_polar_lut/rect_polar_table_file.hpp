@@ -0,0 +1,129 @@
+#ifndef __RECT_POLAR_TABLE_FILE_HPP
+#define __RECT_POLAR_TABLE_FILE_HPP
+
+/* Binary table file, written by gen_lookup_table as rect_polar_lut.bin
+   next to rect_polar_lut.cpp and mapped read only at run time, so every
+   process on a host shares one physical copy of the tables and a table
+   variant can be swapped per deployment without recompiling.  A variant
+   is any contents in the 8/8 shapes below: either rounding, sections in
+   any order and at any aligned offset, extra sections ignored.  Other
+   widths or shapes are refused, the lookups are compiled for these.
+
+   Layout, little endian:
+     table_file_header       64 bytes
+     table_file_section      32 bytes each, section_count of them
+     section data            each section on a TABLE_FILE_ALIGN boundary
+   checksum is FNV-1a 64 over everything after the header, so a version
+   or layout mismatch is reported as such before the checksum is looked at.
+*/
+#include <cstddef>
+#include <cstdint>
+
+struct rect_vector;
+struct polar_vector;
+
+const char TABLE_FILE_MAGIC[8] = { 'R', 'P', 'L', 'U', 'T', 'B', 'I', 'N' };
+const uint32_t TABLE_FILE_VERSION = 1;
+const uint32_t TABLE_FILE_ALIGN = 64;
+
+// rounding the tables were built with
+enum table_file_rounding {
+    ROUND_NEAREST = 0,              // mag and nra rounded to nearest
+    ROUND_TRUNCATE_SATURATE = 1     // x,y truncated toward zero, saturated at 127
+};
+
+// one section per table, entries are [rows][cols] of element_size bytes
+enum table_file_section_id {
+    SECTION_RECT_2_POLAR = 1,       // polar_vector [129][130]
+    SECTION_RECT_2_POLAR_OCTANT,    // polar_vector [1][8385]
+    SECTION_RECT_2_MAG,             // uint8_t [129][129]
+    SECTION_RECT_2_NRA,             // uint8_t [129][129]
+    SECTION_RECT_U8_2_POLAR,        // polar_vector [128][128]
+    SECTION_POLAR_2_RECT,           // rect_vector [256][64]
+    SECTION_POLAR_2_RECT_COS_Q15,   // uint16_t [1][64]
+    SECTION_POLAR_2_RECT_SIN_Q15,   // uint16_t [1][64]
+    SECTION_POLAR_2_RECT_SAT_MAG,   // uint16_t [1][64]
+    TABLE_FILE_SECTIONS = 9
+};
+
+struct table_file_header {
+    char magic[8];              // TABLE_FILE_MAGIC
+    uint32_t version;           // TABLE_FILE_VERSION
+    uint32_t header_size;       // sizeof(table_file_header)
+    uint8_t iq_bits;            // x,y and mag width, 8
+    uint8_t nra_bits;           // nra width, 8
+    uint8_t r2p_rounding;       // table_file_rounding
+    uint8_t p2r_rounding;       // table_file_rounding
+    uint32_t alignment;         // TABLE_FILE_ALIGN
+    uint32_t section_count;
+    uint32_t reserved0;
+    uint64_t file_size;
+    uint64_t checksum;
+    uint8_t reserved[16];
+};
+
+struct table_file_section {
+    uint32_t id;                // table_file_section_id
+    uint32_t element_size;
+    uint32_t rows;
+    uint32_t cols;
+    uint64_t offset;            // from the start of the file
+    uint64_t size;              // rows*cols*element_size
+};
+
+static_assert( sizeof(table_file_header) == 64, "table_file_header must be 64 bytes" );
+static_assert( sizeof(table_file_section) == 32, "table_file_section must be 32 bytes" );
+
+// FNV-1a 64
+inline uint64_t table_file_checksum( const void *data, size_t n ) {
+    const uint8_t *p = static_cast<const uint8_t *>( data );
+    uint64_t h = 14695981039346656037ull;
+    for ( size_t i=0; i < n; i++ ) {
+        h = ( h ^ p[i] ) * 1099511628211ull;
+    }
+    return h;
+}
+
+// Status reported by map_table_file()
+enum table_file_status {
+    TABLE_FILE_OK = 0,
+    TABLE_FILE_OPEN_FAILED,     // open, fstat or mmap failed
+    TABLE_FILE_BAD_HEADER,      // not a table file, or truncated
+    TABLE_FILE_BAD_VERSION,     // a version this loader doesn't read
+    TABLE_FILE_BAD_LAYOUT,      // resolution, an unknown rounding or a section isn't what the lookups expect
+    TABLE_FILE_BAD_CHECKSUM
+};
+
+// A mapped table file, the table pointers point into the read only mapping
+struct rect_polar_table_file {
+    const void *base;
+    size_t size;
+    const table_file_header *header;
+    const polar_vector *rect_2_polar;           // [129][130]
+    const polar_vector *rect_2_polar_octant;    // [8385]
+    const uint8_t *rect_2_mag;                  // [129][129]
+    const uint8_t *rect_2_nra;                  // [129][129]
+    const polar_vector *rect_u8_2_polar;        // [128][128]
+    const rect_vector *polar_2_rect;            // [256][64]
+    const uint16_t *cos_q15;                    // [64]
+    const uint16_t *sin_q15;                    // [64]
+    const uint16_t *sat_mag;                    // [64]
+};
+
+// Map path read only and check it, tf is only filled in on TABLE_FILE_OK.
+// (rect_polar_table_file.cpp)
+table_file_status map_table_file( const char *path, rect_polar_table_file *tf ) noexcept;
+void unmap_table_file( rect_polar_table_file *tf ) noexcept;
+const char *table_file_status_name( table_file_status status ) noexcept;
+
+// Block lookups through a mapped file's tables, same results as
+// convert_rect_2_polar_block()/convert_polar_2_rect_block() when the file
+// holds the compiled in tables
+void convert_rect_2_polar_block_mapped( const rect_polar_table_file *tf, const rect_vector *rv,
+                                        polar_vector *pv, size_t n ) noexcept;
+void convert_polar_2_rect_block_mapped( const rect_polar_table_file *tf, const polar_vector *pv,
+                                        rect_vector *rv, size_t n ) noexcept;
+
+#endif
+
+//EOF
@@ -0,0 +1,411 @@
+#ifndef __RECT_POLAR_TABLES_HPP
+#define __RECT_POLAR_TABLES_HPP
+
+/* constexpr builders for the rect/polar lookup tables
+
+   Every table is built by a constexpr function, so a constexpr variable
+   holding one is computed by the compiler and lands in .rodata with no
+   runtime init.  gen_lookup_table.cpp takes the 8-bit tables it writes out
+   from here, and rect_polar_res.hpp builds the tables for the other widths
+   here, so there is one definition of each table.
+
+   The 8-bit builders are templates on the entry types (anything with
+   mag,nra or x,y members) so they work with the generator's structs and
+   with rect_polar_lut.hpp's.
+
+   They need no libm: mag is rounded with integer compares, nra by counting
+   the NRA rounding boundaries below the angle, and the few sin/cos/atan
+   values are series in double.  The tests check the results against the
+   libm built tables.
+*/
+
+#include <cstddef>
+#include <cstdint>
+
+// constexpr math, double precision on the ranges used here
+
+constexpr double cx_pi = 3.14159265358979323846;
+
+// sin, cos for |a| <= PI/4
+constexpr double cx_sin_series( double a ) {
+    double term = a, sum = a;
+    for ( int i=1; i < 12; i++ ) {
+        term *= -a*a / ( (2*i) * (2*i+1) );
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cx_cos_series( double a ) {
+    double term = 1.0, sum = 1.0;
+    for ( int i=1; i < 12; i++ ) {
+        term *= -a*a / ( (2*i-1) * (2*i) );
+        sum += term;
+    }
+    return sum;
+}
+
+// sin, cos for 0 <= a <= PI/2
+constexpr double cx_sin( double a ) {
+    return ( a <= cx_pi/4 ) ? cx_sin_series( a ) : cx_cos_series( cx_pi/2 - a );
+}
+
+constexpr double cx_cos( double a ) {
+    return ( a <= cx_pi/4 ) ? cx_cos_series( a ) : cx_sin_series( cx_pi/2 - a );
+}
+
+// atan for 0 <= r <= 1, shifted by PI/4 above tan(PI/8) so the series
+// argument stays under 0.42
+constexpr double cx_atan( double r ) {
+    double base = 0.0;
+    if ( r > 0.41421356237309503 ) {
+        base = cx_pi/4;
+        r = ( r - 1.0 ) / ( r + 1.0 );
+    }
+    double term = r, sum = r;
+    for ( int i=1; i < 24; i++ ) {
+        term *= -r*r;
+        sum += term / (2*i+1);
+    }
+    return base + sum;
+}
+
+// sqrt for 1 <= v <= 5
+constexpr double cx_sqrt12( double v ) {
+    double s = 1.25;
+    for ( int i=0; i < 6; i++ ) {
+        s = 0.5 * ( s + v / s );
+    }
+    return s;
+}
+
+// round half up for v >= 0
+constexpr long cx_round( double v ) {
+    return (long)( v + 0.5 );
+}
+
+// sin/cos of the 64 NRA rounding boundaries (j+0.5)*2*PI/256 in the first
+// quadrant, an angle rounds to nra j+1 or more once it is past boundary j
+struct nra_boundaries {
+    double cos[64];
+    double sin[64];
+};
+
+constexpr nra_boundaries make_nra_boundaries() {
+    nra_boundaries b{};
+    for ( int j=0; j < 64; j++ ) {
+        double a = ( j + 0.5 ) * cx_pi / 128;
+        b.cos[j] = cx_cos( a );
+        b.sin[j] = cx_sin( a );
+    }
+    return b;
+}
+
+// round( atan2( y, x ) * 256 / 2*PI ) for x,y >= 0, counting up from a
+// starting nra of k (the nra of an earlier vector with a smaller angle)
+constexpr int cx_nra_8( const nra_boundaries &b, double x, double y, int k ) {
+    while (( k < 64 ) && ( y * b.cos[k] > x * b.sin[k] )) {
+        k++;
+    }
+    return k;
+}
+
+// 8-bit table types and builders, see gen_lookup_table.cpp for the layouts
+
+template <typename P>
+struct rect_2_polar_table {
+    P lut[129][130];
+};
+
+template <typename P>
+constexpr rect_2_polar_table<P> make_rect_2_polar_lut() {
+    rect_2_polar_table<P> t{};
+    const nra_boundaries b = make_nra_boundaries();
+    for ( int x=0; x < 129; x++ ) {
+        // mag and nra only grow with y, so carry them along the row
+        int mag = x;
+        int nra = 0;
+        for ( int y=0; y < 129; y++ ) {
+            // round( sqrt( n ) ) is the k with (2k-1)^2 <= 4n < (2k+1)^2
+            long n4 = 4L * ( x*x + y*y );
+            while ( n4 >= ( 2L*mag + 1 ) * ( 2L*mag + 1 ) ) {
+                mag++;
+            }
+            nra = cx_nra_8( b, x, y, nra );
+            t.lut[x][y].mag = mag;
+            t.lut[x][y].nra = nra;
+        }
+        t.lut[x][129].mag = 0;
+        t.lut[x][129].nra = 0;
+    }
+    return t;
+}
+
+template <typename P>
+struct rect_2_polar_octant_table {
+    P lut[129*130/2];
+};
+
+template <typename P>
+constexpr rect_2_polar_octant_table<P> make_rect_2_polar_octant_lut( const rect_2_polar_table<P> &q ) {
+    rect_2_polar_octant_table<P> t{};
+    for ( int x=0; x < 129; x++ ) {
+        for ( int y=0; y <= x; y++ ) {
+            t.lut[ x*(x+1)/2 + y ] = q.lut[x][y];
+        }
+    }
+    return t;
+}
+
+struct rect_byte_table {
+    uint8_t lut[129][129];
+};
+
+template <typename P>
+constexpr rect_byte_table make_rect_2_mag_lut( const rect_2_polar_table<P> &q ) {
+    rect_byte_table t{};
+    for ( int x=0; x < 129; x++ ) {
+        for ( int y=0; y < 129; y++ ) {
+            t.lut[x][y] = q.lut[x][y].mag;
+        }
+    }
+    return t;
+}
+
+template <typename P>
+constexpr rect_byte_table make_rect_2_nra_lut( const rect_2_polar_table<P> &q ) {
+    rect_byte_table t{};
+    for ( int x=0; x < 129; x++ ) {
+        for ( int y=0; y < 129; y++ ) {
+            t.lut[x][y] = q.lut[x][y].nra;
+        }
+    }
+    return t;
+}
+
+template <typename P>
+struct rect_u8_2_polar_table {
+    P lut[128][128];
+};
+
+// entry [a][b] is the vector (a+0.5, b+0.5), worked in doubled units
+// (2a+1, 2b+1) so everything stays integer
+template <typename P>
+constexpr rect_u8_2_polar_table<P> make_rect_u8_2_polar_lut() {
+    rect_u8_2_polar_table<P> t{};
+    const nra_boundaries b = make_nra_boundaries();
+    for ( int a=0; a < 128; a++ ) {
+        int mag = a;
+        int nra = 0;
+        for ( int c=0; c < 128; c++ ) {
+            // round( sqrt( s )/2 ) is the k with (2k-1)^2 <= s < (2k+1)^2
+            long s = (long)( 2*a + 1 ) * ( 2*a + 1 ) + (long)( 2*c + 1 ) * ( 2*c + 1 );
+            while ( s >= ( 2L*mag + 1 ) * ( 2L*mag + 1 ) ) {
+                mag++;
+            }
+            nra = cx_nra_8( b, 2*a + 1, 2*c + 1, nra );
+            t.lut[a][c].mag = mag;
+            t.lut[a][c].nra = nra;
+        }
+    }
+    return t;
+}
+
+template <typename R>
+struct polar_2_rect_table {
+    R lut[256][64];
+};
+
+// x,y truncated toward zero and saturated at 127, as the table always was
+template <typename R>
+constexpr polar_2_rect_table<R> make_polar_2_rect_lut() {
+    polar_2_rect_table<R> t{};
+    for ( int nra=0; nra < 64; nra++ ) {
+        double c = cx_cos( nra * cx_pi / 128 );
+        double s = cx_sin( nra * cx_pi / 128 );
+        for ( int mag=0; mag < 256; mag++ ) {
+            int x = mag * c;
+            int y = mag * s;
+            t.lut[mag][nra].x = ( x < 127 ) ? x : 127;
+            t.lut[mag][nra].y = ( y < 127 ) ? y : 127;
+        }
+    }
+    return t;
+}
+
+// Q15 cos/sin slices and the saturation mags of polar_2_rect_lut
+struct polar_2_rect_slices {
+    uint16_t cos_q15[64];
+    uint16_t sin_q15[64];
+    uint16_t sat_mag[64];
+};
+
+// the Q15 constant closest to ideal for which min( (mag*c) >> 15, 127 )
+// reproduces col[mag] for every mag, col is one x or y column of the table
+constexpr uint16_t cx_fit_q15( const long *col, double ideal ) {
+    long lo = 0, hi = 65535;
+    for ( long mag=1; mag < 256; mag++ ) {
+        long t = col[mag];
+        // need mag*c >= t<<15, and mag*c < (t+1)<<15 unless saturated
+        long l = ( (t << 15) + mag - 1 ) / mag;
+        lo = ( l > lo ) ? l : lo;
+        if ( t < 127 ) {
+            long h = ( ((t+1) << 15) - 1 ) / mag;
+            hi = ( h < hi ) ? h : hi;
+        }
+    }
+    if ( lo > hi ) {
+        // not a constant expression, so this fails the build
+        throw "no Q15 constant reproduces table column";
+    }
+    long c = cx_round( ideal * 32768.0 );
+    c = ( c < lo ) ? lo : c;
+    c = ( c > hi ) ? hi : c;
+    return c;
+}
+
+template <typename R>
+constexpr polar_2_rect_slices make_polar_2_rect_slices( const polar_2_rect_table<R> &p ) {
+    polar_2_rect_slices t{};
+    for ( int nra=0; nra < 64; nra++ ) {
+        long xcol[256] = {}, ycol[256] = {};
+        double c = cx_cos( nra * cx_pi / 128 );
+        double s = cx_sin( nra * cx_pi / 128 );
+        t.sat_mag[nra] = 256;
+        for ( int mag=0; mag < 256; mag++ ) {
+            xcol[mag] = p.lut[mag][nra].x;
+            ycol[mag] = p.lut[mag][nra].y;
+            // first mag whose unsaturated x or y is over 127
+            if (( (int)( mag * c ) > 127 || (int)( mag * s ) > 127 ) && ( t.sat_mag[nra] > mag )) {
+                t.sat_mag[nra] = mag;
+            }
+        }
+        t.cos_q15[nra] = cx_fit_q15( xcol, c );
+        t.sin_q15[nra] = cx_fit_q15( ycol, s );
+    }
+    return t;
+}
+
+// tables for ratio_engine in rect_polar_res.hpp, T is the nra type
+template <int RATIO_BITS, int NRA_BITS, typename T>
+struct ratio_tables {
+    static const int RATIO_SIZE = ( 1 << RATIO_BITS ) + 1;
+    static const int QUARTER = 1 << ( NRA_BITS - 2 );
+    T atan[RATIO_SIZE];              // octant nra of atan( i/2^RATIO_BITS )
+    uint32_t sec[RATIO_SIZE];        // Q30 sqrt( 1 + (i/2^RATIO_BITS)^2 )
+    uint32_t sin[QUARTER + 1];       // Q30 sin( i*2*PI/2^NRA_BITS )
+};
+
+template <int RATIO_BITS, int NRA_BITS, typename T>
+constexpr ratio_tables<RATIO_BITS,NRA_BITS,T> make_ratio_tables() {
+    typedef ratio_tables<RATIO_BITS,NRA_BITS,T> tables;
+    tables t{};
+    for ( int i=0; i < tables::RATIO_SIZE; i++ ) {
+        double r = (double)i / ( 1 << RATIO_BITS );
+        t.atan[i] = cx_round( cx_atan( r ) * ( 1 << NRA_BITS ) / ( 2.0*cx_pi ) );
+        t.sec[i] = cx_round( cx_sqrt12( 1.0 + r*r ) * ( 1 << 30 ) );
+    }
+    for ( int i=0; i <= tables::QUARTER; i++ ) {
+        t.sin[i] = cx_round( cx_sin( i * 2.0*cx_pi / ( 1 << NRA_BITS ) ) * ( 1 << 30 ) );
+    }
+    return t;
+}
+
+// tables for interp_engine in rect_polar_res.hpp
+//   grid  the first octant of a 2^16 x 2^16 square, rows hi = 2^15:2^16
+//         every 2^(16-HI_BITS) and columns lo = 0:2^16 every 2^(16-LO_BITS),
+//         holding Q15 hypot() and atan2() with the full circle as 2^32
+//   sin   Q30 quarter wave sine at 2^SIN_BITS points, plus one pad entry
+template <int HI_BITS, int LO_BITS, int SIN_BITS>
+struct interp_tables {
+    static const int ROWS = ( 1 << ( HI_BITS - 1 ) ) + 1;
+    static const int COLS = ( 1 << LO_BITS ) + 1;
+    static const int SIN_SIZE = ( 1 << SIN_BITS ) + 2;
+    struct point {
+        uint32_t mag;
+        uint32_t nra;
+    };
+    point grid[ROWS][COLS];
+    uint32_t sin[SIN_SIZE];
+};
+
+template <int HI_BITS, int LO_BITS, int SIN_BITS>
+constexpr interp_tables<HI_BITS,LO_BITS,SIN_BITS> make_interp_tables() {
+    typedef interp_tables<HI_BITS,LO_BITS,SIN_BITS> tables;
+    tables t{};
+    for ( int r=0; r < tables::ROWS; r++ ) {
+        double hi = (double)( r + ( 1 << ( HI_BITS - 1 ) ) ) * ( 1 << ( 16 - HI_BITS ) );
+        for ( int c=0; c < tables::COLS; c++ ) {
+            // columns past lo = hi are only read as the far side of a cell
+            // crossing the diagonal
+            double q = (double)c * ( 1 << ( 16 - LO_BITS ) ) / hi;
+            t.grid[r][c].mag = cx_round( hi * cx_sqrt12( 1.0 + q*q ) * 32768.0 );
+            t.grid[r][c].nra = cx_round( cx_atan( q ) / ( 2.0*cx_pi ) * 4294967296.0 );
+        }
+    }
+    for ( int i=0; i <= ( 1 << SIN_BITS ); i++ ) {
+        t.sin[i] = cx_round( cx_sin( i * cx_pi / ( 2 << SIN_BITS ) ) * ( 1 << 30 ) );
+    }
+    t.sin[ ( 1 << SIN_BITS ) + 1 ] = t.sin[ 1 << SIN_BITS ];
+    return t;
+}
+
+// constants for cordic_engine in rect_polar_res.hpp, the micro-rotation
+// angles atan( 2^-i ) with the full circle as 2^32 and the Q30 inverse of
+// the gain of ITERATIONS of them
+template <int ITERATIONS>
+struct cordic_tables {
+    uint32_t atan[ITERATIONS];
+    uint32_t inv_gain;
+};
+
+template <int ITERATIONS>
+constexpr cordic_tables<ITERATIONS> make_cordic_tables() {
+    cordic_tables<ITERATIONS> t{};
+    double gain = 1.0;
+    for ( int i=0; i < ITERATIONS; i++ ) {
+        double r = 1.0 / ( (uint64_t)1 << i );
+        t.atan[i] = cx_round( cx_atan( r ) / ( 2.0*cx_pi ) * 4294967296.0 );
+        gain *= cx_sqrt12( 1.0 + r*r );
+    }
+    t.inv_gain = cx_round( ( 1 << 30 ) / gain );
+    return t;
+}
+
+// tables for hybrid_engine in rect_polar_res.hpp, for a coarse grid of
+// COARSE_BITS and REFINE micro-rotations after it
+//   rot   Q30 cos and sin of the centres of 2^COARSE_BITS steps across a
+//         quarter wave, over the micro-rotation gain
+//   p2r_atan  micro-rotation angles atan( 2^-i ), i from COARSE_BITS+1
+template <int COARSE_BITS, int REFINE>
+struct hybrid_tables {
+    static const int STEPS = 1 << COARSE_BITS;
+    struct rot_entry {
+        int32_t cos;
+        int32_t sin;
+    };
+    rot_entry rot[STEPS];
+    uint32_t p2r_atan[REFINE + 1];
+};
+
+template <int COARSE_BITS, int REFINE>
+constexpr hybrid_tables<COARSE_BITS,REFINE> make_hybrid_tables() {
+    typedef hybrid_tables<COARSE_BITS,REFINE> tables;
+    tables t{};
+    double p2r_gain = 1.0;
+    for ( int i=0; i < REFINE; i++ ) {
+        double r = 1.0 / ( (uint64_t)1 << ( COARSE_BITS + 1 + i ) );
+        t.p2r_atan[i] = cx_round( cx_atan( r ) / ( 2.0*cx_pi ) * 4294967296.0 );
+        p2r_gain *= cx_sqrt12( 1.0 + r*r );
+    }
+    for ( int j=0; j < tables::STEPS; j++ ) {
+        double a = ( j + 0.5 ) * ( cx_pi/2 ) / tables::STEPS;
+        t.rot[j].cos = cx_round( cx_cos( a ) * ( 1 << 30 ) / p2r_gain );
+        t.rot[j].sin = cx_round( cx_sin( a ) * ( 1 << 30 ) / p2r_gain );
+    }
+    return t;
+}
+
+#endif
+
+//EOF
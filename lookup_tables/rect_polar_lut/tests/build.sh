@@ -1 +1,4 @@
-clang++-3.6 -g -o test_output test_output.cpp rect_polar_lut.cpp -std=c++14 -ferror-limit=4
+clang++-6.0 -g -O2 -mavx2 -c ../rect_polar_avx2.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -g -O2 -mavx512f -mavx512bw -mavx512vbmi -c ../rect_polar_avx512.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -g -O3 -c ../rect_polar_planar.cpp -I.. -std=c++14 -ferror-limit=4
+clang++-6.0 -g -o test_output test_output.cpp ../rect_polar_lut.cpp -Wa,-I.. ../rect_polar_dispatch.cpp rect_polar_planar.o ../rect_polar_table_file.cpp rect_polar_avx2.o rect_polar_avx512.o -I.. -std=c++14 -pthread -ferror-limit=4 "$@"
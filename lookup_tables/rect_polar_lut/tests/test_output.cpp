@@ -1,78 +1,850 @@
 #include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include <thread>
+#include <vector>
 #include "rect_polar_lut.hpp"
+#include "rect_polar_inline.hpp"
+#include "rect_polar_simd.hpp"
+#include "rect_polar_res.hpp"
+#include "rect_polar_runtime.hpp"
+#include "rect_polar_table_file.hpp"
 
-// run a test on a rect lookup operation
-int run_p2r_test( uint8_t mag, uint8_t nra, int8_t expected_x, int8_t expected_y) {
-    polar_vector pv;
-    rect_vector rv;
-    pv.mag = mag, pv.nra = nra;
-    rv = convert_polar_2_rect( pv );
-    std::cout << pv << " => " << rv << "  .........  ";
-    if (( rv.x == expected_x ) && ( rv.y == expected_y )) {
-        std::cout << "PASS\n";
-    } else {
-        std::cout << "FAIL ";
-        std::cout << "Expected { " << (int)expected_x << "," << (int)expected_y << " } " << std::endl;
-        return -1;
+// reference lookups, straight from the generated first quadrant tables
+// with the quadrants unfolded by branches.  Every kernel must match these
+// bit for bit.
+polar_vector ref_rect_2_polar( rect_vector rv ) {
+    int x = rv.x, y = rv.y, quad = 0;
+    // rotate by -90 degrees, (x,y) => (y,-x), until x > 0 and y >= 0
+    while ((( x <= 0 ) || ( y < 0 )) && (( x != 0 ) || ( y != 0 ))) {
+        int t = x;
+        x = y, y = -t;
+        quad++;
     }
-    return 0;
+    polar_vector pv = rect_2_polar_lut[x][y];
+    pv.nra += quad << 6;
+    return pv;
 }
 
-// run a test on a polar lookup operation
-int run_r2p_test( int8_t x, int8_t y, uint8_t expected_mag, uint8_t expected_nra) {
-    polar_vector pv;
+rect_vector ref_polar_2_rect( polar_vector pv ) {
+    rect_vector t = polar_2_rect_lut[pv.mag][pv.nra & 63];
+    int x = t.x, y = t.y;
+    // rotate by 90 degrees per quadrant, (x,y) => (-y,x)
+    for ( int quad=0; quad < ( pv.nra >> 6 ); quad++ ) {
+        int r = x;
+        x = -y, y = r;
+    }
     rect_vector rv;
     rv.x = x, rv.y = y;
-    pv = convert_rect_2_polar( rv );
-    std::cout << rv << " => " << pv << "  .........  ";
-    if (( pv.mag == expected_mag ) && ( pv.nra == expected_nra )) {
-        std::cout << "PASS\n";
-    } else {
-        std::cout << "FAIL ";
-        std::cout << "Expected { " << (int)expected_mag << "," << (int)expected_nra << " } " << std::endl;
-        return -1;
-    }
-    return 0;
+    return rv;
 }
 
+bool operator ==( polar_vector a, polar_vector b ) { return ( a.mag == b.mag ) && ( a.nra == b.nra ); }
+bool operator ==( rect_vector a, rect_vector b ) { return ( a.x == b.x ) && ( a.y == b.y ); }
+bool operator !=( polar_vector a, polar_vector b ) { return !( a == b ); }
+bool operator !=( rect_vector a, rect_vector b ) { return !( a == b ); }
+
+// hand checked vectors in every quadrant, on the axes and at the
+// saturation and -128 edges, only failures are printed
+struct p2r_case {
+    uint8_t mag, nra;
+    int8_t x, y;
+};
+
+struct r2p_case {
+    int8_t x, y;
+    uint8_t mag, nra;
+};
 
 int run_test() {
-    // test polar to rect lookups
+    static const p2r_case p2r_cases[] = {
+        //  mag,nra => x,y
+        // quad 1 0->90
+        { 71, 0, 71, 0 }, { 71, 32, 50, 50 }, { 71, 64, 0, 71 },
+        // quad 2 90->180
+        { 71, 96, -50, 50 }, { 71, 128, -71, 0 },
+        // quad 3 180 -> 270
+        { 71, 160, -50, -50 }, { 71, 192, 0, -71 },
+        // QUAD 4 270 -> 360
+        { 71, 224, 50, -50 },
+        // mag over 127 saturates x,y at 127
+        { 181, 32, 127, 127 }, { 255, 64, 0, 127 }, { 255, 160, -127, -127 }
+    };
+    static const r2p_case r2p_cases[] = {
+        //  x,y => mag,nra
+        // QUAD 1
+        { 71, 0, 71, 0 }, { 50, 50, 71, 32 }, { 0, 71, 71, 64 },
+        // Quad 2
+        { -50, 50, 71, 96 }, { -71, 0, 71, 128 },
+        // Quad 3
+        { -50, -50, 71, 160 }, { 0, -71, 71, 192 },
+        // Quad 4
+        { 50, -50, 71, 224 },
+        // off diagonal vectors, catch x/y swaps when folding quads 2 and 4
+        { -10, 71, 72, 70 }, { -71, 10, 72, 122 }, { 10, -71, 72, 198 }, { 71, -10, 72, 250 },
+        // -128 on either axis
+        { -128, 0, 128, 128 }, { 0, -128, 128, 192 }, { -128, 127, 180, 96 },
+        { 127, -128, 180, 224 }, { -128, -128, 181, 160 }
+    };
     std::cout << "Testing Polar to Rect lookups....\n";
-    // quad 1 0->90
-    //                 mag,nra => x,y
-    if ( run_p2r_test( 71, 0, 71, 0 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 32, 50, 50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 64, 0, 71 ) != 0 ) { return -1; }
-    // quad 2 90->180
-    if ( run_p2r_test( 71, 96, -50, 50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 128, -71, 0 ) != 0 ) { return -1; }
-    // quad 3 180 -> 270
-    if ( run_p2r_test( 71, 160, -50, -50 ) != 0 ) { return -1; }
-    if ( run_p2r_test( 71, 192, 0, -71 ) != 0 ) { return -1; }
-    // QUAD 4 270 -> 360
-    if ( run_p2r_test( 71, 224, 50, -50 ) != 0 ) { return -1; }
+    for ( const p2r_case &c : p2r_cases ) {
+        polar_vector pv;
+        pv.mag = c.mag, pv.nra = c.nra;
+        rect_vector rv = convert_polar_2_rect( pv );
+        if (( rv.x != c.x ) || ( rv.y != c.y ) || ( ref_polar_2_rect( pv ) != rv )) {
+            std::cout << pv << " => " << rv << " FAIL Expected { " << (int)c.x << "," << (int)c.y << " }" << std::endl;
+            return -1;
+        }
+    }
     std::cout << "Testing Rect to Polar lookups....\n";
-    // QUAD 1
-    //                 x,y => mag,nra
-    if ( run_r2p_test( 71, 0, 71, 0 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 50, 50, 71, 32 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 0, 71, 71, 64 ) != 0 ) { return -1; }
-    // Quad 2
-    if ( run_r2p_test( -50, 50, 71, 96 ) != 0 ) { return -1; }
-    if ( run_r2p_test( -71, 0, 71, 128 ) != 0 ) { return -1; }
-    // Quad 3
-    if ( run_r2p_test( -50, -50, 71, 160 ) != 0 ) { return -1; }
-    if ( run_r2p_test( 0, -71, 71, 192 ) != 0 ) { return -1; }
-    // Quad 4
-    if ( run_r2p_test( 50, -50, 71, 224 ) != 0 ) { return -1; }
+    for ( const r2p_case &c : r2p_cases ) {
+        rect_vector rv;
+        rv.x = c.x, rv.y = c.y;
+        polar_vector pv = convert_rect_2_polar( rv );
+        if (( pv.mag != c.mag ) || ( pv.nra != c.nra ) || ( ref_rect_2_polar( rv ) != pv )) {
+            std::cout << rv << " => " << pv << " FAIL Expected { " << (int)c.mag << "," << (int)c.nra << " }" << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+// compare the scalar block kernels against the per sample lookups over every
+// input, and rect to polar against mag/nra computed in double precision
+int run_block_test() {
+    static rect_vector rv[256*256], rv_out[256*256];
+    static polar_vector pv[256*256], pv_in[256*256];
+    size_t n = 0;
+    for ( int x=-128; x <= 127; x++ ) {
+        for ( int y=-128; y <= 127; y++ ) {
+            rv[n].x = x, rv[n].y = y;
+            n++;
+        }
+    }
+    std::cout << "Testing Rect to Polar block lookups....\n";
+    convert_rect_2_polar_block_scalar( rv, pv, n );
+    for ( size_t i=0; i < n; i++ ) {
+        polar_vector e = convert_rect_2_polar( rv[i] );
+        polar_vector d;
+        d.mag = round( sqrt( rv[i].x*rv[i].x + rv[i].y*rv[i].y ) );
+        d.nra = (int)round( atan2( rv[i].y, rv[i].x ) * 128 / M_PI ) & 255;
+        if (( pv[i] != e ) || ( d != e ) || ( ref_rect_2_polar( rv[i] ) != e ) ||
+            ( convert_rect_2_polar_inline( rv[i] ) != e )) {
+            std::cout << rv[i] << " => " << pv[i] << " FAIL Expected " << e << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "Testing Rect to Mag and Rect to NRA block lookups....\n";
+    static uint8_t mag[256*256], nra[256*256];
+    convert_rect_2_mag_block( rv, mag, n );
+    convert_rect_2_nra_block( rv, nra, n );
+    for ( size_t i=0; i < n; i++ ) {
+        if (( mag[i] != pv[i].mag ) || ( nra[i] != pv[i].nra ) ||
+            ( convert_rect_2_mag( rv[i] ) != pv[i].mag ) || ( convert_rect_2_nra( rv[i] ) != pv[i].nra )) {
+            std::cout << rv[i] << " => " << (int)mag[i] << "," << (int)nra[i] << " FAIL Expected " << pv[i] << std::endl;
+            return -1;
+        }
+    }
+    n = 0;
+    for ( int mag=0; mag < 256; mag++ ) {
+        for ( int nra=0; nra < 256; nra++ ) {
+            pv_in[n].mag = mag, pv_in[n].nra = nra;
+            n++;
+        }
+    }
+    std::cout << "Testing Polar to Rect block lookups....\n";
+    convert_polar_2_rect_block_scalar( pv_in, rv_out, n );
+    for ( size_t i=0; i < n; i++ ) {
+        rect_vector e = convert_polar_2_rect( pv_in[i] );
+        if (( rv_out[i] != e ) || ( ref_polar_2_rect( pv_in[i] ) != e ) ||
+            ( convert_polar_2_rect_inline( pv_in[i] ) != e )) {
+            std::cout << pv_in[i] << " => " << rv_out[i] << " FAIL Expected " << e << std::endl;
+            return -1;
+        }
+        // status version, saturated when the first quadrant x or y is over 127
+        lut_status status;
+        rect_vector r = convert_polar_2_rect( pv_in[i], &status );
+        double a = ( pv_in[i].nra & 63 ) * M_PI / 128;
+        bool sat = ( (int)( pv_in[i].mag * cos( a ) ) > 127 ) || ( (int)( pv_in[i].mag * sin( a ) ) > 127 );
+        if (( r.x != e.x ) || ( r.y != e.y ) || ( status != ( sat ? LUT_SATURATED : LUT_OK ) )) {
+            std::cout << pv_in[i] << " => " << r << " status " << status << " FAIL Expected " << e
+                      << " status " << ( sat ? LUT_SATURATED : LUT_OK ) << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+// Kernels under test for check_block, each wraps a lookup and its buffers.
+//   clear( n )                 fills outputs 0:n with 0xa5 bytes
+//   run( in_off, out_off, n )  converts inputs in_off:in_off+n to outputs out_off:
+//   ok( i, j )                 output i is the reference for input j
+//   blank( i )                 output i still holds the fill
+//   show( i, j )               prints input j, output i and the reference
+template <typename I, typename O>
+struct block_kernel {
+    void (*func)( const I *, O *, size_t );
+    const I *in;
+    const O *e;
+    O *out;
+    void clear( size_t n ) { memset( out, 0xa5, n * sizeof(O) ); }
+    void run( size_t in_off, size_t out_off, size_t n ) { func( in + in_off, out + out_off, n ); }
+    bool ok( size_t i, size_t j ) const { return out[i] == e[j]; }
+    bool blank( size_t i ) const {
+        O fill;
+        memset( &fill, 0xa5, sizeof(fill) );
+        return out[i] == fill;
+    }
+    void show( size_t i, size_t j ) const { std::cout << in[j] << " => " << out[i] << " FAIL Expected " << e[j]; }
+};
+
+typedef void (*r2p_planar_func)( const int8_t *x, const int8_t *y, uint8_t *mag, uint8_t *nra, size_t n );
+struct r2p_planar_kernel {
+    r2p_planar_func func;
+    const int8_t *x, *y;
+    const polar_vector *e;
+    uint8_t *mag, *nra;
+    void clear( size_t n ) { memset( mag, 0xa5, n ), memset( nra, 0xa5, n ); }
+    void run( size_t in_off, size_t out_off, size_t n ) { func( x + in_off, y + in_off, mag + out_off, nra + out_off, n ); }
+    bool ok( size_t i, size_t j ) const { return ( mag[i] == e[j].mag ) && ( nra[i] == e[j].nra ); }
+    bool blank( size_t i ) const { return ( mag[i] == 0xa5 ) && ( nra[i] == 0xa5 ); }
+    void show( size_t i, size_t j ) const {
+        std::cout << (int)x[j] << "," << (int)y[j] << " => " << (int)mag[i] << "," << (int)nra[i] << " FAIL Expected " << e[j];
+    }
+};
+
+typedef void (*p2r_planar_func)( const uint8_t *mag, const uint8_t *nra, int8_t *x, int8_t *y, size_t n );
+struct p2r_planar_kernel {
+    p2r_planar_func func;
+    const uint8_t *mag, *nra;
+    const rect_vector *e;
+    int8_t *x, *y;
+    void clear( size_t n ) { memset( x, 0xa5, n ), memset( y, 0xa5, n ); }
+    void run( size_t in_off, size_t out_off, size_t n ) { func( mag + in_off, nra + in_off, x + out_off, y + out_off, n ); }
+    bool ok( size_t i, size_t j ) const { return ( x[i] == e[j].x ) && ( y[i] == e[j].y ); }
+    bool blank( size_t i ) const { return ( x[i] == (int8_t)0xa5 ) && ( y[i] == (int8_t)0xa5 ); }
+    void show( size_t i, size_t j ) const {
+        std::cout << (int)mag[j] << "," << (int)nra[j] << " => " << (int)x[i] << "," << (int)y[i] << " FAIL Expected " << e[j];
+    }
+};
+
+// one byte of the polar reference, mag or nra
+typedef void (*r2p_byte_func)( const rect_vector *rv, uint8_t *out, size_t n );
+struct r2p_byte_kernel {
+    r2p_byte_func func;
+    uint8_t polar_vector::*field;
+    const rect_vector *in;
+    const polar_vector *e;
+    uint8_t *out;
+    void clear( size_t n ) { memset( out, 0xa5, n ); }
+    void run( size_t in_off, size_t out_off, size_t n ) { func( in + in_off, out + out_off, n ); }
+    bool ok( size_t i, size_t j ) const { return out[i] == e[j].*field; }
+    bool blank( size_t i ) const { return out[i] == 0xa5; }
+    void show( size_t i, size_t j ) const { std::cout << in[j] << " => " << (int)out[i] << " FAIL Expected " << e[j]; }
+};
+
+// i,q byte pairs, sample j at iq[2*j]
+typedef void (*u8_func)( const uint8_t *iq, polar_vector *pv, size_t n );
+struct u8_kernel {
+    u8_func func;
+    const uint8_t *iq;
+    const polar_vector *e;
+    polar_vector *out;
+    void clear( size_t n ) { memset( out, 0xa5, n * sizeof(polar_vector) ); }
+    void run( size_t in_off, size_t out_off, size_t n ) { func( iq + 2*in_off, out + out_off, n ); }
+    bool ok( size_t i, size_t j ) const { return out[i] == e[j]; }
+    bool blank( size_t i ) const { return ( out[i].mag == 0xa5 ) && ( out[i].nra == 0xa5 ); }
+    void show( size_t i, size_t j ) const {
+        std::cout << (int)iq[2*j] << "," << (int)iq[2*j+1] << " => " << out[i] << " FAIL Expected " << e[j];
+    }
+};
+
+// frames of channels samples every stride, frame j at in[j*stride], its
+// channel c out to out[c][]
+typedef void (*r2p_channels_func)( const rect_vector *rv, size_t channels, size_t stride,
+                                   polar_vector *const *pv, size_t n );
+struct channels_kernel {
+    r2p_channels_func func;
+    size_t channels, stride;
+    const rect_vector *in;
+    const polar_vector *e;
+    polar_vector *const *out;
+    void clear( size_t n ) {
+        for ( size_t c=0; c < channels; c++ ) memset( out[c], 0xa5, n * sizeof(polar_vector) );
+    }
+    void run( size_t in_off, size_t out_off, size_t n ) {
+        polar_vector *pv[8];
+        for ( size_t c=0; c < channels; c++ ) pv[c] = out[c] + out_off;
+        func( in + in_off*stride, channels, stride, pv, n );
+    }
+    bool ok( size_t i, size_t j ) const {
+        for ( size_t c=0; c < channels; c++ ) {
+            if ( out[c][i] != e[ j*stride + c ] ) return false;
+        }
+        return true;
+    }
+    bool blank( size_t i ) const {
+        for ( size_t c=0; c < channels; c++ ) {
+            if (( out[c][i].mag != 0xa5 ) || ( out[c][i].nra != 0xa5 )) return false;
+        }
+        return true;
+    }
+    void show( size_t i, size_t j ) const {
+        for ( size_t c=0; c < channels; c++ ) {
+            std::cout << in[ j*stride + c ] << " => " << out[c][i] << ( ( out[c][i] != e[ j*stride + c ] ) ? " FAIL" : "" ) << " ";
+        }
+        std::cout << "channels " << channels << " stride " << stride;
+    }
+};
+
+// run kernel k over inputs in_off:in_off+len into outputs out_off:, check
+// every output against the reference and that the GUARD samples either
+// side of the output are untouched
+const size_t GUARD = 64;
+
+template <typename K>
+int check_block( K &k, size_t in_off, size_t out_off, size_t len ) {
+    k.clear( out_off + len + GUARD );
+    k.run( in_off, out_off, len );
+    for ( size_t i=0; i < out_off + len + GUARD; i++ ) {
+        bool inside = ( i >= out_off ) && ( i < out_off + len );
+        if ( inside && !k.ok( i, i - out_off + in_off )) {
+            k.show( i, i - out_off + in_off );
+            std::cout << " offsets " << in_off << "," << out_off << " length " << len << std::endl;
+            return -1;
+        }
+        if ( !inside && !k.blank( i )) {
+            std::cout << "FAIL write to " << i << " outside of output " << out_off << ":" << out_off + len
+                      << " offsets " << in_off << "," << out_off << " length " << len << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// check kernel k against the reference over all n inputs, at every input
+// and output misalignment up to 4 samples, for each short length (no SIMD
+// block at all, each tail after one and two blocks), and for long lengths
+// ending on each tail case.  Outputs need room for n+2*GUARD samples.
+template <typename K>
+int check_block_lengths( K &k, size_t n ) {
+    for ( size_t in_off=0; in_off < 4; in_off++ ) {
+        for ( size_t out_off=0; out_off < 4; out_off++ ) {
+            for ( size_t len=0; len <= 2*GUARD + 1; len++ ) {
+                if ( check_block( k, in_off, out_off, len ) != 0 ) { return -1; }
+            }
+            for ( size_t len = n - in_off; len + GUARD > n - in_off; len-- ) {
+                if ( check_block( k, in_off, out_off, len ) != 0 ) { return -1; }
+            }
+        }
+    }
+    return 0;
+}
+
+// every x,y with its reference polar vector, every mag,nra with its
+// reference rect vector
+const size_t ALL = 256*256;
+static rect_vector all_rect[ALL], all_rect_e[ALL];
+static polar_vector all_polar[ALL], all_polar_e[ALL];
+
+void fill_references() {
+    size_t n = 0;
+    for ( int x=-128; x <= 127; x++ ) {
+        for ( int y=-128; y <= 127; y++ ) {
+            all_rect[n].x = x, all_rect[n].y = y;
+            all_polar_e[n] = ref_rect_2_polar( all_rect[n] );
+            n++;
+        }
+    }
+    n = 0;
+    for ( int mag=0; mag < 256; mag++ ) {
+        for ( int nra=0; nra < 256; nra++ ) {
+            all_polar[n].mag = mag, all_polar[n].nra = nra;
+            all_rect_e[n] = ref_polar_2_rect( all_polar[n] );
+            n++;
+        }
+    }
+}
+
+typedef void (*r2p_func)( const rect_vector *rv, polar_vector *pv, size_t n );
+int run_r2p_block_test( const char *name, r2p_func func ) {
+    static polar_vector pv[ALL+2*GUARD];
+    block_kernel<rect_vector,polar_vector> k = { func, all_rect, all_polar_e, pv };
+    std::cout << "Testing Rect to Polar " << name << " lookups....\n";
+    return check_block_lengths( k, ALL );
+}
+
+typedef void (*p2r_func)( const polar_vector *pv, rect_vector *rv, size_t n );
+int run_p2r_block_test( const char *name, p2r_func func ) {
+    static rect_vector rv[ALL+2*GUARD];
+    block_kernel<polar_vector,rect_vector> k = { func, all_polar, all_rect_e, rv };
+    std::cout << "Testing Polar to Rect " << name << " lookups....\n";
+    return check_block_lengths( k, ALL );
+}
+
+int run_byte_block_test( const char *name, r2p_byte_func func, uint8_t polar_vector::*field ) {
+    static uint8_t out[ALL+2*GUARD];
+    r2p_byte_kernel k = { func, field, all_rect, all_polar_e, out };
+    std::cout << "Testing Rect to " << name << " block lookups....\n";
+    return check_block_lengths( k, ALL );
+}
+
+// planar lookups, a NULL kernel is not tested
+int run_planar_test( const char *name, r2p_planar_func r2p, p2r_planar_func p2r ) {
+    static int8_t x[ALL], y[ALL], x_out[ALL+2*GUARD], y_out[ALL+2*GUARD];
+    static uint8_t mag[ALL], nra[ALL], mag_out[ALL+2*GUARD], nra_out[ALL+2*GUARD];
+    for ( size_t i=0; i < ALL; i++ ) {
+        x[i] = all_rect[i].x, y[i] = all_rect[i].y;
+        mag[i] = all_polar[i].mag, nra[i] = all_polar[i].nra;
+    }
+    if ( r2p ) {
+        std::cout << "Testing Rect to Polar " << name << " planar lookups....\n";
+        r2p_planar_kernel k = { r2p, x, y, all_polar_e, mag_out, nra_out };
+        if ( check_block_lengths( k, ALL ) != 0 ) { return -1; }
+    }
+    if ( p2r ) {
+        std::cout << "Testing Polar to Rect " << name << " planar lookups....\n";
+        p2r_planar_kernel k = { p2r, mag, nra, all_rect_e, x_out, y_out };
+        if ( check_block_lengths( k, ALL ) != 0 ) { return -1; }
+    }
+    return 0;
+}
+
+// channel interleaved lookups for 1 to 8 channels, packed and padded
+// frames, frames counted as samples by the harness.  The offsets and
+// lengths run over the first LENGTH_FRAMES frames, then one block of up to
+// MAX_FRAMES covers every input.
+int run_channels_test( const char *name, r2p_channels_func func ) {
+    const size_t MAX_FRAMES = ALL/8;
+    const size_t LENGTH_FRAMES = ALL/32;
+    static polar_vector out[8][MAX_FRAMES+2*GUARD];
+    polar_vector *pv[8];
+    for ( int c=0; c < 8; c++ ) {
+        pv[c] = out[c];
+    }
+    std::cout << "Testing Rect to Polar " << name << " channel lookups....\n";
+    // no channels converts nothing, whatever the stride
+    func( all_rect, 0, 0, pv, 16 );
+    for ( size_t channels=1; channels <= 8; channels++ ) {
+        for ( size_t stride=channels; stride <= channels+1; stride++ ) {
+            channels_kernel k = { func, channels, stride, all_rect, all_polar_e, pv };
+            if (( check_block_lengths( k, LENGTH_FRAMES ) != 0 ) ||
+                ( check_block( k, 0, 0, std::min( ALL / stride, MAX_FRAMES ) ) != 0 )) { return -1; }
+        }
+    }
+    return 0;
+}
+
+// offset binary lookups over every raw i,q byte pair, the reference is
+// mag/nra computed in double precision from the unbiased vector
+int run_u8_test( const char *name, u8_func func ) {
+    static uint8_t iq[2*ALL];
+    static polar_vector e[ALL], pv[ALL+2*GUARD];
+    size_t n = 0;
+    for ( int i=0; i < 256; i++ ) {
+        for ( int q=0; q < 256; q++ ) {
+            iq[2*n] = i, iq[2*n+1] = q;
+            double x = i - 127.5;
+            double y = q - 127.5;
+            e[n].mag = round( sqrt( x*x + y*y ) );
+            e[n].nra = (int)round( atan2( y, x ) * 128 / M_PI ) & 255;
+            if ( convert_rect_u8_2_polar( i, q ) != e[n] ) {
+                std::cout << i << "," << q << " => " << convert_rect_u8_2_polar( i, q ) << " FAIL Expected " << e[n] << std::endl;
+                return -1;
+            }
+            n++;
+        }
+    }
+    std::cout << "Testing offset binary to Polar " << name << " lookups....\n";
+    u8_kernel k = { func, iq, e, pv };
+    return check_block_lengths( k, ALL );
+}
+
+// check an IQ_BITS/NRA_BITS engine's rect to polar against double precision
+// atan2/hypot, every step'th x,y, errors in output LSBs.  The block
+// conversions must match the per sample ones.
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE>
+int run_res_r2p_test( int step, double max_mag_err, double max_nra_err ) {
+    const int lo = -( 1 << ( IQ_BITS - 1 ) ), hi = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+    const double scale = ( 1 << NRA_BITS ) / ( 2.0*M_PI );
+    static rect_vector_n<IQ_BITS> rv_row[1 << IQ_BITS];
+    static polar_vector_n<IQ_BITS,NRA_BITS> pv_row[1 << IQ_BITS];
+    for ( int x=lo; x <= hi; x += step ) {
+        size_t len = 0;
+        for ( int y=lo; y <= hi; y += step ) {
+            rv_row[len].x = x, rv_row[len].y = y;
+            len++;
+        }
+        convert_rect_2_polar_block_n<IQ_BITS,NRA_BITS,ENGINE>( rv_row, pv_row, len );
+        len = 0;
+        for ( int y=lo; y <= hi; y += step ) {
+            rect_vector_n<IQ_BITS> rv;
+            rv.x = x, rv.y = y;
+            polar_vector_n<IQ_BITS,NRA_BITS> pv = convert_rect_2_polar_n<IQ_BITS,NRA_BITS,ENGINE>( rv );
+            if (( pv.mag != pv_row[len].mag ) || ( pv.nra != pv_row[len].nra )) {
+                std::cout << x << "," << y << " FAIL block " << pv_row[len].mag << "," << pv_row[len].nra
+                          << " per sample " << pv.mag << "," << pv.nra << std::endl;
+                return -1;
+            }
+            len++;
+            double mag_err = fabs( pv.mag - hypot( x, y ) );
+            double nra_err = fabs( remainder( pv.nra - atan2( y, x ) * scale, 1 << NRA_BITS ) );
+            if (( mag_err > max_mag_err ) || ( nra_err > max_nra_err )) {
+                std::cout << x << "," << y << " => " << pv.mag << "," << pv.nra << " FAIL mag error "
+                          << mag_err << " nra error " << nra_err << std::endl;
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// and polar to rect against sin/cos, every step'th mag,nra
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE>
+int run_res_p2r_test( int step, double max_xy_err ) {
+    const int hi = ( 1 << ( IQ_BITS - 1 ) ) - 1;
+    const double scale = ( 1 << NRA_BITS ) / ( 2.0*M_PI );
+    static rect_vector_n<IQ_BITS> rv_row[1 << NRA_BITS];
+    static polar_vector_n<IQ_BITS,NRA_BITS> pv_row[1 << NRA_BITS];
+    for ( int mag=0; mag < ( 1 << IQ_BITS ); mag += step ) {
+        size_t len = 0;
+        for ( int nra=0; nra < ( 1 << NRA_BITS ); nra += step ) {
+            pv_row[len].mag = mag, pv_row[len].nra = nra;
+            len++;
+        }
+        convert_polar_2_rect_block_n<IQ_BITS,NRA_BITS,ENGINE>( pv_row, rv_row, len );
+        len = 0;
+        for ( int nra=0; nra < ( 1 << NRA_BITS ); nra += step ) {
+            polar_vector_n<IQ_BITS,NRA_BITS> pv;
+            pv.mag = mag, pv.nra = nra;
+            rect_vector_n<IQ_BITS> rv = convert_polar_2_rect_n<IQ_BITS,NRA_BITS,ENGINE>( pv );
+            if (( rv.x != rv_row[len].x ) || ( rv.y != rv_row[len].y )) {
+                std::cout << mag << "<" << nra << " FAIL block " << rv_row[len].x << "," << rv_row[len].y
+                          << " per sample " << rv.x << "," << rv.y << std::endl;
+                return -1;
+            }
+            len++;
+            // x,y saturate at hi
+            double ex = std::max( -(double)hi, std::min( (double)hi, mag * cos( nra / scale ) ) );
+            double ey = std::max( -(double)hi, std::min( (double)hi, mag * sin( nra / scale ) ) );
+            if (( fabs( rv.x - ex ) > max_xy_err ) || ( fabs( rv.y - ey ) > max_xy_err )) {
+                std::cout << mag << "<" << nra << " => " << rv.x << "," << rv.y << " FAIL Expected "
+                          << ex << "," << ey << std::endl;
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// both directions of an engine
+template <int IQ_BITS, int NRA_BITS, template <int,int> class ENGINE>
+int run_res_test( const char *name, int step, double max_mag_err, double max_nra_err, double max_xy_err ) {
+    std::cout << "Testing " << IQ_BITS << "/" << NRA_BITS << " " << name << " lookups....\n";
+    if ( run_res_r2p_test<IQ_BITS,NRA_BITS,ENGINE>( step, max_mag_err, max_nra_err ) != 0 ) { return -1; }
+    return run_res_p2r_test<IQ_BITS,NRA_BITS,ENGINE>( step, max_xy_err );
+}
+
+// the 8/8 default engine is the library's tables
+int run_res_exact_test() {
+    std::cout << "Testing 8/8 default lookups....\n";
+    for ( int x=-128; x <= 127; x++ ) {
+        for ( int y=-128; y <= 127; y++ ) {
+            rect_vector rv;
+            rect_vector_n<8> rvn;
+            rv.x = rvn.x = x, rv.y = rvn.y = y;
+            polar_vector e = convert_rect_2_polar( rv );
+            polar_vector_n<8,8> pv = convert_rect_2_polar_n<8,8>( rvn );
+            rect_vector r = convert_polar_2_rect( e );
+            rect_vector_n<8> rn = convert_polar_2_rect_n( pv );
+            if (( pv.mag != e.mag ) || ( pv.nra != e.nra ) || ( rn.x != r.x ) || ( rn.y != r.y )) {
+                std::cout << rv << " => " << (int)pv.mag << "," << (int)pv.nra << " FAIL Expected " << e << std::endl;
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int run_res_tests() {
+    if ( run_res_exact_test() != 0 ) { return -1; }
+    if ( run_res_test<8,8,ratio_engine>( "ratio", 1, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<10,10,ratio_engine>( "ratio", 1, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,12,ratio_engine>( "ratio", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,16,ratio_engine>( "ratio", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    // ratio index is capped at 14 bits, mag error grows past 14-bit x,y
+    if ( run_res_test<16,16,ratio_engine>( "ratio", 53, 1.5, 1.0, 1.0 ) != 0 ) { return -1; }
+    // the interpolated grid stays within 1 LSB at every width
+    if ( run_res_test<8,8,interp_engine>( "interp", 1, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,12,interp_engine>( "interp", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,16,interp_engine>( "interp", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<16,16,interp_engine>( "interp", 53, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    // CORDIC with its default iteration count
+    if ( run_res_test<8,8,cordic_engine>( "cordic", 1, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,12,cordic_engine>( "cordic", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,16,cordic_engine>( "cordic", 3, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<16,16,cordic_engine>( "cordic", 53, 1.0, 1.0, 1.0 ) != 0 ) { return -1; }
+    // hybrid, polar to rect only, with its default micro-rotations
+    std::cout << "Testing hybrid polar to rect lookups....\n";
+    if ( run_res_p2r_test<8,8,hybrid_engine>( 1, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_p2r_test<12,12,hybrid_engine>( 3, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_p2r_test<12,16,hybrid_engine>( 3, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_p2r_test<16,16,hybrid_engine>( 53, 1.0 ) != 0 ) { return -1; }
+    return 0;
+}
+
+// the constexpr builders reproduce the generated tables, entry for entry
+int run_constexpr_test() {
+    static constexpr rect_2_polar_table<polar_vector> r2p = make_rect_2_polar_lut<polar_vector>();
+    static constexpr rect_2_polar_octant_table<polar_vector> oct = make_rect_2_polar_octant_lut( r2p );
+    static constexpr rect_byte_table mag = make_rect_2_mag_lut( r2p );
+    static constexpr rect_byte_table nra = make_rect_2_nra_lut( r2p );
+    static constexpr rect_u8_2_polar_table<polar_vector> u8 = make_rect_u8_2_polar_lut<polar_vector>();
+    static constexpr polar_2_rect_table<rect_vector> p2r = make_polar_2_rect_lut<rect_vector>();
+    static constexpr polar_2_rect_slices slices = make_polar_2_rect_slices( p2r );
+    std::cout << "Testing constexpr tables....\n";
+    for ( int x=0; x < 129; x++ ) {
+        for ( int y=0; y < 129; y++ ) {
+            polar_vector e = rect_2_polar_lut[x][y];
+            if (( r2p.lut[x][y].mag != e.mag ) || ( r2p.lut[x][y].nra != e.nra ) ||
+                ( mag.lut[x][y] != rect_2_mag_lut[x][y] ) || ( nra.lut[x][y] != rect_2_nra_lut[x][y] )) {
+                std::cout << x << "," << y << " => " << r2p.lut[x][y] << " FAIL Expected " << e << std::endl;
+                return -1;
+            }
+        }
+    }
+    for ( int i=0; i < 129*130/2; i++ ) {
+        if (( oct.lut[i].mag != rect_2_polar_octant_lut[i].mag ) || ( oct.lut[i].nra != rect_2_polar_octant_lut[i].nra )) {
+            std::cout << "octant entry " << i << " FAIL\n";
+            return -1;
+        }
+    }
+    for ( int a=0; a < 128; a++ ) {
+        for ( int b=0; b < 128; b++ ) {
+            if (( u8.lut[a][b].mag != rect_u8_2_polar_lut[a][b].mag ) || ( u8.lut[a][b].nra != rect_u8_2_polar_lut[a][b].nra )) {
+                std::cout << "offset binary entry " << a << "," << b << " FAIL\n";
+                return -1;
+            }
+        }
+    }
+    for ( int m=0; m < 256; m++ ) {
+        for ( int n=0; n < 64; n++ ) {
+            if (( p2r.lut[m][n].x != polar_2_rect_lut[m][n].x ) || ( p2r.lut[m][n].y != polar_2_rect_lut[m][n].y )) {
+                std::cout << m << "<" << n << " => " << p2r.lut[m][n] << " FAIL Expected " << polar_2_rect_lut[m][n] << std::endl;
+                return -1;
+            }
+        }
+    }
+    for ( int n=0; n < 64; n++ ) {
+        if (( slices.cos_q15[n] != polar_2_rect_cos_q15[n] ) || ( slices.sin_q15[n] != polar_2_rect_sin_q15[n] ) ||
+            ( slices.sat_mag[n] != polar_2_rect_sat_mag[n] )) {
+            std::cout << "slice entry " << n << " FAIL\n";
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// the runtime tables are the generated ones at 8/8 and within rounding of
+// libm at other widths.  11/11 is first used from several threads at once,
+// which must all get the one build, and it must match a single thread build.
+int run_runtime_test() {
+    typedef runtime_lut_engine<8,8> e8;
+    std::cout << "Testing runtime tables....\n";
+    for ( int x=0; x < 129; x++ ) {
+        for ( int y=0; y < 129; y++ ) {
+            polar_vector_n<8,8> p = e8::lut().r2p[ x*e8::SIDE + y ];
+            if (( p.mag != rect_2_polar_lut[x][y].mag ) || ( p.nra != rect_2_polar_lut[x][y].nra )) {
+                std::cout << x << "," << y << " => " << (int)p.mag << "," << (int)p.nra
+                          << " FAIL Expected " << rect_2_polar_lut[x][y] << std::endl;
+                return -1;
+            }
+        }
+    }
+    for ( int m=0; m < 256; m++ ) {
+        for ( int n=0; n < 64; n++ ) {
+            rect_vector_n<8> r = e8::lut().p2r[ m*e8::QUARTER + n ];
+            if (( r.x != polar_2_rect_lut[m][n].x ) || ( r.y != polar_2_rect_lut[m][n].y )) {
+                std::cout << m << "<" << n << " => " << (int)r.x << "," << (int)r.y
+                          << " FAIL Expected " << polar_2_rect_lut[m][n] << std::endl;
+                return -1;
+            }
+        }
+    }
+    // 8 first callers at once, one build
+    typedef runtime_lut_engine<11,11> e11;
+    const e11::tables *seen[8];
+    std::vector<std::thread> pool;
+    for ( int t=0; t < 8; t++ ) {
+        pool.emplace_back( [&seen, t]() { seen[t] = &e11::lut(); } );
+    }
+    for ( auto &t : pool ) {
+        t.join();
+    }
+    if ( e11::builds() != 1 ) {
+        std::cout << "FAIL runtime tables built " << e11::builds() << " times\n";
+        return -1;
+    }
+    static_assert( !noexcept( e11::to_polar( e11::rect() ) ), "lut() backed conversions can throw" );
+    static_assert( !noexcept( convert_rect_2_polar_block_n<11,11,runtime_lut_engine>( 0, 0, 0 ) ),
+                   "lut() backed conversions can throw" );
+    e11::tables single( 1 );
+    if (( memcmp( seen[0]->r2p, single.r2p, e11::SIDE * e11::SIDE * sizeof( *single.r2p ) ) != 0 ) ||
+        ( memcmp( seen[0]->p2r, single.p2r, e11::MAGS * e11::QUARTER * sizeof( *single.p2r ) ) != 0 )) {
+        std::cout << "FAIL " << seen[0]->threads << " thread runtime tables differ from 1 thread\n";
+        return -1;
+    }
+    if ( run_res_test<8,8,runtime_lut_engine>( "runtime", 1, 0.5, 0.5, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<10,10,runtime_lut_engine>( "runtime", 1, 0.5, 0.5, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<11,11,runtime_lut_engine>( "runtime", 3, 0.5, 0.5, 1.0 ) != 0 ) { return -1; }
+    if ( run_res_test<12,12,runtime_lut_engine>( "runtime", 3, 0.5, 0.5, 1.0 ) != 0 ) { return -1; }
     return 0;
 }
 
+int run_kernel_test() {
+    std::cout << "Dispatching Rect to Polar to " << rect_2_polar_kernel_name()
+              << ", Polar to Rect to " << polar_2_rect_kernel_name() << "\n";
+    fill_references();
+    if ( run_r2p_block_test( "scalar", convert_rect_2_polar_block_scalar ) != 0 ) { return -1; }
+    if ( run_p2r_block_test( "scalar", convert_polar_2_rect_block_scalar ) != 0 ) { return -1; }
+    if ( run_r2p_block_test( "dispatched", convert_rect_2_polar_block ) != 0 ) { return -1; }
+    if ( run_p2r_block_test( "dispatched", convert_polar_2_rect_block ) != 0 ) { return -1; }
+    if ( run_r2p_block_test( "octant", convert_rect_2_polar_block_octant ) != 0 ) { return -1; }
+    if ( run_p2r_block_test( "sine", convert_polar_2_rect_block_sine ) != 0 ) { return -1; }
+    if ( run_byte_block_test( "Mag", convert_rect_2_mag_block, &polar_vector::mag ) != 0 ) { return -1; }
+    if ( run_byte_block_test( "NRA", convert_rect_2_nra_block, &polar_vector::nra ) != 0 ) { return -1; }
+    if ( run_channels_test( "scalar", convert_rect_2_polar_channels_scalar ) != 0 ) { return -1; }
+    if ( run_channels_test( "dispatched", convert_rect_2_polar_channels ) != 0 ) { return -1; }
+    if ( run_planar_test( "scalar", convert_rect_2_polar_planar_scalar, convert_polar_2_rect_planar_scalar ) != 0 ) { return -1; }
+    if ( run_planar_test( "dispatched", convert_rect_2_polar_planar, convert_polar_2_rect_planar ) != 0 ) { return -1; }
+    if ( run_u8_test( "scalar", convert_rect_u8_2_polar_block_scalar ) != 0 ) { return -1; }
+    if ( run_u8_test( "dispatched", convert_rect_u8_2_polar_block ) != 0 ) { return -1; }
+    if ( __builtin_cpu_supports( "avx2" ) ) {
+        if ( run_r2p_block_test( "avx2", convert_rect_2_polar_block_avx2 ) != 0 ) { return -1; }
+        if ( run_p2r_block_test( "avx2", convert_polar_2_rect_block_avx2 ) != 0 ) { return -1; }
+        if ( run_p2r_block_test( "sine avx2", convert_polar_2_rect_block_sine_avx2 ) != 0 ) { return -1; }
+        if ( run_planar_test( "avx2", convert_rect_2_polar_planar_avx2, convert_polar_2_rect_planar_avx2 ) != 0 ) { return -1; }
+        if ( run_channels_test( "avx2", convert_rect_2_polar_channels_avx2 ) != 0 ) { return -1; }
+        if ( run_u8_test( "avx2", convert_rect_u8_2_polar_block_avx2 ) != 0 ) { return -1; }
+    } else {
+        std::cout << "Skipping avx2 tests, not supported by cpu\n";
+    }
+    if ( __builtin_cpu_supports( "avx512vbmi" ) ) {
+        if ( run_p2r_block_test( "avx512vbmi", convert_polar_2_rect_block_avx512vbmi ) != 0 ) { return -1; }
+        if ( run_planar_test( "avx512vbmi", 0, convert_polar_2_rect_planar_avx512vbmi ) != 0 ) { return -1; }
+    } else {
+        std::cout << "Skipping avx512vbmi tests, not supported by cpu\n";
+    }
+    return 0;
+}
+
+
+// the binary table file written by the generator must map, hold the compiled
+// in tables, and convert through them bit for bit.  Damaged copies must be
+// refused, copies with the other rounding mapped.
+static rect_polar_table_file mapped;
+
+void r2p_mapped( const rect_vector *rv, polar_vector *pv, size_t n ) {
+    convert_rect_2_polar_block_mapped( &mapped, rv, pv, n );
+}
+
+void p2r_mapped( const polar_vector *pv, rect_vector *rv, size_t n ) {
+    convert_polar_2_rect_block_mapped( &mapped, pv, rv, n );
+}
+
+// copy of the file at path with byte at offset xor'ed by bits, mapped
+table_file_status map_damaged( const char *path, size_t offset, uint8_t bits ) {
+    std::ifstream in( path, std::ios::binary );
+    std::vector<char> image( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+    image[offset] ^= bits;
+    std::ofstream out( "damaged.bin", std::ios::binary );
+    out.write( image.data(), image.size() );
+    out.close();
+    rect_polar_table_file tf;
+    table_file_status status = map_table_file( "damaged.bin", &tf );
+    if ( status == TABLE_FILE_OK ) {
+        unmap_table_file( &tf );
+    }
+    remove( "damaged.bin" );
+    return status;
+}
+
+int run_table_file_test() {
+    const char *path = "../rect_polar_lut.bin";
+    table_file_status status = map_table_file( path, &mapped );
+    std::cout << "Testing table file " << path << "....\n";
+    if ( status == TABLE_FILE_OPEN_FAILED ) {
+        std::cout << path << " FAIL not found, run ../build.sh to write it" << std::endl;
+        return -1;
+    }
+    if ( status != TABLE_FILE_OK ) {
+        std::cout << path << " FAIL " << table_file_status_name( status ) << std::endl;
+        return -1;
+    }
+    for ( const table_file_section *s = reinterpret_cast<const table_file_section *>( mapped.header + 1 );
+          s < reinterpret_cast<const table_file_section *>( mapped.header + 1 ) + mapped.header->section_count; s++ ) {
+        if ( s->offset % 64 != 0 ) {
+            std::cout << "section " << s->id << " FAIL offset " << s->offset << " not 64 byte aligned" << std::endl;
+            return -1;
+        }
+    }
+    if (( memcmp( mapped.rect_2_polar, rect_2_polar_lut, sizeof(rect_2_polar_lut) ) != 0 ) ||
+        ( memcmp( mapped.rect_2_polar_octant, rect_2_polar_octant_lut, sizeof(rect_2_polar_octant_lut) ) != 0 ) ||
+        ( memcmp( mapped.rect_2_mag, rect_2_mag_lut, sizeof(rect_2_mag_lut) ) != 0 ) ||
+        ( memcmp( mapped.rect_2_nra, rect_2_nra_lut, sizeof(rect_2_nra_lut) ) != 0 ) ||
+        ( memcmp( mapped.rect_u8_2_polar, rect_u8_2_polar_lut, sizeof(rect_u8_2_polar_lut) ) != 0 ) ||
+        ( memcmp( mapped.polar_2_rect, polar_2_rect_lut, sizeof(polar_2_rect_lut) ) != 0 ) ||
+        ( memcmp( mapped.cos_q15, polar_2_rect_cos_q15, sizeof(polar_2_rect_cos_q15) ) != 0 ) ||
+        ( memcmp( mapped.sin_q15, polar_2_rect_sin_q15, sizeof(polar_2_rect_sin_q15) ) != 0 ) ||
+        ( memcmp( mapped.sat_mag, polar_2_rect_sat_mag, sizeof(polar_2_rect_sat_mag) ) != 0 )) {
+        std::cout << path << " FAIL tables differ from rect_polar_lut.cpp" << std::endl;
+        return -1;
+    }
+    int r = ( run_r2p_block_test( "mapped", r2p_mapped ) != 0 ) || ( run_p2r_block_test( "mapped", p2r_mapped ) != 0 );
+    size_t size = mapped.size;
+    unmap_table_file( &mapped );
+    if ( r != 0 ) { return -1; }
+    std::cout << "Testing damaged table files....\n";
+    const struct { size_t offset; table_file_status expect; } damage[] = {
+        { 0, TABLE_FILE_BAD_HEADER },                                   // magic
+        { offsetof( table_file_header, version ), TABLE_FILE_BAD_VERSION },
+        { offsetof( table_file_header, iq_bits ), TABLE_FILE_BAD_LAYOUT },
+        { offsetof( table_file_header, r2p_rounding ), TABLE_FILE_BAD_LAYOUT },
+        { sizeof(table_file_header) + offsetof( table_file_section, rows ), TABLE_FILE_BAD_LAYOUT },
+        { size / 2, TABLE_FILE_BAD_CHECKSUM },
+        { size - 1, TABLE_FILE_BAD_CHECKSUM }
+    };
+    for ( const auto &d : damage ) {
+        status = map_damaged( path, d.offset, 0x10 );
+        if ( status != d.expect ) {
+            std::cout << "byte " << d.offset << " damaged FAIL " << table_file_status_name( status )
+                      << " Expected " << table_file_status_name( d.expect ) << std::endl;
+            return -1;
+        }
+    }
+    // the other rounding is a variant, not damage
+    const size_t variant[] = { offsetof( table_file_header, r2p_rounding ), offsetof( table_file_header, p2r_rounding ) };
+    for ( size_t offset : variant ) {
+        status = map_damaged( path, offset, 0x01 );
+        if ( status != TABLE_FILE_OK ) {
+            std::cout << "byte " << offset << " rounding changed FAIL " << table_file_status_name( status ) << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
 
 int main() {
-    if ( run_test() != 0 ) {
+    if (( run_test() != 0 ) || ( run_block_test() != 0 ) || ( run_kernel_test() != 0 ) || ( run_res_tests() != 0 ) ||
+        ( run_constexpr_test() != 0 ) || ( run_runtime_test() != 0 ) || ( run_table_file_test() != 0 )) {
         std::cout << "Test failed..\n";
+        return -1;
     } else {
         std::cout << "Test Passed..\n";
     }